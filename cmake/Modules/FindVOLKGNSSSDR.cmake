@@ -70,6 +70,29 @@ include(FindPackageHandleStandardArgs)
 find_package_handle_standard_args(VOLKGNSSSDR DEFAULT_MSG VOLK_GNSSSDR_LIBRARIES VOLK_GNSSSDR_INCLUDE_DIRS)
 mark_as_advanced(VOLK_GNSSSDR_LIBRARIES VOLK_GNSSSDR_INCLUDE_DIRS)
 
+# Kernels called by GNSS-SDR that older releases of volk_gnsssdr do not
+# provide. If one of them is missing, the bundled volk_gnsssdr is built.
+if(VOLKGNSSSDR_FOUND)
+    include(CheckSymbolExists)
+    include(CMakePushCheckState)
+    cmake_push_check_state()
+    set(CMAKE_REQUIRED_QUIET ${VOLKGNSSSDR_FIND_QUIETLY})
+    set(CMAKE_REQUIRED_INCLUDES ${VOLK_GNSSSDR_INCLUDE_DIRS})
+    set(CMAKE_REQUIRED_LIBRARIES ${VOLK_GNSSSDR_LIBRARIES})
+    foreach(_kernel
+        volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn
+        volk_gnsssdr_8u_unpack2bit_8i
+    )
+        unset(VOLKGNSSSDR_HAS_${_kernel} CACHE)
+        check_symbol_exists(${_kernel} "volk_gnsssdr/volk_gnsssdr.h" VOLKGNSSSDR_HAS_${_kernel})
+        if(NOT VOLKGNSSSDR_HAS_${_kernel})
+            message(STATUS "The volk_gnsssdr library found at ${VOLK_GNSSSDR_LIBRARIES} does not provide ${_kernel}")
+            set(VOLKGNSSSDR_FOUND FALSE)
+        endif()
+    endforeach()
+    cmake_pop_check_state()
+endif()
+
 if(PC_VOLK_GNSSSDR_VERSION)
     set(VOLKGNSSSDR_VERSION ${PC_VOLK_GNSSSDR_VERSION})
 endif()
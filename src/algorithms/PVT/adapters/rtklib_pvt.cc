@@ -186,6 +186,10 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     pvt_output_parameters.nmea_rate_ms = bc::lcm(configuration->property(role + ".nmea_rate_ms", pvt_output_parameters.nmea_rate_ms), pvt_output_parameters.output_rate_ms);
     pvt_output_parameters.an_rate_ms = configuration->property(role + ".an_rate_ms", pvt_output_parameters.an_rate_ms);
 
+    // Queues of the KML, GPX, GeoJSON, NMEA and AN outputs. Zero writes them from the PVT block
+    pvt_output_parameters.output_queue_size = configuration->property(role + ".output_queue_size", pvt_output_parameters.output_queue_size);
+    pvt_output_parameters.output_drop_policy = configuration->property(role + ".output_drop_policy", pvt_output_parameters.output_drop_policy);
+
     // Infer the type of receiver
     /*
      *   TYPE  |  RECEIVER
@@ -885,6 +889,9 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     pvt_output_parameters.rtcm_output_file_path = configuration->property(role + ".rtcm_output_file_path", default_output_path);
     pvt_output_parameters.has_output_file_path = configuration->property(role + ".has_output_file_path", default_output_path);
 
+    // Binary log of the decoded navigation data. Empty disables it
+    pvt_output_parameters.nav_data_store_file = configuration->property(role + ".nav_data_store_file", pvt_output_parameters.nav_data_store_file);
+
     // Read PVT MONITOR Configuration
     pvt_output_parameters.monitor_enabled = configuration->property(role + ".enable_monitor", false);
     pvt_output_parameters.udp_addresses = configuration->property(role + ".monitor_client_addresses", std::string("127.0.0.1"));
@@ -51,9 +51,12 @@
 #include "monitor_ephemeris_udp_sink.h"
 #include "monitor_pvt.h"
 #include "monitor_pvt_udp_sink.h"
+#include "nav_data_store.h"
 #include "nmea_printer.h"
 #include "osnma_data.h"
 #include "pvt_conf.h"
+#include "pvt_output_epoch.h"
+#include "pvt_output_worker.h"
 #include "rinex_printer.h"
 #include "rtcm_printer.h"
 #include "rtklib_rtkcmn.h"
@@ -67,11 +70,12 @@
 #include <boost/serialization/nvp.hpp>  // for nvp, make_nvp
 #include <gnuradio/io_signature.h>      // for io_signature
 #include <pmt/pmt_sugar.h>              // for mp
-#include <algorithm>                    // for sort, unique
+#include <algorithm>                    // for sort, unique, max
 #include <cerrno>                       // for errno
 #include <cstring>                      // for strerror
 #include <exception>                    // for exception
 #include <fstream>                      // for ofstream
+#include <initializer_list>             // for initializer_list
 #include <iomanip>                      // for put_time, setprecision
 #include <iostream>                     // for operator<<
 #include <locale>                       // for locale
@@ -271,6 +275,10 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
                 }
         }
 
+    // KML, GPX, GeoJSON, NMEA and AN outputs are written from their own threads
+    const auto output_drop_policy = Pvt_Output_Worker::policy_from_string(conf_.output_drop_policy);
+    const auto output_queue_size = static_cast<size_t>(std::max(conf_.output_queue_size, 0));
+
     // initialize kml_printer
     const std::string kml_dump_filename = d_dump_filename;
     if (d_kml_rate_ms == 0)
@@ -281,6 +289,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
         {
             d_kml_dump = std::make_unique<Kml_Printer>(conf_.kml_output_path);
             d_kml_dump->set_headers(kml_dump_filename);
+            d_kml_worker = std::make_unique<Pvt_Output_Worker>("KML", output_queue_size, output_drop_policy);
         }
     else
         {
@@ -297,6 +306,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
         {
             d_gpx_dump = std::make_unique<Gpx_Printer>(conf_.gpx_output_path);
             d_gpx_dump->set_headers(gpx_dump_filename);
+            d_gpx_worker = std::make_unique<Pvt_Output_Worker>("GPX", output_queue_size, output_drop_policy);
         }
     else
         {
@@ -313,6 +323,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
         {
             d_geojson_printer = std::make_unique<GeoJSON_Printer>(conf_.geojson_output_path);
             d_geojson_printer->set_headers(geojson_dump_filename);
+            d_geojson_worker = std::make_unique<Pvt_Output_Worker>("GeoJSON", output_queue_size, output_drop_policy);
         }
     else
         {
@@ -328,6 +339,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
     if (d_nmea_output_file_enabled)
         {
             d_nmea_printer = std::make_unique<Nmea_Printer>(conf_.nmea_dump_filename, conf_.nmea_output_file_enabled, conf_.flag_nmea_tty_port, conf_.nmea_dump_devname, conf_.nmea_output_file_path);
+            d_nmea_worker = std::make_unique<Pvt_Output_Worker>("NMEA", output_queue_size, output_drop_policy);
         }
     else
         {
@@ -452,6 +464,16 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             d_xml_base_path = d_xml_base_path + fs::path::preferred_separator;
         }
 
+    // Navigation data store, updated as each new record arrives
+    if (!conf_.nav_data_store_file.empty())
+        {
+            d_nav_data_store = std::make_unique<Nav_Data_Store>(conf_.nav_data_store_file);
+            if (d_nav_data_store->load())
+                {
+                    LOG(INFO) << "Navigation data store " << conf_.nav_data_store_file << " holds " << d_nav_data_store->size() << " records";
+                }
+        }
+
     // Initialize HAS simple printer
     d_enable_has_messages = (((d_type_of_rx >= 100) && (d_type_of_rx < 109)) && (conf_.output_enabled));
     if (d_enable_has_messages)
@@ -467,6 +489,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
     if (d_an_printer_enabled)
         {
             d_an_printer = std::make_unique<An_Packet_Printer>(conf_.an_dump_devname);
+            d_an_worker = std::make_unique<Pvt_Output_Worker>("AN", output_queue_size, output_drop_policy);
         }
     else
         {
@@ -1227,6 +1250,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                         {
                             d_user_pvt_solver->gps_ephemeris_map[gps_eph->PRN] = *gps_eph;
                         }
+                    if (d_nav_data_store)
+                        {
+                            d_nav_data_store->append(*gps_eph);
+                        }
                     if (gps_eph->SV_health != 0)
                         {
                             std::cout << TEXT_RED << "Satellite " << Gnss_Satellite(std::string("GPS"), gps_eph->PRN)
@@ -1250,6 +1277,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                         {
                             d_user_pvt_solver->gps_iono = *gps_iono;
                         }
+                    if (d_nav_data_store)
+                        {
+                            d_nav_data_store->append(*gps_iono);
+                        }
                     DLOG(INFO) << "New IONO record has arrived";
                 }
             else if (msg_type_hash_code == d_gps_utc_model_sptr_type_hash_code)
@@ -1261,6 +1292,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                         {
                             d_user_pvt_solver->gps_utc_model = *gps_utc_model;
                         }
+                    if (d_nav_data_store)
+                        {
+                            d_nav_data_store->append(*gps_utc_model);
+                        }
                     DLOG(INFO) << "New UTC record has arrived";
                 }
             else if (msg_type_hash_code == d_gps_cnav_ephemeris_sptr_type_hash_code)
@@ -1295,6 +1330,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                         {
                             d_user_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris->PRN] = *gps_cnav_ephemeris;
                         }
+                    if (d_nav_data_store)
+                        {
+                            d_nav_data_store->append(*gps_cnav_ephemeris);
+                        }
                     if (gps_cnav_ephemeris->signal_health != 0)
                         {
                             std::cout << "Satellite " << Gnss_Satellite(std::string("GPS"), gps_cnav_ephemeris->PRN)
@@ -1329,6 +1368,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     {
                         d_user_pvt_solver->gps_cnav_utc_model = *gps_cnav_utc_model;
                     }
+                    if (d_nav_data_store)
+                        {
+                            d_nav_data_store->append(*gps_cnav_utc_model);
+                        }
                     DLOG(INFO) << "New CNAV UTC record has arrived";
                 }
 
@@ -1341,6 +1384,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                         {
                             d_user_pvt_solver->gps_almanac_map[gps_almanac->PRN] = *gps_almanac;
                         }
+                    if (d_nav_data_store)
+                        {
+                            d_nav_data_store->append(*gps_almanac);
+                        }
                     DLOG(INFO) << "New GPS almanac record has arrived";
                 }
 
@@ -1387,6 +1434,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                         {
                             d_user_pvt_solver->galileo_ephemeris_map[galileo_eph->PRN] = *galileo_eph;
                         }
+                    if (d_nav_data_store)
+                        {
+                            d_nav_data_store->append(*galileo_eph);
+                        }
                     if (((galileo_eph->E1B_HS != 0) || (galileo_eph->E1B_DVS == true)) ||
                         ((galileo_eph->E5a_HS != 0) || (galileo_eph->E5a_DVS == true)) ||
                         ((galileo_eph->E5b_HS != 0) || (galileo_eph->E5b_DVS == true)))
@@ -1412,6 +1463,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                         {
                             d_user_pvt_solver->galileo_iono = *galileo_iono;
                         }
+                    if (d_nav_data_store)
+                        {
+                            d_nav_data_store->append(*galileo_iono);
+                        }
                     DLOG(INFO) << "New IONO record has arrived";
                 }
             else if (msg_type_hash_code == d_galileo_utc_model_sptr_type_hash_code)
@@ -1423,6 +1478,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                         {
                             d_user_pvt_solver->galileo_utc_model = *galileo_utc_model;
                         }
+                    if (d_nav_data_store)
+                        {
+                            d_nav_data_store->append(*galileo_utc_model);
+                        }
                     DLOG(INFO) << "New UTC record has arrived";
                 }
             else if (msg_type_hash_code == d_galileo_almanac_helper_sptr_type_hash_code)
@@ -1440,6 +1499,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                 {
                                     d_user_pvt_solver->galileo_almanac_map[sv1.PRN] = sv1;
                                 }
+                            if (d_nav_data_store)
+                                {
+                                    d_nav_data_store->append(sv1);
+                                }
                         }
                     if (sv2.PRN != 0)
                         {
@@ -1448,6 +1511,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                 {
                                     d_user_pvt_solver->galileo_almanac_map[sv2.PRN] = sv2;
                                 }
+                            if (d_nav_data_store)
+                                {
+                                    d_nav_data_store->append(sv2);
+                                }
                         }
                     if (sv3.PRN != 0)
                         {
@@ -1456,6 +1523,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                 {
                                     d_user_pvt_solver->galileo_almanac_map[sv3.PRN] = sv3;
                                 }
+                            if (d_nav_data_store)
+                                {
+                                    d_nav_data_store->append(sv3);
+                                }
                         }
                     DLOG(INFO) << "New Galileo Almanac data have arrived";
                 }
@@ -1469,6 +1540,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                         {
                             d_user_pvt_solver->galileo_almanac_map[galileo_alm->PRN] = *galileo_alm;
                         }
+                    if (d_nav_data_store)
+                        {
+                            d_nav_data_store->append(*galileo_alm);
+                        }
                 }
 
             // **************** GLONASS GNAV Telemetry *************************
@@ -1510,6 +1585,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                         {
                             d_user_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph->PRN] = *glonass_gnav_eph;
                         }
+                    if (d_nav_data_store)
+                        {
+                            d_nav_data_store->append(*glonass_gnav_eph);
+                        }
                 }
             else if (msg_type_hash_code == d_glonass_gnav_utc_model_sptr_type_hash_code)
                 {
@@ -1520,6 +1599,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                         {
                             d_user_pvt_solver->glonass_gnav_utc_model = *glonass_gnav_utc_model;
                         }
+                    if (d_nav_data_store)
+                        {
+                            d_nav_data_store->append(*glonass_gnav_utc_model);
+                        }
                     DLOG(INFO) << "New GLONASS GNAV UTC record has arrived";
                 }
             else if (msg_type_hash_code == d_glonass_gnav_almanac_sptr_type_hash_code)
@@ -1761,6 +1844,18 @@ bool rtklib_pvt_gs::send_ttff_msg(double ttff) const
 }
 
 
+void rtklib_pvt_gs::add_output_stats(Monitor_Pvt& monitor_pvt) const
+{
+    for (const auto* worker : {d_kml_worker.get(), d_gpx_worker.get(), d_geojson_worker.get(), d_nmea_worker.get(), d_an_worker.get()})
+        {
+            if (worker)
+                {
+                    monitor_pvt.outputs.push_back(worker->stats());
+                }
+        }
+}
+
+
 bool rtklib_pvt_gs::save_gnss_synchro_map_xml(const std::string& file_name)
 {
     if (d_gnss_observables_map.empty() == false)
@@ -2404,32 +2499,30 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                                             send_ttff_msg(ttff);
                                             d_first_fix = false;
                                         }
-                                    if (d_kml_output_enabled)
+                                    // Copy of this epoch shared by the outputs, which run in their own
+                                    // threads. It is only made if an output writes this epoch.
+                                    const bool flag_write_kml_output = d_kml_output_enabled && (current_RX_time_ms % d_kml_rate_ms == 0);
+                                    const bool flag_write_gpx_output = d_gpx_output_enabled && (current_RX_time_ms % d_gpx_rate_ms == 0);
+                                    const bool flag_write_geojson_output = d_geojson_output_enabled && (current_RX_time_ms % d_geojson_rate_ms == 0);
+                                    const bool flag_write_nmea_output = d_nmea_output_file_enabled && (current_RX_time_ms % d_nmea_rate_ms == 0);
+                                    if (flag_write_kml_output || flag_write_gpx_output || flag_write_geojson_output || flag_write_nmea_output)
                                         {
-                                            if (current_RX_time_ms % d_kml_rate_ms == 0)
+                                            const auto output_epoch = std::make_shared<const Pvt_Output_Epoch>(*d_user_pvt_solver, flag_write_nmea_output);
+                                            if (flag_write_kml_output)
                                                 {
-                                                    d_kml_dump->print_position(d_user_pvt_solver.get());
+                                                    d_kml_worker->submit([this, output_epoch] { d_kml_dump->print_position(output_epoch.get()); });
                                                 }
-                                        }
-                                    if (d_gpx_output_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_gpx_rate_ms == 0)
+                                            if (flag_write_gpx_output)
                                                 {
-                                                    d_gpx_dump->print_position(d_user_pvt_solver.get());
+                                                    d_gpx_worker->submit([this, output_epoch] { d_gpx_dump->print_position(output_epoch.get()); });
                                                 }
-                                        }
-                                    if (d_geojson_output_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_geojson_rate_ms == 0)
+                                            if (flag_write_geojson_output)
                                                 {
-                                                    d_geojson_printer->print_position(d_user_pvt_solver.get());
+                                                    d_geojson_worker->submit([this, output_epoch] { d_geojson_printer->print_position(output_epoch.get()); });
                                                 }
-                                        }
-                                    if (d_nmea_output_file_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_nmea_rate_ms == 0)
+                                            if (flag_write_nmea_output)
                                                 {
-                                                    d_nmea_printer->Print_Nmea_Line(d_user_pvt_solver.get());
+                                                    d_nmea_worker->submit([this, output_epoch] { d_nmea_printer->Print_Nmea_Line(&output_epoch->get_sol(), output_epoch->get_ssat().data()); });
                                                 }
                                         }
                                     if (d_rinex_output_enabled)
@@ -2514,6 +2607,7 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                             const std::shared_ptr<Monitor_Pvt> monitor_pvt = std::make_shared<Monitor_Pvt>(d_user_pvt_solver->get_monitor_pvt());
                             monitor_pvt->geohash = d_geohash->encode(d_user_pvt_solver->get_latitude(), d_user_pvt_solver->get_longitude());
                             DLOG(INFO) << "geohash=" << monitor_pvt->geohash;
+                            add_output_stats(*monitor_pvt);
                             // publish new position to the gnss_flowgraph channel status monitor
                             if (current_RX_time_ms % d_report_rate_ms == 0)
                                 {
@@ -2529,7 +2623,8 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                 {
                     if (d_local_counter_ms % static_cast<uint64_t>(d_an_rate_ms) == 0)
                         {
-                            d_an_printer->print_packet(d_user_pvt_solver.get(), d_gnss_observables_map);
+                            const auto output_epoch = std::make_shared<const Pvt_Output_Epoch>(*d_user_pvt_solver, d_gnss_observables_map);
+                            d_an_worker->submit([this, output_epoch] { d_an_printer->print_packet(output_epoch.get(), output_epoch->get_observables()); });
                         }
                 }
         }
@@ -59,10 +59,13 @@ class Gps_Almanac;
 class Gps_Ephemeris;
 class Gpx_Printer;
 class Kml_Printer;
+class Monitor_Pvt;
 class Monitor_Pvt_Udp_Sink;
 class Monitor_Ephemeris_Udp_Sink;
+class Nav_Data_Store;
 class Nmea_Printer;
 class Pvt_Conf;
+class Pvt_Output_Worker;
 class Rinex_Printer;
 class Rtcm_Printer;
 class An_Packet_Printer;
@@ -168,6 +171,7 @@ private:
     std::vector<std::string> split_string(const std::string& s, char delim) const;
 
     bool send_ttff_msg(double ttff) const;
+    void add_output_stats(Monitor_Pvt& monitor_pvt) const;
     bool save_gnss_synchro_map_xml(const std::string& file_name);  // debug helper function
     bool load_gnss_synchro_map_xml(const std::string& file_name);  // debug helper function
 
@@ -188,6 +192,15 @@ private:
     std::unique_ptr<Monitor_Ephemeris_Udp_Sink> d_eph_udp_sink_ptr;
     std::unique_ptr<Has_Simple_Printer> d_has_simple_printer;
     std::unique_ptr<An_Packet_Printer> d_an_printer;
+    std::unique_ptr<Nav_Data_Store> d_nav_data_store;
+
+    // Threads of the outputs. Declared after the printers, so they are
+    // stopped before the printers are destroyed.
+    std::unique_ptr<Pvt_Output_Worker> d_kml_worker;
+    std::unique_ptr<Pvt_Output_Worker> d_gpx_worker;
+    std::unique_ptr<Pvt_Output_Worker> d_geojson_worker;
+    std::unique_ptr<Pvt_Output_Worker> d_nmea_worker;
+    std::unique_ptr<Pvt_Output_Worker> d_an_worker;
 
     std::chrono::time_point<std::chrono::system_clock> d_start;
     std::chrono::time_point<std::chrono::system_clock> d_end;
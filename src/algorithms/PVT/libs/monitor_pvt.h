@@ -18,8 +18,11 @@
 #define GNSS_SDR_MONITOR_PVT_H
 
 #include <boost/serialization/nvp.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/version.hpp>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 /** \addtogroup PVT
  * \{ */
@@ -27,6 +30,36 @@
  * \{ */
 
 
+/*!
+ * \brief Counters of one of the outputs (KML, NMEA, ...) of the PVT block
+ */
+class Monitor_Pvt_Output
+{
+public:
+    std::string name;
+    // Epochs written
+    uint64_t processed{0};
+    // Epochs discarded because the output could not keep up
+    uint64_t dropped{0};
+    // Time from the position fix to the end of the write [ms]
+    double mean_latency_ms{0.0};
+    double max_latency_ms{0.0};
+
+    template <class Archive>
+    void serialize(Archive& ar, const unsigned int version)
+    {
+        if (version)
+            {
+            };
+        ar& BOOST_SERIALIZATION_NVP(name);
+        ar& BOOST_SERIALIZATION_NVP(processed);
+        ar& BOOST_SERIALIZATION_NVP(dropped);
+        ar& BOOST_SERIALIZATION_NVP(mean_latency_ms);
+        ar& BOOST_SERIALIZATION_NVP(max_latency_ms);
+    }
+};
+
+
 /*!
  * \brief This class contains parameters and outputs of the PVT block
  */
@@ -100,6 +133,9 @@ public:
 
     std::string geohash;  // See https://en.wikipedia.org/wiki/Geohash
 
+    // Counters of the outputs that run in their own thread
+    std::vector<Monitor_Pvt_Output> outputs;
+
     /*!
      * \brief This member function serializes and restores
      * Monitor_Pvt objects from a byte stream.
@@ -108,10 +144,6 @@ public:
 
     void serialize(Archive& ar, const unsigned int version)
     {
-        if (version)
-            {
-            };
-
         ar& BOOST_SERIALIZATION_NVP(TOW_at_current_symbol_ms);
         ar& BOOST_SERIALIZATION_NVP(week);
         ar& BOOST_SERIALIZATION_NVP(RX_time);
@@ -155,10 +187,18 @@ public:
 
         ar& BOOST_SERIALIZATION_NVP(cog);
         ar& BOOST_SERIALIZATION_NVP(geohash);
+        // Added in version 1. Archives of version 0 have no output counters
+        if (version > 0)
+            {
+                ar& BOOST_SERIALIZATION_NVP(outputs);
+            }
     }
 };
 
 
+BOOST_CLASS_VERSION(Monitor_Pvt, 1)
+
+
 /** \} */
 /** \} */
 #endif  // GNSS_SDR_MONITOR_PVT_H
@@ -0,0 +1,490 @@
+/*!
+ * \file nav_data_store.cc
+ * \brief Binary log of the navigation data decoded by the receiver, used for
+ * warm and hot starts
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "nav_data_store.h"
+#include "gnss_sdr_filesystem.h"
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdio>  // for std::rename, std::remove
+#include <exception>
+#include <sstream>
+#include <utility>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+namespace
+{
+const std::array<char, 8> MAGIC{'G', 'N', 'S', 'S', 'N', 'A', 'V', '\0'};
+
+// Records are compacted only above this size, so a small file is not
+// rewritten every time the almanacs are refreshed
+constexpr size_t MIN_RECORDS_TO_COMPACT = 256;
+
+
+template <typename T>
+std::string to_bytes(const T& record)
+{
+    std::ostringstream os(std::ios::binary);
+    {
+        boost::archive::binary_oarchive archive(os, boost::archive::no_header);
+        archive << record;
+    }
+    return os.str();
+}
+
+
+// The records have a fixed size, so a larger size field can only come from a
+// corrupt file
+size_t max_record_size()
+{
+    static const size_t max_size = std::max({to_bytes(Gps_Ephemeris()).size(),
+        to_bytes(Gps_Almanac()).size(),
+        to_bytes(Gps_Iono()).size(),
+        to_bytes(Gps_Utc_Model()).size(),
+        to_bytes(Gps_CNAV_Ephemeris()).size(),
+        to_bytes(Gps_CNAV_Utc_Model()).size(),
+        to_bytes(Galileo_Ephemeris()).size(),
+        to_bytes(Galileo_Almanac()).size(),
+        to_bytes(Galileo_Iono()).size(),
+        to_bytes(Galileo_Utc_Model()).size(),
+        to_bytes(Glonass_Gnav_Ephemeris()).size(),
+        to_bytes(Glonass_Gnav_Utc_Model()).size()});
+    return max_size;
+}
+
+
+template <typename T>
+bool from_bytes(const std::string& payload, T& record)
+{
+    try
+        {
+            std::istringstream is(payload, std::ios::binary);
+            boost::archive::binary_iarchive archive(is, boost::archive::no_header);
+            archive >> record;
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Wrong record in the navigation data store: " << e.what();
+            return false;
+        }
+    return true;
+}
+
+
+template <typename T>
+bool read_into(std::map<int, T>& contents, const std::string& payload)
+{
+    T record;
+    if (!from_bytes(payload, record))
+        {
+            return false;
+        }
+    contents[record.PRN] = std::move(record);
+    return true;
+}
+
+
+template <typename T>
+bool read_into(std::shared_ptr<T>& contents, const std::string& payload)
+{
+    auto record = std::make_shared<T>();
+    if (!from_bytes(payload, *record))
+        {
+            return false;
+        }
+    contents = std::move(record);
+    return true;
+}
+
+
+void write_record(std::ofstream& out, uint8_t type, const std::string& payload)
+{
+    const auto size = static_cast<uint32_t>(payload.size());
+    out.write(reinterpret_cast<const char*>(&type), sizeof(type));
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    out.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+}
+
+
+template <typename T>
+void write_records(std::ofstream& out, uint8_t type, const std::map<int, T>& contents)
+{
+    for (const auto& it : contents)
+        {
+            write_record(out, type, to_bytes(it.second));
+        }
+}
+
+
+template <typename T>
+void write_records(std::ofstream& out, uint8_t type, const std::shared_ptr<T>& contents)
+{
+    if (contents)
+        {
+            write_record(out, type, to_bytes(*contents));
+        }
+}
+}  // namespace
+
+
+Nav_Data_Store::Nav_Data_Store(std::string filename)
+    : d_filename(std::move(filename))
+{
+}
+
+
+bool Nav_Data_Store::load()
+{
+    std::ifstream in(d_filename, std::ios::binary);
+    if (!in.is_open())
+        {
+            return false;
+        }
+
+    std::array<char, 8> magic{};
+    uint32_t version = 0;
+    in.read(magic.data(), magic.size());
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!in || magic != MAGIC || version != VERSION)
+        {
+            LOG(WARNING) << "File " << d_filename << " is not a navigation data store of version " << VERSION;
+            return false;
+        }
+
+    clear();
+    uint8_t type = 0;
+    uint32_t record_size = 0;
+    std::string payload;
+    std::streamoff good_size = in.tellg();
+    while (in.read(reinterpret_cast<char*>(&type), sizeof(type)) && in.read(reinterpret_cast<char*>(&record_size), sizeof(record_size)))
+        {
+            if (type < GPS_EPHEMERIS || type > GLONASS_GNAV_UTC_MODEL || record_size > max_record_size())
+                {
+                    LOG(WARNING) << "Ignoring a corrupt record and the rest of " << d_filename;
+                    break;
+                }
+            payload.resize(record_size);
+            if (!in.read(&payload[0], record_size))
+                {
+                    LOG(WARNING) << "Ignoring a truncated record at the end of " << d_filename;
+                    break;
+                }
+            read_record(type, payload);
+            d_file_records++;
+            good_size = in.tellg();
+        }
+
+    // Anything after the last good record is cut off before appending, or the
+    // new records would be unreachable behind it
+    in.clear();
+    in.seekg(0, std::ios::end);
+    d_truncate_to = in.tellg() > good_size ? good_size : -1;
+    d_loaded = true;
+    DLOG(INFO) << "Loaded " << size() << " records from " << d_file_records << " in " << d_filename;
+    return true;
+}
+
+
+template <typename T>
+bool Nav_Data_Store::append_to(std::map<int, T>& contents, const T& record, uint8_t type)
+{
+    const bool is_open = open_for_append();
+    const std::string payload = to_bytes(record);
+    const auto it = contents.find(record.PRN);
+    if (it != contents.cend() && to_bytes(it->second) == payload)
+        {
+            return is_open;  // already in the store
+        }
+    contents[record.PRN] = record;
+    if (!is_open)
+        {
+            return false;
+        }
+    return append_record(type, payload);
+}
+
+
+template <typename T>
+bool Nav_Data_Store::append_to(std::shared_ptr<T>& contents, const T& record, uint8_t type)
+{
+    const bool is_open = open_for_append();
+    const std::string payload = to_bytes(record);
+    if (contents && to_bytes(*contents) == payload)
+        {
+            return is_open;  // already in the store
+        }
+    contents = std::make_shared<T>(record);
+    if (!is_open)
+        {
+            return false;
+        }
+    return append_record(type, payload);
+}
+
+
+bool Nav_Data_Store::append(const Gps_Ephemeris& eph)
+{
+    return append_to(gps_ephemeris_map, eph, GPS_EPHEMERIS);
+}
+
+
+bool Nav_Data_Store::append(const Gps_Almanac& almanac)
+{
+    return append_to(gps_almanac_map, almanac, GPS_ALMANAC);
+}
+
+
+bool Nav_Data_Store::append(const Gps_Iono& iono)
+{
+    return append_to(gps_iono, iono, GPS_IONO);
+}
+
+
+bool Nav_Data_Store::append(const Gps_Utc_Model& utc_model)
+{
+    return append_to(gps_utc_model, utc_model, GPS_UTC_MODEL);
+}
+
+
+bool Nav_Data_Store::append(const Gps_CNAV_Ephemeris& eph)
+{
+    return append_to(gps_cnav_ephemeris_map, eph, GPS_CNAV_EPHEMERIS);
+}
+
+
+bool Nav_Data_Store::append(const Gps_CNAV_Utc_Model& utc_model)
+{
+    return append_to(gps_cnav_utc_model, utc_model, GPS_CNAV_UTC_MODEL);
+}
+
+
+bool Nav_Data_Store::append(const Galileo_Ephemeris& eph)
+{
+    return append_to(galileo_ephemeris_map, eph, GALILEO_EPHEMERIS);
+}
+
+
+bool Nav_Data_Store::append(const Galileo_Almanac& almanac)
+{
+    return append_to(galileo_almanac_map, almanac, GALILEO_ALMANAC);
+}
+
+
+bool Nav_Data_Store::append(const Galileo_Iono& iono)
+{
+    return append_to(galileo_iono, iono, GALILEO_IONO);
+}
+
+
+bool Nav_Data_Store::append(const Galileo_Utc_Model& utc_model)
+{
+    return append_to(galileo_utc_model, utc_model, GALILEO_UTC_MODEL);
+}
+
+
+bool Nav_Data_Store::append(const Glonass_Gnav_Ephemeris& eph)
+{
+    return append_to(glonass_gnav_ephemeris_map, eph, GLONASS_GNAV_EPHEMERIS);
+}
+
+
+bool Nav_Data_Store::append(const Glonass_Gnav_Utc_Model& utc_model)
+{
+    return append_to(glonass_gnav_utc_model, utc_model, GLONASS_GNAV_UTC_MODEL);
+}
+
+
+bool Nav_Data_Store::append_record(uint8_t type, const std::string& payload)
+{
+    write_record(d_file, type, payload);
+    d_file.flush();
+    d_file_records++;
+    if (d_file_records > MIN_RECORDS_TO_COMPACT && d_file_records > 3 * size())
+        {
+            return compact();
+        }
+    return d_file.good();
+}
+
+
+bool Nav_Data_Store::compact()
+{
+    // Write a new file and replace the old one, so the store is never left
+    // half-written
+    const std::string tmp_filename = d_filename + ".tmp";
+    {
+        std::ofstream out(tmp_filename, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+            {
+                LOG(WARNING) << "Cannot write the navigation data store " << tmp_filename;
+                return false;
+            }
+        if (!write_all(out))
+            {
+                out.close();
+                std::remove(tmp_filename.c_str());
+                LOG(WARNING) << "Cannot write the navigation data store " << tmp_filename;
+                return false;
+            }
+    }
+
+    const bool was_open = d_file.is_open();
+    if (was_open)
+        {
+            d_file.close();
+        }
+    if (std::rename(tmp_filename.c_str(), d_filename.c_str()) != 0)
+        {
+            std::remove(tmp_filename.c_str());
+            LOG(WARNING) << "Cannot replace the navigation data store " << d_filename;
+            return false;
+        }
+    d_file_records = size();
+    d_truncate_to = -1;
+    d_loaded = true;
+    if (was_open)
+        {
+            d_file.open(d_filename, std::ios::binary | std::ios::app);
+        }
+    return true;
+}
+
+
+size_t Nav_Data_Store::size() const
+{
+    return gps_ephemeris_map.size() + gps_almanac_map.size() +
+           gps_cnav_ephemeris_map.size() + galileo_ephemeris_map.size() +
+           galileo_almanac_map.size() + glonass_gnav_ephemeris_map.size() +
+           static_cast<size_t>(gps_iono != nullptr) + static_cast<size_t>(gps_utc_model != nullptr) +
+           static_cast<size_t>(gps_cnav_utc_model != nullptr) + static_cast<size_t>(galileo_iono != nullptr) +
+           static_cast<size_t>(galileo_utc_model != nullptr) + static_cast<size_t>(glonass_gnav_utc_model != nullptr);
+}
+
+
+bool Nav_Data_Store::open_for_append()
+{
+    if (d_file.is_open())
+        {
+            return true;
+        }
+    // Keep the records of a previous run. If the file does not exist or it is
+    // not a valid store, start a new one.
+    if (!d_loaded && !load() && !compact())
+        {
+            return false;
+        }
+    if (d_truncate_to >= 0)
+        {
+            errorlib::error_code ec;
+            fs::resize_file(fs::path(d_filename), static_cast<uintmax_t>(d_truncate_to), ec);
+            if (ec && !compact())
+                {
+                    LOG(WARNING) << "Cannot truncate the navigation data store " << d_filename << ": " << ec.message();
+                    return false;
+                }
+            d_truncate_to = -1;
+        }
+    d_file.open(d_filename, std::ios::binary | std::ios::app);
+    if (!d_file.is_open())
+        {
+            LOG(WARNING) << "Cannot open the navigation data store " << d_filename;
+            return false;
+        }
+    return true;
+}
+
+
+bool Nav_Data_Store::read_record(uint8_t type, const std::string& payload)
+{
+    switch (type)
+        {
+        case GPS_EPHEMERIS:
+            return read_into(gps_ephemeris_map, payload);
+        case GPS_ALMANAC:
+            return read_into(gps_almanac_map, payload);
+        case GPS_IONO:
+            return read_into(gps_iono, payload);
+        case GPS_UTC_MODEL:
+            return read_into(gps_utc_model, payload);
+        case GPS_CNAV_EPHEMERIS:
+            return read_into(gps_cnav_ephemeris_map, payload);
+        case GPS_CNAV_UTC_MODEL:
+            return read_into(gps_cnav_utc_model, payload);
+        case GALILEO_EPHEMERIS:
+            return read_into(galileo_ephemeris_map, payload);
+        case GALILEO_ALMANAC:
+            return read_into(galileo_almanac_map, payload);
+        case GALILEO_IONO:
+            return read_into(galileo_iono, payload);
+        case GALILEO_UTC_MODEL:
+            return read_into(galileo_utc_model, payload);
+        case GLONASS_GNAV_EPHEMERIS:
+            return read_into(glonass_gnav_ephemeris_map, payload);
+        case GLONASS_GNAV_UTC_MODEL:
+            return read_into(glonass_gnav_utc_model, payload);
+        default:
+            LOG(WARNING) << "Unknown record type " << static_cast<int>(type) << " in " << d_filename;
+            return false;
+        }
+}
+
+
+bool Nav_Data_Store::write_all(std::ofstream& out) const
+{
+    const uint32_t version = VERSION;  // VERSION has no out-of-class definition in C++14
+    out.write(MAGIC.data(), MAGIC.size());
+    out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    write_records(out, GPS_EPHEMERIS, gps_ephemeris_map);
+    write_records(out, GPS_ALMANAC, gps_almanac_map);
+    write_records(out, GPS_IONO, gps_iono);
+    write_records(out, GPS_UTC_MODEL, gps_utc_model);
+    write_records(out, GPS_CNAV_EPHEMERIS, gps_cnav_ephemeris_map);
+    write_records(out, GPS_CNAV_UTC_MODEL, gps_cnav_utc_model);
+    write_records(out, GALILEO_EPHEMERIS, galileo_ephemeris_map);
+    write_records(out, GALILEO_ALMANAC, galileo_almanac_map);
+    write_records(out, GALILEO_IONO, galileo_iono);
+    write_records(out, GALILEO_UTC_MODEL, galileo_utc_model);
+    write_records(out, GLONASS_GNAV_EPHEMERIS, glonass_gnav_ephemeris_map);
+    write_records(out, GLONASS_GNAV_UTC_MODEL, glonass_gnav_utc_model);
+    out.flush();
+    return out.good();
+}
+
+
+void Nav_Data_Store::clear()
+{
+    gps_ephemeris_map.clear();
+    gps_almanac_map.clear();
+    gps_cnav_ephemeris_map.clear();
+    galileo_ephemeris_map.clear();
+    galileo_almanac_map.clear();
+    glonass_gnav_ephemeris_map.clear();
+    gps_iono.reset();
+    gps_utc_model.reset();
+    gps_cnav_utc_model.reset();
+    galileo_iono.reset();
+    galileo_utc_model.reset();
+    glonass_gnav_utc_model.reset();
+    d_file_records = 0;
+}
@@ -0,0 +1,170 @@
+/*!
+ * \file nav_data_store.h
+ * \brief Binary log of the navigation data decoded by the receiver, used for
+ * warm and hot starts
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * The store is an append-only file. Each new ephemeris, almanac, iono or UTC
+ * model is appended as one record, and the latest record of each satellite
+ * wins when the file is loaded. When most of the records in the file are
+ * outdated, it is compacted.
+ *
+ * File format (native byte order):
+ *   header: "GNSSNAV" '\0', uint32_t version
+ *   record: uint8_t type, uint32_t size, size bytes of a Boost binary archive
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_NAV_DATA_STORE_H
+#define GNSS_SDR_NAV_DATA_STORE_H
+
+#include "galileo_almanac.h"
+#include "galileo_ephemeris.h"
+#include "galileo_iono.h"
+#include "galileo_utc_model.h"
+#include "glonass_gnav_ephemeris.h"
+#include "glonass_gnav_utc_model.h"
+#include "gps_almanac.h"
+#include "gps_cnav_ephemeris.h"
+#include "gps_cnav_utc_model.h"
+#include "gps_ephemeris.h"
+#include "gps_iono.h"
+#include "gps_utc_model.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Navigation data of all the satellites, kept in memory and logged to
+ * a file as it is received.
+ */
+class Nav_Data_Store
+{
+public:
+    static constexpr uint32_t VERSION = 1;
+
+    explicit Nav_Data_Store(std::string filename);
+    ~Nav_Data_Store() = default;
+
+    Nav_Data_Store(const Nav_Data_Store&) = delete;
+    Nav_Data_Store& operator=(const Nav_Data_Store&) = delete;
+
+    /*!
+     * \brief Reads the file, replacing the current contents. Returns false if
+     * the file does not exist or it is not a store of this version. A
+     * truncated last record (e.g., the receiver was killed while writing it)
+     * or a corrupt one is ignored, together with the rest of the file, which
+     * is cut off before the next append.
+     */
+    bool load();
+
+    /*!
+     * \brief Updates the contents and appends the record to the file, unless
+     * it is equal to the current one (navigation messages repeat the same
+     * data until it is updated). It compacts the file when less than a third
+     * of its records are current. Returns false if the file could not be
+     * written.
+     */
+    bool append(const Gps_Ephemeris& eph);
+    bool append(const Gps_Almanac& almanac);
+    bool append(const Gps_Iono& iono);
+    bool append(const Gps_Utc_Model& utc_model);
+    bool append(const Gps_CNAV_Ephemeris& eph);
+    bool append(const Gps_CNAV_Utc_Model& utc_model);
+    bool append(const Galileo_Ephemeris& eph);
+    bool append(const Galileo_Almanac& almanac);
+    bool append(const Galileo_Iono& iono);
+    bool append(const Galileo_Utc_Model& utc_model);
+    bool append(const Glonass_Gnav_Ephemeris& eph);
+    bool append(const Glonass_Gnav_Utc_Model& utc_model);
+
+    /*!
+     * \brief Rewrites the file with the current contents only.
+     */
+    bool compact();
+
+    size_t size() const;  //!< Current records
+
+    size_t file_records() const  //!< Records in the file, current or not
+    {
+        return d_file_records;
+    }
+
+    const std::string& filename() const
+    {
+        return d_filename;
+    }
+
+    // Current contents. Maps are indexed by PRN, and the models are null
+    // until one is received.
+    std::map<int, Gps_Ephemeris> gps_ephemeris_map;
+    std::map<int, Gps_Almanac> gps_almanac_map;
+    std::map<int, Gps_CNAV_Ephemeris> gps_cnav_ephemeris_map;
+    std::map<int, Galileo_Ephemeris> galileo_ephemeris_map;
+    std::map<int, Galileo_Almanac> galileo_almanac_map;
+    std::map<int, Glonass_Gnav_Ephemeris> glonass_gnav_ephemeris_map;
+    std::shared_ptr<Gps_Iono> gps_iono;
+    std::shared_ptr<Gps_Utc_Model> gps_utc_model;
+    std::shared_ptr<Gps_CNAV_Utc_Model> gps_cnav_utc_model;
+    std::shared_ptr<Galileo_Iono> galileo_iono;
+    std::shared_ptr<Galileo_Utc_Model> galileo_utc_model;
+    std::shared_ptr<Glonass_Gnav_Utc_Model> glonass_gnav_utc_model;
+
+private:
+    enum Record_Type : uint8_t
+    {
+        GPS_EPHEMERIS = 1,
+        GPS_ALMANAC,
+        GPS_IONO,
+        GPS_UTC_MODEL,
+        GPS_CNAV_EPHEMERIS,
+        GPS_CNAV_UTC_MODEL,
+        GALILEO_EPHEMERIS,
+        GALILEO_ALMANAC,
+        GALILEO_IONO,
+        GALILEO_UTC_MODEL,
+        GLONASS_GNAV_EPHEMERIS,
+        GLONASS_GNAV_UTC_MODEL
+    };
+
+    template <typename T>
+    bool append_to(std::map<int, T>& contents, const T& record, uint8_t type);
+
+    template <typename T>
+    bool append_to(std::shared_ptr<T>& contents, const T& record, uint8_t type);
+
+    bool append_record(uint8_t type, const std::string& payload);
+    bool open_for_append();
+    bool read_record(uint8_t type, const std::string& payload);
+    bool write_all(std::ofstream& out) const;
+    void clear();
+
+    std::ofstream d_file;
+    std::string d_filename;
+    std::streamoff d_truncate_to{-1};  // good size of a file with a corrupt end
+    size_t d_file_records{0};
+    bool d_loaded{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_NAV_DATA_STORE_H
@@ -106,7 +106,8 @@ Nmea_Printer::Nmea_Printer(const std::string& filename,
             nmea_dev_descriptor = -1;
         }
 
-    d_PVT_data = nullptr;
+    d_sol = nullptr;
+    d_ssat = nullptr;
 }
 
 
@@ -196,9 +197,16 @@ void Nmea_Printer::close_serial() const
 
 
 bool Nmea_Printer::Print_Nmea_Line(const Rtklib_Solver* const pvt_data)
+{
+    return Print_Nmea_Line(&pvt_data->pvt_sol, pvt_data->pvt_ssat.data());
+}
+
+
+bool Nmea_Printer::Print_Nmea_Line(const sol_t* const sol, const ssat_t* const ssat)
 {
     // set the new PVT data
-    d_PVT_data = pvt_data;
+    d_sol = sol;
+    d_ssat = ssat;
 
     // generate the NMEA sentences
 
@@ -398,7 +406,7 @@ std::string Nmea_Printer::get_GPRMC() const
     // Sample -> $GPRMC,161229.487,A,3723.2475,N,12158.3416,W,0.13,309.62,120598,*10
     std::stringstream sentence_str;
     std::array<unsigned char, 1024> buff{};
-    outnmea_rmc(buff.data(), &d_PVT_data->pvt_sol);
+    outnmea_rmc(buff.data(), d_sol);
     sentence_str << buff.data();
     return sentence_str.str();
 }
@@ -410,7 +418,7 @@ std::string Nmea_Printer::get_GPGSA() const
     // GSA-GNSS DOP and Active Satellites
     std::stringstream sentence_str;
     std::array<unsigned char, 1024> buff{};
-    outnmea_gsa(buff.data(), &d_PVT_data->pvt_sol, d_PVT_data->pvt_ssat.data());
+    outnmea_gsa(buff.data(), d_sol, d_ssat);
     sentence_str << buff.data();
     return sentence_str.str();
 }
@@ -423,7 +431,7 @@ std::string Nmea_Printer::get_GPGSV() const
     // Notice that NMEA 2.1 only supports 12 channels
     std::stringstream sentence_str;
     std::array<unsigned char, 1024> buff{};
-    outnmea_gsv(buff.data(), &d_PVT_data->pvt_sol, d_PVT_data->pvt_ssat.data());
+    outnmea_gsv(buff.data(), d_sol, d_ssat);
     sentence_str << buff.data();
     return sentence_str.str();
 }
@@ -433,7 +441,7 @@ std::string Nmea_Printer::get_GPGGA() const
 {
     std::stringstream sentence_str;
     std::array<unsigned char, 1024> buff{};
-    outnmea_gga(buff.data(), &d_PVT_data->pvt_sol);
+    outnmea_gga(buff.data(), d_sol);
     sentence_str << buff.data();
     return sentence_str.str();
     // $GPGGA,104427.591,5920.7009,N,01803.2938,E,1,05,3.3,78.2,M,23.2,M,0.0,0000*4A
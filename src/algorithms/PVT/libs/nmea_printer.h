@@ -22,6 +22,7 @@
 #ifndef GNSS_SDR_NMEA_PRINTER_H
 #define GNSS_SDR_NMEA_PRINTER_H
 
+#include "rtklib.h"                              // for sol_t, ssat_t
 #include <boost/date_time/posix_time/ptime.hpp>  // for ptime
 #include <fstream>                               // for ofstream
 #include <memory>                                // for shared_ptr
@@ -59,6 +60,12 @@ public:
      */
     bool Print_Nmea_Line(const Rtklib_Solver* const pvt_data);
 
+    /*!
+     * \brief Print NMEA PVT and satellite info from a RTKLIB solution and
+     * the status of the MAXSAT satellites
+     */
+    bool Print_Nmea_Line(const sol_t* const sol, const ssat_t* const ssat);
+
 private:
     int init_serial(const std::string& serial_device);  // serial port control
     void close_serial() const;
@@ -71,7 +78,8 @@ private:
     std::string latitude_to_hm(double lat) const;
     char checkSum(const std::string& sentence) const;
 
-    const Rtklib_Solver* d_PVT_data;
+    const sol_t* d_sol;
+    const ssat_t* d_ssat;
 
     std::ofstream nmea_file_descriptor;  // Output file stream for NMEA log file
 
@@ -51,6 +51,8 @@ public:
     std::string udp_ports;
     std::string udp_eph_addresses;
     std::string log_source_timetag_file;
+    std::string nav_data_store_file;
+    std::string output_drop_policy = std::string("block");
 
     uint32_t type_of_receiver = 0;
     uint32_t observable_interval_ms = 20;
@@ -64,6 +66,7 @@ public:
     int32_t rinex_version = 0;
     int32_t rinexobs_rate_ms = 0;
     int32_t an_rate_ms = 20;
+    int32_t output_queue_size = 16;
     int32_t max_obs_block_rx_clock_offset_ms = 40;
     int udp_eph_port = 0;
     int rtk_trace_level = 0;
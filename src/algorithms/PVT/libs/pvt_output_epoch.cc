@@ -0,0 +1,47 @@
+/*!
+ * \file pvt_output_epoch.cc
+ * \brief Copy of the PVT solution of one epoch, for the outputs of the PVT
+ * block that run in their own thread
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_output_epoch.h"
+#include "rtklib_solver.h"
+
+
+Pvt_Output_Epoch::Pvt_Output_Epoch(const Rtklib_Solver& solver, bool with_satellite_status)
+    : Pvt_Solution(solver),
+      d_sol(solver.pvt_sol),
+      d_hdop(solver.get_hdop()),
+      d_vdop(solver.get_vdop()),
+      d_pdop(solver.get_pdop()),
+      d_gdop(solver.get_gdop())
+{
+    if (with_satellite_status)
+        {
+            d_ssat.assign(solver.pvt_ssat.cbegin(), solver.pvt_ssat.cend());
+        }
+}
+
+
+Pvt_Output_Epoch::Pvt_Output_Epoch(const Rtklib_Solver& solver,
+    const std::map<int, Gnss_Synchro>& observables)
+    : Pvt_Solution(solver),
+      d_sol(solver.pvt_sol),
+      d_observables(observables),
+      d_hdop(solver.get_hdop()),
+      d_vdop(solver.get_vdop()),
+      d_pdop(solver.get_pdop()),
+      d_gdop(solver.get_gdop())
+{
+}
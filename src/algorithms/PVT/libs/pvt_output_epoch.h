@@ -0,0 +1,104 @@
+/*!
+ * \file pvt_output_epoch.h
+ * \brief Copy of the PVT solution of one epoch, for the outputs of the PVT
+ * block that run in their own thread
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PVT_OUTPUT_EPOCH_H
+#define GNSS_SDR_PVT_OUTPUT_EPOCH_H
+
+#include "gnss_synchro.h"
+#include "pvt_solution.h"
+#include "rtklib.h"
+#include <map>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+class Rtklib_Solver;
+
+/*!
+ * \brief Immutable copy of the solution computed by the Rtklib_Solver in one
+ * epoch, together with the observables used to compute it. The outputs share
+ * it through a std::shared_ptr<const Pvt_Output_Epoch>, so the solver can go
+ * on with the next epoch while they are written.
+ */
+class Pvt_Output_Epoch : public Pvt_Solution
+{
+public:
+    /*!
+     * \brief Copies the solution. The status of each satellite, needed only by
+     * the NMEA sentences, is copied if with_satellite_status is true.
+     */
+    Pvt_Output_Epoch(const Rtklib_Solver& solver, bool with_satellite_status);
+
+    /*!
+     * \brief Copies the solution and the observables used to compute it.
+     */
+    Pvt_Output_Epoch(const Rtklib_Solver& solver,
+        const std::map<int, Gnss_Synchro>& observables);
+
+    double get_hdop() const override
+    {
+        return d_hdop;
+    }
+
+    double get_vdop() const override
+    {
+        return d_vdop;
+    }
+
+    double get_pdop() const override
+    {
+        return d_pdop;
+    }
+
+    double get_gdop() const override
+    {
+        return d_gdop;
+    }
+
+    const sol_t& get_sol() const
+    {
+        return d_sol;
+    }
+
+    const std::vector<ssat_t>& get_ssat() const  //!< Empty if not copied
+    {
+        return d_ssat;
+    }
+
+    const std::map<int, Gnss_Synchro>& get_observables() const  //!< Empty if not copied
+    {
+        return d_observables;
+    }
+
+private:
+    sol_t d_sol{};
+    std::vector<ssat_t> d_ssat;
+    std::map<int, Gnss_Synchro> d_observables;
+    double d_hdop;
+    double d_vdop;
+    double d_pdop;
+    double d_gdop;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PVT_OUTPUT_EPOCH_H
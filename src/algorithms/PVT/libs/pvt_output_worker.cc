@@ -0,0 +1,175 @@
+/*!
+ * \file pvt_output_worker.cc
+ * \brief Thread that runs the tasks of one of the outputs of the PVT block
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_output_worker.h"
+#include <algorithm>  // for std::max
+#include <exception>
+#include <utility>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+Pvt_Output_Worker::Drop_Policy Pvt_Output_Worker::policy_from_string(const std::string& policy)
+{
+    if (policy == "drop_oldest")
+        {
+            return DROP_OLDEST;
+        }
+    if (policy == "drop_newest")
+        {
+            return DROP_NEWEST;
+        }
+    if (policy != "block")
+        {
+            LOG(WARNING) << "Unknown PVT output drop policy " << policy << ", using block";
+        }
+    return BLOCK;
+}
+
+
+Pvt_Output_Worker::Pvt_Output_Worker(std::string name, size_t capacity, Drop_Policy policy)
+    : d_stats{},
+      d_capacity(capacity),
+      d_policy(policy)
+{
+    d_stats.name = std::move(name);
+    if (d_capacity > 0)
+        {
+            d_thread = std::thread(&Pvt_Output_Worker::worker, this);
+        }
+}
+
+
+Pvt_Output_Worker::~Pvt_Output_Worker()
+{
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        d_running = false;
+    }
+    d_cond_not_empty.notify_all();
+    if (d_thread.joinable())
+        {
+            d_thread.join();
+        }
+    if (d_stats.dropped > 0)
+        {
+            LOG(WARNING) << "PVT output " << d_stats.name << " dropped " << d_stats.dropped << " epochs";
+        }
+}
+
+
+bool Pvt_Output_Worker::submit(std::function<void()> task)
+{
+    Task t{std::move(task), std::chrono::steady_clock::now()};
+    if (d_capacity == 0)
+        {
+            run(t);
+            return true;
+        }
+
+    bool dropped = false;
+    {
+        std::unique_lock<std::mutex> lk(d_mutex);
+        if (d_queue.size() >= d_capacity)
+            {
+                if (d_policy == BLOCK)
+                    {
+                        d_cond_not_full.wait(lk, [this] { return d_queue.size() < d_capacity; });
+                    }
+                else if (d_policy == DROP_OLDEST)
+                    {
+                        d_queue.pop_front();
+                        d_stats.dropped++;
+                        dropped = true;
+                    }
+                else
+                    {
+                        d_stats.dropped++;
+                        return false;
+                    }
+            }
+        d_queue.push_back(std::move(t));
+    }
+    d_cond_not_empty.notify_one();
+    return !dropped;
+}
+
+
+void Pvt_Output_Worker::flush()
+{
+    std::unique_lock<std::mutex> lk(d_mutex);
+    d_cond_not_full.wait(lk, [this] { return d_queue.empty() && !d_busy; });
+}
+
+
+Monitor_Pvt_Output Pvt_Output_Worker::stats() const
+{
+    std::lock_guard<std::mutex> lk(d_mutex);
+    Monitor_Pvt_Output stats = d_stats;
+    stats.mean_latency_ms = stats.processed > 0 ? d_total_latency_ms / static_cast<double>(stats.processed) : 0.0;
+    return stats;
+}
+
+
+void Pvt_Output_Worker::run(Task& task)
+{
+    try
+        {
+            task.run();
+        }
+    catch (const std::exception& e)
+        {
+            LOG(ERROR) << "Exception in PVT output " << d_stats.name << ": " << e.what();
+        }
+    const double latency_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - task.enqueued).count();
+    std::lock_guard<std::mutex> lk(d_mutex);
+    d_stats.processed++;
+    d_total_latency_ms += latency_ms;
+    d_stats.max_latency_ms = std::max(d_stats.max_latency_ms, latency_ms);
+}
+
+
+void Pvt_Output_Worker::worker()
+{
+    while (true)
+        {
+            Task task;
+            {
+                std::unique_lock<std::mutex> lk(d_mutex);
+                d_cond_not_empty.wait(lk, [this] { return !d_running || !d_queue.empty(); });
+                if (d_queue.empty())
+                    {
+                        return;  // stopped, and all the tasks have run
+                    }
+                task = std::move(d_queue.front());
+                d_queue.pop_front();
+                d_busy = true;
+            }
+            d_cond_not_full.notify_all();
+
+            run(task);
+
+            {
+                std::lock_guard<std::mutex> lk(d_mutex);
+                d_busy = false;
+            }
+            d_cond_not_full.notify_all();
+        }
+}
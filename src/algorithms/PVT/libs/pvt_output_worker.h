@@ -0,0 +1,119 @@
+/*!
+ * \file pvt_output_worker.h
+ * \brief Thread that runs the tasks of one of the outputs of the PVT block
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * Each printer (KML, NMEA, ...) gets its own worker, so a slow file system
+ * or serial port only delays that output and not the computation of the
+ * next position fix. Tasks run in submission order.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PVT_OUTPUT_WORKER_H
+#define GNSS_SDR_PVT_OUTPUT_WORKER_H
+
+#include "monitor_pvt.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+class Pvt_Output_Worker
+{
+public:
+    /*!
+     * \brief What to do with a new task when the queue is full:
+     * BLOCK waits for room, DROP_OLDEST discards the oldest queued task and
+     * DROP_NEWEST discards the new one.
+     */
+    enum Drop_Policy
+    {
+        BLOCK,
+        DROP_OLDEST,
+        DROP_NEWEST
+    };
+
+    /*!
+     * \brief Parses "block", "drop_oldest" or "drop_newest". Returns BLOCK
+     * for any other value.
+     */
+    static Drop_Policy policy_from_string(const std::string& policy);
+
+    /*!
+     * \brief Starts the worker thread. A capacity of zero means that tasks are
+     * run synchronously by submit().
+     */
+    Pvt_Output_Worker(std::string name, size_t capacity, Drop_Policy policy);
+
+    /*!
+     * \brief Runs the queued tasks and stops the thread.
+     */
+    ~Pvt_Output_Worker();
+
+    Pvt_Output_Worker(const Pvt_Output_Worker&) = delete;
+    Pvt_Output_Worker& operator=(const Pvt_Output_Worker&) = delete;
+
+    /*!
+     * \brief Queues a task. Returns false if the task, or an older one, was
+     * dropped according to the drop policy.
+     */
+    bool submit(std::function<void()> task);
+
+    /*!
+     * \brief Blocks until all the queued tasks have run.
+     */
+    void flush();
+
+    /*!
+     * \brief Counters of the tasks run and dropped. Latencies go from
+     * submission to the end of the task.
+     */
+    Monitor_Pvt_Output stats() const;
+
+private:
+    struct Task
+    {
+        std::function<void()> run;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+
+    void run(Task& task);
+    void worker();
+
+    std::deque<Task> d_queue;
+    std::thread d_thread;
+    mutable std::mutex d_mutex;
+    std::condition_variable d_cond_not_empty;
+    std::condition_variable d_cond_not_full;
+    Monitor_Pvt_Output d_stats;
+    double d_total_latency_ms{0.0};
+    size_t d_capacity;
+    Drop_Policy d_policy;
+    bool d_busy{false};
+    bool d_running{true};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PVT_OUTPUT_WORKER_H
@@ -3802,17 +3802,14 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Glonass_Gnav_Utc_
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -3849,23 +3846,12 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Glonass_Gnav_Utc_
                             data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
-    out.close();
-    out.open(navGlofilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
+    if (Rinex_Printer::overwrite_header(out, navGlofilename, data))
         {
-            out << data[i] << '\n';
+            std::cout << "The RINEX Navigation file header has been updated with UTC info.\n";
         }
-    out.close();
-    out.open(navGlofilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
-    std::cout << "The RINEX Navigation file header has been updated with UTC info.\n";
 }
 
 
@@ -3874,17 +3860,14 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Galileo_Iono& gal
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -3944,23 +3927,12 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Galileo_Iono& gal
                             data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
-    out.close();
-    out.open(navGalfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
+    if (Rinex_Printer::overwrite_header(out, navGalfilename, data))
         {
-            out << data[i] << '\n';
+            std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
         }
-    out.close();
-    out.open(navGalfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
-    std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
 
@@ -3969,17 +3941,14 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Utc_Model& ut
     std::vector<std::string> data;
     std::string line_aux;
 
-    int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -4123,23 +4092,12 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Utc_Model& ut
                                 }
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
+    if (Rinex_Printer::overwrite_header(out, navfilename, data))
         {
-            out << data[i] << '\n';
+            std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
         }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
-    std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
 
@@ -4148,17 +4106,14 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Mode
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -4218,23 +4173,12 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Mode
                             data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
+    if (Rinex_Printer::overwrite_header(out, navfilename, data))
         {
-            out << data[i] << '\n';
+            std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
         }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
-    std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
 
@@ -4243,17 +4187,14 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Mode
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -4348,22 +4289,12 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Mode
                             data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
+
+    if (Rinex_Printer::overwrite_header(out, navfilename, data))
         {
-            out << data[i] << '\n';
+            std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
         }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
-    std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
 
@@ -4372,17 +4303,14 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Iono& gps_ion
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -4491,23 +4419,12 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Iono& gps_ion
                             data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
+    if (Rinex_Printer::overwrite_header(out, navMixfilename, data))
         {
-            out << data[i] << '\n';
+            std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
         }
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
-    std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
 
@@ -4519,17 +4436,14 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Iono& gps_ion
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -4613,23 +4527,12 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Iono& gps_ion
                             data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
+    if (Rinex_Printer::overwrite_header(out, navMixfilename, data))
         {
-            out << data[i] << '\n';
+            std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
         }
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
-    std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
 
@@ -4641,17 +4544,14 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Iono& gp
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -4721,23 +4621,12 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Iono& gp
                             data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
+    if (Rinex_Printer::overwrite_header(out, navMixfilename, data))
         {
-            out << data[i] << '\n';
+            std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
         }
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
-    std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
 
@@ -4753,17 +4642,14 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Galileo_Iono& gal
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -4823,23 +4709,12 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Galileo_Iono& gal
                             data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
+    if (Rinex_Printer::overwrite_header(out, navMixfilename, data))
         {
-            out << data[i] << '\n';
+            std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
         }
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
-    std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
 
@@ -4848,17 +4723,14 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Beidou_Dnav_Utc_M
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -4916,23 +4788,12 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Beidou_Dnav_Utc_M
                             data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
+    if (Rinex_Printer::overwrite_header(out, navfilename, data))
         {
-            out << data[i] << '\n';
+            std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
         }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
-    std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
 
@@ -6790,6 +6651,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& gps
             out << line << '\n';
         }
 
+    // -------- Reserved for LEAP SECONDS, written by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -7129,6 +6993,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_CNAV_Ephemeris
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Reserved for LEAP SECONDS, written by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -7487,6 +7354,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Galileo_Ephemeris&
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Reserved for LEAP SECONDS, written by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -7763,6 +7633,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& eph
 
     // -------- SYS /PHASE SHIFTS
 
+    // -------- Reserved for LEAP SECONDS, written by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -8022,6 +7895,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_CNAV_Ephemeris
 
     // -------- SYS /PHASE SHIFTS
 
+    // -------- Reserved for LEAP SECONDS, written by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -8308,6 +8184,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& eph
 
     // -------- SYS /PHASE SHIFTS
 
+    // -------- Reserved for LEAP SECONDS, written by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -8697,6 +8576,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& gps
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Reserved for LEAP SECONDS, written by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -9056,6 +8938,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_CNAV_Ephemeris
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Reserved for LEAP SECONDS, written by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -9361,6 +9246,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Galileo_Ephemeris&
 
     // -------- SYS /PHASE SHIFTS
 
+    // -------- Reserved for LEAP SECONDS, written by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -9693,6 +9581,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& gps
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Reserved for LEAP SECONDS, written by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -9936,6 +9827,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Beidou_Dnav_Epheme
 
     // -------- SYS /PHASE SHIFTS
 
+    // -------- Reserved for LEAP SECONDS, written by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -9965,10 +9859,8 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Gps_Utc_Model& ut
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -10018,22 +9910,9 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Gps_Utc_Model& ut
                                 }
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
-    out.seekp(0, std::ios_base::end);
+    Rinex_Printer::overwrite_header(out, obsfilename, data);
 }
 
 
@@ -10048,10 +9927,8 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Gps_CNAV_Utc_Mode
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -10076,22 +9953,9 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Gps_CNAV_Utc_Mode
                             data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
-    out.seekp(0, std::ios_base::end);
+    Rinex_Printer::overwrite_header(out, obsfilename, data);
 }
 
 
@@ -10106,10 +9970,8 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Galileo_Utc_Model
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -10135,22 +9997,9 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Galileo_Utc_Model
                             data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
-    out.seekp(0, std::ios_base::end);
+    Rinex_Printer::overwrite_header(out, obsfilename, data);
 }
 
 
@@ -10165,10 +10014,8 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Beidou_Dnav_Utc_M
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
             if (!no_more_finds)
                 {
                     line_aux.clear();
@@ -10194,22 +10041,79 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Beidou_Dnav_Utc_M
                             data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
+    Rinex_Printer::overwrite_header(out, obsfilename, data);
+}
+
+
+bool Rinex_Printer::overwrite_header(std::fstream& out, const std::string& filename, std::vector<std::string>& header) const
+{
+    // header was read up to END OF HEADER, so this is the size of the old one
+    const int64_t old_header_size = out.tellg();
     out.close();
-    out.open(obsfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
+
+    bool written = false;
+    if (old_header_size <= 0 || header.empty() || header.back().find("END OF HEADER", 59) == std::string::npos)
         {
-            out << data[i] << '\n';
+            LOG(ERROR) << "END OF HEADER not found in " << filename << ", the header is not updated";
         }
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
+    else
+        {
+            const std::string reserved_line = Rinex_Printer::reserved_header_line();
+            header.erase(std::remove(header.begin(), header.end(), reserved_line), header.end());
+            int64_t header_size = 0;
+            for (const auto& line : header)
+                {
+                    header_size += static_cast<int64_t>(line.size()) + 1;
+                }
+            const auto reserved_line_size = static_cast<int64_t>(reserved_line.size()) + 1;
+
+            if (header_size <= old_header_size && (old_header_size - header_size) % reserved_line_size == 0)
+                {
+                    // Fill the space left with reserved lines and overwrite the header in place
+                    header.insert(header.end() - 1, (old_header_size - header_size) / reserved_line_size, reserved_line);
+                    out.open(filename, std::ios::out | std::ios::in);
+                    out.seekp(0);
+                    for (const auto& line : header)
+                        {
+                            out << line << '\n';
+                        }
+                    written = true;
+                }
+            else
+                {
+                    // The header grows: the data records have to be moved
+                    std::ifstream in(filename, std::ios::binary);
+                    in.seekg(old_header_size);
+                    if (!in)
+                        {
+                            LOG(ERROR) << "Cannot read the data records of " << filename << ", the header is not updated";
+                        }
+                    else
+                        {
+                            const std::string records((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+                            in.close();
+                            out.open(filename, std::ios::out | std::ios::trunc);
+                            for (const auto& line : header)
+                                {
+                                    out << line << '\n';
+                                }
+                            out << records;
+                            written = true;
+                        }
+                }
+            out.close();
+        }
+    out.open(filename, std::ios::out | std::ios::in | std::ios::app);
     out.seekp(0, std::ios_base::end);
+    return written;
+}
+
+
+std::string Rinex_Printer::reserved_header_line() const
+{
+    return std::string(60, ' ') + Rinex_Printer::leftJustify("COMMENT", 20);
 }
 
 
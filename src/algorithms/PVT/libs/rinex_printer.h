@@ -38,6 +38,9 @@
 #ifndef GNSS_SDR_RINEX_PRINTER_H
 #define GNSS_SDR_RINEX_PRINTER_H
 
+#define FRIEND_TEST(test_case_name, test_name) \
+    friend class test_case_name##_##test_name##_Test
+
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <cstdint>        // for int32_t
 #include <cstdlib>        // for strtol, strtod
@@ -786,6 +789,24 @@ private:
     void update_obs_header(std::fstream& out,
         const Beidou_Dnav_Utc_Model& utc_model) const;
 
+    /*
+     * Writes the updated header lines (up to END OF HEADER) read from out.
+     * If they fit in the space of the old header, padded with reserved
+     * lines, they are overwritten in place and the data records are not
+     * touched. Otherwise, the whole file is rewritten. If END OF HEADER was
+     * not found, the file is left as it was. Returns true if the header was
+     * written.
+     */
+    bool overwrite_header(std::fstream& out,
+        const std::string& filename,
+        std::vector<std::string>& header) const;
+
+    /*
+     * Blank COMMENT line written before END OF HEADER to leave room for
+     * the records added later by update_obs_header()
+     */
+    std::string reserved_header_line() const;
+
     /*
      * Generation of RINEX signal strength indicators
      */
@@ -1022,6 +1043,12 @@ private:
     bool d_rinex_header_updated;
     bool d_rinex_header_written;
     bool d_pre_2009_file;
+
+    // Provide access to inner functions to Gtest
+    FRIEND_TEST(RinexPrinterTest, HeaderOverwrittenInPlace);
+    FRIEND_TEST(RinexPrinterTest, HeaderPaddedWithReservedLines);
+    FRIEND_TEST(RinexPrinterTest, HeaderGrowsRewritesFile);
+    FRIEND_TEST(RinexPrinterTest, HeaderWithoutEndKeepsFile);
 };
 
 
@@ -8,7 +8,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -24,7 +24,6 @@
 #include "Galileo_FNAV.h"
 #include "Galileo_INAV.h"
 #include <boost/algorithm/string.hpp>  // for to_upper_copy
-#include <boost/crc.hpp>
 #include <boost/date_time/gregorian/gregorian.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/exception/diagnostic_information.hpp>
@@ -122,49 +121,18 @@ bool Rtcm::is_server_running() const
 //
 // *****************************************************************************************************
 
-std::string Rtcm::add_CRC(const std::string& message_without_crc) const
-{
-    // ******  Computes Qualcomm CRC-24Q ******
-    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> CRC_RTCM;
-    // 1) Converts the string to a vector of uint8_t:
-    boost::dynamic_bitset<uint8_t> frame_bits(message_without_crc);
-    std::vector<uint8_t> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    // 2) Computes CRC
-    CRC_RTCM.process_bytes(bytes.data(), bytes.size());
-    const auto crc_frame = std::bitset<24>(CRC_RTCM.checksum());
-
-    // 3) Builds the complete message
-    const std::string complete_message = message_without_crc + crc_frame.to_string();
-    return bin_to_binary_data(complete_message);
-}
-
-
 bool Rtcm::check_CRC(const std::string& message) const
 {
-    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> CRC_RTCM_CHECK;
-    // Convert message to binary
-    const std::string message_bin = Rtcm::binary_data_to_bin(message);
-    // Check CRC
-    const std::string crc = message_bin.substr(message_bin.length() - 24, 24);
-    const auto read_crc = std::bitset<24>(crc);
-    const std::string msg_without_crc = message_bin.substr(0, message_bin.length() - 24);
-
-    boost::dynamic_bitset<uint8_t> frame_bits(msg_without_crc);
-    std::vector<uint8_t> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    CRC_RTCM_CHECK.process_bytes(bytes.data(), bytes.size());
-    const auto computed_crc = std::bitset<24>(CRC_RTCM_CHECK.checksum());
-    if (read_crc == computed_crc)
+    if (message.length() < 3)
         {
-            return true;
+            return false;
         }
-
-    return false;
+    const auto* bytes = reinterpret_cast<const uint8_t*>(message.data());
+    const size_t length = message.length() - 3;
+    const uint32_t read_crc = (static_cast<uint32_t>(bytes[length]) << 16) |
+                              (static_cast<uint32_t>(bytes[length + 1]) << 8) |
+                              static_cast<uint32_t>(bytes[length + 2]);
+    return read_crc == rtcm_crc24q(bytes, length);
 }
 
 
@@ -341,6 +309,18 @@ static inline uint64_t glo_sgn(double val)
 }
 
 
+// Reads a GLONASS sign-magnitude data field, with the same sign convention as Rtcm::bin_to_sint
+static inline int32_t glo_sint(const Rtcm_Bit_Reader& bits, uint32_t pos, uint32_t num_bits)
+{
+    const auto magnitude = static_cast<int32_t>(bits.get_uint(pos + 1, num_bits - 1));
+    if (bits.get_uint(pos, 1) != 0)
+        {
+            return magnitude;
+        }
+    return -magnitude;
+}
+
+
 double Rtcm::bin_to_double(const std::string& s) const
 {
     double reading;
@@ -396,19 +376,21 @@ int64_t Rtcm::hex_to_int(const std::string& s) const
 }
 
 
-std::string Rtcm::build_message(const std::string& data) const
+std::string Rtcm::build_message(const Rtcm_Bit_Writer& data) const
 {
-    const uint32_t msg_length_bits = data.length();
-    const uint32_t msg_length_bytes = std::ceil(static_cast<float>(msg_length_bits) / 8.0);
-    const auto message_length = std::bitset<10>(msg_length_bytes);
-    const uint32_t zeros_to_fill = 8 * msg_length_bytes - msg_length_bits;
-    const std::string b(zeros_to_fill, '0');
-    const std::string msg_content = data + b;
-    const std::string msg_without_crc = preamble.to_string() +
-                                        reserved_field.to_string() +
-                                        message_length.to_string() +
-                                        msg_content;
-    return Rtcm::add_CRC(msg_without_crc);
+    // The last byte of data is already zero-padded
+    const std::vector<uint8_t>& msg_content = data.bytes();
+    const auto msg_length_bytes = static_cast<uint32_t>(msg_content.size());
+    std::string msg(msg_length_bytes + 6, '\0');
+    msg[0] = static_cast<char>(preamble.to_ulong());
+    msg[1] = static_cast<char>((reserved_field.to_ulong() << 2) | ((msg_length_bytes >> 8) & 0x03U));
+    msg[2] = static_cast<char>(msg_length_bytes & 0xFFU);
+    std::copy(msg_content.cbegin(), msg_content.cend(), msg.begin() + 3);
+    const uint32_t crc = rtcm_crc24q(reinterpret_cast<const uint8_t*>(msg.data()), msg_length_bytes + 3);
+    msg[msg_length_bytes + 3] = static_cast<char>((crc >> 16) & 0xFFU);
+    msg[msg_length_bytes + 4] = static_cast<char>((crc >> 8) & 0xFFU);
+    msg[msg_length_bytes + 5] = static_cast<char>(crc & 0xFFU);
+    return msg;
 }
 
 
@@ -425,8 +407,8 @@ std::string Rtcm::build_message(const std::string& data) const
 //
 // ********************************************************
 
-std::bitset<64> Rtcm::get_MT1001_4_header(uint32_t msg_number, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables,
-    uint32_t ref_id, uint32_t smooth_int, bool sync_flag, bool divergence_free)
+void Rtcm::get_MT1001_4_header(uint32_t msg_number, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables,
+    uint32_t ref_id, uint32_t smooth_int, bool sync_flag, bool divergence_free, Rtcm_Bit_Writer& data)
 {
     const uint32_t reference_station_id = ref_id;  // Max: 4095
     const std::map<int32_t, Gnss_Synchro>& observables_ = observables;
@@ -441,20 +423,17 @@ std::bitset<64> Rtcm::get_MT1001_4_header(uint32_t msg_number, double obs_time,
     Rtcm::set_DF007(divergence_free_smoothing_indicator);
     Rtcm::set_DF008(smoothing_interval);
 
-    const std::string header = DF002.to_string() +
-                               DF003.to_string() +
-                               DF004.to_string() +
-                               DF005.to_string() +
-                               DF006.to_string() +
-                               DF007.to_string() +
-                               DF008.to_string();
-
-    std::bitset<64> header_msg(header);
-    return header_msg;
+    data << DF002
+         << DF003
+         << DF004
+         << DF005
+         << DF006
+         << DF007
+         << DF008;
 }
 
 
-std::bitset<58> Rtcm::get_MT1001_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
+void Rtcm::get_MT1001_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro, Rtcm_Bit_Writer& data)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF009(gnss_synchro);
@@ -463,14 +442,11 @@ std::bitset<58> Rtcm::get_MT1001_sat_content(const Gps_Ephemeris& eph, double ob
     Rtcm::set_DF012(gnss_synchro);
     Rtcm::set_DF013(eph, obs_time, gnss_synchro);
 
-    const std::string content = DF009.to_string() +
-                                DF010.to_string() +
-                                DF011.to_string() +
-                                DF012.to_string() +
-                                DF013.to_string();
-
-    std::bitset<58> content_msg(content);
-    return content_msg;
+    data << DF009
+         << DF010
+         << DF011
+         << DF012
+         << DF013;
 }
 
 
@@ -497,15 +473,14 @@ std::string Rtcm::print_MT1001(const Gps_Ephemeris& gps_eph, double obs_time, co
                 }
         }
 
-    const std::bitset<64> header = Rtcm::get_MT1001_4_header(1001, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MT1001_4_header(1001, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free, data);
 
     for (observables_iter = observablesL1.cbegin();
         observables_iter != observablesL1.cend();
         observables_iter++)
         {
-            const std::bitset<58> content = Rtcm::get_MT1001_sat_content(gps_eph, obs_time, observables_iter->second);
-            data += content.to_string();
+            Rtcm::get_MT1001_sat_content(gps_eph, obs_time, observables_iter->second, data);
         }
 
     std::string msg = build_message(data);
@@ -546,15 +521,14 @@ std::string Rtcm::print_MT1002(const Gps_Ephemeris& gps_eph, double obs_time, co
                 }
         }
 
-    const std::bitset<64> header = Rtcm::get_MT1001_4_header(1002, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MT1001_4_header(1002, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free, data);
 
     for (observables_iter = observablesL1.cbegin();
         observables_iter != observablesL1.cend();
         observables_iter++)
         {
-            const std::bitset<74> content = Rtcm::get_MT1002_sat_content(gps_eph, obs_time, observables_iter->second);
-            data += content.to_string();
+            Rtcm::get_MT1002_sat_content(gps_eph, obs_time, observables_iter->second, data);
         }
 
     const std::string msg = build_message(data);
@@ -566,7 +540,7 @@ std::string Rtcm::print_MT1002(const Gps_Ephemeris& gps_eph, double obs_time, co
 }
 
 
-std::bitset<74> Rtcm::get_MT1002_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
+void Rtcm::get_MT1002_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro, Rtcm_Bit_Writer& data)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF009(gnss_synchro);
@@ -575,16 +549,13 @@ std::bitset<74> Rtcm::get_MT1002_sat_content(const Gps_Ephemeris& eph, double ob
     Rtcm::set_DF012(gnss_synchro);
     Rtcm::set_DF013(eph, obs_time, gnss_synchro);
 
-    const std::string content = DF009.to_string() +
-                                DF010.to_string() +
-                                DF011.to_string() +
-                                DF012.to_string() +
-                                DF013.to_string() +
-                                DF014.to_string() +
-                                DF015.to_string();
-
-    std::bitset<74> content_msg(content);
-    return content_msg;
+    data << DF009
+         << DF010
+         << DF011
+         << DF012
+         << DF013
+         << DF014
+         << DF015;
 }
 
 
@@ -649,15 +620,14 @@ std::string Rtcm::print_MT1003(const Gps_Ephemeris& ephL1, const Gps_CNAV_Epheme
                 }
         }
 
-    const std::bitset<64> header = Rtcm::get_MT1001_4_header(1003, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MT1001_4_header(1003, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free, data);
 
     for (common_observables_iter = common_observables.cbegin();
         common_observables_iter != common_observables.cend();
         common_observables_iter++)
         {
-            std::bitset<101> content = Rtcm::get_MT1003_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
-            data += content.to_string();
+            Rtcm::get_MT1003_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second, data);
         }
 
     std::string msg = build_message(data);
@@ -669,7 +639,7 @@ std::string Rtcm::print_MT1003(const Gps_Ephemeris& ephL1, const Gps_CNAV_Epheme
 }
 
 
-std::bitset<101> Rtcm::get_MT1003_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
+void Rtcm::get_MT1003_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2, Rtcm_Bit_Writer& data)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF009(gnss_synchroL1);
@@ -682,18 +652,15 @@ std::bitset<101> Rtcm::get_MT1003_sat_content(const Gps_Ephemeris& ephL1, const
     Rtcm::set_DF018(gnss_synchroL1, gnss_synchroL2);
     Rtcm::set_DF019(ephL2, obs_time, gnss_synchroL2);
 
-    const std::string content = DF009.to_string() +
-                                DF010.to_string() +
-                                DF011.to_string() +
-                                DF012.to_string() +
-                                DF013.to_string() +
-                                DF016_.to_string() +
-                                DF017.to_string() +
-                                DF018.to_string() +
-                                DF019.to_string();
-
-    std::bitset<101> content_msg(content);
-    return content_msg;
+    data << DF009
+         << DF010
+         << DF011
+         << DF012
+         << DF013
+         << DF016_
+         << DF017
+         << DF018
+         << DF019;
 }
 
 
@@ -758,15 +725,14 @@ std::string Rtcm::print_MT1004(const Gps_Ephemeris& ephL1, const Gps_CNAV_Epheme
                 }
         }
 
-    const std::bitset<64> header = Rtcm::get_MT1001_4_header(1004, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MT1001_4_header(1004, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free, data);
 
     for (common_observables_iter = common_observables.cbegin();
         common_observables_iter != common_observables.cend();
         common_observables_iter++)
         {
-            std::bitset<125> content = Rtcm::get_MT1004_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
-            data += content.to_string();
+            Rtcm::get_MT1004_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second, data);
         }
 
     std::string msg = build_message(data);
@@ -778,7 +744,7 @@ std::string Rtcm::print_MT1004(const Gps_Ephemeris& ephL1, const Gps_CNAV_Epheme
 }
 
 
-std::bitset<125> Rtcm::get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
+void Rtcm::get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2, Rtcm_Bit_Writer& data)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF009(gnss_synchroL1);
@@ -794,21 +760,18 @@ std::bitset<125> Rtcm::get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const
     Rtcm::set_DF019(ephL2, obs_time, gnss_synchroL2);
     Rtcm::set_DF020(gnss_synchroL2);
 
-    const std::string content = DF009.to_string() +
-                                DF010.to_string() +
-                                DF011.to_string() +
-                                DF012.to_string() +
-                                DF013.to_string() +
-                                DF014.to_string() +
-                                DF015.to_string() +
-                                DF016_.to_string() +
-                                DF017.to_string() +
-                                DF018.to_string() +
-                                DF019.to_string() +
-                                DF020.to_string();
-
-    std::bitset<125> content_msg(content);
-    return content_msg;
+    data << DF009
+         << DF010
+         << DF011
+         << DF012
+         << DF013
+         << DF014
+         << DF015
+         << DF016_
+         << DF017
+         << DF018
+         << DF019
+         << DF020;
 }
 
 
@@ -828,7 +791,7 @@ std::bitset<125> Rtcm::get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const
    Expected output: D3 00 13 3E D7 D3 02 02 98 0E DE EF 34 B4 BD 62
                     AC 09 41 98 6F 33 36 0B 98
  */
-std::bitset<152> Rtcm::get_MT1005_test()
+void Rtcm::get_MT1005_test(Rtcm_Bit_Writer& data)
 {
     const uint32_t mt1005 = 1005;
     const uint32_t reference_station_id = 2003;  // Max: 4095
@@ -852,22 +815,19 @@ std::bitset<152> Rtcm::get_MT1005_test()
     DF364 = std::bitset<2>("00");  // Quarter Cycle Indicator
     Rtcm::set_DF027(ECEF_Z);
 
-    const std::string message = DF002.to_string() +
-                                DF003.to_string() +
-                                DF021.to_string() +
-                                DF022.to_string() +
-                                DF023.to_string() +
-                                DF024.to_string() +
-                                DF141.to_string() +
-                                DF025.to_string() +
-                                DF142.to_string() +
-                                DF001_.to_string() +
-                                DF026.to_string() +
-                                DF364.to_string() +
-                                DF027.to_string();
-
-    std::bitset<152> test_msg(message);
-    return test_msg;
+    data << DF002
+         << DF003
+         << DF021
+         << DF022
+         << DF023
+         << DF024
+         << DF141
+         << DF025
+         << DF142
+         << DF001_
+         << DF026
+         << DF364
+         << DF027;
 }
 
 
@@ -890,19 +850,20 @@ std::string Rtcm::print_MT1005(uint32_t ref_id, double ecef_x, double ecef_y, do
     DF364 = std::bitset<2>(quarter_cycle_indicator);
     Rtcm::set_DF027(ecef_z);
 
-    const std::string data = DF002.to_string() +
-                             DF003.to_string() +
-                             DF021.to_string() +
-                             DF022.to_string() +
-                             DF023.to_string() +
-                             DF024.to_string() +
-                             DF141.to_string() +
-                             DF025.to_string() +
-                             DF142.to_string() +
-                             DF001_.to_string() +
-                             DF026.to_string() +
-                             DF364.to_string() +
-                             DF027.to_string();
+    Rtcm_Bit_Writer data;
+    data << DF002
+         << DF003
+         << DF021
+         << DF022
+         << DF023
+         << DF024
+         << DF141
+         << DF025
+         << DF142
+         << DF001_
+         << DF026
+         << DF364
+         << DF027;
 
     std::string msg = build_message(data);
     if (server_is_running)
@@ -916,7 +877,7 @@ std::string Rtcm::print_MT1005(uint32_t ref_id, double ecef_x, double ecef_y, do
 int32_t Rtcm::read_MT1005(const std::string& message, uint32_t& ref_id, double& ecef_x, double& ecef_y, double& ecef_z, bool& gps, bool& glonass, bool& galileo)
 {
     // Convert message to binary
-    const std::string message_bin = Rtcm::binary_data_to_bin(message);
+    const Rtcm_Bit_Reader message_bits(message);
 
     if (!Rtcm::check_CRC(message))
         {
@@ -929,7 +890,7 @@ int32_t Rtcm::read_MT1005(const std::string& message, uint32_t& ref_id, double&
     const uint32_t reserved_field_length = 6;
     uint32_t index = preamble_length + reserved_field_length;
 
-    uint32_t read_message_length = Rtcm::bin_to_uint(message_bin.substr(index, 10));
+    uint32_t read_message_length = message_bits.get_uint(index, 10);
     index += 10;
     if (read_message_length != 19)
         {
@@ -939,7 +900,7 @@ int32_t Rtcm::read_MT1005(const std::string& message, uint32_t& ref_id, double&
 
     const uint32_t msg_number = 1005;
     Rtcm::set_DF002(msg_number);
-    std::bitset<12> read_msg_number(message_bin.substr(index, 12));
+    const auto read_msg_number = std::bitset<12>(message_bits.get_uint(index, 12));
     index += 12;
 
     if (DF002 != read_msg_number)
@@ -948,32 +909,32 @@ int32_t Rtcm::read_MT1005(const std::string& message, uint32_t& ref_id, double&
             return 1;
         }
 
-    ref_id = Rtcm::bin_to_uint(message_bin.substr(index, 12));
+    ref_id = message_bits.get_uint(index, 12);
     index += 12;
 
     index += 6;  // ITRF year
-    gps = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    gps = static_cast<bool>(message_bits.get_uint(index, 1));
     index += 1;
 
-    glonass = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    glonass = static_cast<bool>(message_bits.get_uint(index, 1));
     index += 1;
 
-    galileo = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    galileo = static_cast<bool>(message_bits.get_uint(index, 1));
     index += 1;
 
     index += 1;  // ref_station_indicator
 
-    ecef_x = Rtcm::bin_to_double(message_bin.substr(index, 38)) / 10000.0;
+    ecef_x = static_cast<double>(message_bits.get_signed_bits(index, 38)) / 10000.0;
     index += 38;
 
     index += 1;  // single rx oscillator
     index += 1;  // reserved
 
-    ecef_y = Rtcm::bin_to_double(message_bin.substr(index, 38)) / 10000.0;
+    ecef_y = static_cast<double>(message_bits.get_signed_bits(index, 38)) / 10000.0;
     index += 38;
 
     index += 2;  // quarter cycle indicator
-    ecef_z = Rtcm::bin_to_double(message_bin.substr(index, 38)) / 10000.0;
+    ecef_z = static_cast<double>(message_bits.get_signed_bits(index, 38)) / 10000.0;
 
     return 0;
 }
@@ -981,8 +942,9 @@ int32_t Rtcm::read_MT1005(const std::string& message, uint32_t& ref_id, double&
 
 std::string Rtcm::print_MT1005_test()
 {
-    std::bitset<152> mt1005 = get_MT1005_test();
-    return Rtcm::build_message(mt1005.to_string());
+    Rtcm_Bit_Writer mt1005;
+    get_MT1005_test(mt1005);
+    return Rtcm::build_message(mt1005);
 }
 
 // ********************************************************
@@ -1011,20 +973,21 @@ std::string Rtcm::print_MT1006(uint32_t ref_id, double ecef_x, double ecef_y, do
     Rtcm::set_DF027(ecef_z);
     Rtcm::set_DF028(height);
 
-    const std::string data = DF002.to_string() +
-                             DF003.to_string() +
-                             DF021.to_string() +
-                             DF022.to_string() +
-                             DF023.to_string() +
-                             DF024.to_string() +
-                             DF141.to_string() +
-                             DF025.to_string() +
-                             DF142.to_string() +
-                             DF001_.to_string() +
-                             DF026.to_string() +
-                             DF364.to_string() +
-                             DF027.to_string() +
-                             DF028.to_string();
+    Rtcm_Bit_Writer data;
+    data << DF002
+         << DF003
+         << DF021
+         << DF022
+         << DF023
+         << DF024
+         << DF141
+         << DF025
+         << DF142
+         << DF001_
+         << DF026
+         << DF364
+         << DF027
+         << DF028;
 
     std::string msg = build_message(data);
     if (server_is_running)
@@ -1054,13 +1017,6 @@ std::string Rtcm::print_MT1008(uint32_t ref_id, const std::string& antenna_descr
         }
     DF029 = std::bitset<8>(len);
 
-    std::string DF030_str_;
-    for (char c : ant_descriptor)
-        {
-            const auto character = std::bitset<8>(c);
-            DF030_str_ += character.to_string();
-        }
-
     Rtcm::set_DF031(antenna_setup_id);
 
     std::string ant_sn(antenna_serial_number);
@@ -1072,21 +1028,21 @@ std::string Rtcm::print_MT1008(uint32_t ref_id, const std::string& antenna_descr
         }
     DF032 = std::bitset<8>(len2);
 
-    std::string DF033_str_;
+    Rtcm_Bit_Writer data;
+    data << DF002_
+         << DF003
+         << DF029;
+    for (char c : ant_descriptor)
+        {
+            data.put(static_cast<uint8_t>(c), 8);  // DF030
+        }
+    data << DF031
+         << DF032;
     for (char c : ant_sn)
         {
-            const auto character = std::bitset<8>(c);
-            DF033_str_ += character.to_string();
+            data.put(static_cast<uint8_t>(c), 8);  // DF033
         }
 
-    const std::string data = DF002_.to_string() +
-                             DF003.to_string() +
-                             DF029.to_string() +
-                             DF030_str_ +
-                             DF031.to_string() +
-                             DF032.to_string() +
-                             DF033_str_;
-
     std::string msg = build_message(data);
     if (server_is_running)
         {
@@ -1101,8 +1057,8 @@ std::string Rtcm::print_MT1008(uint32_t ref_id, const std::string& antenna_descr
 //   MESSAGE TYPE 1009 (GLONASS L1 Basic RTK Observables)
 //
 // ********************************************************
-std::bitset<61> Rtcm::get_MT1009_12_header(uint32_t msg_number, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables,
-    uint32_t ref_id, uint32_t smooth_int, bool sync_flag, bool divergence_free)
+void Rtcm::get_MT1009_12_header(uint32_t msg_number, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables,
+    uint32_t ref_id, uint32_t smooth_int, bool sync_flag, bool divergence_free, Rtcm_Bit_Writer& data)
 {
     const uint32_t reference_station_id = ref_id;  // Max: 4095
     const std::map<int32_t, Gnss_Synchro>& observables_ = observables;
@@ -1117,20 +1073,17 @@ std::bitset<61> Rtcm::get_MT1009_12_header(uint32_t msg_number, double obs_time,
     Rtcm::set_DF036(divergence_free_smoothing_indicator);
     Rtcm::set_DF037(smoothing_interval);
 
-    const std::string header = DF002.to_string() +
-                               DF003.to_string() +
-                               DF034.to_string() +
-                               DF005.to_string() +
-                               DF035.to_string() +
-                               DF036.to_string() +
-                               DF037.to_string();
-
-    std::bitset<61> header_msg(header);
-    return header_msg;
+    data << DF002
+         << DF003
+         << DF034
+         << DF005
+         << DF035
+         << DF036
+         << DF037;
 }
 
 
-std::bitset<64> Rtcm::get_MT1009_sat_content(const Glonass_Gnav_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
+void Rtcm::get_MT1009_sat_content(const Glonass_Gnav_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro, Rtcm_Bit_Writer& data)
 {
     const bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF038(gnss_synchro);
@@ -1140,15 +1093,12 @@ std::bitset<64> Rtcm::get_MT1009_sat_content(const Glonass_Gnav_Ephemeris& eph,
     Rtcm::set_DF042(gnss_synchro);
     Rtcm::set_DF043(eph, obs_time, gnss_synchro);
 
-    const std::string content = DF038.to_string() +
-                                DF039.to_string() +
-                                DF040.to_string() +
-                                DF041.to_string() +
-                                DF042.to_string() +
-                                DF043.to_string();
-
-    std::bitset<64> content_msg(content);
-    return content_msg;
+    data << DF038
+         << DF039
+         << DF040
+         << DF041
+         << DF042
+         << DF043;
 }
 
 
@@ -1175,15 +1125,14 @@ std::string Rtcm::print_MT1009(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, d
                 }
         }
 
-    const std::bitset<61> header = Rtcm::get_MT1009_12_header(1009, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MT1009_12_header(1009, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free, data);
 
     for (observables_iter = observablesL1.begin();
         observables_iter != observablesL1.end();
         observables_iter++)
         {
-            const std::bitset<64> content = Rtcm::get_MT1009_sat_content(glonass_gnav_eph, obs_time, observables_iter->second);
-            data += content.to_string();
+            Rtcm::get_MT1009_sat_content(glonass_gnav_eph, obs_time, observables_iter->second, data);
         }
 
     std::string msg = build_message(data);
@@ -1224,15 +1173,14 @@ std::string Rtcm::print_MT1010(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, d
                 }
         }
 
-    const std::bitset<61> header = Rtcm::get_MT1009_12_header(1010, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MT1009_12_header(1010, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free, data);
 
     for (observables_iter = observablesL1.begin();
         observables_iter != observablesL1.end();
         observables_iter++)
         {
-            const std::bitset<79> content = Rtcm::get_MT1010_sat_content(glonass_gnav_eph, obs_time, observables_iter->second);
-            data += content.to_string();
+            Rtcm::get_MT1010_sat_content(glonass_gnav_eph, obs_time, observables_iter->second, data);
         }
 
     std::string msg = build_message(data);
@@ -1244,7 +1192,7 @@ std::string Rtcm::print_MT1010(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, d
 }
 
 
-std::bitset<79> Rtcm::get_MT1010_sat_content(const Glonass_Gnav_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
+void Rtcm::get_MT1010_sat_content(const Glonass_Gnav_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro, Rtcm_Bit_Writer& data)
 {
     const bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF038(gnss_synchro);
@@ -1256,17 +1204,14 @@ std::bitset<79> Rtcm::get_MT1010_sat_content(const Glonass_Gnav_Ephemeris& eph,
     Rtcm::set_DF044(gnss_synchro);
     Rtcm::set_DF045(gnss_synchro);
 
-    const std::string content = DF038.to_string() +
-                                DF039.to_string() +
-                                DF040.to_string() +
-                                DF041.to_string() +
-                                DF042.to_string() +
-                                DF043.to_string() +
-                                DF044.to_string() +
-                                DF045.to_string();
-
-    std::bitset<79> content_msg(content);
-    return content_msg;
+    data << DF038
+         << DF039
+         << DF040
+         << DF041
+         << DF042
+         << DF043
+         << DF044
+         << DF045;
 }
 
 
@@ -1331,15 +1276,14 @@ std::string Rtcm::print_MT1011(const Glonass_Gnav_Ephemeris& ephL1, const Glonas
                 }
         }
 
-    const std::bitset<61> header = Rtcm::get_MT1009_12_header(1011, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MT1009_12_header(1011, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free, data);
 
     for (common_observables_iter = common_observables.begin();
         common_observables_iter != common_observables.end();
         common_observables_iter++)
         {
-            const std::bitset<107> content = Rtcm::get_MT1011_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
-            data += content.to_string();
+            Rtcm::get_MT1011_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second, data);
         }
 
     std::string msg = build_message(data);
@@ -1351,7 +1295,7 @@ std::string Rtcm::print_MT1011(const Glonass_Gnav_Ephemeris& ephL1, const Glonas
 }
 
 
-std::bitset<107> Rtcm::get_MT1011_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
+void Rtcm::get_MT1011_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2, Rtcm_Bit_Writer& data)
 {
     const bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF038(gnss_synchroL1);
@@ -1365,19 +1309,16 @@ std::bitset<107> Rtcm::get_MT1011_sat_content(const Glonass_Gnav_Ephemeris& ephL
     Rtcm::set_DF048(gnss_synchroL1, gnss_synchroL2);
     Rtcm::set_DF049(ephL2, obs_time, gnss_synchroL2);
 
-    const std::string content = DF038.to_string() +
-                                DF039.to_string() +
-                                DF040.to_string() +
-                                DF041.to_string() +
-                                DF042.to_string() +
-                                DF043.to_string() +
-                                DF046_.to_string() +
-                                DF047.to_string() +
-                                DF048.to_string() +
-                                DF049.to_string();
-
-    std::bitset<107> content_msg(content);
-    return content_msg;
+    data << DF038
+         << DF039
+         << DF040
+         << DF041
+         << DF042
+         << DF043
+         << DF046_
+         << DF047
+         << DF048
+         << DF049;
 }
 
 
@@ -1442,15 +1383,14 @@ std::string Rtcm::print_MT1012(const Glonass_Gnav_Ephemeris& ephL1, const Glonas
                 }
         }
 
-    const std::bitset<61> header = Rtcm::get_MT1009_12_header(1012, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MT1009_12_header(1012, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free, data);
 
     for (common_observables_iter = common_observables.begin();
         common_observables_iter != common_observables.end();
         common_observables_iter++)
         {
-            const std::bitset<130> content = Rtcm::get_MT1012_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
-            data += content.to_string();
+            Rtcm::get_MT1012_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second, data);
         }
 
     std::string msg = build_message(data);
@@ -1462,7 +1402,7 @@ std::string Rtcm::print_MT1012(const Glonass_Gnav_Ephemeris& ephL1, const Glonas
 }
 
 
-std::bitset<130> Rtcm::get_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
+void Rtcm::get_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2, Rtcm_Bit_Writer& data)
 {
     const bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF038(gnss_synchroL1);
@@ -1479,22 +1419,19 @@ std::bitset<130> Rtcm::get_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL
     Rtcm::set_DF049(ephL2, obs_time, gnss_synchroL2);
     Rtcm::set_DF050(gnss_synchroL2);
 
-    const std::string content = DF038.to_string() +
-                                DF039.to_string() +
-                                DF040.to_string() +
-                                DF041.to_string() +
-                                DF042.to_string() +
-                                DF043.to_string() +
-                                DF044.to_string() +
-                                DF045.to_string() +
-                                DF046_.to_string() +
-                                DF047.to_string() +
-                                DF048.to_string() +
-                                DF049.to_string() +
-                                DF050.to_string();
-
-    std::bitset<130> content_msg(content);
-    return content_msg;
+    data << DF038
+         << DF039
+         << DF040
+         << DF041
+         << DF042
+         << DF043
+         << DF044
+         << DF045
+         << DF046_
+         << DF047
+         << DF048
+         << DF049
+         << DF050;
 }
 
 
@@ -1540,41 +1477,42 @@ std::string Rtcm::print_MT1019(const Gps_Ephemeris& gps_eph)
     Rtcm::set_DF103(gps_eph);
     Rtcm::set_DF137(gps_eph);
 
-    const std::string data = DF002.to_string() +
-                             DF009.to_string() +
-                             DF076.to_string() +
-                             DF077.to_string() +
-                             DF078.to_string() +
-                             DF079.to_string() +
-                             DF071.to_string() +
-                             DF081.to_string() +
-                             DF082.to_string() +
-                             DF083.to_string() +
-                             DF084.to_string() +
-                             DF085.to_string() +
-                             DF086.to_string() +
-                             DF087.to_string() +
-                             DF088.to_string() +
-                             DF089.to_string() +
-                             DF090.to_string() +
-                             DF091.to_string() +
-                             DF092.to_string() +
-                             DF093.to_string() +
-                             DF094.to_string() +
-                             DF095.to_string() +
-                             DF096.to_string() +
-                             DF097.to_string() +
-                             DF098.to_string() +
-                             DF099.to_string() +
-                             DF100.to_string() +
-                             DF101.to_string() +
-                             DF102.to_string() +
-                             DF103.to_string() +
-                             DF137.to_string();
-
-    if (data.length() != 488)
-        {
-            LOG(WARNING) << "Bad-formatted RTCM MT1019 (488 bits expected, found " << data.length() << ")";
+    Rtcm_Bit_Writer data;
+    data << DF002
+         << DF009
+         << DF076
+         << DF077
+         << DF078
+         << DF079
+         << DF071
+         << DF081
+         << DF082
+         << DF083
+         << DF084
+         << DF085
+         << DF086
+         << DF087
+         << DF088
+         << DF089
+         << DF090
+         << DF091
+         << DF092
+         << DF093
+         << DF094
+         << DF095
+         << DF096
+         << DF097
+         << DF098
+         << DF099
+         << DF100
+         << DF101
+         << DF102
+         << DF103
+         << DF137;
+
+    if (data.size() != 488)
+        {
+            LOG(WARNING) << "Bad-formatted RTCM MT1019 (488 bits expected, found " << data.size() << ")";
         }
 
     std::string msg = build_message(data);
@@ -1589,7 +1527,7 @@ std::string Rtcm::print_MT1019(const Gps_Ephemeris& gps_eph)
 int32_t Rtcm::read_MT1019(const std::string& message, Gps_Ephemeris& gps_eph) const
 {
     // Convert message to binary
-    const std::string message_bin = Rtcm::binary_data_to_bin(message);
+    const Rtcm_Bit_Reader message_bits(message);
 
     if (!Rtcm::check_CRC(message))
         {
@@ -1601,7 +1539,7 @@ int32_t Rtcm::read_MT1019(const std::string& message, Gps_Ephemeris& gps_eph) co
     const uint32_t reserved_field_length = 6;
     uint32_t index = preamble_length + reserved_field_length;
 
-    const uint32_t read_message_length = Rtcm::bin_to_uint(message_bin.substr(index, 10));
+    const uint32_t read_message_length = message_bits.get_uint(index, 10);
     index += 10;
 
     if (read_message_length != 61)
@@ -1611,7 +1549,7 @@ int32_t Rtcm::read_MT1019(const std::string& message, Gps_Ephemeris& gps_eph) co
         }
 
     // Check than the message number is correct
-    const uint32_t read_msg_number = Rtcm::bin_to_uint(message_bin.substr(index, 12));
+    const uint32_t read_msg_number = message_bits.get_uint(index, 12);
     index += 12;
 
     if (1019 != read_msg_number)
@@ -1621,95 +1559,95 @@ int32_t Rtcm::read_MT1019(const std::string& message, Gps_Ephemeris& gps_eph) co
         }
 
     // Fill Gps Ephemeris with message data content
-    gps_eph.PRN = Rtcm::bin_to_uint(message_bin.substr(index, 6));
+    gps_eph.PRN = message_bits.get_uint(index, 6);
     index += 6;
 
-    gps_eph.WN = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 10)));
+    gps_eph.WN = static_cast<int32_t>(message_bits.get_uint(index, 10));
     index += 10;
 
-    gps_eph.SV_accuracy = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 4)));
+    gps_eph.SV_accuracy = static_cast<int32_t>(message_bits.get_uint(index, 4));
     index += 4;
 
-    gps_eph.code_on_L2 = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 2)));
+    gps_eph.code_on_L2 = static_cast<int32_t>(message_bits.get_uint(index, 2));
     index += 2;
 
-    gps_eph.idot = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 14))) * I_DOT_LSB;
+    gps_eph.idot = static_cast<double>(message_bits.get_int(index, 14)) * I_DOT_LSB;
     index += 14;
 
-    gps_eph.IODE_SF2 = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 8)));
-    gps_eph.IODE_SF3 = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 8)));
+    gps_eph.IODE_SF2 = static_cast<double>(message_bits.get_uint(index, 8));
+    gps_eph.IODE_SF3 = static_cast<double>(message_bits.get_uint(index, 8));
     index += 8;
 
-    gps_eph.toc = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 16))) * T_OC_LSB;
+    gps_eph.toc = static_cast<double>(message_bits.get_uint(index, 16)) * T_OC_LSB;
     index += 16;
 
-    gps_eph.af2 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 8))) * A_F2_LSB;
+    gps_eph.af2 = static_cast<double>(message_bits.get_int(index, 8)) * A_F2_LSB;
     index += 8;
 
-    gps_eph.af1 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * A_F1_LSB;
+    gps_eph.af1 = static_cast<double>(message_bits.get_int(index, 16)) * A_F1_LSB;
     index += 16;
 
-    gps_eph.af0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 22))) * A_F0_LSB;
+    gps_eph.af0 = static_cast<double>(message_bits.get_int(index, 22)) * A_F0_LSB;
     index += 22;
 
-    gps_eph.IODC = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 10)));
+    gps_eph.IODC = static_cast<double>(message_bits.get_uint(index, 10));
     index += 10;
 
-    gps_eph.Crs = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_RS_LSB;
+    gps_eph.Crs = static_cast<double>(message_bits.get_int(index, 16)) * C_RS_LSB;
     index += 16;
 
-    gps_eph.delta_n = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * DELTA_N_LSB;
+    gps_eph.delta_n = static_cast<double>(message_bits.get_int(index, 16)) * DELTA_N_LSB;
     index += 16;
 
-    gps_eph.M_0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * M_0_LSB;
+    gps_eph.M_0 = static_cast<double>(message_bits.get_int(index, 32)) * M_0_LSB;
     index += 32;
 
-    gps_eph.Cuc = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_UC_LSB;
+    gps_eph.Cuc = static_cast<double>(message_bits.get_int(index, 16)) * C_UC_LSB;
     index += 16;
 
-    gps_eph.ecc = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 32))) * ECCENTRICITY_LSB;
+    gps_eph.ecc = static_cast<double>(message_bits.get_uint(index, 32)) * ECCENTRICITY_LSB;
     index += 32;
 
-    gps_eph.Cus = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_US_LSB;
+    gps_eph.Cus = static_cast<double>(message_bits.get_int(index, 16)) * C_US_LSB;
     index += 16;
 
-    gps_eph.sqrtA = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 32))) * SQRT_A_LSB;
+    gps_eph.sqrtA = static_cast<double>(message_bits.get_uint(index, 32)) * SQRT_A_LSB;
     index += 32;
 
-    gps_eph.toe = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 16))) * T_OE_LSB;
+    gps_eph.toe = static_cast<double>(message_bits.get_uint(index, 16)) * T_OE_LSB;
     index += 16;
 
-    gps_eph.Cic = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_IC_LSB;
+    gps_eph.Cic = static_cast<double>(message_bits.get_int(index, 16)) * C_IC_LSB;
     index += 16;
 
-    gps_eph.OMEGA_0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * OMEGA_0_LSB;
+    gps_eph.OMEGA_0 = static_cast<double>(message_bits.get_int(index, 32)) * OMEGA_0_LSB;
     index += 32;
 
-    gps_eph.Cis = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_IS_LSB;
+    gps_eph.Cis = static_cast<double>(message_bits.get_int(index, 16)) * C_IS_LSB;
     index += 16;
 
-    gps_eph.i_0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * I_0_LSB;
+    gps_eph.i_0 = static_cast<double>(message_bits.get_int(index, 32)) * I_0_LSB;
     index += 32;
 
-    gps_eph.Crc = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_RC_LSB;
+    gps_eph.Crc = static_cast<double>(message_bits.get_int(index, 16)) * C_RC_LSB;
     index += 16;
 
-    gps_eph.omega = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * OMEGA_LSB;
+    gps_eph.omega = static_cast<double>(message_bits.get_int(index, 32)) * OMEGA_LSB;
     index += 32;
 
-    gps_eph.OMEGAdot = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 24))) * OMEGA_DOT_LSB;
+    gps_eph.OMEGAdot = static_cast<double>(message_bits.get_int(index, 24)) * OMEGA_DOT_LSB;
     index += 24;
 
-    gps_eph.TGD = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 8))) * T_GD_LSB;
+    gps_eph.TGD = static_cast<double>(message_bits.get_int(index, 8)) * T_GD_LSB;
     index += 8;
 
-    gps_eph.SV_health = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 6)));
+    gps_eph.SV_health = static_cast<int32_t>(message_bits.get_uint(index, 6));
     index += 6;
 
-    gps_eph.L2_P_data_flag = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    gps_eph.L2_P_data_flag = static_cast<bool>(message_bits.get_uint(index, 1));
     index += 1;
 
-    gps_eph.fit_interval_flag = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    gps_eph.fit_interval_flag = static_cast<bool>(message_bits.get_uint(index, 1));
 
     return 0;
 }
@@ -1765,47 +1703,48 @@ std::string Rtcm::print_MT1020(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, c
     Rtcm::set_DF135(glonass_gnav_utc_model);
     Rtcm::set_DF136(glonass_gnav_eph);
 
-    const std::string data = DF002.to_string() +
-                             DF038.to_string() +
-                             DF040.to_string() +
-                             DF104.to_string() +
-                             DF105.to_string() +
-                             DF106.to_string() +
-                             DF107.to_string() +
-                             DF108.to_string() +
-                             DF109.to_string() +
-                             DF110.to_string() +
-                             DF111.to_string() +
-                             DF112.to_string() +
-                             DF113.to_string() +
-                             DF114.to_string() +
-                             DF115.to_string() +
-                             DF116.to_string() +
-                             DF117.to_string() +
-                             DF118.to_string() +
-                             DF119.to_string() +
-                             DF120.to_string() +
-                             DF121.to_string() +
-                             DF122.to_string() +
-                             DF123.to_string() +
-                             DF124.to_string() +
-                             DF125.to_string() +
-                             DF126.to_string() +
-                             DF127.to_string() +
-                             DF128.to_string() +
-                             DF129.to_string() +
-                             DF130.to_string() +
-                             DF131.to_string() +
-                             DF132.to_string() +
-                             DF133.to_string() +
-                             DF134.to_string() +
-                             DF135.to_string() +
-                             DF136.to_string() +
-                             std::bitset<7>().to_string();  // Reserved bits
-
-    if (data.length() != 360)
-        {
-            LOG(WARNING) << "Bad-formatted RTCM MT1020 (360 bits expected, found " << data.length() << ")";
+    Rtcm_Bit_Writer data;
+    data << DF002
+         << DF038
+         << DF040
+         << DF104
+         << DF105
+         << DF106
+         << DF107
+         << DF108
+         << DF109
+         << DF110
+         << DF111
+         << DF112
+         << DF113
+         << DF114
+         << DF115
+         << DF116
+         << DF117
+         << DF118
+         << DF119
+         << DF120
+         << DF121
+         << DF122
+         << DF123
+         << DF124
+         << DF125
+         << DF126
+         << DF127
+         << DF128
+         << DF129
+         << DF130
+         << DF131
+         << DF132
+         << DF133
+         << DF134
+         << DF135
+         << DF136
+         << std::bitset<7>();  // Reserved bits
+
+    if (data.size() != 360)
+        {
+            LOG(WARNING) << "Bad-formatted RTCM MT1020 (360 bits expected, found " << data.size() << ")";
         }
 
     std::string msg = build_message(data);
@@ -1820,7 +1759,7 @@ std::string Rtcm::print_MT1020(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, c
 int32_t Rtcm::read_MT1020(const std::string& message, Glonass_Gnav_Ephemeris& glonass_gnav_eph, Glonass_Gnav_Utc_Model& glonass_gnav_utc_model) const
 {
     // Convert message to binary
-    const std::string message_bin = Rtcm::binary_data_to_bin(message);
+    const Rtcm_Bit_Reader message_bits(message);
     int32_t glonass_gnav_alm_health = 0;
     int32_t glonass_gnav_alm_health_ind = 0;
     int32_t fifth_str_additional_data_ind = 0;
@@ -1835,7 +1774,7 @@ int32_t Rtcm::read_MT1020(const std::string& message, Glonass_Gnav_Ephemeris& gl
     const uint32_t reserved_field_length = 6;
     uint32_t index = preamble_length + reserved_field_length;
 
-    const uint32_t read_message_length = Rtcm::bin_to_uint(message_bin.substr(index, 10));
+    const uint32_t read_message_length = message_bits.get_uint(index, 10);
     index += 10;
 
     if (read_message_length != 45)  // 360 bits = 45 bytes
@@ -1845,7 +1784,7 @@ int32_t Rtcm::read_MT1020(const std::string& message, Glonass_Gnav_Ephemeris& gl
         }
 
     // Check than the message number is correct
-    const uint32_t read_msg_number = Rtcm::bin_to_uint(message_bin.substr(index, 12));
+    const uint32_t read_msg_number = message_bits.get_uint(index, 12);
     index += 12;
 
     if (1020 != read_msg_number)
@@ -1855,123 +1794,123 @@ int32_t Rtcm::read_MT1020(const std::string& message, Glonass_Gnav_Ephemeris& gl
         }
 
     // Fill Gps Ephemeris with message data content
-    glonass_gnav_eph.i_satellite_slot_number = Rtcm::bin_to_uint(message_bin.substr(index, 6));
+    glonass_gnav_eph.i_satellite_slot_number = message_bits.get_uint(index, 6);
     index += 6;
 
-    glonass_gnav_eph.i_satellite_freq_channel = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 5)) - 7.0);
+    glonass_gnav_eph.i_satellite_freq_channel = static_cast<int32_t>(message_bits.get_uint(index, 5) - 7.0);
     index += 5;
 
-    glonass_gnav_alm_health = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    glonass_gnav_alm_health = static_cast<int32_t>(message_bits.get_uint(index, 1));
     index += 1;
     if (glonass_gnav_alm_health)
         {
         }  // Avoid compiler warning
 
-    glonass_gnav_alm_health_ind = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    glonass_gnav_alm_health_ind = static_cast<int32_t>(message_bits.get_uint(index, 1));
     index += 1;
     if (glonass_gnav_alm_health_ind)
         {
         }  // Avoid compiler warning
 
-    uint32_t P_1_tmp = Rtcm::bin_to_uint(message_bin.substr(index, 2));
+    uint32_t P_1_tmp = message_bits.get_uint(index, 2);
     glonass_gnav_eph.d_P_1 = (P_1_tmp == 0) ? 0. : (P_1_tmp + 1) * 15;
     index += 2;
 
-    glonass_gnav_eph.d_t_k += static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 5))) * 3600;
+    glonass_gnav_eph.d_t_k += static_cast<double>(message_bits.get_int(index, 5)) * 3600;
     index += 5;
-    glonass_gnav_eph.d_t_k += static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 6))) * 60;
+    glonass_gnav_eph.d_t_k += static_cast<double>(message_bits.get_int(index, 6)) * 60;
     index += 6;
-    glonass_gnav_eph.d_t_k += static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 1))) * 30;
+    glonass_gnav_eph.d_t_k += static_cast<double>(message_bits.get_int(index, 1)) * 30;
     index += 1;
 
-    glonass_gnav_eph.d_B_n = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    glonass_gnav_eph.d_B_n = static_cast<double>(message_bits.get_uint(index, 1));
     index += 1;
 
-    glonass_gnav_eph.d_P_2 = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    glonass_gnav_eph.d_P_2 = static_cast<bool>(message_bits.get_uint(index, 1));
     index += 1;
 
-    glonass_gnav_eph.d_t_b = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 7))) * 15 * 60.0;
+    glonass_gnav_eph.d_t_b = static_cast<double>(message_bits.get_uint(index, 7)) * 15 * 60.0;
     index += 7;
 
     // TODO Check for type spec for intS24
-    glonass_gnav_eph.d_VXn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 24))) * TWO_N20;
+    glonass_gnav_eph.d_VXn = static_cast<double>(glo_sint(message_bits, index, 24)) * TWO_N20;
     index += 24;
 
-    glonass_gnav_eph.d_Xn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 27))) * TWO_N11;
+    glonass_gnav_eph.d_Xn = static_cast<double>(glo_sint(message_bits, index, 27)) * TWO_N11;
     index += 27;
 
-    glonass_gnav_eph.d_AXn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 5))) * TWO_N30;
+    glonass_gnav_eph.d_AXn = static_cast<double>(glo_sint(message_bits, index, 5)) * TWO_N30;
     index += 5;
 
-    glonass_gnav_eph.d_VYn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 24))) * TWO_N20;
+    glonass_gnav_eph.d_VYn = static_cast<double>(glo_sint(message_bits, index, 24)) * TWO_N20;
     index += 24;
 
-    glonass_gnav_eph.d_Yn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 27))) * TWO_N11;
+    glonass_gnav_eph.d_Yn = static_cast<double>(glo_sint(message_bits, index, 27)) * TWO_N11;
     index += 27;
 
-    glonass_gnav_eph.d_AYn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 5))) * TWO_N30;
+    glonass_gnav_eph.d_AYn = static_cast<double>(glo_sint(message_bits, index, 5)) * TWO_N30;
     index += 5;
 
-    glonass_gnav_eph.d_VZn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 24))) * TWO_N20;
+    glonass_gnav_eph.d_VZn = static_cast<double>(glo_sint(message_bits, index, 24)) * TWO_N20;
     index += 24;
 
-    glonass_gnav_eph.d_Zn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 27))) * TWO_N11;
+    glonass_gnav_eph.d_Zn = static_cast<double>(glo_sint(message_bits, index, 27)) * TWO_N11;
     index += 27;
 
-    glonass_gnav_eph.d_AZn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 5))) * TWO_N30;
+    glonass_gnav_eph.d_AZn = static_cast<double>(glo_sint(message_bits, index, 5)) * TWO_N30;
     index += 5;
 
-    glonass_gnav_eph.d_P_3 = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    glonass_gnav_eph.d_P_3 = static_cast<bool>(message_bits.get_uint(index, 1));
     index += 1;
 
-    glonass_gnav_eph.d_gamma_n = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 11))) * TWO_N30;
+    glonass_gnav_eph.d_gamma_n = static_cast<double>(glo_sint(message_bits, index, 11)) * TWO_N30;
     index += 11;
 
-    glonass_gnav_eph.d_P = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 2)));
+    glonass_gnav_eph.d_P = static_cast<double>(message_bits.get_uint(index, 2));
     index += 2;
 
-    glonass_gnav_eph.d_l3rd_n = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    glonass_gnav_eph.d_l3rd_n = static_cast<bool>(message_bits.get_uint(index, 1));
     index += 1;
 
-    glonass_gnav_eph.d_tau_n = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 22))) * TWO_N30;
+    glonass_gnav_eph.d_tau_n = static_cast<double>(glo_sint(message_bits, index, 22)) * TWO_N30;
     index += 22;
 
-    glonass_gnav_eph.d_Delta_tau_n = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 5))) * TWO_N30;
+    glonass_gnav_eph.d_Delta_tau_n = static_cast<double>(glo_sint(message_bits, index, 5)) * TWO_N30;
     index += 5;
 
-    glonass_gnav_eph.d_E_n = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 5)));
+    glonass_gnav_eph.d_E_n = static_cast<double>(message_bits.get_uint(index, 5));
     index += 5;
 
-    glonass_gnav_eph.d_P_4 = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    glonass_gnav_eph.d_P_4 = static_cast<bool>(message_bits.get_uint(index, 1));
     index += 1;
 
-    glonass_gnav_eph.d_F_T = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 4)));
+    glonass_gnav_eph.d_F_T = static_cast<double>(message_bits.get_uint(index, 4));
     index += 4;
 
-    glonass_gnav_eph.d_N_T = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 11)));
+    glonass_gnav_eph.d_N_T = static_cast<double>(message_bits.get_uint(index, 11));
     index += 11;
 
-    glonass_gnav_eph.d_M = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 2)));
+    glonass_gnav_eph.d_M = static_cast<double>(message_bits.get_uint(index, 2));
     index += 2;
 
-    fifth_str_additional_data_ind = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    fifth_str_additional_data_ind = static_cast<double>(message_bits.get_uint(index, 1));
     index += 1;
 
     if (fifth_str_additional_data_ind == true)
         {
-            glonass_gnav_utc_model.d_N_A = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 11)));
+            glonass_gnav_utc_model.d_N_A = static_cast<double>(message_bits.get_uint(index, 11));
             index += 11;
 
-            glonass_gnav_utc_model.d_tau_c = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 32))) * TWO_N31;
+            glonass_gnav_utc_model.d_tau_c = static_cast<double>(glo_sint(message_bits, index, 32)) * TWO_N31;
             index += 32;
 
-            glonass_gnav_utc_model.d_N_4 = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 5)));
+            glonass_gnav_utc_model.d_N_4 = static_cast<double>(message_bits.get_uint(index, 5));
             index += 5;
 
-            glonass_gnav_utc_model.d_tau_gps = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 22))) * TWO_N30;
+            glonass_gnav_utc_model.d_tau_gps = static_cast<double>(glo_sint(message_bits, index, 22)) * TWO_N30;
             index += 22;
 
-            glonass_gnav_eph.d_l5th_n = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+            glonass_gnav_eph.d_l5th_n = static_cast<int32_t>(message_bits.get_uint(index, 1));
         }
 
     return 0;
@@ -1995,7 +1934,6 @@ std::string Rtcm::print_MT1029(uint32_t ref_id, const Gps_Ephemeris& gps_eph, do
 
     uint32_t i = 0;
     bool first = true;
-    std::string text_binary;
     for (char c : message)
         {
             if (isgraph(c) || c == ' ')
@@ -2015,20 +1953,22 @@ std::string Rtcm::print_MT1029(uint32_t ref_id, const Gps_Ephemeris& gps_eph, do
                             first = false;
                         }
                 }
-            const auto character = std::bitset<8>(c);
-            text_binary += character.to_string();
         }
 
     const auto DF138_ = std::bitset<7>(i);
     const auto DF139_ = std::bitset<8>(message.length());
 
-    const std::string data = DF002.to_string() +
-                             DF003.to_string() +
-                             DF051.to_string() +
-                             DF052.to_string() +
-                             DF138_.to_string() +
-                             DF139_.to_string() +
-                             text_binary;
+    Rtcm_Bit_Writer data;
+    data << DF002
+         << DF003
+         << DF051
+         << DF052
+         << DF138_
+         << DF139_;
+    for (char c : message)
+        {
+            data.put(static_cast<uint8_t>(c), 8);
+        }
 
     std::string msg = build_message(data);
     if (server_is_running)
@@ -2079,39 +2019,40 @@ std::string Rtcm::print_MT1045(const Galileo_Ephemeris& gal_eph)
     const uint32_t seven_zero = 0;
     const auto DF001_ = std::bitset<7>(seven_zero);
 
-    const std::string data = DF002.to_string() +
-                             DF252.to_string() +
-                             DF289.to_string() +
-                             DF290.to_string() +
-                             DF291.to_string() +
-                             DF292.to_string() +
-                             DF293.to_string() +
-                             DF294.to_string() +
-                             DF295.to_string() +
-                             DF296.to_string() +
-                             DF297.to_string() +
-                             DF298.to_string() +
-                             DF299.to_string() +
-                             DF300.to_string() +
-                             DF301.to_string() +
-                             DF302.to_string() +
-                             DF303.to_string() +
-                             DF304.to_string() +
-                             DF305.to_string() +
-                             DF306.to_string() +
-                             DF307.to_string() +
-                             DF308.to_string() +
-                             DF309.to_string() +
-                             DF310.to_string() +
-                             DF311.to_string() +
-                             DF312.to_string() +
-                             DF314.to_string() +
-                             DF315.to_string() +
-                             DF001_.to_string();
-
-    if (data.length() != 496)
-        {
-            LOG(WARNING) << "Bad-formatted RTCM MT1045 (496 bits expected, found " << data.length() << ")";
+    Rtcm_Bit_Writer data;
+    data << DF002
+         << DF252
+         << DF289
+         << DF290
+         << DF291
+         << DF292
+         << DF293
+         << DF294
+         << DF295
+         << DF296
+         << DF297
+         << DF298
+         << DF299
+         << DF300
+         << DF301
+         << DF302
+         << DF303
+         << DF304
+         << DF305
+         << DF306
+         << DF307
+         << DF308
+         << DF309
+         << DF310
+         << DF311
+         << DF312
+         << DF314
+         << DF315
+         << DF001_;
+
+    if (data.size() != 496)
+        {
+            LOG(WARNING) << "Bad-formatted RTCM MT1045 (496 bits expected, found " << data.size() << ")";
         }
 
     std::string msg = build_message(data);
@@ -2126,7 +2067,7 @@ std::string Rtcm::print_MT1045(const Galileo_Ephemeris& gal_eph)
 int32_t Rtcm::read_MT1045(const std::string& message, Galileo_Ephemeris& gal_eph) const
 {
     // Convert message to binary
-    const std::string message_bin = Rtcm::binary_data_to_bin(message);
+    const Rtcm_Bit_Reader message_bits(message);
 
     if (!Rtcm::check_CRC(message))
         {
@@ -2138,7 +2079,7 @@ int32_t Rtcm::read_MT1045(const std::string& message, Galileo_Ephemeris& gal_eph
     const uint32_t reserved_field_length = 6;
     uint32_t index = preamble_length + reserved_field_length;
 
-    const uint32_t read_message_length = Rtcm::bin_to_uint(message_bin.substr(index, 10));
+    const uint32_t read_message_length = message_bits.get_uint(index, 10);
     index += 10;
 
     if (read_message_length != 62)
@@ -2148,7 +2089,7 @@ int32_t Rtcm::read_MT1045(const std::string& message, Galileo_Ephemeris& gal_eph
         }
 
     // Check than the message number is correct
-    const uint32_t read_msg_number = Rtcm::bin_to_uint(message_bin.substr(index, 12));
+    const uint32_t read_msg_number = message_bits.get_uint(index, 12);
     index += 12;
 
     if (1045 != read_msg_number)
@@ -2158,85 +2099,85 @@ int32_t Rtcm::read_MT1045(const std::string& message, Galileo_Ephemeris& gal_eph
         }
 
     // Fill Galileo Ephemeris with message data content
-    gal_eph.PRN = Rtcm::bin_to_uint(message_bin.substr(index, 6));
+    gal_eph.PRN = message_bits.get_uint(index, 6);
     index += 6;
 
-    gal_eph.WN = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 12)));
+    gal_eph.WN = static_cast<double>(message_bits.get_uint(index, 12));
     index += 12;
 
-    gal_eph.IOD_nav = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 10)));
+    gal_eph.IOD_nav = static_cast<int32_t>(message_bits.get_uint(index, 10));
     index += 10;
 
-    gal_eph.SISA = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 8)));
+    gal_eph.SISA = static_cast<double>(message_bits.get_uint(index, 8));
     index += 8;
 
-    gal_eph.idot = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 14))) * I_DOT_2_LSB;
+    gal_eph.idot = static_cast<double>(message_bits.get_int(index, 14)) * I_DOT_2_LSB;
     index += 14;
 
-    gal_eph.toc = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 14))) * T0C_4_LSB;
+    gal_eph.toc = static_cast<double>(message_bits.get_uint(index, 14)) * T0C_4_LSB;
     index += 14;
 
-    gal_eph.af2 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 6))) * AF2_4_LSB;
+    gal_eph.af2 = static_cast<double>(message_bits.get_int(index, 6)) * AF2_4_LSB;
     index += 6;
 
-    gal_eph.af1 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 21))) * AF1_4_LSB;
+    gal_eph.af1 = static_cast<double>(message_bits.get_int(index, 21)) * AF1_4_LSB;
     index += 21;
 
-    gal_eph.af0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 31))) * AF0_4_LSB;
+    gal_eph.af0 = static_cast<double>(message_bits.get_int(index, 31)) * AF0_4_LSB;
     index += 31;
 
-    gal_eph.Crs = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_RS_3_LSB;
+    gal_eph.Crs = static_cast<double>(message_bits.get_int(index, 16)) * C_RS_3_LSB;
     index += 16;
 
-    gal_eph.delta_n = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * DELTA_N_3_LSB;
+    gal_eph.delta_n = static_cast<double>(message_bits.get_int(index, 16)) * DELTA_N_3_LSB;
     index += 16;
 
-    gal_eph.M_0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * M0_1_LSB;
+    gal_eph.M_0 = static_cast<double>(message_bits.get_int(index, 32)) * M0_1_LSB;
     index += 32;
 
-    gal_eph.Cuc = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_UC_3_LSB;
+    gal_eph.Cuc = static_cast<double>(message_bits.get_int(index, 16)) * C_UC_3_LSB;
     index += 16;
 
-    gal_eph.ecc = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 32))) * E_1_LSB;
+    gal_eph.ecc = static_cast<double>(message_bits.get_uint(index, 32)) * E_1_LSB;
     index += 32;
 
-    gal_eph.Cus = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_US_3_LSB;
+    gal_eph.Cus = static_cast<double>(message_bits.get_int(index, 16)) * C_US_3_LSB;
     index += 16;
 
-    gal_eph.sqrtA = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 32))) * A_1_LSB_GAL;
+    gal_eph.sqrtA = static_cast<double>(message_bits.get_uint(index, 32)) * A_1_LSB_GAL;
     index += 32;
 
-    gal_eph.toe = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 14))) * T0E_1_LSB;
+    gal_eph.toe = static_cast<double>(message_bits.get_uint(index, 14)) * T0E_1_LSB;
     index += 14;
 
-    gal_eph.Cic = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_IC_4_LSB;
+    gal_eph.Cic = static_cast<double>(message_bits.get_int(index, 16)) * C_IC_4_LSB;
     index += 16;
 
-    gal_eph.OMEGA_0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * OMEGA_0_2_LSB;
+    gal_eph.OMEGA_0 = static_cast<double>(message_bits.get_int(index, 32)) * OMEGA_0_2_LSB;
     index += 32;
 
-    gal_eph.Cis = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_IS_4_LSB;
+    gal_eph.Cis = static_cast<double>(message_bits.get_int(index, 16)) * C_IS_4_LSB;
     index += 16;
 
-    gal_eph.i_0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * I_0_2_LSB;
+    gal_eph.i_0 = static_cast<double>(message_bits.get_int(index, 32)) * I_0_2_LSB;
     index += 32;
 
-    gal_eph.Crc = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_RC_3_LSB;
+    gal_eph.Crc = static_cast<double>(message_bits.get_int(index, 16)) * C_RC_3_LSB;
     index += 16;
 
-    gal_eph.omega = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * OMEGA_2_LSB;
+    gal_eph.omega = static_cast<double>(message_bits.get_int(index, 32)) * OMEGA_2_LSB;
     index += 32;
 
-    gal_eph.OMEGAdot = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 24))) * OMEGA_DOT_3_LSB;
+    gal_eph.OMEGAdot = static_cast<double>(message_bits.get_int(index, 24)) * OMEGA_DOT_3_LSB;
     index += 24;
 
-    gal_eph.BGD_E1E5a = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 10)));
+    gal_eph.BGD_E1E5a = static_cast<double>(message_bits.get_int(index, 10));
     index += 10;
 
-    gal_eph.E5a_HS = Rtcm::bin_to_uint(message_bin.substr(index, 2));
+    gal_eph.E5a_HS = message_bits.get_uint(index, 2);
     index += 2;
 
-    gal_eph.E5a_DVS = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    gal_eph.E5a_DVS = static_cast<bool>(message_bits.get_uint(index, 1));
 
     return 0;
 }
@@ -2288,7 +2229,8 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
             msg_number = 1071;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2296,13 +2238,14 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
         external_clock_indicator,
         smooth_int,
         divergence_free,
-        more_messages);
+        more_messages,
+        data);
 
-    const std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    Rtcm::get_MSM_1_content_sat_data(observables, data);
 
-    const std::string signal_data = Rtcm::get_MSM_1_content_signal_data(observables);
+    Rtcm::get_MSM_1_content_signal_data(observables, data);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
 
     if (server_is_running)
         {
@@ -2313,7 +2256,7 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_header(uint32_t msg_number,
+void Rtcm::get_MSM_header(uint32_t msg_number,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables,
     uint32_t ref_id,
@@ -2321,7 +2264,8 @@ std::string Rtcm::get_MSM_header(uint32_t msg_number,
     uint32_t external_clock_indicator,
     int32_t smooth_int,
     bool divergence_free,
-    bool more_messages)
+    bool more_messages,
+    Rtcm_Bit_Writer& data)
 {
     // Find first element in observables block and define type of message
     auto observables_iter = observables.begin();
@@ -2340,39 +2284,38 @@ std::string Rtcm::get_MSM_header(uint32_t msg_number,
     Rtcm::set_DF394(observables);
     Rtcm::set_DF395(observables);
 
-    std::string header = DF002.to_string() + DF003.to_string();
+    data << DF002
+         << DF003;
     // GNSS Epoch Time Specific to each constellation
     if ((sys == "R"))
         {
             // GLONASS Epoch Time
             Rtcm::set_DF034(obs_time);
-            header += DF034.to_string();
+            data << DF034;
         }
     else
         {
             // GPS, Galileo Epoch Time
             Rtcm::set_DF004(obs_time);
-            header += DF004.to_string();
+            data << DF004;
         }
 
-    header = header + DF393.to_string() +
-             DF409.to_string() +
-             DF001_.to_string() +
-             DF411.to_string() +
-             DF417.to_string() +
-             DF412.to_string() +
-             DF418.to_string() +
-             DF394.to_string() +
-             DF395.to_string() +
-             Rtcm::set_DF396(observables);
-
-    return header;
+    Rtcm::set_DF396(observables);
+    data << DF393
+         << DF409
+         << DF001_
+         << DF411
+         << DF417
+         << DF412
+         << DF418
+         << DF394
+         << DF395
+         << DF396;
 }
 
 
-std::string Rtcm::get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables, Rtcm_Bit_Writer& data)
 {
-    std::string sat_data;
 
     Rtcm::set_DF394(observables);
     const uint32_t num_satellites = DF394.count();
@@ -2403,16 +2346,14 @@ std::string Rtcm::get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchr
     for (uint32_t nsat = 0; nsat < num_satellites; nsat++)
         {
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
-            sat_data += DF398.to_string();
+            data << DF398;
         }
-
-    return sat_data;
 }
 
 
-std::string Rtcm::get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables,
+    Rtcm_Bit_Writer& data)
 {
-    std::string signal_data;
     const uint32_t Ncells = observables.size();
 
     auto observables_vector = std::vector<std::pair<int32_t, Gnss_Synchro>>();
@@ -2433,10 +2374,8 @@ std::string Rtcm::get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Syn
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF400(ordered_by_PRN_pos.at(cell).second);
-            signal_data += DF400.to_string();
+            data << DF400;
         }
-
-    return signal_data;
 }
 
 
@@ -2486,7 +2425,8 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
             msg_number = 1072;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2494,13 +2434,14 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
         external_clock_indicator,
         smooth_int,
         divergence_free,
-        more_messages);
+        more_messages,
+        data);
 
-    const std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    Rtcm::get_MSM_1_content_sat_data(observables, data);
 
-    const std::string signal_data = Rtcm::get_MSM_2_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::get_MSM_2_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables, data);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2510,17 +2451,17 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
-    const std::map<int32_t, Gnss_Synchro>& observables)
+    const std::map<int32_t, Gnss_Synchro>& observables,
+    Rtcm_Bit_Writer& data)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
 
     const uint32_t Ncells = observables.size();
 
@@ -2544,13 +2485,12 @@ std::string Rtcm::get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF401(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF401.to_string();
-            second_data_type += DF402.to_string();
-            third_data_type += DF420.to_string();
+            first_data_type << DF401;
+            second_data_type << DF402;
+            third_data_type << DF420;
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type;
-    return signal_data;
+    data << first_data_type << second_data_type << third_data_type;
 }
 
 
@@ -2600,7 +2540,8 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
             msg_number = 1073;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2608,13 +2549,14 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
         external_clock_indicator,
         smooth_int,
         divergence_free,
-        more_messages);
+        more_messages,
+        data);
 
-    const std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    Rtcm::get_MSM_1_content_sat_data(observables, data);
 
-    const std::string signal_data = Rtcm::get_MSM_3_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::get_MSM_3_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables, data);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2624,18 +2566,18 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
-    const std::map<int32_t, Gnss_Synchro>& observables)
+    const std::map<int32_t, Gnss_Synchro>& observables,
+    Rtcm_Bit_Writer& data)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
+    Rtcm_Bit_Writer fourth_data_type;
 
     const uint32_t Ncells = observables.size();
 
@@ -2660,14 +2602,13 @@ std::string Rtcm::get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF401(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
+            first_data_type << DF400;
+            second_data_type << DF401;
+            third_data_type << DF402;
+            fourth_data_type << DF420;
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type;
-    return signal_data;
+    data << first_data_type << second_data_type << third_data_type << fourth_data_type;
 }
 
 
@@ -2717,7 +2658,8 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
             msg_number = 1074;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2725,13 +2667,14 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
         external_clock_indicator,
         smooth_int,
         divergence_free,
-        more_messages);
+        more_messages,
+        data);
 
-    const std::string sat_data = Rtcm::get_MSM_4_content_sat_data(observables);
+    Rtcm::get_MSM_4_content_sat_data(observables, data);
 
-    const std::string signal_data = Rtcm::get_MSM_4_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::get_MSM_4_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables, data);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2741,11 +2684,10 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables, Rtcm_Bit_Writer& data)
 {
-    std::string sat_data;
-    std::string first_data_type;
-    std::string second_data_type;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
 
     Rtcm::set_DF394(observables);
     const uint32_t num_satellites = DF394.count();
@@ -2776,27 +2718,26 @@ std::string Rtcm::get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchr
         {
             Rtcm::set_DF397(ordered_by_PRN_pos.at(nsat).second);
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
-            first_data_type += DF397.to_string();
-            second_data_type += DF398.to_string();
+            first_data_type << DF397;
+            second_data_type << DF398;
         }
-    sat_data = first_data_type + second_data_type;
-    return sat_data;
+    data << first_data_type << second_data_type;
 }
 
 
-std::string Rtcm::get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
-    const std::map<int32_t, Gnss_Synchro>& observables)
+    const std::map<int32_t, Gnss_Synchro>& observables,
+    Rtcm_Bit_Writer& data)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
+    Rtcm_Bit_Writer fourth_data_type;
+    Rtcm_Bit_Writer fifth_data_type;
 
     const uint32_t Ncells = observables.size();
 
@@ -2822,15 +2763,14 @@ std::string Rtcm::get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF403(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF403.to_string();
+            first_data_type << DF400;
+            second_data_type << DF401;
+            third_data_type << DF402;
+            fourth_data_type << DF420;
+            fifth_data_type << DF403;
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type;
-    return signal_data;
+    data << first_data_type << second_data_type << third_data_type << fourth_data_type << fifth_data_type;
 }
 
 
@@ -2880,7 +2820,8 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
             msg_number = 1075;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2888,13 +2829,14 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
         external_clock_indicator,
         smooth_int,
         divergence_free,
-        more_messages);
+        more_messages,
+        data);
 
-    const std::string sat_data = Rtcm::get_MSM_5_content_sat_data(observables);
+    Rtcm::get_MSM_5_content_sat_data(observables, data);
 
-    const std::string signal_data = Rtcm::get_MSM_5_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::get_MSM_5_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables, data);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2904,13 +2846,12 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables, Rtcm_Bit_Writer& data)
 {
-    std::string sat_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
+    Rtcm_Bit_Writer fourth_data_type;
 
     Rtcm::set_DF394(observables);
     const uint32_t num_satellites = DF394.count();
@@ -2943,30 +2884,29 @@ std::string Rtcm::get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchr
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
             Rtcm::set_DF399(ordered_by_PRN_pos.at(nsat).second);
             auto reserved = std::bitset<4>("0000");
-            first_data_type += DF397.to_string();
-            second_data_type += reserved.to_string();
-            third_data_type += DF398.to_string();
-            fourth_data_type += DF399.to_string();
+            first_data_type << DF397;
+            second_data_type << reserved;
+            third_data_type << DF398;
+            fourth_data_type << DF399;
         }
-    sat_data = first_data_type + second_data_type + third_data_type + fourth_data_type;
-    return sat_data;
+    data << first_data_type << second_data_type << third_data_type << fourth_data_type;
 }
 
 
-std::string Rtcm::get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
-    const std::map<int32_t, Gnss_Synchro>& observables)
+    const std::map<int32_t, Gnss_Synchro>& observables,
+    Rtcm_Bit_Writer& data)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-    std::string sixth_data_type;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
+    Rtcm_Bit_Writer fourth_data_type;
+    Rtcm_Bit_Writer fifth_data_type;
+    Rtcm_Bit_Writer sixth_data_type;
 
     const uint32_t Ncells = observables.size();
 
@@ -2993,16 +2933,15 @@ std::string Rtcm::get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF403(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF404(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF403.to_string();
-            sixth_data_type += DF404.to_string();
+            first_data_type << DF400;
+            second_data_type << DF401;
+            third_data_type << DF402;
+            fourth_data_type << DF420;
+            fifth_data_type << DF403;
+            sixth_data_type << DF404;
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type + sixth_data_type;
-    return signal_data;
+    data << first_data_type << second_data_type << third_data_type << fourth_data_type << fifth_data_type << sixth_data_type;
 }
 
 
@@ -3052,7 +2991,8 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
             msg_number = 1076;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -3060,13 +3000,14 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
         external_clock_indicator,
         smooth_int,
         divergence_free,
-        more_messages);
+        more_messages,
+        data);
 
-    const std::string sat_data = Rtcm::get_MSM_4_content_sat_data(observables);
+    Rtcm::get_MSM_4_content_sat_data(observables, data);
 
-    const std::string signal_data = Rtcm::get_MSM_6_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::get_MSM_6_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables, data);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -3076,19 +3017,19 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
-    const std::map<int32_t, Gnss_Synchro>& observables)
+    const std::map<int32_t, Gnss_Synchro>& observables,
+    Rtcm_Bit_Writer& data)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
+    Rtcm_Bit_Writer fourth_data_type;
+    Rtcm_Bit_Writer fifth_data_type;
 
     const uint32_t Ncells = observables.size();
 
@@ -3114,15 +3055,14 @@ std::string Rtcm::get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF407(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF408(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF405.to_string();
-            second_data_type += DF406.to_string();
-            third_data_type += DF407.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF408.to_string();
+            first_data_type << DF405;
+            second_data_type << DF406;
+            third_data_type << DF407;
+            fourth_data_type << DF420;
+            fifth_data_type << DF408;
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type;
-    return signal_data;
+    data << first_data_type << second_data_type << third_data_type << fourth_data_type << fifth_data_type;
 }
 
 
@@ -3172,7 +3112,8 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
             msg_number = 1076;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data;
+    Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -3180,13 +3121,14 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
         external_clock_indicator,
         smooth_int,
         divergence_free,
-        more_messages);
+        more_messages,
+        data);
 
-    const std::string sat_data = Rtcm::get_MSM_5_content_sat_data(observables);
+    Rtcm::get_MSM_5_content_sat_data(observables, data);
 
-    const std::string signal_data = Rtcm::get_MSM_7_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::get_MSM_7_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables, data);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -3196,20 +3138,20 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
-    const std::map<int32_t, Gnss_Synchro>& observables)
+    const std::map<int32_t, Gnss_Synchro>& observables,
+    Rtcm_Bit_Writer& data)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-    std::string sixth_data_type;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
+    Rtcm_Bit_Writer fourth_data_type;
+    Rtcm_Bit_Writer fifth_data_type;
+    Rtcm_Bit_Writer sixth_data_type;
 
     const uint32_t Ncells = observables.size();
 
@@ -3236,16 +3178,15 @@ std::string Rtcm::get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF408(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF404(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF405.to_string();
-            second_data_type += DF406.to_string();
-            third_data_type += DF407.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF408.to_string();
-            sixth_data_type += DF404.to_string();
+            first_data_type << DF405;
+            second_data_type << DF406;
+            third_data_type << DF407;
+            fourth_data_type << DF420;
+            fifth_data_type << DF408;
+            sixth_data_type << DF404;
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type + sixth_data_type;
-    return signal_data;
+    data << first_data_type << second_data_type << third_data_type << fourth_data_type << fifth_data_type << sixth_data_type;
 }
 
 // SSR
@@ -3335,9 +3276,10 @@ std::vector<std::string> Rtcm::print_IGM01(const Galileo_HAS_data& has_data)
                 {
                     ssr_multiple_msg_indicator = false;  // last message of a sequence
                 }
-            const std::string header = Rtcm::get_IGM01_header(has_data, sys, ssr_multiple_msg_indicator);
-            const std::string sat_data = Rtcm::get_IGM01_content_sat(has_data, sys);
-            std::string message = build_message(header + sat_data);
+            Rtcm_Bit_Writer data;
+            Rtcm::get_IGM01_header(has_data, sys, ssr_multiple_msg_indicator, data);
+            Rtcm::get_IGM01_content_sat(has_data, sys, data);
+            std::string message = build_message(data);
             if (server_is_running)
                 {
                     rtcm_message_queue->push(message);
@@ -3359,9 +3301,10 @@ std::vector<std::string> Rtcm::print_IGM02(const Galileo_HAS_data& has_data)
                 {
                     ssr_multiple_msg_indicator = false;  // last message of a sequence
                 }
-            const std::string header = Rtcm::get_IGM02_header(has_data, sys, ssr_multiple_msg_indicator);
-            const std::string sat_data = Rtcm::get_IGM02_content_sat(has_data, sys);
-            std::string message = build_message(header + sat_data);
+            Rtcm_Bit_Writer data;
+            Rtcm::get_IGM02_header(has_data, sys, ssr_multiple_msg_indicator, data);
+            Rtcm::get_IGM02_content_sat(has_data, sys, data);
+            std::string message = build_message(data);
             if (server_is_running)
                 {
                     rtcm_message_queue->push(message);
@@ -3383,9 +3326,10 @@ std::vector<std::string> Rtcm::print_IGM03(const Galileo_HAS_data& has_data)
                 {
                     ssr_multiple_msg_indicator = false;  // last message of a sequence
                 }
-            const std::string header = Rtcm::get_IGM03_header(has_data, sys, ssr_multiple_msg_indicator);
-            const std::string sat_data = Rtcm::get_IGM03_content_sat(has_data, sys);
-            std::string message = build_message(header + sat_data);
+            Rtcm_Bit_Writer data;
+            Rtcm::get_IGM03_header(has_data, sys, ssr_multiple_msg_indicator, data);
+            Rtcm::get_IGM03_content_sat(has_data, sys, data);
+            std::string message = build_message(data);
             if (server_is_running)
                 {
                     rtcm_message_queue->push(message);
@@ -3407,11 +3351,13 @@ std::vector<std::string> Rtcm::print_IGM05(const Galileo_HAS_data& has_data)
                 {
                     ssr_multiple_msg_indicator = false;  // last message of a sequence
                 }
-            const std::string header = Rtcm::get_IGM05_header(has_data, sys, ssr_multiple_msg_indicator);
-            const std::string sat_data = Rtcm::get_IGM05_content_sat(has_data, sys);
-            if (!sat_data.empty())
+            Rtcm_Bit_Writer data;
+            Rtcm::get_IGM05_header(has_data, sys, ssr_multiple_msg_indicator, data);
+            const uint32_t header_length = data.size();
+            Rtcm::get_IGM05_content_sat(has_data, sys, data);
+            if (data.size() > header_length)
                 {
-                    std::string message = build_message(header + sat_data);
+                    std::string message = build_message(data);
                     if (server_is_running)
                         {
                             rtcm_message_queue->push(message);
@@ -3423,10 +3369,8 @@ std::vector<std::string> Rtcm::print_IGM05(const Galileo_HAS_data& has_data)
 }
 
 
-std::string Rtcm::get_IGM01_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator)
+void Rtcm::get_IGM01_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator, Rtcm_Bit_Writer& data)
 {
-    std::string header;
-
     uint32_t tow = has_data.tow;
     uint16_t ssr_provider_id = 0;                    // ?
     uint8_t igm_version = 0;                         // ?
@@ -3461,18 +3405,15 @@ std::string Rtcm::get_IGM01_header(const Galileo_HAS_data& has_data, uint8_t nsy
     Rtcm::set_IDF006(regional_indicator);
     Rtcm::set_IDF010(Nsat);
 
-    header += DF002.to_string() + IDF001.to_string() + IDF002.to_string() +
-              IDF003.to_string() + IDF004.to_string() + IDF005.to_string() +
-              IDF007.to_string() + IDF008.to_string() + IDF009.to_string() +
-              IDF006.to_string() + IDF010.to_string();
-    return header;
+    data << DF002 << IDF001 << IDF002
+         << IDF003 << IDF004 << IDF005
+         << IDF007 << IDF008 << IDF009
+         << IDF006 << IDF010;
 }
 
 
-std::string Rtcm::get_IGM01_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index)
+void Rtcm::get_IGM01_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index, Rtcm_Bit_Writer& data)
 {
-    std::string content;
-
     std::vector<int> prn = has_data.get_PRNs_in_mask(nsys_index);
     std::vector<uint16_t> gnss_iod = has_data.get_gnss_iod(nsys_index);
     std::vector<float> delta_orbit_radial_m = has_data.get_delta_radial_m(nsys_index);
@@ -3491,19 +3432,15 @@ std::string Rtcm::get_IGM01_content_sat(const Galileo_HAS_data& has_data, uint8_
             Rtcm::set_IDF017(0.0);  // dot_orbit_delta_in_track_m_s
             Rtcm::set_IDF018(0.0);  // dot_orbit_delta_cross_track_m_s
 
-            content += IDF011.to_string() + IDF012.to_string() + IDF013.to_string() +
-                       IDF014.to_string() + IDF016.to_string() + IDF015.to_string() +
-                       IDF017.to_string() + IDF018.to_string();
+            data << IDF011 << IDF012 << IDF013
+                 << IDF014 << IDF016 << IDF015
+                 << IDF017 << IDF018;
         }
-
-    return content;
 }
 
 
-std::string Rtcm::get_IGM02_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator)
+void Rtcm::get_IGM02_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator, Rtcm_Bit_Writer& data)
 {
-    std::string header;
-
     uint32_t tow = has_data.tow;
     uint16_t ssr_provider_id = 0;                    // ?
     uint8_t igm_version = 0;                         // ?
@@ -3536,18 +3473,15 @@ std::string Rtcm::get_IGM02_header(const Galileo_HAS_data& has_data, uint8_t nsy
     Rtcm::set_IDF009(ssr_solution_id);
     Rtcm::set_IDF010(Nsat);
 
-    header += DF002.to_string() + IDF001.to_string() + IDF002.to_string() +
-              IDF003.to_string() + IDF004.to_string() + IDF005.to_string() +
-              IDF007.to_string() + IDF008.to_string() + IDF009.to_string() +
-              IDF010.to_string();
-    return header;
+    data << DF002 << IDF001 << IDF002
+         << IDF003 << IDF004 << IDF005
+         << IDF007 << IDF008 << IDF009
+         << IDF010;
 }
 
 
-std::string Rtcm::get_IGM02_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index)
+void Rtcm::get_IGM02_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index, Rtcm_Bit_Writer& data)
 {
-    std::string content;
-
     const uint8_t num_sats_in_this_system = has_data.get_num_satellites()[nsys_index];
 
     std::vector<int> prn = has_data.get_PRNs_in_mask(nsys_index);
@@ -3563,18 +3497,14 @@ std::string Rtcm::get_IGM02_content_sat(const Galileo_HAS_data& has_data, uint8_
             Rtcm::set_IDF020(delta_clock_c1[sat]);
             Rtcm::set_IDF021(delta_clock_c2[sat]);
 
-            content += IDF011.to_string() + IDF019.to_string() + IDF020.to_string() +
-                       IDF021.to_string();
+            data << IDF011 << IDF019 << IDF020
+                 << IDF021;
         }
-
-    return content;
 }
 
 
-std::string Rtcm::get_IGM03_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator)
+void Rtcm::get_IGM03_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator, Rtcm_Bit_Writer& data)
 {
-    std::string header;
-
     uint32_t tow = has_data.tow;
     uint16_t ssr_provider_id = 0;                    // ?
     uint8_t igm_version = 0;                         // ?
@@ -3609,18 +3539,15 @@ std::string Rtcm::get_IGM03_header(const Galileo_HAS_data& has_data, uint8_t nsy
     Rtcm::set_IDF006(regional_indicator);
     Rtcm::set_IDF010(Nsat);
 
-    header += DF002.to_string() + IDF001.to_string() + IDF002.to_string() +
-              IDF003.to_string() + IDF004.to_string() + IDF005.to_string() +
-              IDF007.to_string() + IDF008.to_string() + IDF009.to_string() +
-              IDF006.to_string() + IDF010.to_string();
-    return header;
+    data << DF002 << IDF001 << IDF002
+         << IDF003 << IDF004 << IDF005
+         << IDF007 << IDF008 << IDF009
+         << IDF006 << IDF010;
 }
 
 
-std::string Rtcm::get_IGM03_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index)
+void Rtcm::get_IGM03_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index, Rtcm_Bit_Writer& data)
 {
-    std::string content;
-
     const uint8_t num_sats_in_this_system = has_data.get_num_satellites()[nsys_index];
 
     std::vector<int> prn = has_data.get_PRNs_in_mask(nsys_index);
@@ -3646,20 +3573,16 @@ std::string Rtcm::get_IGM03_content_sat(const Galileo_HAS_data& has_data, uint8_
             Rtcm::set_IDF020(delta_clock_c1[sat]);
             Rtcm::set_IDF021(delta_clock_c2[sat]);
 
-            content += IDF011.to_string() + IDF012.to_string() + IDF013.to_string() +
-                       IDF014.to_string() + IDF015.to_string() + IDF016.to_string() +
-                       IDF017.to_string() + IDF018.to_string() + DF019.to_string() +
-                       IDF020.to_string() + IDF021.to_string();
+            data << IDF011 << IDF012 << IDF013
+                 << IDF014 << IDF015 << IDF016
+                 << IDF017 << IDF018 << DF019
+                 << IDF020 << IDF021;
         }
-
-    return content;
 }
 
 
-std::string Rtcm::get_IGM05_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator)
+void Rtcm::get_IGM05_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator, Rtcm_Bit_Writer& data)
 {
-    std::string header;
-
     uint32_t tow = has_data.tow;
     uint16_t ssr_provider_id = 0;                    // ?
     uint8_t igm_version = 0;                         // ?
@@ -3692,18 +3615,15 @@ std::string Rtcm::get_IGM05_header(const Galileo_HAS_data& has_data, uint8_t nsy
     Rtcm::set_IDF009(ssr_solution_id);
     Rtcm::set_IDF010(Nsat);
 
-    header += DF002.to_string() + IDF001.to_string() + IDF002.to_string() +
-              IDF003.to_string() + IDF004.to_string() + IDF005.to_string() +
-              IDF007.to_string() + IDF008.to_string() + IDF009.to_string() +
-              IDF010.to_string();
-    return header;
+    data << DF002 << IDF001 << IDF002
+         << IDF003 << IDF004 << IDF005
+         << IDF007 << IDF008 << IDF009
+         << IDF010;
 }
 
 
-std::string Rtcm::get_IGM05_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index)
+void Rtcm::get_IGM05_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index, Rtcm_Bit_Writer& data)
 {
-    std::string content;
-
     const uint8_t num_sats_in_this_system = has_data.get_num_satellites()[nsys_index];
     std::vector<int> prn = has_data.get_PRNs_in_mask(nsys_index);
     std::vector<std::vector<float>> code_bias_m = has_data.get_code_bias_m();
@@ -3837,7 +3757,7 @@ std::string Rtcm::get_IGM05_content_sat(const Galileo_HAS_data& has_data, uint8_
                     Rtcm::set_IDF011(static_cast<uint8_t>(prn[sat]));
                     Rtcm::set_IDF023(valid_num_bias_processed);
 
-                    content += IDF011.to_string() + IDF023.to_string();
+                    data << IDF011 << IDF023;
 
                     uint8_t num_sats_in_previous_systems = 0;
                     for (uint8_t nsys = 0; nsys < nsys_index; nsys++)
@@ -3852,13 +3772,11 @@ std::string Rtcm::get_IGM05_content_sat(const Galileo_HAS_data& has_data, uint8_
                                 {
                                     Rtcm::set_IDF024(gnss_signal_tracking_mode_id_v[code]);
                                     Rtcm::set_IDF025(code_bias_m[sat_index][code]);
-                                    content += DF024.to_string() + IDF025.to_string();
+                                    data << DF024 << IDF025;
                                 }
                         }
                 }
         }
-
-    return content;
 }
 
 
@@ -5123,12 +5041,8 @@ int32_t Rtcm::set_DF107(const Glonass_Gnav_Ephemeris& glonass_gnav_eph)
     min = (tk - hrs * 3600) / 60;
     sec = (tk - hrs * 3600 - min * 60) / 60;
 
-    std::string _hrs = std::bitset<5>(hrs).to_string();  // string conversion
-    std::string _min = std::bitset<6>(min).to_string();  // string conversion
-    std::string _sec = std::bitset<1>(sec).to_string();  // string conversion
-
-    // Set hrs, min, sec in designed bit positions
-    DF107 = std::bitset<12>(_hrs + _min + _sec);
+    // Set hrs (5 bits), min (6 bits), sec (1 bit) in designed bit positions
+    DF107 = std::bitset<12>(((hrs & 0x1FU) << 7) | ((min & 0x3FU) << 1) | (sec & 0x1U));
 
     return 0;
 }
@@ -5751,19 +5665,18 @@ int32_t Rtcm::set_DF395(const std::map<int32_t, Gnss_Synchro>& gnss_synchro)
 }
 
 
-std::string Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
+int32_t Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string DF396;
     std::map<int32_t, Gnss_Synchro>::const_iterator observables_iter;
     Rtcm::set_DF394(observables);
     Rtcm::set_DF395(observables);
     uint32_t num_signals = DF395.count();
     uint32_t num_satellites = DF394.count();
 
+    DF396.clear();
     if ((num_signals == 0) || (num_satellites == 0))
         {
-            std::string s("");
-            return s;
+            return 0;
         }
     std::vector<std::vector<bool>> matrix(num_signals, std::vector<bool>());
 
@@ -5868,24 +5781,14 @@ std::string Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
         }
 
     // write the matrix column-wise
-    DF396.clear();
     for (uint32_t col = 0; col < num_satellites; col++)
         {
             for (uint32_t row = 0; row < num_signals; row++)
                 {
-                    std::string ss;
-                    if (matrix[row].at(col))
-                        {
-                            ss = "1";
-                        }
-                    else
-                        {
-                            ss = "0";
-                        }
-                    DF396 += ss;
+                    DF396.push_back(matrix[row].at(col));
                 }
         }
-    return DF396;
+    return 0;
 }
 
 
@@ -8,7 +8,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -27,6 +27,7 @@
 #include "gnss_synchro.h"
 #include "gps_cnav_ephemeris.h"
 #include "gps_ephemeris.h"
+#include "rtcm_bit_stream.h"
 #include <boost/asio.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <algorithm>  // for std::max, std::min, std::copy_n
@@ -402,20 +403,21 @@ private:
     //
     // Generation of messages content
     //
-    std::bitset<64> get_MT1001_4_header(uint32_t msg_number,
+    void get_MT1001_4_header(uint32_t msg_number,
         double obs_time,
         const std::map<int32_t, Gnss_Synchro>& observables,
         uint32_t ref_id,
         uint32_t smooth_int,
         bool sync_flag,
-        bool divergence_free);
+        bool divergence_free,
+        Rtcm_Bit_Writer& data);
 
-    std::bitset<58> get_MT1001_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro);
-    std::bitset<74> get_MT1002_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro);
-    std::bitset<101> get_MT1003_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
-    std::bitset<125> get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
+    void get_MT1001_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro, Rtcm_Bit_Writer& data);
+    void get_MT1002_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro, Rtcm_Bit_Writer& data);
+    void get_MT1003_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2, Rtcm_Bit_Writer& data);
+    void get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2, Rtcm_Bit_Writer& data);
 
-    std::bitset<152> get_MT1005_test();
+    void get_MT1005_test(Rtcm_Bit_Writer& data);
 
     /*!
      * \brief Generates contents of message header for types 1009, 1010, 1011 and 1012. GLONASS RTK Message
@@ -426,15 +428,16 @@ private:
      * \param ref_id
      * \param smooth_int
      * \param divergence_free
-     * \return Returns the message header content as set of bits
+     * \param data Buffer where the message header content is appended
      */
-    std::bitset<61> get_MT1009_12_header(uint32_t msg_number,
+    void get_MT1009_12_header(uint32_t msg_number,
         double obs_time,
         const std::map<int32_t, Gnss_Synchro>& observables,
         uint32_t ref_id,
         uint32_t smooth_int,
         bool sync_flag,
-        bool divergence_free);
+        bool divergence_free,
+        Rtcm_Bit_Writer& data);
 
     /*!
      * \brief Get the contents of the satellite specific portion of a type 1009 Message (GLONASS Basic RTK, L1 Only)
@@ -443,9 +446,9 @@ private:
      * \param ephGNAV Ephemeris for GLONASS GNAV in L1 satellites
      * \param obs_time Time of observation at the moment of printing
      * \param gnss_synchro Information generated by channels while processing the satellite
-     * \return Returns the message content as set of bits
+     * \param data Buffer where the message content is appended
      */
-    std::bitset<64> get_MT1009_sat_content(const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const Gnss_Synchro& gnss_synchro);
+    void get_MT1009_sat_content(const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const Gnss_Synchro& gnss_synchro, Rtcm_Bit_Writer& data);
     /*!
      * \brief Get the contents of the satellite specific portion of a type 1010 Message (GLONASS Extended RTK, L1 Only)
      * \details Contents generated for each satellite. See table 3.5-12
@@ -453,9 +456,9 @@ private:
      * \param ephGNAV Ephemeris for GLONASS GNAV in L1 satellites
      * \param obs_time Time of observation at the moment of printing
      * \param gnss_synchro Information generated by channels while processing the satellite
-     * \return Returns the message content as set of bits
+     * \param data Buffer where the message content is appended
      */
-    std::bitset<79> get_MT1010_sat_content(const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const Gnss_Synchro& gnss_synchro);
+    void get_MT1010_sat_content(const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const Gnss_Synchro& gnss_synchro, Rtcm_Bit_Writer& data);
     /*!
      * \brief Get the contents of the satellite specific portion of a type 1011 Message (GLONASS Basic RTK, L1 & L2)
      * \details Contents generated for each satellite. See table 3.5-13
@@ -465,9 +468,9 @@ private:
      * \param obs_time Time of observation at the moment of printing
      * \param gnss_synchroL1 Information generated by channels while processing the GLONASS GNAV L1 satellite
      * \param gnss_synchroL2 Information generated by channels while processing the GLONASS GNAV L2 satellite
-     * \return Returns the message content as set of bits
+     * \param data Buffer where the message content is appended
      */
-    std::bitset<107> get_MT1011_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
+    void get_MT1011_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2, Rtcm_Bit_Writer& data);
     /*!
      * \brief Get the contents of the satellite specific portion of a type 1012 Message (GLONASS Extended RTK, L1 & L2)
      * \details Contents generated for each satellite. See table 3.5-14
@@ -477,11 +480,11 @@ private:
      * \param obs_time Time of observation at the moment of printing
      * \param gnss_synchroL1 Information generated by channels while processing the GLONASS GNAV L1 satellite
      * \param gnss_synchroL2 Information generated by channels while processing the GLONASS GNAV L2 satellite
-     * \return Returns the message content as set of bits
+     * \param data Buffer where the message content is appended
      */
-    std::bitset<130> get_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
+    void get_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2, Rtcm_Bit_Writer& data);
 
-    std::string get_MSM_header(uint32_t msg_number,
+    void get_MSM_header(uint32_t msg_number,
         double obs_time,
         const std::map<int32_t, Gnss_Synchro>& observables,
         uint32_t ref_id,
@@ -489,28 +492,29 @@ private:
         uint32_t external_clock_indicator,
         int32_t smooth_int,
         bool divergence_free,
-        bool more_messages);
-
-    std::string get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
-
-    std::string get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-
-    std::string get_IGM01_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator);
-    std::string get_IGM01_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index);
-    std::string get_IGM02_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator);
-    std::string get_IGM02_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index);
-    std::string get_IGM03_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator);
-    std::string get_IGM03_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index);
-    std::string get_IGM05_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator);
-    std::string get_IGM05_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index);
+        bool more_messages,
+        Rtcm_Bit_Writer& data);
+
+    void get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables, Rtcm_Bit_Writer& data);
+    void get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables, Rtcm_Bit_Writer& data);
+    void get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables, Rtcm_Bit_Writer& data);
+
+    void get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables, Rtcm_Bit_Writer& data);
+    void get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables, Rtcm_Bit_Writer& data);
+    void get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables, Rtcm_Bit_Writer& data);
+    void get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables, Rtcm_Bit_Writer& data);
+    void get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables, Rtcm_Bit_Writer& data);
+    void get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables, Rtcm_Bit_Writer& data);
+    void get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables, Rtcm_Bit_Writer& data);
+
+    void get_IGM01_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator, Rtcm_Bit_Writer& data);
+    void get_IGM01_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index, Rtcm_Bit_Writer& data);
+    void get_IGM02_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator, Rtcm_Bit_Writer& data);
+    void get_IGM02_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index, Rtcm_Bit_Writer& data);
+    void get_IGM03_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator, Rtcm_Bit_Writer& data);
+    void get_IGM03_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index, Rtcm_Bit_Writer& data);
+    void get_IGM05_header(const Galileo_HAS_data& has_data, uint8_t nsys, bool ssr_multiple_msg_indicator, Rtcm_Bit_Writer& data);
+    void get_IGM05_content_sat(const Galileo_HAS_data& has_data, uint8_t nsys_index, Rtcm_Bit_Writer& data);
 
     //
     // Utilities
@@ -1035,8 +1039,7 @@ private:
     //
     std::bitset<8> preamble;
     std::bitset<6> reserved_field;
-    std::string add_CRC(const std::string& m) const;
-    std::string build_message(const std::string& data) const;  // adds 0s to complete a byte and adds the CRC
+    std::string build_message(const Rtcm_Bit_Writer& data) const;  // adds the header, 0s to complete a byte and the CRC
 
     //
     // Data Fields
@@ -1489,7 +1492,8 @@ private:
     std::bitset<32> DF395;
     int32_t set_DF395(const std::map<int32_t, Gnss_Synchro>& gnss_synchro);
 
-    std::string set_DF396(const std::map<int32_t, Gnss_Synchro>& observables);
+    std::vector<bool> DF396;
+    int32_t set_DF396(const std::map<int32_t, Gnss_Synchro>& observables);
 
     std::bitset<8> DF397;
     int32_t set_DF397(const Gnss_Synchro& gnss_synchro);
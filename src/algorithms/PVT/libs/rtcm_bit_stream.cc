@@ -0,0 +1,124 @@
+/*!
+ * \file rtcm_bit_stream.cc
+ * \brief Writer and reader of the MSB-first bit fields of RTCM messages
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtcm_bit_stream.h"
+#include <boost/crc.hpp>
+#include <algorithm>  // for std::min
+
+
+void Rtcm_Bit_Writer::put(uint64_t value, uint32_t num_bits)
+{
+    while (num_bits > 0)
+        {
+            const uint32_t used = d_num_bits % 8;
+            if (used == 0)
+                {
+                    d_bytes.push_back(0);
+                }
+            // Fill the free bits of the last byte with the next bits of value
+            const uint32_t n = std::min(8 - used, num_bits);
+            num_bits -= n;
+            const auto chunk = static_cast<uint8_t>((value >> num_bits) & ((1U << n) - 1));
+            d_bytes.back() |= static_cast<uint8_t>(chunk << (8 - used - n));
+            d_num_bits += n;
+        }
+}
+
+
+Rtcm_Bit_Writer& Rtcm_Bit_Writer::operator<<(const std::vector<bool>& bits)
+{
+    for (const bool bit : bits)
+        {
+            put(bit, 1);
+        }
+    return *this;
+}
+
+
+Rtcm_Bit_Writer& Rtcm_Bit_Writer::operator<<(const Rtcm_Bit_Writer& other)
+{
+    const uint32_t full_bytes = other.d_num_bits / 8;
+    if (d_num_bits % 8 == 0)
+        {
+            d_bytes.insert(d_bytes.end(), other.d_bytes.cbegin(), other.d_bytes.cbegin() + full_bytes);
+            d_num_bits += 8 * full_bytes;
+        }
+    else
+        {
+            for (uint32_t i = 0; i < full_bytes; i++)
+                {
+                    put(other.d_bytes[i], 8);
+                }
+        }
+    const uint32_t remaining_bits = other.d_num_bits % 8;
+    if (remaining_bits > 0)
+        {
+            put(other.d_bytes.back() >> (8 - remaining_bits), remaining_bits);
+        }
+    return *this;
+}
+
+
+void Rtcm_Bit_Writer::clear()
+{
+    d_bytes.clear();
+    d_num_bits = 0;
+}
+
+
+Rtcm_Bit_Reader::Rtcm_Bit_Reader(const std::string& data)
+    : d_data(reinterpret_cast<const uint8_t*>(data.data())),
+      d_size(data.size())
+{
+}
+
+
+uint64_t Rtcm_Bit_Reader::get_bits(uint32_t pos, uint32_t num_bits) const
+{
+    uint64_t value = 0;
+    while (num_bits > 0)
+        {
+            const size_t byte = pos / 8;
+            const uint32_t offset = pos % 8;
+            const uint32_t n = std::min(8 - offset, num_bits);
+            const uint32_t byte_value = byte < d_size ? d_data[byte] : 0;
+            value = (value << n) | ((byte_value >> (8 - offset - n)) & ((1U << n) - 1));
+            pos += n;
+            num_bits -= n;
+        }
+    return value;
+}
+
+
+int64_t Rtcm_Bit_Reader::get_signed_bits(uint32_t pos, uint32_t num_bits) const
+{
+    const uint64_t value = get_bits(pos, num_bits);
+    if (num_bits == 0 || num_bits >= 64)
+        {
+            return static_cast<int64_t>(value);
+        }
+    const uint64_t sign = uint64_t(1) << (num_bits - 1);
+    return static_cast<int64_t>(value ^ sign) - static_cast<int64_t>(sign);
+}
+
+
+uint32_t rtcm_crc24q(const uint8_t* data, size_t length)
+{
+    // Table-driven, one byte per step
+    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc_24_q;
+    crc_24_q.process_bytes(data, length);
+    return crc_24_q.checksum();
+}
@@ -0,0 +1,132 @@
+/*!
+ * \file rtcm_bit_stream.h
+ * \brief Writer and reader of the MSB-first bit fields of RTCM messages
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * RTCM 3 data fields are packed with no alignment, most significant bit
+ * first. The writer packs them directly into bytes, and the reader extracts
+ * them from the binary data of a received message, with no intermediate
+ * string of '0' and '1' characters.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RTCM_BIT_STREAM_H
+#define GNSS_SDR_RTCM_BIT_STREAM_H
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Appends bit fields to a byte buffer, most significant bit first.
+ * The bits of the last byte not written yet are zero.
+ */
+class Rtcm_Bit_Writer
+{
+public:
+    Rtcm_Bit_Writer() = default;
+
+    //! Appends the num_bits (up to 64) least significant bits of value
+    void put(uint64_t value, uint32_t num_bits);
+
+    //! Appends a data field
+    template <size_t N>
+    inline Rtcm_Bit_Writer& operator<<(const std::bitset<N>& field)
+    {
+        static_assert(N <= 64, "RTCM data fields are up to 64 bits long");
+        put(field.to_ullong(), N);
+        return *this;
+    }
+
+    Rtcm_Bit_Writer& operator<<(const std::vector<bool>& bits);  //!< Appends bits in order
+    Rtcm_Bit_Writer& operator<<(const Rtcm_Bit_Writer& other);   //!< Appends the bits of other
+
+    //! Number of bits written
+    inline uint32_t size() const
+    {
+        return d_num_bits;
+    }
+
+    inline bool empty() const
+    {
+        return d_num_bits == 0;
+    }
+
+    //! Written bits, zero-padded to a whole number of bytes
+    inline const std::vector<uint8_t>& bytes() const
+    {
+        return d_bytes;
+    }
+
+    void clear();
+
+private:
+    std::vector<uint8_t> d_bytes;
+    uint32_t d_num_bits{};
+};
+
+
+/*!
+ * \brief Reads bit fields, most significant bit first, from a string of
+ * binary data. The string must outlive the reader. Bits beyond the end of
+ * the data read as zeros.
+ */
+class Rtcm_Bit_Reader
+{
+public:
+    explicit Rtcm_Bit_Reader(const std::string& data);
+
+    uint64_t get_bits(uint32_t pos, uint32_t num_bits) const;  //!< Unsigned field of up to 64 bits starting at bit pos
+    int64_t get_signed_bits(uint32_t pos, uint32_t num_bits) const;  //!< Two's complement field of up to 64 bits starting at bit pos
+
+    //! Unsigned field of up to 32 bits
+    inline uint32_t get_uint(uint32_t pos, uint32_t num_bits) const
+    {
+        return static_cast<uint32_t>(get_bits(pos, num_bits));
+    }
+
+    //! Two's complement field of up to 32 bits
+    inline int32_t get_int(uint32_t pos, uint32_t num_bits) const
+    {
+        return static_cast<int32_t>(get_signed_bits(pos, num_bits));
+    }
+
+    //! Number of bits of the data
+    inline uint32_t size() const
+    {
+        return static_cast<uint32_t>(8 * d_size);
+    }
+
+private:
+    const uint8_t* d_data;
+    size_t d_size;
+};
+
+
+/*!
+ * \brief Qualcomm CRC-24Q of a byte buffer, as used by the RTCM 3 transport
+ * layer
+ */
+uint32_t rtcm_crc24q(const uint8_t* data, size_t length);
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_RTCM_BIT_STREAM_H
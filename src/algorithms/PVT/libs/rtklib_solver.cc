@@ -1414,6 +1414,8 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
             d_nav_data.geph = geph_data.data();
             d_nav_data.n = valid_obs;
             d_nav_data.ng = glo_valid_obs;
+            d_nav_data.orbits = &d_orbit_cache;
+            d_orbit_cache.index(&d_nav_data);
             if (gps_iono.valid)
                 {
                     d_nav_data.ion_gps[0] = gps_iono.alpha0;
@@ -1503,7 +1505,11 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                         }
                 }
 
-            result = rtkpos(&d_rtk, d_obs_data.data(), valid_obs + glo_valid_obs, &d_nav_data);
+            {
+                // The matrix temporaries of this epoch are taken from d_arena, and released all at once
+                const Rtklib_Arena_Scope arena_scope(d_arena);
+                result = rtkpos(&d_rtk, d_obs_data.data(), valid_obs + glo_valid_obs, &d_nav_data);
+            }
 
             if (result == 0)
                 {
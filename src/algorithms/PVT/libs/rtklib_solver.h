@@ -60,7 +60,9 @@
 #include "pvt_kf.h"
 #include "pvt_solution.h"
 #include "rtklib.h"
+#include "rtklib_arena.h"
 #include "rtklib_conversions.h"
+#include "rtklib_orbit_cache.h"
 #include <array>
 #include <cstdint>
 #include <fstream>
@@ -150,7 +152,9 @@ private:
     std::string d_dump_filename;
     std::ofstream d_dump_file;
     rtk_t d_rtk{};
+    Rtklib_Arena d_arena;  // scratch memory for the matrices of each rtkpos() call
     nav_t d_nav_data{};
+    Rtklib_Orbit_Cache d_orbit_cache;  // satellite orbits and clocks of the last epochs
     Monitor_Pvt d_monitor_pvt{};
     Pvt_Conf d_conf;
     Pvt_Kf d_pvt_kf;
@@ -119,6 +119,16 @@ public:
         monitor_.set_cog(monitor->cog);
         monitor_.set_galhas_status(monitor->galhas_status);
         monitor_.set_geohash(monitor->geohash);
+        monitor_.clear_outputs();
+        for (const auto& output : monitor->outputs)
+            {
+                auto* out = monitor_.add_outputs();
+                out->set_name(output.name);
+                out->set_processed(output.processed);
+                out->set_dropped(output.dropped);
+                out->set_mean_latency_ms(output.mean_latency_ms);
+                out->set_max_latency_ms(output.max_latency_ms);
+            }
 
         monitor_.SerializeToString(&data);
         return data;
@@ -164,6 +174,16 @@ public:
         monitor.cog = mon.cog();
         monitor.galhas_status = mon.galhas_status();
         monitor.geohash = mon.geohash();
+        for (const auto& out : mon.outputs())
+            {
+                Monitor_Pvt_Output output;
+                output.name = out.name();
+                output.processed = out.processed();
+                output.dropped = out.dropped();
+                output.mean_latency_ms = out.mean_latency_ms();
+                output.max_latency_ms = out.max_latency_ms();
+                monitor.outputs.push_back(std::move(output));
+            }
 
         return monitor;
     }
@@ -129,6 +129,12 @@ void BeidouB1iPcpsAcquisition::set_doppler_step(uint32_t doppler_step)
 }
 
 
+void BeidouB1iPcpsAcquisition::set_rf_channel(int rf_channel)
+{
+    acquisition_->set_rf_channel(rf_channel);
+}
+
+
 void BeidouB1iPcpsAcquisition::set_gnss_synchro(Gnss_Synchro* gnss_synchro)
 {
     gnss_synchro_ = gnss_synchro;
@@ -116,6 +116,11 @@ public:
      */
     void set_doppler_step(uint32_t doppler_step) override;
 
+    /*!
+     * \brief Set the RF channel feeding the acquisition
+     */
+    void set_rf_channel(int rf_channel) override;
+
     /*!
      * \brief Initializes acquisition algorithm.
      */
@@ -125,6 +125,12 @@ void BeidouB3iPcpsAcquisition::set_doppler_step(unsigned int doppler_step)
 }
 
 
+void BeidouB3iPcpsAcquisition::set_rf_channel(int rf_channel)
+{
+    acquisition_->set_rf_channel(rf_channel);
+}
+
+
 void BeidouB3iPcpsAcquisition::set_gnss_synchro(Gnss_Synchro* gnss_synchro)
 {
     gnss_synchro_ = gnss_synchro;
@@ -115,6 +115,11 @@ public:
      */
     void set_doppler_step(unsigned int doppler_step) override;
 
+    /*!
+     * \brief Set the RF channel feeding the acquisition
+     */
+    void set_rf_channel(int rf_channel) override;
+
     /*!
      * \brief Initializes acquisition algorithm.
      */
@@ -130,6 +130,12 @@ void GalileoE1PcpsAmbiguousAcquisition::set_doppler_step(unsigned int doppler_st
 }
 
 
+void GalileoE1PcpsAmbiguousAcquisition::set_rf_channel(int rf_channel)
+{
+    acquisition_->set_rf_channel(rf_channel);
+}
+
+
 void GalileoE1PcpsAmbiguousAcquisition::set_doppler_center(int doppler_center)
 {
     doppler_center_ = doppler_center;
@@ -126,6 +126,12 @@ void GalileoE5bPcpsAcquisition::set_doppler_step(unsigned int doppler_step)
 }
 
 
+void GalileoE5bPcpsAcquisition::set_rf_channel(int rf_channel)
+{
+    acquisition_->set_rf_channel(rf_channel);
+}
+
+
 void GalileoE5bPcpsAcquisition::set_doppler_center(int doppler_center)
 {
     doppler_center_ = doppler_center;
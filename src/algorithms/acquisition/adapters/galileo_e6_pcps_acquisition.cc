@@ -129,6 +129,12 @@ void GalileoE6PcpsAcquisition::set_doppler_step(unsigned int doppler_step)
 }
 
 
+void GalileoE6PcpsAcquisition::set_rf_channel(int rf_channel)
+{
+    acquisition_->set_rf_channel(rf_channel);
+}
+
+
 void GalileoE6PcpsAcquisition::set_doppler_center(int doppler_center)
 {
     doppler_center_ = doppler_center;
@@ -129,6 +129,12 @@ void GlonassL1CaPcpsAcquisition::set_doppler_step(unsigned int doppler_step)
 }
 
 
+void GlonassL1CaPcpsAcquisition::set_rf_channel(int rf_channel)
+{
+    acquisition_->set_rf_channel(rf_channel);
+}
+
+
 void GlonassL1CaPcpsAcquisition::set_gnss_synchro(Gnss_Synchro* gnss_synchro)
 {
     gnss_synchro_ = gnss_synchro;
@@ -128,6 +128,12 @@ void GlonassL2CaPcpsAcquisition::set_doppler_step(unsigned int doppler_step)
 }
 
 
+void GlonassL2CaPcpsAcquisition::set_rf_channel(int rf_channel)
+{
+    acquisition_->set_rf_channel(rf_channel);
+}
+
+
 void GlonassL2CaPcpsAcquisition::set_gnss_synchro(Gnss_Synchro* gnss_synchro)
 {
     gnss_synchro_ = gnss_synchro;
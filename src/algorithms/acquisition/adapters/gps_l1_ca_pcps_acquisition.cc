@@ -132,6 +132,12 @@ void GpsL1CaPcpsAcquisition::set_doppler_step(unsigned int doppler_step)
 }
 
 
+void GpsL1CaPcpsAcquisition::set_rf_channel(int rf_channel)
+{
+    acquisition_->set_rf_channel(rf_channel);
+}
+
+
 void GpsL1CaPcpsAcquisition::set_doppler_center(int doppler_center)
 {
     doppler_center_ = doppler_center;
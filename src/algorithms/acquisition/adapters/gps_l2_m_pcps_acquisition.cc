@@ -131,6 +131,12 @@ void GpsL2MPcpsAcquisition::set_doppler_step(unsigned int doppler_step)
 }
 
 
+void GpsL2MPcpsAcquisition::set_rf_channel(int rf_channel)
+{
+    acquisition_->set_rf_channel(rf_channel);
+}
+
+
 void GpsL2MPcpsAcquisition::set_doppler_center(int doppler_center)
 {
     doppler_center_ = doppler_center;
@@ -22,6 +22,7 @@
 #include "pcps_acquisition.h"
 #include "GLONASS_L1_L2_CA.h"  // for GLONASS_PRN
 #include "MATH_CONSTANTS.h"    // for TWO_PI
+#include "acq_task_pool.h"
 #include "gnss_frequencies.h"
 #include "gnss_sdr_create_directory.h"
 #include "gnss_sdr_filesystem.h"
@@ -62,6 +63,8 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
       d_dump_filename(conf_.dump_filename),
       d_dump_number(0LL),
       d_sample_counter(0ULL),
+      d_snapshot_sample_counter(0ULL),
+      d_shared_min_stamp(0ULL),
       d_threshold(0.0),
       d_mag(0),
       d_input_power(0.0),
@@ -71,6 +74,7 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
       d_positive_acq(0),
       d_doppler_center(0U),
       d_doppler_bias(0),
+      d_rf_channel(0),
       d_channel(0U),
       d_samplesPerChip(conf_.samples_per_chip),
       d_doppler_step(conf_.doppler_step),
@@ -84,10 +88,16 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
       d_worker_active(false),
       d_step_two(false),
       d_use_CFAR_algorithm_flag(conf_.use_CFAR_algorithm_flag),
+      d_freq_domain_doppler(conf_.freq_domain_doppler),
       d_dump(conf_.dump)
 {
     this->message_port_register_out(pmt::mp("events"));
 
+    if (!d_acq_parameters.blocking && d_acq_parameters.pool_threads > 0)
+        {
+            Acq_Task_Pool::instance().start(d_acq_parameters.pool_threads, d_acq_parameters.pool_cpus, d_acq_parameters.pool_queue_size);
+        }
+
     if (d_acq_parameters.sampled_ms == d_acq_parameters.ms_per_code)
         {
             d_fft_size = d_consumed_samples;
@@ -117,8 +127,8 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
     d_tmp_buffer = volk_gnsssdr::vector<float>(d_fft_size);
     d_fft_codes = volk_gnsssdr::vector<std::complex<float>>(d_fft_size);
     d_input_signal = volk_gnsssdr::vector<std::complex<float>>(d_fft_size);
-    d_fft_if = gnss_fft_fwd_make_unique(d_fft_size);
-    d_ifft = gnss_fft_rev_make_unique(d_fft_size);
+    d_fft_if = gnss_fft_fwd_make_cached(d_fft_size);
+    d_ifft = gnss_fft_rev_make_cached(d_fft_size);
 
     d_grid = arma::fmat();
     d_narrow_grid = arma::fmat();
@@ -268,10 +278,6 @@ void pcps_acquisition::init()
     d_num_doppler_bins = static_cast<uint32_t>(std::ceil(static_cast<double>(2 * d_acq_parameters.doppler_max) / static_cast<double>(d_doppler_step)));
 
     // Create the carrier Doppler wipeoff signals
-    if (d_grid_doppler_wipeoffs.empty())
-        {
-            d_grid_doppler_wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
-        }
     if (d_acq_parameters.make_2_steps && (d_grid_doppler_wipeoffs_step_two.empty()))
         {
             d_grid_doppler_wipeoffs_step_two = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins_step2, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
@@ -301,6 +307,20 @@ void pcps_acquisition::init()
 
 void pcps_acquisition::update_grid_doppler_wipeoffs()
 {
+    if (d_acq_parameters.shared_engine && (d_doppler_center == 0) && (d_doppler_bias == 0))
+        {
+            // The Doppler grid is provided by the shared acquisition engine
+            return;
+        }
+    if (d_freq_domain_doppler)
+        {
+            update_grid_doppler_shifts();
+            return;
+        }
+    if (d_grid_doppler_wipeoffs.size() != d_num_doppler_bins)
+        {
+            d_grid_doppler_wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
+        }
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
         {
             const int32_t doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + d_doppler_step * doppler_index;
@@ -309,6 +329,53 @@ void pcps_acquisition::update_grid_doppler_wipeoffs()
 }
 
 
+void pcps_acquisition::update_grid_doppler_shifts()
+{
+    // A Doppler hypothesis f = k * fs / N + r is built from the spectrum of the
+    // input wiped off by the residual frequency r, circularly shifted by k bins.
+    // Only one forward FFT per distinct residual is needed at each dwell.
+    const double fs = static_cast<double>(d_acq_parameters.use_automatic_resampler ? d_acq_parameters.resampled_fs : d_acq_parameters.fs_in);
+    std::vector<double> doppler_hz(d_num_doppler_bins);
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            const int32_t doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + d_doppler_step * doppler_index;
+            doppler_hz[doppler_index] = static_cast<double>(d_doppler_bias + doppler);
+        }
+    acq_doppler_grid_shifts(doppler_hz, fs / static_cast<double>(d_fft_size), d_fft_size, d_residual_doppler_hz, d_doppler_residual_index, d_doppler_bin_shift);
+
+    const size_t num_residuals = d_residual_doppler_hz.size();
+    if (d_residual_doppler_wipeoffs.size() != num_residuals)
+        {
+            d_residual_doppler_wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(num_residuals, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
+            d_residual_input_spectra = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(num_residuals, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
+        }
+    for (size_t i = 0; i < num_residuals; i++)
+        {
+            update_local_carrier(d_residual_doppler_wipeoffs[i], d_residual_doppler_hz[i]);
+        }
+    DLOG(INFO) << "Channel " << d_channel << ": " << d_num_doppler_bins << " Doppler bins built from "
+               << num_residuals << " forward FFTs per dwell";
+}
+
+
+bool pcps_acquisition::use_shared_engine()
+{
+    // The shared engine searches a grid centered at zero, so channels with
+    // Doppler assistance, FDMA signals and second-step searches use their own
+    if (!d_acq_parameters.shared_engine || d_step_two || (d_doppler_center != 0) || (d_doppler_bias != 0))
+        {
+            return false;
+        }
+    if (!d_shared_engine)
+        {
+            const int64_t fs = d_acq_parameters.use_automatic_resampler ? d_acq_parameters.resampled_fs : d_acq_parameters.fs_in;
+            d_shared_engine = Acq_Shared_Engine::get_instance(std::string(d_gnss_synchro->Signal, 2), d_rf_channel, fs, d_fft_size,
+                d_consumed_samples, d_acq_parameters.doppler_max, d_doppler_step, d_freq_domain_doppler);
+        }
+    return true;
+}
+
+
 void pcps_acquisition::update_grid_doppler_wipeoffs_step2()
 {
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins_step2; doppler_index++)
@@ -607,6 +674,33 @@ float pcps_acquisition::first_vs_second_peak_statistic(uint32_t& indext, int32_t
 }
 
 
+bool pcps_acquisition::submit_to_pool(uint64_t samp_count)
+{
+    auto& pool = Acq_Task_Pool::instance();
+    // The pool is stopped with the flowgraph. Start it again if the
+    // flowgraph was restarted.
+    pool.start(d_acq_parameters.pool_threads, d_acq_parameters.pool_cpus, d_acq_parameters.pool_queue_size);
+
+    // Keep the block alive until the search is done
+    auto self = shared_from_this();
+    const int32_t priority = pool.satellite_priority(d_gnss_synchro->System, d_gnss_synchro->PRN);
+    return pool.submit([self, this, samp_count]() { acquisition_core(samp_count); }, priority,
+        [self, this]() { cancel_acquisition_core(); });
+}
+
+
+void pcps_acquisition::cancel_acquisition_core()
+{
+    // The search was dropped by the pool before it ran
+    gr::thread::scoped_lock lk(d_setlock);
+    d_num_noncoherent_integrations_counter = 0U;
+    d_step_two = false;
+    d_state = 0;
+    d_active = false;
+    d_worker_active = false;
+}
+
+
 void pcps_acquisition::acquisition_core(uint64_t samp_count)
 {
     gr::thread::scoped_lock lk(d_setlock);
@@ -615,16 +709,31 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
     int32_t doppler = 0;
     uint32_t indext = 0U;
     const int32_t effective_fft_size = (d_acq_parameters.bit_transition_flag ? d_fft_size / 2 : d_fft_size);
-    if (d_cshort)
+    const bool shared_engine = use_shared_engine();
+    std::shared_ptr<const Acq_Shared_Engine::Snapshot> snapshot;
+    if (shared_engine)
         {
-            volk_gnsssdr_16ic_convert_32fc(d_data_buffer.data(), d_data_buffer_sc.data(), d_consumed_samples);
+            snapshot = std::move(d_shared_snapshot);
         }
-    std::copy(d_data_buffer.data(), d_data_buffer.data() + d_consumed_samples, d_input_signal.data());
-    if (d_fft_size > d_consumed_samples)
+    d_shared_snapshot.reset();
+    if (snapshot)
         {
-            for (uint32_t i = d_consumed_samples; i < d_fft_size; i++)
+            // Another channel already took (and transformed) an input snapshot
+            samp_count = snapshot->sample_stamp;
+        }
+    else
+        {
+            if (d_cshort)
+                {
+                    volk_gnsssdr_16ic_convert_32fc(d_data_buffer.data(), d_data_buffer_sc.data(), d_consumed_samples);
+                }
+            std::copy(d_data_buffer.data(), d_data_buffer.data() + d_consumed_samples, d_input_signal.data());
+            if (d_fft_size > d_consumed_samples)
                 {
-                    d_input_signal[i] = gr_complex(0.0, 0.0);
+                    for (uint32_t i = d_consumed_samples; i < d_fft_size; i++)
+                        {
+                            d_input_signal[i] = gr_complex(0.0, 0.0);
+                        }
                 }
         }
     const gr_complex* in = d_input_signal.data();  // Get the input samples pointer
@@ -644,20 +753,57 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
             lk.unlock();
         }
 
+    if (shared_engine && !snapshot)
+        {
+            // Make this snapshot available to all the channels of the same signal
+            snapshot = d_shared_engine->publish(in, samp_count);
+            samp_count = snapshot->sample_stamp;
+        }
+
     // Doppler frequency grid loop
     if (!d_step_two)
         {
+            if (d_freq_domain_doppler && !shared_engine)
+                {
+                    // Compute the FFT of the input once per residual Doppler frequency
+                    for (size_t i = 0; i < d_residual_doppler_wipeoffs.size(); i++)
+                        {
+                            volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_residual_doppler_wipeoffs[i].data(), d_fft_size);
+                            d_fft_if->execute();
+                            std::copy(d_fft_if->get_outbuf(), d_fft_if->get_outbuf() + d_fft_size, d_residual_input_spectra[i].data());
+                        }
+                }
             for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
                 {
-                    // Remove Doppler
-                    volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
+                    if (shared_engine)
+                        {
+                            // Remove Doppler and multiply with the local FFT'd code reference
+                            d_shared_engine->multiply_code(*snapshot, doppler_index, d_fft_codes.data(), d_ifft->get_inbuf());
+                        }
+                    else if (d_freq_domain_doppler)
+                        {
+                            // Remove Doppler by circularly shifting the input spectrum, and
+                            // multiply it with the local FFT'd code reference
+                            const uint32_t shift = d_doppler_bin_shift[doppler_index];
+                            const gr_complex* spectrum = d_residual_input_spectra[d_doppler_residual_index[doppler_index]].data();
+                            volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), spectrum + shift, d_fft_codes.data(), d_fft_size - shift);
+                            if (shift > 0)
+                                {
+                                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf() + d_fft_size - shift, spectrum, d_fft_codes.data() + d_fft_size - shift, shift);
+                                }
+                        }
+                    else
+                        {
+                            // Remove Doppler
+                            volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
 
-                    // Perform the FFT-based convolution  (parallel time search)
-                    // Compute the FFT of the carrier wiped--off incoming signal
-                    d_fft_if->execute();
+                            // Perform the FFT-based convolution  (parallel time search)
+                            // Compute the FFT of the carrier wiped--off incoming signal
+                            d_fft_if->execute();
 
-                    // Multiply carrier wiped--off, Fourier transformed incoming signal with the local FFT'd code reference
-                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
+                            // Multiply carrier wiped--off, Fourier transformed incoming signal with the local FFT'd code reference
+                            volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
+                        }
 
                     // Compute the inverse FFT
                     d_ifft->execute();
@@ -774,6 +920,12 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
             lk.lock();
         }
 
+    if (snapshot)
+        {
+            // Next dwell needs a newer snapshot
+            d_shared_min_stamp = snapshot->sample_stamp + 1;
+        }
+
     if (!d_acq_parameters.bit_transition_flag)
         {
             if (d_test_statistics > d_threshold)
@@ -972,10 +1124,23 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
                         d_sample_counter += static_cast<uint64_t>(ninput_items[0]);  // sample counter
                         consume_each(ninput_items[0]);
                     }
+                d_shared_min_stamp = d_sample_counter;
                 break;
             }
         case 1:
             {
+                if (use_shared_engine())
+                    {
+                        // Skip buffering if another channel already took a recent enough snapshot
+                        d_shared_snapshot = d_shared_engine->latest_snapshot(d_shared_min_stamp);
+                        if (d_shared_snapshot)
+                            {
+                                d_state = 2;
+                                d_snapshot_sample_counter = d_sample_counter;
+                                consume_each(0);
+                                break;
+                            }
+                    }
                 uint32_t buff_increment;
                 if (d_cshort)
                     {
@@ -1008,6 +1173,7 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
                 if (d_buffer_count >= d_consumed_samples)
                     {
                         d_state = 2;
+                        d_snapshot_sample_counter = d_sample_counter;
                     }
                 d_buffer_count += buff_increment;
                 d_sample_counter += static_cast<uint64_t>(buff_increment);
@@ -1022,6 +1188,26 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
                         lk.unlock();
                         acquisition_core(d_sample_counter);
                     }
+                else if (d_acq_parameters.pool_threads > 0)
+                    {
+                        if (!submit_to_pool(d_snapshot_sample_counter))
+                            {
+                                // The queue is full. The block stays in this state with
+                                // the same snapshot, and submits it again in the next
+                                // call. The samples received meanwhile are not needed.
+                                if (!d_acq_parameters.blocking_on_standby)
+                                    {
+                                        d_sample_counter += static_cast<uint64_t>(ninput_items[0]);
+                                        consume_each(ninput_items[0]);
+                                    }
+                                else
+                                    {
+                                        consume_each(0);
+                                    }
+                                break;
+                            }
+                        d_worker_active = true;
+                    }
                 else
                     {
                         gr::thread::thread d_worker(&pcps_acquisition::acquisition_core, this, d_sample_counter);
@@ -43,8 +43,9 @@
 #endif
 
 #include "acq_conf.h"
+#include "acq_shared_engine.h"
 #include "channel_fsm.h"
-#include "gnss_sdr_fft.h"
+#include "gnss_sdr_fft_cache.h"
 #include <armadillo>
 #include <gnuradio/block.h>
 #include <gnuradio/gr_complex.h>              // for gr_complex
@@ -58,6 +59,7 @@
 #include <queue>
 #include <string>
 #include <utility>
+#include <vector>
 
 
 #if HAS_STD_SPAN
@@ -153,6 +155,18 @@ public:
         d_channel = channel;
     }
 
+    /*!
+     * \brief Set the RF channel (signal conditioner) feeding this block. Only
+     * the blocks fed by the same RF channel share an acquisition engine.
+     * \param rf_channel - RF channel ID.
+     */
+    inline void set_rf_channel(int32_t rf_channel)
+    {
+        gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
+        d_rf_channel = rf_channel;
+        d_shared_engine = nullptr;
+    }
+
     /*!
      * \brief Set channel fsm associated to this acquisition instance
      */
@@ -212,6 +226,10 @@ private:
     void update_local_carrier(own::span<gr_complex> carrier_vector, float freq) const;
     void update_grid_doppler_wipeoffs();
     void update_grid_doppler_wipeoffs_step2();
+    void update_grid_doppler_shifts();
+    bool use_shared_engine();
+    bool submit_to_pool(uint64_t samp_count);
+    void cancel_acquisition_core();
     void acquisition_core(uint64_t samp_count);
     void send_negative_acquisition();
     void send_positive_acquisition();
@@ -227,12 +245,16 @@ private:
     volk_gnsssdr::vector<std::complex<float>> d_input_signal;
     volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_wipeoffs;
     volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_wipeoffs_step_two;
+    volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_residual_doppler_wipeoffs;
+    volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_residual_input_spectra;
     volk_gnsssdr::vector<std::complex<float>> d_fft_codes;
     volk_gnsssdr::vector<std::complex<float>> d_data_buffer;
     volk_gnsssdr::vector<lv_16sc_t> d_data_buffer_sc;
 
-    std::unique_ptr<gnss_fft_complex_fwd> d_fft_if;
-    std::unique_ptr<gnss_fft_complex_rev> d_ifft;
+    gnss_fft_fwd_cached_ptr d_fft_if;
+    gnss_fft_rev_cached_ptr d_ifft;
+    std::shared_ptr<Acq_Shared_Engine> d_shared_engine;
+    std::shared_ptr<const Acq_Shared_Engine::Snapshot> d_shared_snapshot;
     std::weak_ptr<ChannelFsm> d_channel_fsm;
 
     Acq_Conf d_acq_parameters;
@@ -240,11 +262,17 @@ private:
     arma::fmat d_grid;
     arma::fmat d_narrow_grid;
 
+    std::vector<float> d_residual_doppler_hz;
+    std::vector<uint32_t> d_doppler_residual_index;
+    std::vector<uint32_t> d_doppler_bin_shift;
+
     std::queue<Gnss_Synchro> d_monitor_queue;
     std::string d_dump_filename;
 
     int64_t d_dump_number;
     uint64_t d_sample_counter;
+    uint64_t d_snapshot_sample_counter;  // d_sample_counter at the end of the buffered snapshot
+    uint64_t d_shared_min_stamp;
 
     float d_threshold;
     float d_mag;
@@ -256,6 +284,7 @@ private:
     int32_t d_positive_acq;
     int32_t d_doppler_center;
     int32_t d_doppler_bias;
+    int32_t d_rf_channel;
     uint32_t d_channel;
     uint32_t d_samplesPerChip;
     uint32_t d_doppler_step;
@@ -272,6 +301,7 @@ private:
     bool d_cshort;
     bool d_step_two;
     bool d_use_CFAR_algorithm_flag;
+    bool d_freq_domain_doppler;
     bool d_dump;
 };
 
@@ -18,6 +18,8 @@
 #include "acq_conf.h"
 #include "item_type_helpers.h"
 #include <cmath>
+#include <sstream>
+#include <stdexcept>
 
 #if USE_GLOG_AND_GFLAGS
 #include <glog/logging.h>
@@ -81,6 +83,26 @@ void Acq_Conf::SetFromConfiguration(const ConfigurationInterface *configuration,
         }
     make_2_steps = configuration->property(role + ".make_two_steps", make_2_steps);
     blocking_on_standby = configuration->property(role + ".blocking_on_standby", blocking_on_standby);
+    freq_domain_doppler = configuration->property(role + ".freq_domain_doppler", freq_domain_doppler);
+    shared_engine = configuration->property(role + ".shared_engine", shared_engine);
+
+    pool_threads = configuration->property("GNSS-SDR.acquisition_pool_threads", pool_threads);
+    pool_queue_size = configuration->property("GNSS-SDR.acquisition_pool_queue_size", pool_queue_size);
+    const std::string pool_cpus_str = configuration->property("GNSS-SDR.acquisition_pool_cpus", std::string(""));
+    std::stringstream cpus_ss(pool_cpus_str);
+    std::string cpu;
+    pool_cpus.clear();
+    while (std::getline(cpus_ss, cpu, ','))
+        {
+            try
+                {
+                    pool_cpus.push_back(std::stoi(cpu));
+                }
+            catch (const std::exception &)
+                {
+                    LOG(WARNING) << "Invalid CPU '" << cpu << "' in GNSS-SDR.acquisition_pool_cpus";
+                }
+        }
 
     if (pfa <= 0.0)
         {
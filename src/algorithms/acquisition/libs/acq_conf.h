@@ -22,6 +22,7 @@
 #include <gnuradio/gr_complex.h>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 /** \addtogroup Acquisition
  * \{ */
@@ -62,6 +63,8 @@ public:
     uint32_t num_doppler_bins_step2{4U};
     uint32_t resampler_latency_samples{0U};
     uint32_t dump_channel{0U};
+    uint32_t pool_threads{0U};       // Number of acquisition workers. 0: one new thread per non-blocking search
+    uint32_t pool_queue_size{256U};  // Maximum number of pending searches in the acquisition task pool
     int32_t doppler_max{5000};
     int32_t doppler_min{-5000};
 
@@ -73,6 +76,10 @@ public:
     bool make_2_steps{false};
     bool use_automatic_resampler{false};
     bool enable_monitor_output{false};
+    bool freq_domain_doppler{false};  // Build Doppler hypotheses by shifting the input spectrum instead of one FFT per bin
+    bool shared_engine{false};        // Share input snapshots and their Doppler spectra among all channels of the same signal
+
+    std::vector<int32_t> pool_cpus;  // CPUs to which the acquisition workers are pinned
 
 private:
     void SetDerivedParams();
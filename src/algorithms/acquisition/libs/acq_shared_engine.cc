@@ -0,0 +1,200 @@
+/*!
+ * \file acq_shared_engine.cc
+ * \brief Doppler search engine shared by all the PCPS acquisition channels
+ * working on the same signal.
+ * \author Carles Fernandez, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acq_shared_engine.h"
+#include "MATH_CONSTANTS.h"
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>  // for std::find_if, std::copy
+#include <array>
+#include <cmath>
+#include <iterator>  // for std::distance
+#include <map>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+void acq_doppler_grid_shifts(const std::vector<double>& doppler_hz,
+    double bin_width_hz,
+    uint32_t fft_size,
+    std::vector<float>& residual_hz,
+    std::vector<uint32_t>& residual_index,
+    std::vector<uint32_t>& bin_shift)
+{
+    const double tolerance_hz = bin_width_hz * 1e-6;
+    const auto n = static_cast<int64_t>(fft_size);
+    residual_hz.clear();
+    residual_index.assign(doppler_hz.size(), 0U);
+    bin_shift.assign(doppler_hz.size(), 0U);
+    for (size_t i = 0; i < doppler_hz.size(); i++)
+        {
+            auto bin = static_cast<int64_t>(std::floor(doppler_hz[i] / bin_width_hz));
+            double residual = doppler_hz[i] - static_cast<double>(bin) * bin_width_hz;
+            if (residual > bin_width_hz - tolerance_hz)
+                {
+                    bin++;
+                    residual = 0.0;
+                }
+            const auto it = std::find_if(residual_hz.cbegin(), residual_hz.cend(),
+                [residual, tolerance_hz](float r) { return std::abs(static_cast<double>(r) - residual) < tolerance_hz; });
+            residual_index[i] = static_cast<uint32_t>(std::distance(residual_hz.cbegin(), it));
+            if (it == residual_hz.cend())
+                {
+                    residual_hz.push_back(static_cast<float>(residual));
+                }
+            bin_shift[i] = static_cast<uint32_t>(((bin % n) + n) % n);
+        }
+}
+
+
+std::shared_ptr<Acq_Shared_Engine> Acq_Shared_Engine::get_instance(const std::string& signal,
+    int32_t rf_channel,
+    int64_t fs,
+    uint32_t fft_size,
+    uint32_t consumed_samples,
+    int32_t doppler_max,
+    uint32_t doppler_step,
+    bool freq_domain_doppler)
+{
+    static std::mutex registry_mutex;
+    static std::map<std::string, std::weak_ptr<Acq_Shared_Engine>> registry;
+
+    const std::string key = signal + "_" + std::to_string(rf_channel) + "_" + std::to_string(fs) + "_" + std::to_string(fft_size) + "_" +
+                            std::to_string(consumed_samples) + "_" + std::to_string(doppler_max) + "_" +
+                            std::to_string(doppler_step) + (freq_domain_doppler ? "_f" : "_t");
+
+    std::lock_guard<std::mutex> lk(registry_mutex);
+    auto engine = registry[key].lock();
+    if (!engine)
+        {
+            engine = std::make_shared<Acq_Shared_Engine>(fs, fft_size, doppler_max, doppler_step, freq_domain_doppler);
+            registry[key] = engine;
+            DLOG(INFO) << "Created shared acquisition engine " << key;
+        }
+    return engine;
+}
+
+
+Acq_Shared_Engine::Acq_Shared_Engine(int64_t fs,
+    uint32_t fft_size,
+    int32_t doppler_max,
+    uint32_t doppler_step,
+    bool freq_domain_doppler)
+    : d_fft(gnss_fft_fwd_make_cached(fft_size)),
+      d_fft_size(fft_size),
+      d_num_doppler_bins(static_cast<uint32_t>(std::ceil(static_cast<double>(2 * doppler_max) / static_cast<double>(doppler_step))))
+{
+    std::vector<double> doppler_hz(d_num_doppler_bins);
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            doppler_hz[doppler_index] = static_cast<double>(-doppler_max + static_cast<int32_t>(doppler_step * doppler_index));
+        }
+
+    if (freq_domain_doppler)
+        {
+            acq_doppler_grid_shifts(doppler_hz, static_cast<double>(fs) / static_cast<double>(fft_size), fft_size, d_residual_hz, d_residual_index, d_bin_shift);
+        }
+    else
+        {
+            // One wipeoff per Doppler bin, no spectrum shift
+            d_residual_hz = std::vector<float>(doppler_hz.cbegin(), doppler_hz.cend());
+            d_residual_index = std::vector<uint32_t>(d_num_doppler_bins);
+            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+                {
+                    d_residual_index[doppler_index] = doppler_index;
+                }
+            d_bin_shift = std::vector<uint32_t>(d_num_doppler_bins, 0U);
+        }
+
+    d_wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::vector<gr_complex>>(d_residual_hz.size(), volk_gnsssdr::vector<gr_complex>(fft_size));
+    for (size_t i = 0; i < d_residual_hz.size(); i++)
+        {
+            const auto phase_step_rad = static_cast<float>(TWO_PI) * d_residual_hz[i] / static_cast<float>(fs);
+            std::array<float, 1> _phase{};
+            volk_gnsssdr_s32f_sincos_32fc(d_wipeoffs[i].data(), -phase_step_rad, _phase.data(), fft_size);
+        }
+}
+
+
+std::shared_ptr<const Acq_Shared_Engine::Snapshot> Acq_Shared_Engine::latest_snapshot(uint64_t min_sample_stamp)
+{
+    std::lock_guard<std::mutex> lk(d_mutex);
+    if (d_latest && d_latest->sample_stamp >= min_sample_stamp)
+        {
+            d_reused++;
+            return d_latest;
+        }
+    return nullptr;
+}
+
+
+std::shared_ptr<const Acq_Shared_Engine::Snapshot> Acq_Shared_Engine::publish(const gr_complex* in, uint64_t sample_stamp)
+{
+    // The FFTs are computed holding only d_fft_mutex, so the channels calling
+    // latest_snapshot() meanwhile are not blocked. Concurrent publishers wait
+    // here, and then reuse the snapshot published by the first one.
+    std::lock_guard<std::mutex> fft_lk(d_fft_mutex);
+    std::shared_ptr<Snapshot> snapshot;
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        if (d_latest && d_latest->sample_stamp >= sample_stamp)
+            {
+                d_reused++;
+                return d_latest;
+            }
+        // Recycle the memory of an older snapshot if no channel is still using it
+        if (d_spare && d_spare.use_count() == 1)
+            {
+                snapshot = std::move(d_spare);
+            }
+    }
+    if (!snapshot)
+        {
+            snapshot = std::make_shared<Snapshot>();
+            snapshot->spectra = volk_gnsssdr::vector<volk_gnsssdr::vector<gr_complex>>(d_wipeoffs.size(), volk_gnsssdr::vector<gr_complex>(d_fft_size));
+        }
+
+    for (size_t i = 0; i < d_wipeoffs.size(); i++)
+        {
+            volk_32fc_x2_multiply_32fc(d_fft->get_inbuf(), in, d_wipeoffs[i].data(), d_fft_size);
+            d_fft->execute();
+            std::copy(d_fft->get_outbuf(), d_fft->get_outbuf() + d_fft_size, snapshot->spectra[i].data());
+        }
+    snapshot->sample_stamp = sample_stamp;
+
+    std::lock_guard<std::mutex> lk(d_mutex);
+    d_spare = std::move(d_latest);
+    d_latest = std::move(snapshot);
+    d_published++;
+    return d_latest;
+}
+
+
+void Acq_Shared_Engine::multiply_code(const Snapshot& snapshot, uint32_t doppler_index, const gr_complex* fft_code, gr_complex* out) const
+{
+    const uint32_t shift = d_bin_shift[doppler_index];
+    const gr_complex* spectrum = snapshot.spectra[d_residual_index[doppler_index]].data();
+    volk_32fc_x2_multiply_32fc(out, spectrum + shift, fft_code, d_fft_size - shift);
+    if (shift > 0)
+        {
+            volk_32fc_x2_multiply_32fc(out + d_fft_size - shift, spectrum, fft_code + d_fft_size - shift, shift);
+        }
+}
@@ -0,0 +1,151 @@
+/*!
+ * \file acq_shared_engine.h
+ * \brief Doppler search engine shared by all the PCPS acquisition channels
+ * working on the same signal.
+ * \author Carles Fernandez, 2026. cfernandez(at)cttc.es
+ *
+ * All the channels of a given signal fed by the same RF channel (signal
+ * conditioner) see the same input, so an input snapshot taken by one channel
+ * is valid for all of them. This
+ * engine computes the Doppler wipeoff and the forward FFT of a snapshot only
+ * once, and every channel then correlates the resulting spectra with its own
+ * FFT'd local code.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_SHARED_ENGINE_H
+#define GNSS_SDR_ACQ_SHARED_ENGINE_H
+
+#include "gnss_sdr_fft_cache.h"
+#include <gnuradio/gr_complex.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs
+ * \{ */
+
+
+/*!
+ * \brief Splits each frequency of a Doppler grid into a whole number of FFT
+ * bins, applied as a circular shift of the input spectrum, plus a residual
+ * frequency, applied as a carrier wipeoff before the forward FFT.
+ *
+ * On return, residual_hz contains the distinct residual frequencies, and
+ * residual_index and bin_shift contain, for each grid frequency, the index
+ * of its residual and its shift in bins.
+ */
+void acq_doppler_grid_shifts(const std::vector<double>& doppler_hz,
+    double bin_width_hz,
+    uint32_t fft_size,
+    std::vector<float>& residual_hz,
+    std::vector<uint32_t>& residual_index,
+    std::vector<uint32_t>& bin_shift);
+
+
+/*!
+ * \brief Shared Doppler search engine for PCPS acquisition.
+ *
+ * Instances are obtained through get_instance(), which returns the same
+ * engine to all the callers with the same signal and grid parameters.
+ */
+class Acq_Shared_Engine
+{
+public:
+    /*!
+     * \brief Forward FFTs of a Doppler wiped-off input snapshot.
+     */
+    struct Snapshot
+    {
+        uint64_t sample_stamp{0ULL};
+        volk_gnsssdr::vector<volk_gnsssdr::vector<gr_complex>> spectra;
+    };
+
+    /*!
+     * \brief Returns the engine shared by all the acquisition blocks with the
+     * same signal, RF channel and parameters, creating it if needed.
+     */
+    static std::shared_ptr<Acq_Shared_Engine> get_instance(const std::string& signal,
+        int32_t rf_channel,
+        int64_t fs,
+        uint32_t fft_size,
+        uint32_t consumed_samples,
+        int32_t doppler_max,
+        uint32_t doppler_step,
+        bool freq_domain_doppler);
+
+    Acq_Shared_Engine(int64_t fs,
+        uint32_t fft_size,
+        int32_t doppler_max,
+        uint32_t doppler_step,
+        bool freq_domain_doppler);
+
+    /*!
+     * \brief Returns the latest snapshot if it was taken at or after
+     * min_sample_stamp, or nullptr otherwise.
+     */
+    std::shared_ptr<const Snapshot> latest_snapshot(uint64_t min_sample_stamp);
+
+    /*!
+     * \brief Computes the spectra of fft_size input samples taken at
+     * sample_stamp and makes them available to all the channels. If a newer
+     * snapshot has already been published, that one is returned instead.
+     */
+    std::shared_ptr<const Snapshot> publish(const gr_complex* in, uint64_t sample_stamp);
+
+    /*!
+     * \brief Multiplies the spectrum of the given Doppler bin by the FFT'd
+     * local code, writing fft_size samples into out.
+     */
+    void multiply_code(const Snapshot& snapshot, uint32_t doppler_index, const gr_complex* fft_code, gr_complex* out) const;
+
+    inline uint32_t num_doppler_bins() const
+    {
+        return d_num_doppler_bins;
+    }
+
+    inline uint64_t published_snapshots() const
+    {
+        return d_published;
+    }
+
+    inline uint64_t reused_snapshots() const
+    {
+        return d_reused;
+    }
+
+private:
+    volk_gnsssdr::vector<volk_gnsssdr::vector<gr_complex>> d_wipeoffs;
+    std::vector<float> d_residual_hz;
+    std::vector<uint32_t> d_residual_index;
+    std::vector<uint32_t> d_bin_shift;
+    gnss_fft_fwd_cached_ptr d_fft;
+    std::shared_ptr<Snapshot> d_latest;
+    std::shared_ptr<Snapshot> d_spare;
+    std::mutex d_mutex;      // guards d_latest and d_spare
+    std::mutex d_fft_mutex;  // guards d_fft
+    std::atomic<uint64_t> d_published{0ULL};
+    std::atomic<uint64_t> d_reused{0ULL};
+    uint32_t d_fft_size;
+    uint32_t d_num_doppler_bins;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ACQ_SHARED_ENGINE_H
@@ -0,0 +1,243 @@
+/*!
+ * \file acq_task_pool.cc
+ * \brief Receiver-wide pool of worker threads for non-blocking acquisition.
+ * \author Carles Fernandez, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acq_task_pool.h"
+#include <algorithm>  // for std::max
+#include <exception>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+constexpr int32_t Acq_Task_Pool::DEFAULT_PRIORITY;
+
+
+Acq_Task_Pool& Acq_Task_Pool::instance()
+{
+    static Acq_Task_Pool pool;
+    return pool;
+}
+
+
+Acq_Task_Pool::~Acq_Task_Pool()
+{
+    stop();
+}
+
+
+void Acq_Task_Pool::start(uint32_t num_workers, const std::vector<int32_t>& cpus, size_t max_queue_size)
+{
+    std::lock_guard<std::mutex> lk(d_mutex);
+    if (d_running || num_workers == 0)
+        {
+            return;
+        }
+    d_running = true;
+    d_stats = Stats();
+    d_total_wait_us = 0.0;
+    d_total_run_us = 0.0;
+    d_max_queue_size = std::max<size_t>(max_queue_size, 1);
+    d_workers.reserve(num_workers);
+    for (uint32_t i = 0; i < num_workers; i++)
+        {
+            const int32_t cpu = cpus.empty() ? -1 : cpus[i % cpus.size()];
+            d_workers.emplace_back(&Acq_Task_Pool::worker, this, cpu);
+        }
+    LOG(INFO) << "Acquisition task pool started with " << num_workers << " workers";
+}
+
+
+void Acq_Task_Pool::stop()
+{
+    std::vector<std::thread> workers;
+    decltype(d_queue) pending;
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        if (!d_running)
+            {
+                return;
+            }
+        d_running = false;
+        std::swap(pending, d_queue);
+        workers.swap(d_workers);
+    }
+    d_cond.notify_all();
+    for (auto& w : workers)
+        {
+            if (w.joinable())
+                {
+                    w.join();
+                }
+        }
+
+    // The submitters of the tasks that did not run are told, so they do not
+    // wait for them
+    uint64_t cancelled = 0ULL;
+    while (!pending.empty())
+        {
+            const Task& task = pending.top();
+            if (task.cancel)
+                {
+                    try
+                        {
+                            task.cancel();
+                        }
+                    catch (const std::exception& e)
+                        {
+                            LOG(ERROR) << "Exception cancelling acquisition task: " << e.what();
+                        }
+                }
+            pending.pop();
+            cancelled++;
+        }
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        d_stats.cancelled += cancelled;
+    }
+
+    const Stats s = stats();
+    LOG(INFO) << "Acquisition task pool stopped. Tasks executed: " << s.executed
+              << ", rejected: " << s.rejected
+              << ", cancelled: " << s.cancelled
+              << ", max queue depth: " << s.max_queue_depth
+              << ", mean / max queue wait: " << s.mean_wait_us << " / " << s.max_wait_us << " us"
+              << ", mean / max execution time: " << s.mean_run_us << " / " << s.max_run_us << " us";
+}
+
+
+bool Acq_Task_Pool::running() const
+{
+    std::lock_guard<std::mutex> lk(d_mutex);
+    return d_running;
+}
+
+
+bool Acq_Task_Pool::submit(std::function<void()> task, int32_t priority, std::function<void()> cancel)
+{
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        if (!d_running || d_queue.size() >= d_max_queue_size)
+            {
+                d_stats.rejected++;
+                return false;
+            }
+        d_queue.push(Task{std::move(task), std::move(cancel), std::chrono::steady_clock::now(), d_stats.submitted++, priority});
+        d_stats.max_queue_depth = std::max(d_stats.max_queue_depth, d_queue.size());
+    }
+    d_cond.notify_one();
+    return true;
+}
+
+
+void Acq_Task_Pool::set_satellite_priority(char system, uint32_t prn, int32_t priority)
+{
+    std::lock_guard<std::mutex> lk(d_priority_mutex);
+    d_satellite_priority[std::make_pair(system, prn)] = priority;
+}
+
+
+void Acq_Task_Pool::clear_satellite_priorities()
+{
+    std::lock_guard<std::mutex> lk(d_priority_mutex);
+    d_satellite_priority.clear();
+}
+
+
+int32_t Acq_Task_Pool::satellite_priority(char system, uint32_t prn) const
+{
+    std::lock_guard<std::mutex> lk(d_priority_mutex);
+    const auto it = d_satellite_priority.find(std::make_pair(system, prn));
+    return it == d_satellite_priority.cend() ? DEFAULT_PRIORITY : it->second;
+}
+
+
+Acq_Task_Pool::Stats Acq_Task_Pool::stats() const
+{
+    std::lock_guard<std::mutex> lk(d_mutex);
+    Stats s = d_stats;
+    s.queue_depth = d_queue.size();
+    if (s.executed > 0)
+        {
+            s.mean_wait_us = d_total_wait_us / static_cast<double>(s.executed);
+            s.mean_run_us = d_total_run_us / static_cast<double>(s.executed);
+        }
+    return s;
+}
+
+
+void Acq_Task_Pool::worker(int32_t cpu)
+{
+#if defined(__linux__)
+    if (cpu >= 0)
+        {
+            cpu_set_t cpuset;
+            CPU_ZERO(&cpuset);
+            CPU_SET(cpu, &cpuset);
+            if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) != 0)
+                {
+                    LOG(WARNING) << "Unable to pin acquisition worker to CPU " << cpu;
+                }
+        }
+#else
+    if (cpu >= 0)
+        {
+            LOG(WARNING) << "CPU pinning of acquisition workers is not supported on this platform";
+        }
+#endif
+
+    while (true)
+        {
+            Task task;
+            {
+                std::unique_lock<std::mutex> lk(d_mutex);
+                d_cond.wait(lk, [this] { return !d_running || !d_queue.empty(); });
+                if (!d_running)
+                    {
+                        return;
+                    }
+                task = d_queue.top();
+                d_queue.pop();
+            }
+
+            const auto t_start = std::chrono::steady_clock::now();
+            try
+                {
+                    task.run();
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(ERROR) << "Exception in acquisition task: " << e.what();
+                }
+            const auto t_end = std::chrono::steady_clock::now();
+
+            const double wait_us = std::chrono::duration<double, std::micro>(t_start - task.enqueued).count();
+            const double run_us = std::chrono::duration<double, std::micro>(t_end - t_start).count();
+            std::lock_guard<std::mutex> lk(d_mutex);
+            d_stats.executed++;
+            d_total_wait_us += wait_us;
+            d_total_run_us += run_us;
+            d_stats.max_wait_us = std::max(d_stats.max_wait_us, wait_us);
+            d_stats.max_run_us = std::max(d_stats.max_run_us, run_us);
+        }
+}
@@ -0,0 +1,151 @@
+/*!
+ * \file acq_task_pool.h
+ * \brief Receiver-wide pool of worker threads for non-blocking acquisition.
+ * \author Carles Fernandez, 2026. cfernandez(at)cttc.es
+ *
+ * Instead of creating a new thread at each dwell of each channel, the
+ * non-blocking acquisition blocks submit their search to a fixed set of
+ * (optionally CPU-pinned) workers. Pending searches are served by satellite
+ * priority, as set by the flowgraph from the list of visible satellites.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_TASK_POOL_H
+#define GNSS_SDR_ACQ_TASK_POOL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs
+ * \{ */
+
+
+class Acq_Task_Pool
+{
+public:
+    static constexpr int32_t DEFAULT_PRIORITY = std::numeric_limits<int32_t>::min();
+
+    /*!
+     * \brief Pool statistics. Latencies are in microseconds.
+     */
+    struct Stats
+    {
+        uint64_t submitted{0ULL};
+        uint64_t executed{0ULL};
+        uint64_t rejected{0ULL};
+        uint64_t cancelled{0ULL};
+        size_t queue_depth{0};
+        size_t max_queue_depth{0};
+        double mean_wait_us{0.0};
+        double max_wait_us{0.0};
+        double mean_run_us{0.0};
+        double max_run_us{0.0};
+    };
+
+    /*!
+     * \brief Returns the receiver-wide pool.
+     */
+    static Acq_Task_Pool& instance();
+
+    ~Acq_Task_Pool();
+
+    Acq_Task_Pool(const Acq_Task_Pool&) = delete;
+    Acq_Task_Pool& operator=(const Acq_Task_Pool&) = delete;
+
+    /*!
+     * \brief Starts num_workers threads and resets the statistics. Worker i is
+     * pinned to cpus[i % cpus.size()] if cpus is not empty. Does nothing if the
+     * pool is already running.
+     */
+    void start(uint32_t num_workers, const std::vector<int32_t>& cpus, size_t max_queue_size);
+
+    /*!
+     * \brief Stops the workers. Pending tasks are not run, their cancel
+     * callbacks are called instead once the workers have finished.
+     */
+    void stop();
+
+    bool running() const;
+
+    /*!
+     * \brief Queues a task. Tasks with higher priority run first, and tasks
+     * with the same priority run in submission order. Returns false if the
+     * pool is not running or the queue is full. If the pool is stopped before
+     * the task runs, cancel is called instead.
+     */
+    bool submit(std::function<void()> task, int32_t priority = DEFAULT_PRIORITY, std::function<void()> cancel = nullptr);
+
+    /*!
+     * \brief Sets the priority of a satellite (e.g., its elevation in degrees).
+     * \param system - System letter as in Gnss_Synchro::System ('G', 'E', ...)
+     */
+    void set_satellite_priority(char system, uint32_t prn, int32_t priority);
+
+    void clear_satellite_priorities();
+
+    /*!
+     * \brief Returns the priority of a satellite, or DEFAULT_PRIORITY if unknown.
+     */
+    int32_t satellite_priority(char system, uint32_t prn) const;
+
+    Stats stats() const;
+
+private:
+    struct Task
+    {
+        std::function<void()> run;
+        std::function<void()> cancel;
+        std::chrono::steady_clock::time_point enqueued;
+        uint64_t sequence;
+        int32_t priority;
+    };
+
+    struct Task_Order
+    {
+        bool operator()(const Task& a, const Task& b) const
+        {
+            return (a.priority < b.priority) || ((a.priority == b.priority) && (a.sequence > b.sequence));
+        }
+    };
+
+    Acq_Task_Pool() = default;
+    void worker(int32_t cpu);
+
+    std::priority_queue<Task, std::vector<Task>, Task_Order> d_queue;
+    std::vector<std::thread> d_workers;
+    std::map<std::pair<char, uint32_t>, int32_t> d_satellite_priority;
+    mutable std::mutex d_mutex;
+    mutable std::mutex d_priority_mutex;
+    std::condition_variable d_cond;
+    Stats d_stats;
+    double d_total_wait_us{0.0};
+    double d_total_run_us{0.0};
+    size_t d_max_queue_size{0};
+    bool d_running{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ACQ_TASK_POOL_H
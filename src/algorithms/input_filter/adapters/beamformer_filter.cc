@@ -42,7 +42,10 @@ BeamformerFilter::BeamformerFilter(
     if (item_type_ == "gr_complex")
         {
             item_size_ = sizeof(gr_complex);
-            beamformer_ = make_beamformer_sptr();
+            const bool adaptive = configuration->property(role + ".adaptive", false);
+            const uint64_t update_period = configuration->property(role + ".adaptive_update_period_samples", static_cast<uint64_t>(4000000));
+            const int32_t snapshot_size = configuration->property(role + ".adaptive_snapshot_samples", 1024);
+            beamformer_ = make_beamformer_sptr(adaptive, update_period, snapshot_size);
             DLOG(INFO) << "Item size " << item_size_;
             DLOG(INFO) << "resampler(" << beamformer_->unique_id() << ")";
         }
@@ -1,14 +1,14 @@
 /*!
  * \file beamformer.cc
  *
- * \brief Unpacks byte samples to NSR 2 bits samples
+ * \brief Simple spatial filter using RAW array input and beamforming coefficients
  * \author Javier Arribas jarribas (at) cttc.es
  * -----------------------------------------------------------------------------
  *
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -16,21 +16,153 @@
 
 
 #include "beamformer.h"
+#include <armadillo>
 #include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>  // for std::min, std::copy
 #include <cstddef>
 
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
 
-beamformer_sptr make_beamformer_sptr()
+#if HAS_GENERIC_LAMBDA
+#else
+#include <boost/bind/bind.hpp>
+#endif
+
+
+beamformer_sptr make_beamformer_sptr(bool adaptive, uint64_t update_period, int32_t snapshot_size)
+{
+    return beamformer_sptr(new beamformer(adaptive, update_period, snapshot_size));
+}
+
+
+void beamformer_combine(gr_complex *out, const gr_vector_const_void_star &in,
+    const std::vector<gr_complex> &weights, int num_samples, gr_complex *tmp)
 {
-    return beamformer_sptr(new beamformer());
+    for (int offset = 0; offset < num_samples; offset += GNSS_SDR_BEAMFORMER_BLOCK_SIZE)
+        {
+            const auto len = static_cast<unsigned int>(std::min(GNSS_SDR_BEAMFORMER_BLOCK_SIZE, num_samples - offset));
+            gr_complex *block_out = out + offset;
+            for (size_t i = 0; i < weights.size(); i++)
+                {
+                    const gr_complex *block_in = reinterpret_cast<const gr_complex *>(in[i]) + offset;
+                    gr_complex *product = (i == 0) ? block_out : tmp;
+#if VOLK_EQUAL_OR_GREATER_31
+                    volk_32fc_s32fc_multiply2_32fc(product, block_in, &weights[i], len);
+#else
+                    volk_32fc_s32fc_multiply_32fc(product, block_in, weights[i], len);
+#endif
+                    if (i > 0)
+                        {
+                            volk_32f_x2_add_32f(reinterpret_cast<float *>(block_out), reinterpret_cast<const float *>(block_out),
+                                reinterpret_cast<const float *>(tmp), 2 * len);
+                        }
+                }
+        }
 }
 
 
-beamformer::beamformer()
+beamformer::beamformer(bool adaptive, uint64_t update_period, int32_t snapshot_size)
     : gr::sync_block("beamformer",
           gr::io_signature::make(GNSS_SDR_BEAMFORMER_CHANNELS, GNSS_SDR_BEAMFORMER_CHANNELS, sizeof(gr_complex)),
-          gr::io_signature::make(1, 1, sizeof(gr_complex)))
+          gr::io_signature::make(1, 1, sizeof(gr_complex))),
+      d_tmp(GNSS_SDR_BEAMFORMER_BLOCK_SIZE),
+      d_update_period(update_period),
+      d_samples_since_update(update_period),
+      d_snapshot_size(std::max(snapshot_size, 4 * GNSS_SDR_BEAMFORMER_CHANNELS)),
+      d_adaptive(adaptive)
+{
+    const int alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
+    set_alignment(std::max(1, alignment_multiple));
+
+    this->message_port_register_in(pmt::mp("weights"));
+    this->set_msg_handler(pmt::mp("weights"),
+#if HAS_GENERIC_LAMBDA
+        [this](auto &&PH1) { msg_handler_weights(PH1); });
+#else
+#if USE_BOOST_BIND_PLACEHOLDERS
+        boost::bind(&beamformer::msg_handler_weights, this, boost::placeholders::_1));
+#else
+        boost::bind(&beamformer::msg_handler_weights, this, _1));
+#endif
+#endif
+}
+
+
+void beamformer::set_weights(const std::vector<gr_complex> &weights)
+{
+    if (weights.size() != static_cast<size_t>(GNSS_SDR_BEAMFORMER_CHANNELS))
+        {
+            LOG(WARNING) << "Beamformer weights ignored: got " << weights.size()
+                         << ", expected " << GNSS_SDR_BEAMFORMER_CHANNELS;
+            return;
+        }
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_new_weights = weights;
+    d_new_weights_pending.store(true, std::memory_order_release);
+}
+
+
+std::vector<gr_complex> beamformer::get_weights() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_new_weights_pending.load(std::memory_order_acquire) ? d_new_weights : d_weights;
+}
+
+
+void beamformer::msg_handler_weights(const pmt::pmt_t &msg)
 {
+    if (!pmt::is_c32vector(msg))
+        {
+            LOG(WARNING) << "Beamformer weights message is not a c32vector";
+            return;
+        }
+    set_weights(pmt::c32vector_elements(msg));
+}
+
+
+bool beamformer::update_adaptive_weights(const gr_vector_const_void_star &input_items, int num_samples)
+{
+    // Power inversion: minimize the output power with the weight of the
+    // reference element fixed to one. GNSS signals are below the noise, so
+    // this only places nulls towards the interferences.
+    const int n = std::min(num_samples, d_snapshot_size);
+    if (n < GNSS_SDR_BEAMFORMER_CHANNELS)
+        {
+            return false;
+        }
+    arma::cx_fmat snapshot(n, GNSS_SDR_BEAMFORMER_CHANNELS);
+    for (int i = 0; i < GNSS_SDR_BEAMFORMER_CHANNELS; i++)
+        {
+            const auto *in = reinterpret_cast<const gr_complex *>(input_items[i]);
+            std::copy(in, in + n, snapshot.colptr(i));
+        }
+    // R = E[x x^H], with one sample of x per row of the snapshot
+    arma::cx_fmat covariance = snapshot.st() * arma::conj(snapshot) / static_cast<float>(n);
+    // Diagonal loading, for a well-conditioned matrix
+    covariance.diag() += 1e-3F * std::real(arma::trace(covariance)) / static_cast<float>(GNSS_SDR_BEAMFORMER_CHANNELS);
+
+    arma::cx_fvec steering(GNSS_SDR_BEAMFORMER_CHANNELS, arma::fill::zeros);
+    steering(0) = gr_complex(1.0, 0.0);
+    arma::cx_fvec w;
+    if (!arma::solve(w, covariance, steering) || std::abs(w(0)) == 0.0F)
+        {
+            LOG(WARNING) << "Beamformer covariance matrix is singular, weights not updated";
+            return true;
+        }
+    w /= w(0);
+
+    // The output is w^H x
+    std::lock_guard<std::mutex> lock(d_mutex);
+    for (int i = 0; i < GNSS_SDR_BEAMFORMER_CHANNELS; i++)
+        {
+            d_weights[i] = std::conj(w(i));
+        }
+    return true;
 }
 
 
@@ -38,28 +170,25 @@ int beamformer::work(int noutput_items, gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
     auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
-    // channel output buffers
-    //  gr_complex *ch1 = (gr_complex *) input_items[0];
-    //  gr_complex *ch2 = (gr_complex *) input_items[1];
-    //  gr_complex *ch3 = (gr_complex *) input_items[2];
-    //  gr_complex *ch4 = (gr_complex *) input_items[3];
-    //  gr_complex *ch5 = (gr_complex *) input_items[4];
-    //  gr_complex *ch6 = (gr_complex *) input_items[5];
-    //  gr_complex *ch7 = (gr_complex *) input_items[6];
-    //  gr_complex *ch8 = (gr_complex *) input_items[7];
-
-    // NON-VOLK beamforming operation
-    // TODO: Implement VOLK SIMD-accelerated beamformer!
-    gr_complex sum;
-    for (int n = 0; n < noutput_items; n++)
+
+    if (d_new_weights_pending.load(std::memory_order_acquire))
         {
-            sum = gr_complex(0, 0);
-            for (size_t i = 0; i < weight_vector.size(); i++)
+            std::lock_guard<std::mutex> lock(d_mutex);
+            d_weights.swap(d_new_weights);
+            d_new_weights_pending.store(false, std::memory_order_release);
+        }
+
+    if (d_adaptive)
+        {
+            // If the call is too short for an update, it is tried again in the next one
+            if (d_samples_since_update >= d_update_period && update_adaptive_weights(input_items, noutput_items))
                 {
-                    sum = sum + (reinterpret_cast<const gr_complex *>(input_items[i]))[n] * weight_vector[i];
+                    d_samples_since_update = 0;
                 }
-            out[n] = sum;
+            d_samples_since_update += noutput_items;
         }
 
+    beamformer_combine(out, input_items, d_weights, noutput_items, d_tmp.data());
+
     return noutput_items;
 }
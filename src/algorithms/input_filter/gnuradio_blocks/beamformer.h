@@ -9,7 +9,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -20,6 +20,11 @@
 
 #include "gnss_block_interface.h"
 #include <gnuradio/sync_block.h>
+#include <pmt/pmt.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 #include <vector>
 
 /** \addtogroup Input_Filter
@@ -32,12 +37,34 @@ class beamformer;
 
 using beamformer_sptr = gnss_shared_ptr<beamformer>;
 
-beamformer_sptr make_beamformer_sptr();
+/*!
+ * \brief Makes a beamformer. If adaptive is true, the weights are recomputed
+ * every update_period samples from the covariance of snapshot_size samples
+ * (power inversion).
+ */
+beamformer_sptr make_beamformer_sptr(bool adaptive = false,
+    uint64_t update_period = 4000000,
+    int32_t snapshot_size = 1024);
 
 const int GNSS_SDR_BEAMFORMER_CHANNELS = 8;
 
+//! Samples combined at once, so the output and scratch blocks stay in the L1 cache
+const int GNSS_SDR_BEAMFORMER_BLOCK_SIZE = 1024;
+
+/*!
+ * \brief Computes out[n] = sum_i weights[i] * in[i][n], for n < num_samples,
+ * with VOLK kernels. tmp is a scratch buffer of at least
+ * GNSS_SDR_BEAMFORMER_BLOCK_SIZE items.
+ */
+void beamformer_combine(gr_complex *out, const gr_vector_const_void_star &in,
+    const std::vector<gr_complex> &weights, int num_samples, gr_complex *tmp);
+
 /*!
  * \brief This class implements a real-time software-defined spatial filter using the CTTC GNSS experimental antenna array input and a set of dynamically reloadable weights
+ *
+ * The weights can be replaced at runtime through the "weights" message port
+ * (a PMT c32vector with one weight per channel) or with set_weights(). New
+ * weights are applied from the next call to work().
  */
 class beamformer : public gr::sync_block
 {
@@ -46,10 +73,25 @@ public:
     int work(int noutput_items, gr_vector_const_void_star &input_items,
         gr_vector_void_star &output_items);
 
+    void set_weights(const std::vector<gr_complex> &weights);
+    std::vector<gr_complex> get_weights() const;
+
 private:
-    friend beamformer_sptr make_beamformer_sptr();
-    beamformer();
-    std::vector<gr_complex> weight_vector = std::vector<gr_complex>(GNSS_SDR_BEAMFORMER_CHANNELS, gr_complex(1.0, 0.0));
+    friend beamformer_sptr make_beamformer_sptr(bool adaptive, uint64_t update_period, int32_t snapshot_size);
+    beamformer(bool adaptive, uint64_t update_period, int32_t snapshot_size);
+    void msg_handler_weights(const pmt::pmt_t &msg);
+    // Returns false if there are too few samples for an update
+    bool update_adaptive_weights(const gr_vector_const_void_star &input_items, int num_samples);
+
+    std::vector<gr_complex> d_weights = std::vector<gr_complex>(GNSS_SDR_BEAMFORMER_CHANNELS, gr_complex(1.0, 0.0));
+    std::vector<gr_complex> d_new_weights;
+    volk_gnsssdr::vector<gr_complex> d_tmp;
+    mutable std::mutex d_mutex;
+    std::atomic<bool> d_new_weights_pending{false};
+    uint64_t d_update_period;
+    uint64_t d_samples_since_update;
+    int32_t d_snapshot_size;
+    bool d_adaptive;
 };
 
 
@@ -0,0 +1,43 @@
+/*!
+ * \file interference_mitigation_counters.cc
+ * \brief Throughput counters of the interference mitigation blocks
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "interference_mitigation_counters.h"
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+double Interference_Mitigation_Counters::throughput_sps() const
+{
+    const double work_time = work_time_s();
+    if (work_time <= 0.0)
+        {
+            return 0.0;
+        }
+    return static_cast<double>(d_samples) / work_time;
+}
+
+
+void Interference_Mitigation_Counters::log(const std::string& block_name) const
+{
+    LOG(INFO) << block_name << ": " << d_samples << " samples processed at "
+              << throughput_sps() * 1e-6 << " Msps, "
+              << d_estimation_segments << " segments used to estimate the noise, "
+              << d_filtered_segments << " segments filtered";
+}
@@ -0,0 +1,103 @@
+/*!
+ * \file interference_mitigation_counters.h
+ * \brief Throughput counters of the interference mitigation blocks
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_INTERFERENCE_MITIGATION_COUNTERS_H
+#define GNSS_SDR_INTERFERENCE_MITIGATION_COUNTERS_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_gnuradio_blocks
+ * \{ */
+
+
+/*!
+ * \brief Samples and segments processed by an interference mitigation
+ * block, and the time spent in its general_work().
+ *
+ * The counters are updated by the thread of the block, so they should be
+ * read once the flowgraph is stopped.
+ */
+class Interference_Mitigation_Counters
+{
+public:
+    //! Called when general_work() starts
+    inline void start_work()
+    {
+        d_start = std::chrono::steady_clock::now();
+    }
+
+    //! Called when general_work() returns, with the samples it produced
+    inline void end_work(int32_t num_samples)
+    {
+        d_work_time += std::chrono::steady_clock::now() - d_start;
+        d_samples += static_cast<uint64_t>(num_samples);
+    }
+
+    //! A segment was used to estimate the noise power
+    inline void add_estimation_segment()
+    {
+        d_estimation_segments++;
+    }
+
+    //! A segment exceeded the threshold, and was blanked or filtered
+    inline void add_filtered_segment()
+    {
+        d_filtered_segments++;
+    }
+
+    inline uint64_t samples() const
+    {
+        return d_samples;
+    }
+
+    inline uint64_t estimation_segments() const
+    {
+        return d_estimation_segments;
+    }
+
+    inline uint64_t filtered_segments() const
+    {
+        return d_filtered_segments;
+    }
+
+    //! Time spent in general_work() [s]
+    inline double work_time_s() const
+    {
+        return std::chrono::duration<double>(d_work_time).count();
+    }
+
+    //! Samples processed per second of general_work() [Sps]
+    double throughput_sps() const;
+
+    //! Writes the counters to the log, preceded by block_name
+    void log(const std::string& block_name) const;
+
+private:
+    std::chrono::steady_clock::time_point d_start{};
+    std::chrono::steady_clock::duration d_work_time{0};
+    uint64_t d_samples{0};
+    uint64_t d_estimation_segments{0};
+    uint64_t d_filtered_segments{0};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_INTERFERENCE_MITIGATION_COUNTERS_H
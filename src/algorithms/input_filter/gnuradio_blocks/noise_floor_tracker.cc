@@ -0,0 +1,130 @@
+/*!
+ * \file noise_floor_tracker.cc
+ * \brief Estimates the noise floor of a sample stream with decimated,
+ * overlapping FFTs
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "noise_floor_tracker.h"
+#include "MATH_CONSTANTS.h"
+#include <volk/volk.h>
+#include <algorithm>
+#include <cmath>
+
+
+Noise_Floor_Tracker::Noise_Floor_Tracker(int32_t fft_length,
+    int32_t num_windows,
+    int32_t decimation)
+    : d_fft(gnss_fft_fwd_make_unique(fft_length)),
+      d_buffer(fft_length),
+      d_window(fft_length),
+      d_power(fft_length),
+      d_spectrum(fft_length, 0.0),
+      d_window_power(0.0),
+      d_noise_power(0.0),
+      d_num_estimates(0),
+      d_fft_length(fft_length),
+      d_hop(std::max(1, fft_length / 2)),
+      d_num_windows(std::max(1, num_windows)),
+      d_decimation(std::max(1, decimation)),
+      d_skip(0),
+      d_fill(0),
+      d_windows_in_block(0)
+{
+    // Periodic Hann window. With 50 % overlap, all the samples of a block
+    // have the same weight in the averaged spectrum.
+    const auto two_pi = static_cast<float>(TWO_PI);
+    for (int32_t n = 0; n < d_fft_length; n++)
+        {
+            d_window[n] = 0.5F - 0.5F * std::cos(two_pi * static_cast<float>(n) / static_cast<float>(d_fft_length));
+            d_window_power += d_window[n] * d_window[n];
+        }
+}
+
+
+void Noise_Floor_Tracker::update(const gr_complex *in, int32_t num_samples)
+{
+    while (num_samples > 0)
+        {
+            if (d_skip > 0)
+                {
+                    const int32_t skipped = std::min(d_skip, num_samples);
+                    d_skip -= skipped;
+                    in += skipped;
+                    num_samples -= skipped;
+                    continue;
+                }
+            const int32_t copied = std::min(d_fft_length - d_fill, num_samples);
+            std::copy(in, in + copied, d_buffer.data() + d_fill);
+            d_fill += copied;
+            in += copied;
+            num_samples -= copied;
+            if (d_fill == d_fft_length)
+                {
+                    process_window();
+                }
+        }
+}
+
+
+void Noise_Floor_Tracker::reset()
+{
+    std::fill(d_spectrum.begin(), d_spectrum.end(), 0.0F);
+    d_noise_power = 0.0;
+    d_num_estimates = 0;
+    d_skip = 0;
+    d_fill = 0;
+    d_windows_in_block = 0;
+}
+
+
+void Noise_Floor_Tracker::process_window()
+{
+    volk_32fc_32f_multiply_32fc(d_fft->get_inbuf(), d_buffer.data(), d_window.data(), d_fft_length);
+    d_fft->execute();
+    volk_32fc_magnitude_squared_32f(d_power.data(), d_fft->get_outbuf(), d_fft_length);
+    volk_32f_x2_add_32f(d_spectrum.data(), d_spectrum.data(), d_power.data(), d_fft_length);
+    d_windows_in_block++;
+
+    if (d_windows_in_block == d_num_windows)
+        {
+            finish_block();
+            d_fill = 0;
+            d_skip = (d_decimation - 1) * (d_hop * (d_num_windows - 1) + d_fft_length);
+        }
+    else
+        {
+            // The next window starts d_hop samples later
+            std::copy(d_buffer.data() + d_hop, d_buffer.data() + d_fft_length, d_buffer.data());
+            d_fill = d_fft_length - d_hop;
+        }
+}
+
+
+void Noise_Floor_Tracker::finish_block()
+{
+    // Mean power per bin, in dB
+    const float scale = 1.0F / (static_cast<float>(d_num_windows) * d_window_power);
+    volk_32f_s32f_multiply_32f(d_spectrum.data(), d_spectrum.data(), scale, d_fft_length);
+    volk_32f_log2_32f(d_power.data(), d_spectrum.data(), d_fft_length);
+    volk_32f_s32f_multiply_32f(d_power.data(), d_power.data(), static_cast<float>(10.0 * std::log10(2.0)), d_fft_length);
+
+    float noise_floor_db = 0.0;
+    volk_32f_s32f_calc_spectral_noise_floor_32f(&noise_floor_db, d_power.data(), 15.0, d_fft_length);
+    const float noise_power = std::pow(10.0F, noise_floor_db / 10.0F);
+
+    d_noise_power = (static_cast<float>(d_num_estimates) * d_noise_power + noise_power) / static_cast<float>(d_num_estimates + 1);
+    d_num_estimates++;
+    d_windows_in_block = 0;
+    std::fill(d_spectrum.begin(), d_spectrum.end(), 0.0F);
+}
@@ -0,0 +1,104 @@
+/*!
+ * \file noise_floor_tracker.h
+ * \brief Estimates the noise floor of a sample stream with decimated,
+ * overlapping FFTs
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_NOISE_FLOOR_TRACKER_H
+#define GNSS_SDR_NOISE_FLOOR_TRACKER_H
+
+#include "gnss_sdr_fft.h"
+#include <gnuradio/gr_complex.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstdint>
+#include <memory>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_gnuradio_blocks
+ * \{ */
+
+
+/*!
+ * \brief Noise floor estimator shared by the notch filters.
+ *
+ * The stream is analyzed in blocks of num_windows Hann-windowed FFTs of
+ * fft_length samples with 50 % overlap (Welch method). The noise floor of
+ * each averaged spectrum is computed excluding the bins more than 15 dB above
+ * the mean, so narrowband interferences do not bias it. Only one block out
+ * of every decimation blocks is analyzed, and the estimate is the mean over
+ * the analyzed blocks since the last reset().
+ *
+ * All buffers are allocated in the constructor, and windows that straddle
+ * two calls to update() are completed from an internal buffer, so the
+ * caller can feed the samples in segments of any size.
+ */
+class Noise_Floor_Tracker
+{
+public:
+    explicit Noise_Floor_Tracker(int32_t fft_length,
+        int32_t num_windows = 8,
+        int32_t decimation = 4);
+
+    /*!
+     * \brief Feeds num_samples consecutive samples of the stream
+     */
+    void update(const gr_complex *in, int32_t num_samples);
+
+    /*!
+     * \brief Discards the estimate, and starts a new one with the next sample
+     */
+    void reset();
+
+    /*!
+     * \brief Noise power per complex sample
+     */
+    inline float noise_power() const
+    {
+        return d_noise_power;
+    }
+
+    /*!
+     * \brief Number of averaged spectra in the current estimate
+     */
+    inline uint32_t num_estimates() const
+    {
+        return d_num_estimates;
+    }
+
+private:
+    void process_window();
+    void finish_block();
+
+    std::unique_ptr<gnss_fft_complex_fwd> d_fft;
+    volk_gnsssdr::vector<gr_complex> d_buffer;
+    volk_gnsssdr::vector<float> d_window;
+    volk_gnsssdr::vector<float> d_power;
+    volk_gnsssdr::vector<float> d_spectrum;
+    float d_window_power;
+    float d_noise_power;
+    uint32_t d_num_estimates;
+    int32_t d_fft_length;
+    int32_t d_hop;
+    int32_t d_num_windows;
+    int32_t d_decimation;
+    int32_t d_skip;
+    int32_t d_fill;
+    int32_t d_windows_in_block;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_NOISE_FLOOR_TRACKER_H
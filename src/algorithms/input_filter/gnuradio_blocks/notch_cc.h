@@ -8,7 +8,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -19,11 +19,11 @@
 #define GNSS_SDR_NOTCH_CC_H
 
 #include "gnss_block_interface.h"
-#include "gnss_sdr_fft.h"
+#include "interference_mitigation_counters.h"
+#include "noise_floor_tracker.h"
 #include <gnuradio/block.h>
 #include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
 #include <cstdint>
-#include <memory>
 
 /** \addtogroup Input_Filter
  * \{ */
@@ -44,24 +44,32 @@ notch_sptr make_notch_filter(
 
 /*!
  * \brief This class implements a real-time software-defined multi state notch filter
+ *
+ * The noise floor is estimated by a Noise_Floor_Tracker, and the block
+ * allocates no memory in general_work().
  */
 class Notch : public gr::block
 {
 public:
-    ~Notch() = default;
+    ~Notch();
 
     int general_work(int noutput_items, gr_vector_int &ninput_items,
         gr_vector_const_void_star &input_items,
         gr_vector_void_star &output_items);
 
+    inline const Interference_Mitigation_Counters &counters() const
+    {
+        return counters_;
+    }
+
 private:
     friend notch_sptr make_notch_filter(float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
     Notch(float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
 
-    std::unique_ptr<gnss_fft_complex_fwd> d_fft_;
+    Noise_Floor_Tracker noise_floor_;
+    Interference_Mitigation_Counters counters_;
     volk_gnsssdr::vector<gr_complex> c_samples_;
-    volk_gnsssdr::vector<float> angle_;
-    volk_gnsssdr::vector<float> power_spect_;
+    volk_gnsssdr::vector<float> magnitude_;
     gr_complex last_out_;
     gr_complex z_0_;
     gr_complex p_c_factor_;
@@ -8,7 +8,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -38,6 +38,7 @@ NotchLite::NotchLite(float p_c_factor,
     : gr::block("NotchLite",
           gr::io_signature::make(1, 1, sizeof(gr_complex)),
           gr::io_signature::make(1, 1, sizeof(gr_complex))),
+      noise_floor_(length),
       last_out_(gr_complex(0.0, 0.0)),
       z_0_(gr_complex(0.0, 0.0)),
       p_c_factor_(gr_complex(p_c_factor, 0.0)),
@@ -62,32 +63,32 @@ NotchLite::NotchLite(float p_c_factor,
 
     boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred_);
     thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa_));
+}
+
 
-    power_spect_ = volk_gnsssdr::vector<float>(length_);
-    d_fft_ = gnss_fft_fwd_make_unique(length_);
+NotchLite::~NotchLite()
+{
+    counters_.log("Notch filter lite");
 }
 
 
 int NotchLite::general_work(int noutput_items, gr_vector_int &ninput_items __attribute__((unused)),
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
+    counters_.start_work();
     int32_t index_out = 0;
-    float sig2dB = 0.0;
-    float sig2lin = 0.0;
     lv_32fc_t dot_prod_;
     const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
     auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
     in++;
     while ((index_out + length_) < noutput_items)
         {
-            if ((n_segments_ < n_segments_est_) && (filter_state_ == false))
+            if ((n_segments_ < n_segments_est_ || noise_pow_est_ <= 0.0F) && (filter_state_ == false))
                 {
-                    std::copy(in, in + length_, d_fft_->get_inbuf());
-                    d_fft_->execute();
-                    volk_32fc_s32f_power_spectrum_32f(power_spect_.data(), d_fft_->get_outbuf(), 1.0, length_);
-                    volk_32f_s32f_calc_spectral_noise_floor_32f(&sig2dB, power_spect_.data(), 15.0, length_);
-                    sig2lin = std::pow(10.0F, (sig2dB / 10.0F)) / static_cast<float>(n_deg_fred_);
-                    noise_pow_est_ = (static_cast<float>(n_segments_) * noise_pow_est_ + sig2lin) / static_cast<float>(n_segments_ + 1);
+                    noise_floor_.update(in, length_);
+                    // Noise power per degree of freedom of the segment energy
+                    noise_pow_est_ = noise_floor_.noise_power() / 2.0F;
+                    counters_.add_estimation_segment();
                     std::copy(in, in + length_, out);
                 }
             else
@@ -95,6 +96,7 @@ int NotchLite::general_work(int noutput_items, gr_vector_int &ninput_items __att
                     volk_32fc_x2_conjugate_dot_prod_32fc(&dot_prod_, in, in, length_);
                     if ((lv_creal(dot_prod_) / noise_pow_est_) > thres_)
                         {
+                            counters_.add_filtered_segment();
                             if (filter_state_ == false)
                                 {
                                     filter_state_ = true;
@@ -123,6 +125,7 @@ int NotchLite::general_work(int noutput_items, gr_vector_int &ninput_items __att
                             if (n_segments_ > n_segments_reset_)
                                 {
                                     n_segments_ = 0;
+                                    noise_floor_.reset();
                                 }
                             filter_state_ = false;
                             std::copy(in, in + length_, out);
@@ -134,5 +137,6 @@ int NotchLite::general_work(int noutput_items, gr_vector_int &ninput_items __att
             out += length_;
         }
     consume_each(index_out);
+    counters_.end_work(index_out);
     return index_out;
 }
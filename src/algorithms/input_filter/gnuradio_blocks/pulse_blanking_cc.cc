@@ -9,7 +9,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -37,6 +37,8 @@ pulse_blanking_cc::pulse_blanking_cc(float pfa,
     : gr::block("pulse_blanking_cc",
           gr::io_signature::make(1, 1, sizeof(gr_complex)),
           gr::io_signature::make(1, 1, sizeof(gr_complex))),
+      energy_sum_(0.0),
+      n_energy_segments_(0),
       noise_power_estimation_(0.0),
       pfa_(pfa),
       length_(length),
@@ -50,33 +52,43 @@ pulse_blanking_cc::pulse_blanking_cc(float pfa,
     set_alignment(std::max(1, alignment_multiple));
     boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred_);
     thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa_));
-    zeros_ = volk_gnsssdr::vector<gr_complex>(length_);
+}
+
+
+pulse_blanking_cc::~pulse_blanking_cc()
+{
+    counters_.log("Pulse blanking filter");
 }
 
 
 int pulse_blanking_cc::general_work(int noutput_items, gr_vector_int &ninput_items __attribute__((unused)),
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
+    counters_.start_work();
     const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
     auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
-    auto magnitude = volk_gnsssdr::vector<float>(noutput_items);
-    volk_32fc_magnitude_squared_32f(magnitude.data(), in, noutput_items);
     int32_t sample_index = 0;
-    float segment_energy;
+    lv_32fc_t segment_energy;
     while ((sample_index + length_) < noutput_items)
         {
-            volk_32f_accumulator_s32f(&segment_energy, (magnitude.data() + sample_index), length_);
-            if ((n_segments_ < n_segments_est_) && (last_filtered_ == false))
+            // Sum of |x|^2 over the segment, computed in a single pass
+            volk_32fc_x2_conjugate_dot_prod_32fc(&segment_energy, in, in, length_);
+            if ((n_segments_ < n_segments_est_ || noise_power_estimation_ <= 0.0F) && (last_filtered_ == false))
                 {
-                    noise_power_estimation_ = (static_cast<float>(n_segments_) * noise_power_estimation_ + segment_energy / static_cast<float>(n_deg_fred_)) / static_cast<float>(n_segments_ + 1);
+                    // Running mean of the segment energy, per degree of freedom
+                    energy_sum_ += static_cast<double>(lv_creal(segment_energy));
+                    n_energy_segments_++;
+                    noise_power_estimation_ = static_cast<float>(energy_sum_ / (static_cast<double>(n_energy_segments_) * n_deg_fred_));
+                    counters_.add_estimation_segment();
                     std::copy(in, in + length_, out);
                 }
             else
                 {
-                    if ((segment_energy / noise_power_estimation_) > thres_)
+                    if ((lv_creal(segment_energy) / noise_power_estimation_) > thres_)
                         {
-                            std::copy_n(zeros_.data(), length_, out);
+                            std::fill_n(out, length_, gr_complex(0.0, 0.0));
                             last_filtered_ = true;
+                            counters_.add_filtered_segment();
                         }
                     else
                         {
@@ -85,6 +97,8 @@ int pulse_blanking_cc::general_work(int noutput_items, gr_vector_int &ninput_ite
                             if (n_segments_ > n_segments_reset_)
                                 {
                                     n_segments_ = 0;
+                                    energy_sum_ = 0.0;
+                                    n_energy_segments_ = 0;
                                 }
                         }
                 }
@@ -94,5 +108,6 @@ int pulse_blanking_cc::general_work(int noutput_items, gr_vector_int &ninput_ite
             n_segments_++;
         }
     consume_each(sample_index);
+    counters_.end_work(sample_index);
     return sample_index;
 }
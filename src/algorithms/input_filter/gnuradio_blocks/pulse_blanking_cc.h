@@ -9,7 +9,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -20,8 +20,8 @@
 #define GNSS_SDR_PULSE_BLANKING_CC_H
 
 #include "gnss_block_interface.h"
+#include "interference_mitigation_counters.h"
 #include <gnuradio/block.h>
-#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
 #include <cstdint>
 
 /** \addtogroup Input_Filter
@@ -41,18 +41,36 @@ pulse_blanking_cc_sptr make_pulse_blanking_cc(
     int32_t n_segments_est,
     int32_t n_segments_reset);
 
+/*!
+ * \brief Blanks the segments of length samples whose energy exceeds the
+ * threshold given by pfa for the estimated noise floor.
+ *
+ * The noise power is the mean energy of the first n_segments_est segments,
+ * and of the segments that follow each n_segments_reset segments, kept as a
+ * running sum. Unlike the spectral noise floor of the notch filters, it
+ * includes the power of narrowband interferences, so that they do not make
+ * every segment exceed the threshold. The block allocates no memory in
+ * general_work().
+ */
 class pulse_blanking_cc : public gr::block
 {
 public:
-    ~pulse_blanking_cc() = default;
+    ~pulse_blanking_cc();
 
     int general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items __attribute__((unused)),
         gr_vector_const_void_star &input_items, gr_vector_void_star &output_items);
 
+    inline const Interference_Mitigation_Counters &counters() const
+    {
+        return counters_;
+    }
+
 private:
     friend pulse_blanking_cc_sptr make_pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
     pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
-    volk_gnsssdr::vector<gr_complex> zeros_;
+    Interference_Mitigation_Counters counters_;
+    double energy_sum_;  // energy of the segments of the current estimation
+    uint32_t n_energy_segments_;
     float noise_power_estimation_;
     float thres_;
     float pfa_;
@@ -0,0 +1,250 @@
+/*!
+ * \file concurrent_ring_queue.h
+ * \brief Interface of a bounded, lock-free thread-safe queue
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * Multiple producer, multiple consumer ring buffer in which each slot carries
+ * a sequence number (D. Vyukov's bounded MPMC queue). push() and try_pop()
+ * never take a lock. A mutex and a condition variable are used only to put a
+ * consumer to sleep when the queue is empty, and producers touch them only if
+ * there is a consumer sleeping.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CONCURRENT_RING_QUEUE_H
+#define GNSS_SDR_CONCURRENT_RING_QUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+template <typename Data>
+
+/*!
+ * \brief This class implements a bounded, lock-free thread-safe queue with
+ * the same interface as Concurrent_Queue. push() waits for a free slot if
+ * the queue is full.
+ */
+class Concurrent_Ring_Queue
+{
+public:
+    /*!
+     * \brief Creates a queue that holds at least capacity elements (rounded
+     * up to a power of two)
+     */
+    explicit Concurrent_Ring_Queue(size_t capacity = 1024)
+    {
+        size_t n = 2;
+        while (n < capacity)
+            {
+                n *= 2;
+            }
+        the_mask = n - 1;
+        the_buffer = std::unique_ptr<Cell[]>(new Cell[n]);
+        for (size_t i = 0; i < n; i++)
+            {
+                the_buffer[i].sequence.store(i, std::memory_order_relaxed);
+            }
+    }
+
+    void push(const Data& data)
+    {
+        Data copy(data);
+        push(std::move(copy));
+    }
+
+    void push(Data&& data)
+    {
+        while (!try_push(std::move(data)))
+            {
+                std::this_thread::yield();
+            }
+    }
+
+    /*!
+     * \brief Inserts data if there is a free slot. Returns false, leaving
+     * data untouched, if the queue is full.
+     */
+    bool try_push(Data&& data)
+    {
+        Cell* cell;
+        size_t pos = the_enqueue_pos.load(std::memory_order_relaxed);
+        while (true)
+            {
+                cell = &the_buffer[pos & the_mask];
+                const size_t seq = cell->sequence.load(std::memory_order_acquire);
+                const auto dif = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+                if (dif == 0)
+                    {
+                        if (the_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            {
+                                break;
+                            }
+                    }
+                else if (dif < 0)
+                    {
+                        return false;
+                    }
+                else
+                    {
+                        pos = the_enqueue_pos.load(std::memory_order_relaxed);
+                    }
+            }
+        cell->data = std::move(data);
+        // Sequentially consistent, so that either this producer sees a
+        // consumer going to sleep, or that consumer sees this element
+        cell->sequence.store(pos + 1, std::memory_order_seq_cst);
+
+        // Wake up a sleeping consumer, if any. The empty critical section
+        // avoids notifying between its last check of the queue and its wait.
+        if (the_sleepers.load(std::memory_order_seq_cst) > 0)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(the_mutex);
+                }
+                the_condition_variable.notify_one();
+            }
+        return true;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /*!
+     * \brief Number of elements in the queue. It can be outdated by the time
+     * it is returned if other threads are pushing or popping.
+     */
+    size_t size() const noexcept
+    {
+        const size_t dequeue_pos = the_dequeue_pos.load(std::memory_order_acquire);
+        const size_t enqueue_pos = the_enqueue_pos.load(std::memory_order_acquire);
+        return enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+    }
+
+    size_t capacity() const noexcept
+    {
+        return the_mask + 1;
+    }
+
+    void clear()
+    {
+        Data discarded;
+        while (try_pop(discarded))
+            {
+            }
+    }
+
+    bool try_pop(Data& popped_value)
+    {
+        Cell* cell;
+        size_t pos = the_dequeue_pos.load(std::memory_order_relaxed);
+        while (true)
+            {
+                cell = &the_buffer[pos & the_mask];
+                const size_t seq = cell->sequence.load(std::memory_order_seq_cst);
+                const auto dif = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+                if (dif == 0)
+                    {
+                        if (the_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            {
+                                break;
+                            }
+                    }
+                else if (dif < 0)
+                    {
+                        return false;
+                    }
+                else
+                    {
+                        pos = the_dequeue_pos.load(std::memory_order_relaxed);
+                    }
+            }
+        popped_value = std::move(cell->data);
+        cell->sequence.store(pos + the_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    void wait_and_pop(Data& popped_value)
+    {
+        if (spin_and_pop(popped_value))
+            {
+                return;
+            }
+        std::unique_lock<std::mutex> lock(the_mutex);
+        the_sleepers++;
+        the_condition_variable.wait(lock, [&] { return try_pop(popped_value); });
+        the_sleepers--;
+    }
+
+    bool timed_wait_and_pop(Data& popped_value, int wait_ms)
+    {
+        if (spin_and_pop(popped_value))
+            {
+                return true;
+            }
+        std::unique_lock<std::mutex> lock(the_mutex);
+        the_sleepers++;
+        const bool popped = the_condition_variable.wait_for(lock,
+            std::chrono::milliseconds(wait_ms),
+            [&] { return try_pop(popped_value); });
+        the_sleepers--;
+        return popped;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        Data data;
+    };
+
+    // Retries for a short while before going to sleep
+    bool spin_and_pop(Data& popped_value)
+    {
+        for (int i = 0; i < 64; i++)
+            {
+                if (try_pop(popped_value))
+                    {
+                        return true;
+                    }
+                std::this_thread::yield();
+            }
+        return false;
+    }
+
+    std::unique_ptr<Cell[]> the_buffer;
+    size_t the_mask;
+    alignas(64) std::atomic<size_t> the_enqueue_pos{0};
+    alignas(64) std::atomic<size_t> the_dequeue_pos{0};
+    alignas(64) std::atomic<int> the_sleepers{0};
+    std::mutex the_mutex;
+    std::condition_variable the_condition_variable;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CONCURRENT_RING_QUEUE_H
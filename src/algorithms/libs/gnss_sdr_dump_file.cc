@@ -0,0 +1,278 @@
+/*!
+ * \file gnss_sdr_dump_file.cc
+ * \brief Binary dump file written to disk by a background thread.
+ * \author Carles Fernandez Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_dump_file.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+namespace
+{
+constexpr size_t DUMP_BUFFER_BYTES = 256 * 1024;            // data handed to the writer at once
+constexpr size_t DUMP_MAX_QUEUED_BYTES = 64 * 1024 * 1024;  // beyond this, blocks wait for the writer
+}  // namespace
+
+
+struct Gnss_Sdr_Dump_File::Target
+{
+    std::ofstream file;
+    std::string filename;
+    uint64_t dropped_bytes{0};
+    uint32_t pending{0};  // buffers queued and not yet written
+};
+
+
+/*!
+ * \brief Thread that writes the buffers of all the dump files, in order
+ */
+class Gnss_Sdr_Dump_Service
+{
+public:
+    static std::shared_ptr<Gnss_Sdr_Dump_Service> instance()
+    {
+        static auto service = std::make_shared<Gnss_Sdr_Dump_Service>();
+        return service;
+    }
+
+    ~Gnss_Sdr_Dump_Service()
+    {
+        {
+            std::lock_guard<std::mutex> lk(d_mutex);
+            d_stop = true;
+        }
+        d_work_cv.notify_one();
+        if (d_thread.joinable())
+            {
+                d_thread.join();
+            }
+    }
+
+    void submit(const std::shared_ptr<Gnss_Sdr_Dump_File::Target>& target, std::vector<char>&& data)
+    {
+        std::unique_lock<std::mutex> lk(d_mutex);
+        if (!d_thread.joinable())
+            {
+                d_thread = std::thread(&Gnss_Sdr_Dump_Service::run, this);
+            }
+        if (d_queued_bytes > DUMP_MAX_QUEUED_BYTES)
+            {
+                // Backpressure: the disk is not keeping up
+                d_stats.stalls++;
+                d_done_cv.wait(lk, [this] { return d_queued_bytes <= DUMP_MAX_QUEUED_BYTES; });
+            }
+        d_queued_bytes += data.size();
+        d_stats.max_queued_bytes = std::max(d_stats.max_queued_bytes, d_queued_bytes);
+        target->pending++;
+        d_jobs.emplace_back(target, std::move(data));
+        lk.unlock();
+        d_work_cv.notify_one();
+    }
+
+    void wait(const std::shared_ptr<Gnss_Sdr_Dump_File::Target>& target)
+    {
+        std::unique_lock<std::mutex> lk(d_mutex);
+        d_done_cv.wait(lk, [&target] { return target->pending == 0; });
+    }
+
+    std::vector<char> get_buffer()
+    {
+        std::vector<char> buffer;
+        {
+            std::lock_guard<std::mutex> lk(d_mutex);
+            if (!d_free_buffers.empty())
+                {
+                    buffer = std::move(d_free_buffers.back());
+                    d_free_buffers.pop_back();
+                }
+        }
+        buffer.clear();
+        buffer.reserve(DUMP_BUFFER_BYTES);
+        return buffer;
+    }
+
+    Gnss_Sdr_Dump_Stats statistics()
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        return d_stats;
+    }
+
+private:
+    void run()
+    {
+        std::unique_lock<std::mutex> lk(d_mutex);
+        while (true)
+            {
+                d_work_cv.wait(lk, [this] { return d_stop || !d_jobs.empty(); });
+                if (d_jobs.empty())
+                    {
+                        return;
+                    }
+                auto job = std::move(d_jobs.front());
+                d_jobs.pop_front();
+                lk.unlock();
+
+                // Only this thread writes to the file while it has pending buffers
+                bool written = true;
+                try
+                    {
+                        job.first->file.write(job.second.data(), static_cast<std::streamsize>(job.second.size()));
+                        written = job.first->file.good();
+                    }
+                catch (const std::exception& e)
+                    {
+                        written = false;
+                    }
+
+                lk.lock();
+                if (written)
+                    {
+                        d_stats.bytes_written += job.second.size();
+                    }
+                else
+                    {
+                        d_stats.bytes_dropped += job.second.size();
+                        job.first->dropped_bytes += job.second.size();
+                    }
+                d_queued_bytes -= job.second.size();
+                job.first->pending--;
+                if (d_free_buffers.size() < 16)
+                    {
+                        d_free_buffers.push_back(std::move(job.second));
+                    }
+                d_done_cv.notify_all();
+            }
+    }
+
+    std::deque<std::pair<std::shared_ptr<Gnss_Sdr_Dump_File::Target>, std::vector<char>>> d_jobs;
+    std::vector<std::vector<char>> d_free_buffers;
+    std::mutex d_mutex;
+    std::condition_variable d_work_cv;
+    std::condition_variable d_done_cv;
+    std::thread d_thread;
+    Gnss_Sdr_Dump_Stats d_stats;
+    size_t d_queued_bytes{0};
+    bool d_stop{false};
+};
+
+
+Gnss_Sdr_Dump_File::~Gnss_Sdr_Dump_File()
+{
+    try
+        {
+            close();
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Error closing dump file: " << e.what();
+        }
+}
+
+
+void Gnss_Sdr_Dump_File::exceptions(std::ios_base::iostate except)
+{
+    d_exceptions = except;
+}
+
+
+void Gnss_Sdr_Dump_File::open(const std::string& filename, std::ios_base::openmode mode)
+{
+    close();
+    auto target = std::make_shared<Target>();
+    target->filename = filename;
+    target->file.exceptions(d_exceptions);
+    target->file.open(filename, mode);  // can throw, as std::ofstream
+    if (!target->file.is_open())
+        {
+            return;
+        }
+    d_service = Gnss_Sdr_Dump_Service::instance();
+    d_target = std::move(target);
+    d_buffer = d_service->get_buffer();
+    d_bytes = 0;
+}
+
+
+bool Gnss_Sdr_Dump_File::is_open() const
+{
+    return d_target != nullptr;
+}
+
+
+Gnss_Sdr_Dump_File& Gnss_Sdr_Dump_File::write(const char* s, std::streamsize n)
+{
+    if (d_target && n > 0)
+        {
+            d_buffer.insert(d_buffer.end(), s, s + n);
+            d_bytes += static_cast<uint64_t>(n);
+            if (d_buffer.size() >= DUMP_BUFFER_BYTES)
+                {
+                    flush();
+                }
+        }
+    return *this;
+}
+
+
+std::streampos Gnss_Sdr_Dump_File::tellp() const
+{
+    return {static_cast<std::streamoff>(d_bytes)};
+}
+
+
+void Gnss_Sdr_Dump_File::flush()
+{
+    if (d_target && !d_buffer.empty())
+        {
+            d_service->submit(d_target, std::move(d_buffer));
+            d_buffer = d_service->get_buffer();
+        }
+}
+
+
+void Gnss_Sdr_Dump_File::close()
+{
+    if (!d_target)
+        {
+            return;
+        }
+    flush();
+    d_service->wait(d_target);
+    auto target = std::move(d_target);
+    d_target = nullptr;
+    d_buffer = std::vector<char>();
+    if (target->dropped_bytes > 0)
+        {
+            LOG(WARNING) << "Lost " << target->dropped_bytes << " bytes of dump file " << target->filename << " due to write errors";
+        }
+    target->file.close();  // can throw, as std::ofstream
+}
+
+
+Gnss_Sdr_Dump_Stats Gnss_Sdr_Dump_File::statistics()
+{
+    return Gnss_Sdr_Dump_Service::instance()->statistics();
+}
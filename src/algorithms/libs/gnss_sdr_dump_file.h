@@ -0,0 +1,119 @@
+/*!
+ * \file gnss_sdr_dump_file.h
+ * \brief Binary dump file written to disk by a background thread.
+ * \author Carles Fernandez Prades, 2026. cfernandez(at)cttc.es
+ *
+ * Gnss_Sdr_Dump_File can replace the std::ofstream used by processing blocks
+ * to dump their internal variables. Calls to write() only copy the data into
+ * a memory buffer owned by the block. Full buffers are handed to a single
+ * process-wide thread that writes them to disk, so disk stalls do not reach
+ * the signal processing threads. The content of the files is the same as
+ * with std::ofstream.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SDR_DUMP_FILE_H
+#define GNSS_SDR_GNSS_SDR_DUMP_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+class Gnss_Sdr_Dump_Service;
+
+/*!
+ * \brief Counters of the background dump writer, aggregated over all the
+ * dump files of the process.
+ */
+struct Gnss_Sdr_Dump_Stats
+{
+    uint64_t bytes_written{0};  //!< Bytes written to disk
+    uint64_t bytes_dropped{0};  //!< Bytes lost because of write errors
+    uint64_t stalls{0};         //!< Times a block had to wait because too much data was queued
+    size_t max_queued_bytes{0};  //!< Peak amount of data waiting to be written
+};
+
+
+/*!
+ * \brief Binary output file with the subset of the std::ofstream interface
+ * used by the dump functions of processing blocks, written by a background
+ * thread.
+ */
+class Gnss_Sdr_Dump_File
+{
+public:
+    Gnss_Sdr_Dump_File() = default;
+    ~Gnss_Sdr_Dump_File();
+
+    Gnss_Sdr_Dump_File(const Gnss_Sdr_Dump_File&) = delete;
+    Gnss_Sdr_Dump_File& operator=(const Gnss_Sdr_Dump_File&) = delete;
+
+    /*!
+     * \brief Exceptions thrown by open() and close(), as in std::ofstream.
+     * Errors writing the data are counted in Gnss_Sdr_Dump_Stats instead.
+     */
+    void exceptions(std::ios_base::iostate except);
+
+    void open(const std::string& filename, std::ios_base::openmode mode = std::ios::out | std::ios::binary);
+
+    bool is_open() const;
+
+    /*!
+     * \brief Appends n bytes to the file. It only copies them into memory.
+     */
+    Gnss_Sdr_Dump_File& write(const char* s, std::streamsize n);
+
+    /*!
+     * \brief Number of bytes written to the file so far, including those not
+     * yet on disk
+     */
+    std::streampos tellp() const;
+
+    /*!
+     * \brief Hands the buffered data to the background writer, without
+     * waiting for it to be on disk
+     */
+    void flush();
+
+    /*!
+     * \brief Waits until all the data is on disk, and closes the file
+     */
+    void close();
+
+    static Gnss_Sdr_Dump_Stats statistics();
+
+private:
+    struct Target;
+
+    std::shared_ptr<Gnss_Sdr_Dump_Service> d_service;
+    std::shared_ptr<Target> d_target;
+    std::vector<char> d_buffer;
+    std::ios_base::iostate d_exceptions{std::ios_base::goodbit};
+    uint64_t d_bytes{0};
+
+    friend class Gnss_Sdr_Dump_Service;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SDR_DUMP_FILE_H
@@ -0,0 +1,238 @@
+/*!
+ * \file gnss_sdr_fft_cache.cc
+ * \brief Process-wide cache of FFT plans, with optional FFTW wisdom
+ * persistence.
+ * \author Carles Fernandez Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_fft_cache.h"
+#include <utility>
+
+#if HAS_FFTW3F
+#include <fftw3.h>
+#endif
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+void Gnss_Fft_Fwd_Releaser::operator()(gnss_fft_complex_fwd* fft) const
+{
+    Gnss_Fft_Cache::instance().release_fwd(fft, d_fft_size, d_nthreads);
+}
+
+
+void Gnss_Fft_Rev_Releaser::operator()(gnss_fft_complex_rev* fft) const
+{
+    Gnss_Fft_Cache::instance().release_rev(fft, d_fft_size, d_nthreads);
+}
+
+
+Gnss_Fft_Cache& Gnss_Fft_Cache::instance()
+{
+    static Gnss_Fft_Cache cache;
+    return cache;
+}
+
+
+gnss_fft_fwd_cached_ptr Gnss_Fft_Cache::get_fwd(int32_t fft_size, int32_t nthreads)
+{
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        auto it = d_idle_fwd.find(Key(fft_size, nthreads));
+        if (it != d_idle_fwd.end() && !it->second.empty())
+            {
+                d_hits++;
+                d_n_idle--;
+                auto fft = std::move(it->second.back());
+                it->second.pop_back();
+                return gnss_fft_fwd_cached_ptr(fft.release(), Gnss_Fft_Fwd_Releaser(fft_size, nthreads));
+            }
+        d_misses++;
+    }
+    // Planning is done outside the lock, GNU Radio serializes it with its own planner mutex
+#if GNURADIO_FFT_USES_TEMPLATES
+    auto fft = std::make_unique<gr::fft::fft_complex_fwd>(fft_size, nthreads);
+#else
+    auto fft = std::make_unique<gr::fft::fft_complex>(fft_size, true, nthreads);
+#endif
+    return gnss_fft_fwd_cached_ptr(fft.release(), Gnss_Fft_Fwd_Releaser(fft_size, nthreads));
+}
+
+
+gnss_fft_rev_cached_ptr Gnss_Fft_Cache::get_rev(int32_t fft_size, int32_t nthreads)
+{
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        auto it = d_idle_rev.find(Key(fft_size, nthreads));
+        if (it != d_idle_rev.end() && !it->second.empty())
+            {
+                d_hits++;
+                d_n_idle--;
+                auto fft = std::move(it->second.back());
+                it->second.pop_back();
+                return gnss_fft_rev_cached_ptr(fft.release(), Gnss_Fft_Rev_Releaser(fft_size, nthreads));
+            }
+        d_misses++;
+    }
+#if GNURADIO_FFT_USES_TEMPLATES
+    auto fft = std::make_unique<gr::fft::fft_complex_rev>(fft_size, nthreads);
+#else
+    auto fft = std::make_unique<gr::fft::fft_complex>(fft_size, false, nthreads);
+#endif
+    return gnss_fft_rev_cached_ptr(fft.release(), Gnss_Fft_Rev_Releaser(fft_size, nthreads));
+}
+
+
+void Gnss_Fft_Cache::release_fwd(gnss_fft_complex_fwd* fft, int32_t fft_size, int32_t nthreads)
+{
+    std::unique_ptr<gnss_fft_complex_fwd> plan(fft);
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        if (d_n_idle < d_max_idle_plans)
+            {
+                d_idle_fwd[Key(fft_size, nthreads)].push_back(std::move(plan));
+                d_n_idle++;
+                return;
+            }
+        d_evictions++;
+    }
+    // The cache is full. The plan is destroyed outside the lock.
+}
+
+
+void Gnss_Fft_Cache::release_rev(gnss_fft_complex_rev* fft, int32_t fft_size, int32_t nthreads)
+{
+    std::unique_ptr<gnss_fft_complex_rev> plan(fft);
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        if (d_n_idle < d_max_idle_plans)
+            {
+                d_idle_rev[Key(fft_size, nthreads)].push_back(std::move(plan));
+                d_n_idle++;
+                return;
+            }
+        d_evictions++;
+    }
+    // The cache is full. The plan is destroyed outside the lock.
+}
+
+
+bool Gnss_Fft_Cache::import_wisdom(const std::string& filename)
+{
+#if HAS_FFTW3F
+    gr::fft::planner::scoped_lock lock(gr::fft::planner::mutex());
+    if (fftwf_import_wisdom_from_filename(filename.c_str()) == 0)
+        {
+            LOG(INFO) << "Unable to read FFTW wisdom from " << filename;
+            return false;
+        }
+    LOG(INFO) << "FFTW wisdom loaded from " << filename;
+    return true;
+#else
+    LOG(WARNING) << "This build does not support FFTW wisdom files, " << filename << " is ignored";
+    return false;
+#endif
+}
+
+
+bool Gnss_Fft_Cache::export_wisdom(const std::string& filename)
+{
+#if HAS_FFTW3F
+    gr::fft::planner::scoped_lock lock(gr::fft::planner::mutex());
+    if (fftwf_export_wisdom_to_filename(filename.c_str()) == 0)
+        {
+            LOG(WARNING) << "Unable to write FFTW wisdom to " << filename;
+            return false;
+        }
+    DLOG(INFO) << "FFTW wisdom stored in " << filename;
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+void Gnss_Fft_Cache::forget_wisdom()
+{
+#if HAS_FFTW3F
+    gr::fft::planner::scoped_lock lock(gr::fft::planner::mutex());
+    fftwf_forget_wisdom();
+#endif
+}
+
+
+void Gnss_Fft_Cache::clear()
+{
+    evict_above(0);
+}
+
+
+void Gnss_Fft_Cache::set_max_idle_plans(size_t max_idle_plans)
+{
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        d_max_idle_plans = max_idle_plans;
+    }
+    evict_above(max_idle_plans);
+}
+
+
+void Gnss_Fft_Cache::evict_above(size_t max_idle_plans)
+{
+    // Plans are moved out. They are declared before the lock, so they are
+    // destroyed once it is released
+    std::vector<std::unique_ptr<gnss_fft_complex_fwd>> evicted_fwd;
+    std::vector<std::unique_ptr<gnss_fft_complex_rev>> evicted_rev;
+    std::lock_guard<std::mutex> lk(d_mutex);
+    for (auto& p : d_idle_fwd)
+        {
+            while (d_n_idle > max_idle_plans && !p.second.empty())
+                {
+                    evicted_fwd.push_back(std::move(p.second.back()));
+                    p.second.pop_back();
+                    d_n_idle--;
+                }
+        }
+    for (auto& p : d_idle_rev)
+        {
+            while (d_n_idle > max_idle_plans && !p.second.empty())
+                {
+                    evicted_rev.push_back(std::move(p.second.back()));
+                    p.second.pop_back();
+                    d_n_idle--;
+                }
+        }
+}
+
+
+size_t Gnss_Fft_Cache::idle_plans() const
+{
+    std::lock_guard<std::mutex> lk(d_mutex);
+    return d_n_idle;
+}
+
+
+gnss_fft_fwd_cached_ptr gnss_fft_fwd_make_cached(int32_t fft_size, int32_t nthreads)
+{
+    return Gnss_Fft_Cache::instance().get_fwd(fft_size, nthreads);
+}
+
+
+gnss_fft_rev_cached_ptr gnss_fft_rev_make_cached(int32_t fft_size, int32_t nthreads)
+{
+    return Gnss_Fft_Cache::instance().get_rev(fft_size, nthreads);
+}
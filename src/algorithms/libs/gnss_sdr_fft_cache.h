@@ -0,0 +1,183 @@
+/*!
+ * \file gnss_sdr_fft_cache.h
+ * \brief Process-wide cache of FFT plans, with optional FFTW wisdom
+ * persistence.
+ * \author Carles Fernandez Prades, 2026. cfernandez(at)cttc.es
+ *
+ * FFT objects obtained through gnss_fft_fwd_make_cached() and
+ * gnss_fft_rev_make_cached() are returned to the cache when released, so
+ * blocks created later with the same FFT size (e.g., after a receiver
+ * restart) reuse the existing plans instead of planning them again.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SDR_FFT_CACHE_H
+#define GNSS_SDR_GNSS_SDR_FFT_CACHE_H
+
+#include "gnss_sdr_fft.h"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Returns a forward FFT to the cache instead of destroying it.
+ */
+class Gnss_Fft_Fwd_Releaser
+{
+public:
+    Gnss_Fft_Fwd_Releaser() = default;
+    Gnss_Fft_Fwd_Releaser(int32_t fft_size, int32_t nthreads) : d_fft_size(fft_size), d_nthreads(nthreads) {}
+    void operator()(gnss_fft_complex_fwd* fft) const;
+
+private:
+    int32_t d_fft_size{0};
+    int32_t d_nthreads{1};
+};
+
+
+/*!
+ * \brief Returns a reverse FFT to the cache instead of destroying it.
+ */
+class Gnss_Fft_Rev_Releaser
+{
+public:
+    Gnss_Fft_Rev_Releaser() = default;
+    Gnss_Fft_Rev_Releaser(int32_t fft_size, int32_t nthreads) : d_fft_size(fft_size), d_nthreads(nthreads) {}
+    void operator()(gnss_fft_complex_rev* fft) const;
+
+private:
+    int32_t d_fft_size{0};
+    int32_t d_nthreads{1};
+};
+
+
+using gnss_fft_fwd_cached_ptr = std::unique_ptr<gnss_fft_complex_fwd, Gnss_Fft_Fwd_Releaser>;
+using gnss_fft_rev_cached_ptr = std::unique_ptr<gnss_fft_complex_rev, Gnss_Fft_Rev_Releaser>;
+
+
+/*!
+ * \brief Process-wide cache of FFT plans, keyed by size, direction and
+ * number of threads.
+ */
+class Gnss_Fft_Cache
+{
+public:
+    static Gnss_Fft_Cache& instance();
+
+    Gnss_Fft_Cache(const Gnss_Fft_Cache&) = delete;
+    Gnss_Fft_Cache& operator=(const Gnss_Fft_Cache&) = delete;
+
+    gnss_fft_fwd_cached_ptr get_fwd(int32_t fft_size, int32_t nthreads = 1);
+    gnss_fft_rev_cached_ptr get_rev(int32_t fft_size, int32_t nthreads = 1);
+
+    /*!
+     * \brief Loads FFTW wisdom from filename, so plans are not measured
+     * again. Returns false if the file cannot be read or FFTW wisdom is not
+     * supported by this build.
+     */
+    bool import_wisdom(const std::string& filename);
+
+    /*!
+     * \brief Stores the accumulated FFTW wisdom in filename.
+     */
+    bool export_wisdom(const std::string& filename);
+
+    /*!
+     * \brief Forgets the FFTW wisdom accumulated by the process, so the plans
+     * created afterwards are measured again unless wisdom is imported.
+     */
+    void forget_wisdom();
+
+    /*!
+     * \brief Destroys all the plans not currently in use.
+     */
+    void clear();
+
+    /*!
+     * \brief Sets the maximum number of plans kept while not in use. Plans
+     * released above it are destroyed.
+     */
+    void set_max_idle_plans(size_t max_idle_plans);
+
+    size_t idle_plans() const;
+
+    inline size_t max_idle_plans() const
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        return d_max_idle_plans;
+    }
+
+    //! Plans destroyed because the cache was full
+    inline uint64_t evictions() const
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        return d_evictions;
+    }
+
+    inline uint64_t hits() const
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        return d_hits;
+    }
+
+    inline uint64_t misses() const
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        return d_misses;
+    }
+
+private:
+    friend class Gnss_Fft_Fwd_Releaser;
+    friend class Gnss_Fft_Rev_Releaser;
+    using Key = std::tuple<int32_t, int32_t>;  // FFT size, number of threads
+
+    Gnss_Fft_Cache() = default;
+    void release_fwd(gnss_fft_complex_fwd* fft, int32_t fft_size, int32_t nthreads);
+    void release_rev(gnss_fft_complex_rev* fft, int32_t fft_size, int32_t nthreads);
+    void evict_above(size_t max_idle_plans);
+
+    std::map<Key, std::vector<std::unique_ptr<gnss_fft_complex_fwd>>> d_idle_fwd;
+    std::map<Key, std::vector<std::unique_ptr<gnss_fft_complex_rev>>> d_idle_rev;
+    mutable std::mutex d_mutex;
+    size_t d_n_idle{0};
+    size_t d_max_idle_plans{256};
+    uint64_t d_hits{0ULL};
+    uint64_t d_misses{0ULL};
+    uint64_t d_evictions{0ULL};
+};
+
+
+/*!
+ * \brief Returns a forward FFT of size fft_size from the plan cache.
+ */
+gnss_fft_fwd_cached_ptr gnss_fft_fwd_make_cached(int32_t fft_size, int32_t nthreads = 1);
+
+/*!
+ * \brief Returns a reverse FFT of size fft_size from the plan cache.
+ */
+gnss_fft_rev_cached_ptr gnss_fft_rev_make_cached(int32_t fft_size, int32_t nthreads = 1);
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SDR_FFT_CACHE_H
@@ -256,6 +256,7 @@ const double MAXDTOE_GLO = 1800.0;   //!<    max time difference to GLONASS Toe
 const double MAXDTOE_SBS = 360.0;    //!<    max time difference to SBAS Toe (s)
 const double MAXDTOE_S = 86400.0;    //!<    max time difference to ephem toe (s) for other
 const double MAXGDOP = 300.0;        //!<    max GDOP
+const double ERREPH_GLO = 5.0;       //!<    error of GLONASS ephemeris (m)
 
 const int MAXSBSURA = 8;  //!<    max URA of SBAS satellite
 const int MAXBAND = 10;   //!<    max SBAS band of IGP
@@ -749,6 +750,8 @@ typedef struct
 } pppcorr_t;
 
 
+class Rtklib_Orbit_Cache;
+
 typedef struct
 {                                 /* navigation data type */
     int n, nmax;                  /* number of broadcast ephemeris */
@@ -795,6 +798,7 @@ typedef struct
     lexeph_t lexeph[MAXSAT];      /* LEX ephemeris */
     lexion_t lexion;              /* LEX ionosphere correction */
     pppcorr_t pppcorr;            /* ppp corrections */
+    Rtklib_Orbit_Cache *orbits;   /* orbit and clock evaluation cache (nullptr: none) */
 } nav_t;
 
 
@@ -0,0 +1,108 @@
+/*!
+ * \file rtklib_arena.cc
+ * \brief Scratch memory for the matrix temporaries of the RTKLIB solvers
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtklib_arena.h"
+#include "gnss_sdr_make_unique.h"  // for std::make_unique in C++11
+#include <algorithm>               // for std::max
+
+namespace
+{
+thread_local Rtklib_Arena* active_arena = nullptr;
+
+constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+}  // namespace
+
+
+Rtklib_Arena::Rtklib_Arena(size_t initial_bytes)
+{
+    d_blocks.reserve(8);
+    add_block(std::max(initial_bytes, ALIGNMENT));
+}
+
+
+void* Rtklib_Arena::allocate(size_t bytes)
+{
+    bytes = (std::max(bytes, size_t(1)) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    if (d_blocks.empty() || d_used + bytes > d_blocks.back().size)
+        {
+            // Grow geometrically; reset() merges the blocks afterwards
+            add_block(std::max(bytes, d_capacity));
+        }
+    void* p = reinterpret_cast<uint8_t*>(d_blocks.back().data.get()) + d_used;
+    d_used += bytes;
+    return p;
+}
+
+
+bool Rtklib_Arena::owns(const void* p) const
+{
+    const auto* byte = static_cast<const uint8_t*>(p);
+    for (const auto& block : d_blocks)
+        {
+            const auto* begin = reinterpret_cast<const uint8_t*>(block.data.get());
+            if (byte >= begin && byte < begin + block.size)
+                {
+                    return true;
+                }
+        }
+    return false;
+}
+
+
+void Rtklib_Arena::reset()
+{
+    if (d_blocks.size() > 1)
+        {
+            const size_t total = d_capacity;
+            d_blocks.clear();
+            d_capacity = 0;
+            add_block(total);
+        }
+    d_used = 0;
+}
+
+
+void Rtklib_Arena::add_block(size_t bytes)
+{
+    const size_t elements = (bytes + ALIGNMENT - 1) / ALIGNMENT;
+    d_blocks.push_back({std::make_unique<std::max_align_t[]>(elements), elements * ALIGNMENT});
+    d_used = 0;
+    d_capacity += elements * ALIGNMENT;
+    d_heap_allocations++;
+}
+
+
+Rtklib_Arena_Scope::Rtklib_Arena_Scope(Rtklib_Arena& arena) : d_arena(arena),
+                                                             d_previous(active_arena)
+{
+    active_arena = &d_arena;
+}
+
+
+Rtklib_Arena_Scope::~Rtklib_Arena_Scope()
+{
+    active_arena = d_previous;
+    if (d_previous != &d_arena)
+        {
+            d_arena.reset();
+        }
+}
+
+
+Rtklib_Arena* rtklib_active_arena()
+{
+    return active_arena;
+}
@@ -0,0 +1,124 @@
+/*!
+ * \file rtklib_arena.h
+ * \brief Scratch memory for the matrix temporaries of the RTKLIB solvers
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RTKLIB_ARENA_H
+#define GNSS_SDR_RTKLIB_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup RTKLIB_Library
+ * \{ */
+
+
+/*!
+ * \brief Bump allocator for the matrices that mat(), imat(), zeros() and
+ * eye() create while an Rtklib_Arena_Scope is active in the calling thread.
+ *
+ * Freeing a matrix of the arena with matfree() does nothing; the whole arena
+ * is released at once by reset(). If the allocations of an epoch did not fit
+ * in a single block, reset() replaces the blocks with one of their total
+ * size, so that in the steady state the solver does not touch the heap.
+ */
+class Rtklib_Arena
+{
+public:
+    explicit Rtklib_Arena(size_t initial_bytes = 64 * 1024);
+    ~Rtklib_Arena() = default;
+
+    Rtklib_Arena(const Rtklib_Arena&) = delete;
+    Rtklib_Arena& operator=(const Rtklib_Arena&) = delete;
+    Rtklib_Arena(Rtklib_Arena&&) = default;
+    Rtklib_Arena& operator=(Rtklib_Arena&&) = default;
+
+    /*!
+     * \brief Returns bytes of memory aligned for any scalar type. Never
+     * returns nullptr.
+     */
+    void* allocate(size_t bytes);
+
+    /*!
+     * \brief Returns true if p points to memory handed out by this arena
+     */
+    bool owns(const void* p) const;
+
+    /*!
+     * \brief Releases all the memory handed out since the last reset
+     */
+    void reset();
+
+    inline size_t capacity() const
+    {
+        return d_capacity;
+    }
+
+    //! Number of blocks requested from the heap since construction
+    inline uint64_t heap_allocations() const
+    {
+        return d_heap_allocations;
+    }
+
+private:
+    struct Block
+    {
+        std::unique_ptr<std::max_align_t[]> data;
+        size_t size;
+    };
+
+    void add_block(size_t bytes);
+
+    std::vector<Block> d_blocks;
+    size_t d_used{0};  // bytes used in the last block
+    size_t d_capacity{0};
+    uint64_t d_heap_allocations{0};
+};
+
+
+/*!
+ * \brief Makes mat(), imat(), zeros() and eye() take their memory from an
+ * arena, in the calling thread, during the lifetime of the object. The arena
+ * is reset when the scope ends, so no matrix taken from it can outlive the
+ * scope.
+ */
+class Rtklib_Arena_Scope
+{
+public:
+    explicit Rtklib_Arena_Scope(Rtklib_Arena& arena);
+    ~Rtklib_Arena_Scope();
+
+    Rtklib_Arena_Scope(const Rtklib_Arena_Scope&) = delete;
+    Rtklib_Arena_Scope& operator=(const Rtklib_Arena_Scope&) = delete;
+
+private:
+    Rtklib_Arena& d_arena;
+    Rtklib_Arena* d_previous;
+};
+
+
+/*!
+ * \brief Arena of the innermost Rtklib_Arena_Scope of the calling thread, or
+ * nullptr if there is none
+ */
+Rtklib_Arena* rtklib_active_arena();
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_RTKLIB_ARENA_H
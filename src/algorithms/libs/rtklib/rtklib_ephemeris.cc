@@ -31,10 +31,11 @@
  */
 
 #include "rtklib_ephemeris.h"
+#include "rtklib_orbit_cache.h"
 #include "rtklib_preceph.h"
 #include "rtklib_rtkcmn.h"
 #include "rtklib_sbas.h"
-#include <vector>
+#include <array>
 
 /* constants -----------------------------------------------------------------*/
 
@@ -52,7 +53,6 @@ const double OMGE_BDS = BEIDOU_OMEGA_EARTH_DOT;  /* earth angular velocity (rad/
 const double SIN_5 = -0.0871557427476582; /* sin(-5.0 deg) */
 const double COS_5 = 0.9961946980917456;  /* cos(-5.0 deg) */
 
-const double ERREPH_GLO = 5.0;    /* error of glonass ephemeris (m) */
 const double TSTEP = 60.0;        /* integration step glonass ephemeris (s) */
 const double RTOL_KEPLER = 1e-13; /* relative tolerance for Kepler equation */
 
@@ -122,7 +122,7 @@ void alm2pos(gtime_t time, const alm_t *alm, double *rs, double *dts)
     double mu;
     int n;
 
-    trace(4, "alm2pos : time=%s sat=%2d\n", time_str(time, 3), alm->sat);
+    TRACE_RTK(4, "alm2pos : time=%s sat=%2d\n", time_str(time, 3), alm->sat);
 
     tk = timediffweekcrossover(time, alm->toa);
 
@@ -141,7 +141,7 @@ void alm2pos(gtime_t time, const alm_t *alm, double *rs, double *dts)
         }
     if (n >= MAX_ITER_KEPLER)
         {
-            trace(2, "alm2pos: kepler iteration overflow sat=%2d\n", alm->sat);
+            TRACE_RTK(2, "alm2pos: kepler iteration overflow sat=%2d\n", alm->sat);
             return;
         }
     sinE = sin(E);
@@ -175,7 +175,7 @@ double eph2clk(gtime_t time, const eph_t *eph)
     double t;
     int i;
 
-    trace(4, "eph2clk : time=%s sat=%2d\n", time_str(time, 3), eph->sat);
+    TRACE_RTK(4, "eph2clk : time=%s sat=%2d\n", time_str(time, 3), eph->sat);
 
     t = timediffweekcrossover(time, eph->toc);
 
@@ -202,6 +202,39 @@ double eph2clk(gtime_t time, const eph_t *eph)
  *-----------------------------------------------------------------------------*/
 void eph2pos(gtime_t time, const eph_t *eph, double *rs, double *dts,
     double *var)
+{
+    double rsv[6];
+    double dtsv[2];
+    int i;
+
+    eph2posvel(time, eph, rsv, dtsv, var);
+    for (i = 0; i < 3; i++)
+        {
+            rs[i] = rsv[i];
+        }
+    *dts = dtsv[0];
+}
+
+
+/* broadcast ephemeris to satellite position, velocity and clock ---------------
+ * compute satellite position, velocity, clock bias and clock drift with
+ * broadcast ephemeris (gps, galileo, qzss, beidou)
+ * args   : gtime_t time     I   time (gpst)
+ *          eph_t *eph       I   broadcast ephemeris
+ *          double *rs       O   satellite position and velocity (ecef)
+ *                               {x,y,z,vx,vy,vz} (m|m/s)
+ *          double *dts      O   satellite clock {bias,drift} (s|s/s)
+ *          double *var      O   satellite position and clock variance (m^2)
+ * return : none
+ * notes  : see ref [1],[7],[8],[9]
+ *          velocity and clock drift are the time derivatives of the orbit and
+ *          clock models
+ *          satellite clock includes relativity correction without code bias
+ *          (tgd or bgd)
+ *          all outputs are set to 0 if the ephemeris is not valid
+ *-----------------------------------------------------------------------------*/
+void eph2posvel(gtime_t time, const eph_t *eph, double *rs, double *dts,
+    double *var)
 {
     double tk;
     double M;
@@ -220,6 +253,7 @@ void eph2pos(gtime_t time, const eph_t *eph, double *rs, double *dts,
     double sinO;
     double cosO;
     double cosi;
+    double sini;
     double mu;
     double omge;
     double xg;
@@ -227,16 +261,26 @@ void eph2pos(gtime_t time, const eph_t *eph, double *rs, double *dts,
     double zg;
     double sino;
     double coso;
+    double n0;
+    double Edot;
+    double pdot;
+    double udot;
+    double rdot;
+    double idot;
+    double xdot;
+    double ydot;
+    double Odot;
+    double tmp;
     int n;
     int sys;
     int prn;
 
     double has_relativistic_correction = 0.0;
-    trace(4, "eph2pos : time=%s sat=%2d\n", time_str(time, 3), eph->sat);
+    TRACE_RTK(4, "eph2posvel: time=%s sat=%2d\n", time_str(time, 3), eph->sat);
 
     if (eph->A <= 0.0)
         {
-            rs[0] = rs[1] = rs[2] = *dts = *var = 0.0;
+            rs[0] = rs[1] = rs[2] = rs[3] = rs[4] = rs[5] = dts[0] = dts[1] = *var = 0.0;
             return;
         }
     tk = timediffweekcrossover(time, eph->toe);
@@ -256,7 +300,8 @@ void eph2pos(gtime_t time, const eph_t *eph, double *rs, double *dts,
             omge = GNSS_OMEGA_EARTH_DOT;
             break;
         }
-    M = eph->M0 + (sqrt(mu / (eph->A * eph->A * eph->A)) + eph->deln) * tk;
+    n0 = sqrt(mu / (eph->A * eph->A * eph->A)) + eph->deln;
+    M = eph->M0 + n0 * tk;
 
     for (n = 0, E = M, Ek = 0.0; fabs(E - Ek) > RTOL_KEPLER && n < MAX_ITER_KEPLER; n++)
         {
@@ -265,13 +310,14 @@ void eph2pos(gtime_t time, const eph_t *eph, double *rs, double *dts,
         }
     if (n >= MAX_ITER_KEPLER)
         {
-            trace(2, "eph2pos: kepler iteration overflow sat=%2d\n", eph->sat);
+            TRACE_RTK(2, "eph2posvel: kepler iteration overflow sat=%2d\n", eph->sat);
+            rs[0] = rs[1] = rs[2] = rs[3] = rs[4] = rs[5] = dts[0] = dts[1] = *var = 0.0;
             return;
         }
     sinE = sin(E);
     cosE = cos(E);
 
-    trace(4, "kepler: sat=%2d e=%8.5f n=%2d del=%10.3e\n", eph->sat, eph->e, n, E - Ek);
+    TRACE_RTK(4, "kepler: sat=%2d e=%8.5f n=%2d del=%10.3e\n", eph->sat, eph->e, n, E - Ek);
 
     u = atan2(sqrt(1.0 - eph->e * eph->e) * sinE, cosE - eph->e) + eph->omg;
     r = eph->A * (1.0 - eph->e * cosE);
@@ -284,6 +330,16 @@ void eph2pos(gtime_t time, const eph_t *eph, double *rs, double *dts,
     x = r * cos(u);
     y = r * sin(u);
     cosi = cos(i);
+    sini = sin(i);
+
+    /* derivatives of the corrected arguments and of the position in the orbital plane */
+    Edot = n0 / (1.0 - eph->e * cosE);
+    pdot = sqrt(1.0 - eph->e * eph->e) * Edot / (1.0 - eph->e * cosE);
+    udot = pdot * (1.0 + 2.0 * (eph->cus * cos2u - eph->cuc * sin2u));
+    rdot = eph->A * eph->e * sinE * Edot + 2.0 * pdot * (eph->crs * cos2u - eph->crc * sin2u);
+    idot = eph->idot + 2.0 * pdot * (eph->cis * cos2u - eph->cic * sin2u);
+    xdot = rdot * cos(u) - y * udot;
+    ydot = rdot * sin(u) + x * udot;
 
     /* beidou geo satellite (ref [9]) */
     if (sys == SYS_BDS && (prn <= 5 || prn > 58))
@@ -293,12 +349,22 @@ void eph2pos(gtime_t time, const eph_t *eph, double *rs, double *dts,
             cosO = cos(O);
             xg = x * cosO - y * cosi * sinO;
             yg = x * sinO + y * cosi * cosO;
-            zg = y * sin(i);
+            zg = y * sini;
             sino = sin(omge * tk);
             coso = cos(omge * tk);
             rs[0] = xg * coso + yg * sino * COS_5 + zg * sino * SIN_5;
             rs[1] = -xg * sino + yg * coso * COS_5 + zg * coso * SIN_5;
             rs[2] = -yg * SIN_5 + zg * COS_5;
+
+            /* velocity in the inertial frame of the geo orbit, then rotated */
+            tmp = ydot * cosi - y * sini * idot;
+            const double xgdot = xdot * cosO - tmp * sinO - eph->OMGd * yg;
+            const double ygdot = xdot * sinO + tmp * cosO + eph->OMGd * xg;
+            const double zgdot = y * cosi * idot + ydot * sini;
+            const double wdot = ygdot * COS_5 + zgdot * SIN_5;
+            rs[3] = xgdot * coso + wdot * sino + omge * rs[1];
+            rs[4] = -xgdot * sino + wdot * coso - omge * rs[0];
+            rs[5] = -ygdot * SIN_5 + zgdot * COS_5;
         }
     else
         {
@@ -307,12 +373,19 @@ void eph2pos(gtime_t time, const eph_t *eph, double *rs, double *dts,
             cosO = cos(O);
             rs[0] = x * cosO - y * cosi * sinO;
             rs[1] = x * sinO + y * cosi * cosO;
-            rs[2] = y * sin(i);
+            rs[2] = y * sini;
+
+            Odot = eph->OMGd - omge;
+            tmp = ydot * cosi - rs[2] * idot;
+            rs[3] = -Odot * rs[1] + xdot * cosO - tmp * sinO;
+            rs[4] = Odot * rs[0] + xdot * sinO + tmp * cosO;
+            rs[5] = y * cosi * idot + ydot * sini;
+
             // Apply HAS orbit correction if available
             if (eph->apply_has_corrections)
                 {
                     // HAS SIS ICD, Issue 1.0, Section 7.2
-                    double vel_sat[3]{};
+                    const double *vel_sat = rs + 3;
                     double cross_pos_vel[3]{};
                     double et[3]{};
                     double ew[3]{};
@@ -320,20 +393,6 @@ void eph2pos(gtime_t time, const eph_t *eph, double *rs, double *dts,
                     double R[3][3]{};
                     double corrections[3]{};
                     double rotated_corrections[3]{};
-                    // Compute satellite velocity
-                    const double OneMinusecosE = 1.0 - (eph->e * cosE);
-                    const double ekdot = (sqrt(mu / (eph->A * eph->A * eph->A)) + eph->deln) / OneMinusecosE;
-                    const double pkdot = sqrt(1.0 - eph->e * eph->e) * ekdot / OneMinusecosE;
-                    const double ukdot = pkdot * (1.0 + 2.0 * (eph->cus * cos2u - eph->cuc * sin2u));
-                    const double ikdot = eph->idot + 2.0 * pkdot * (eph->cis * cos2u - eph->cic * sin2u);
-                    const double rkdot = eph->A * eph->e * sinE * ekdot + 2.0 * pkdot * (eph->crs * cos2u - eph->crc * sin2u);
-                    const double xpkdot = rkdot * cos(u) - y * ukdot;
-                    const double ypkdot = rkdot * sin(u) + x * ukdot;
-                    const double tmp = ypkdot * cosi - rs[2] * ikdot;
-
-                    vel_sat[0] = -(eph->OMGd - omge) * rs[1] + xpkdot * cosO - tmp * sinO;
-                    vel_sat[1] = (eph->OMGd - omge) * rs[0] + xpkdot * sinO + tmp * cosO;
-                    vel_sat[2] = y * cosi * ikdot + ypkdot * sin(i);
 
                     // Compute HAS relativistic clock correction (HAS SIS ICD, Issue 1.0, Section 7.3)
                     const double pos_by_vel = rs[0] * vel_sat[0] + rs[1] * vel_sat[1] + rs[2] * vel_sat[2];
@@ -390,20 +449,23 @@ void eph2pos(gtime_t time, const eph_t *eph, double *rs, double *dts,
                 }
         }
     tk = timediffweekcrossover(time, eph->toc);
-    *dts = eph->f0 + eph->f1 * tk + eph->f2 * tk * tk;
+    dts[0] = eph->f0 + eph->f1 * tk + eph->f2 * tk * tk;
+    dts[1] = eph->f1 + 2.0 * eph->f2 * tk;
 
     /* relativity correction */
     if (eph->apply_has_corrections)
         {
             // Apply HAS clock correction (HAS SIS ICD, Issue 1.0, Section 7.3)
-            *dts += (has_relativistic_correction + (eph->has_clock_correction_m / SPEED_OF_LIGHT_M_S));
+            dts[0] += (has_relativistic_correction + (eph->has_clock_correction_m / SPEED_OF_LIGHT_M_S));
             // Note: This is referred to the GST for Galileo satellites. The user must account for
             // a possible common offset in the broadcast HAS GPS clock corrections
         }
     else
         {
-            *dts -= 2.0 * sqrt(mu * eph->A) * eph->e * sinE / (SPEED_OF_LIGHT_M_S * SPEED_OF_LIGHT_M_S);
+            dts[0] -= 2.0 * sqrt(mu * eph->A) * eph->e * sinE / (SPEED_OF_LIGHT_M_S * SPEED_OF_LIGHT_M_S);
         }
+    /* drift of the relativity correction, with pos*vel=sqrt(mu*A)*e*sinE */
+    dts[1] -= 2.0 * sqrt(mu * eph->A) * eph->e * cosE * Edot / (SPEED_OF_LIGHT_M_S * SPEED_OF_LIGHT_M_S);
 
     /* position and clock error variance */
     *var = var_uraeph(eph->sva);
@@ -471,6 +533,58 @@ void glorbit(double t, double *x, const double *acc)
 }
 
 
+/* glonass orbit propagation ---------------------------------------------------
+ * propagate glonass orbit by numerical integration from the ephemeris epoch
+ * args   : double t         I   time from the ephemeris epoch toe (s)
+ *          geph_t *geph     I   glonass ephemeris
+ *          int    *k        IO  full integration steps of x from toe, with the
+ *                               sign of the direction (0: x is loaded from geph)
+ *          double *x        IO  state {x,y,z,vx,vy,vz} after k full steps (ecef)
+ *          double *xt       O   state {x,y,z,vx,vy,vz} at time t (ecef)
+ * return : none
+ * notes  : x is advanced to the last full step before t, so that a later call
+ *          with t farther from toe in the same direction continues from it.
+ *          the integration steps do not depend on the state of x and k
+ *-----------------------------------------------------------------------------*/
+void gloprop(double t, const geph_t *geph, int *k, double *x, double *xt)
+{
+    const int dir = t < 0.0 ? -1 : 1;
+    double rem;
+    int kt;
+    int i;
+
+    /* number of full steps before t */
+    kt = static_cast<int>(floor(fabs(t) / TSTEP));
+    if (kt * TSTEP > fabs(t))
+        {
+            kt--;
+        }
+    if (*k == 0 || *k * dir < 0 || abs(*k) > kt)
+        {
+            for (i = 0; i < 3; i++)
+                {
+                    x[i] = geph->pos[i];
+                    x[i + 3] = geph->vel[i];
+                }
+            *k = 0;
+        }
+    while (abs(*k) < kt)
+        {
+            glorbit(dir * TSTEP, x, geph->acc);
+            *k += dir;
+        }
+    for (i = 0; i < 6; i++)
+        {
+            xt[i] = x[i];
+        }
+    rem = t - *k * TSTEP;
+    if (fabs(rem) > 1e-9)
+        {
+            glorbit(rem, xt, geph->acc);
+        }
+}
+
+
 /* glonass ephemeris to satellite clock bias -----------------------------------
  * compute satellite clock bias with glonass ephemeris
  * args   : gtime_t time     I   time by satellite clock (gpst)
@@ -483,7 +597,7 @@ double geph2clk(gtime_t time, const geph_t *geph)
     double t;
     int i;
 
-    trace(4, "geph2clk: time=%s sat=%2d\n", time_str(time, 3), geph->sat);
+    TRACE_RTK(4, "geph2clk: time=%s sat=%2d\n", time_str(time, 3), geph->sat);
 
     t = timediff(time, geph->toe);
 
@@ -507,37 +621,48 @@ double geph2clk(gtime_t time, const geph_t *geph)
  *-----------------------------------------------------------------------------*/
 void geph2pos(gtime_t time, const geph_t *geph, double *rs, double *dts,
     double *var)
+{
+    double rsv[6];
+    double dtsv[2];
+    int i;
+
+    geph2posvel(time, geph, rsv, dtsv, var);
+    for (i = 0; i < 3; i++)
+        {
+            rs[i] = rsv[i];
+        }
+    *dts = dtsv[0];
+}
+
+
+/* glonass ephemeris to satellite position, velocity and clock -----------------
+ * compute satellite position, velocity, clock bias and clock drift with
+ * glonass ephemeris
+ * args   : gtime_t time     I   time (gpst)
+ *          geph_t *geph     I   glonass ephemeris
+ *          double *rs       O   satellite position and velocity (ecef)
+ *                               {x,y,z,vx,vy,vz} (m|m/s)
+ *          double *dts      O   satellite clock {bias,drift} (s|s/s)
+ *          double *var      O   satellite position and clock variance (m^2)
+ * return : none
+ * notes  : see ref [2]
+ *          velocity is the one of the integrated orbit state
+ *-----------------------------------------------------------------------------*/
+void geph2posvel(gtime_t time, const geph_t *geph, double *rs, double *dts,
+    double *var)
 {
     double t;
-    double tt;
     double x[6];
-    int i;
+    int k = 0;
 
-    trace(4, "geph2pos: time=%s sat=%2d\n", time_str(time, 3), geph->sat);
+    TRACE_RTK(4, "geph2posvel: time=%s sat=%2d\n", time_str(time, 3), geph->sat);
 
     t = timediff(time, geph->toe);
 
-    *dts = -geph->taun + geph->gamn * t;
+    dts[0] = -geph->taun + geph->gamn * t;
+    dts[1] = geph->gamn;
 
-    for (i = 0; i < 3; i++)
-        {
-            x[i] = geph->pos[i];
-            x[i + 3] = geph->vel[i];
-        }
-    tt = t < 0.0 ? -TSTEP : TSTEP;
-    while (fabs(t) > 1e-9)
-        {
-            if (fabs(t) < TSTEP)
-                {
-                    tt = t;
-                }
-            glorbit(tt, x, geph->acc);
-            t -= tt;
-        }
-    for (i = 0; i < 3; i++)
-        {
-            rs[i] = x[i];
-        }
+    gloprop(t, geph, &k, x, rs);
 
     *var = std::pow(ERREPH_GLO, 2.0);
 }
@@ -555,7 +680,7 @@ double seph2clk(gtime_t time, const seph_t *seph)
     double t;
     int i;
 
-    trace(4, "seph2clk: time=%s sat=%2d\n", time_str(time, 3), seph->sat);
+    TRACE_RTK(4, "seph2clk: time=%s sat=%2d\n", time_str(time, 3), seph->sat);
 
     t = timediffweekcrossover(time, seph->t0);
 
@@ -579,19 +704,49 @@ double seph2clk(gtime_t time, const seph_t *seph)
  *-----------------------------------------------------------------------------*/
 void seph2pos(gtime_t time, const seph_t *seph, double *rs, double *dts,
     double *var)
+{
+    double rsv[6];
+    double dtsv[2];
+    int i;
+
+    seph2posvel(time, seph, rsv, dtsv, var);
+    for (i = 0; i < 3; i++)
+        {
+            rs[i] = rsv[i];
+        }
+    *dts = dtsv[0];
+}
+
+
+/* sbas ephemeris to satellite position, velocity and clock --------------------
+ * compute satellite position, velocity, clock bias and clock drift with sbas
+ * ephemeris
+ * args   : gtime_t time     I   time (gpst)
+ *          seph_t  *seph    I   sbas ephemeris
+ *          double  *rs      O   satellite position and velocity (ecef)
+ *                               {x,y,z,vx,vy,vz} (m|m/s)
+ *          double  *dts     O   satellite clock {bias,drift} (s|s/s)
+ *          double  *var     O   satellite position and clock variance (m^2)
+ * return : none
+ * notes  : see ref [3]
+ *-----------------------------------------------------------------------------*/
+void seph2posvel(gtime_t time, const seph_t *seph, double *rs, double *dts,
+    double *var)
 {
     double t;
     int i;
 
-    trace(4, "seph2pos: time=%s sat=%2d\n", time_str(time, 3), seph->sat);
+    TRACE_RTK(4, "seph2posvel: time=%s sat=%2d\n", time_str(time, 3), seph->sat);
 
     t = timediffweekcrossover(time, seph->t0);
 
     for (i = 0; i < 3; i++)
         {
             rs[i] = seph->pos[i] + seph->vel[i] * t + seph->acc[i] * t * t / 2.0;
+            rs[i + 3] = seph->vel[i] + seph->acc[i] * t;
         }
-    *dts = seph->af0 + seph->af1 * t;
+    dts[0] = seph->af0 + seph->af1 * t;
+    dts[1] = seph->af1;
 
     *var = var_uraeph(seph->sva);
 }
@@ -603,10 +758,13 @@ eph_t *seleph(gtime_t time, int sat, int iode, const nav_t *nav)
     double t;
     double tmax;
     double tmin;
+    const int *index = nullptr;
+    int n = nav->n;
     int i;
     int j = -1;
+    int k;
 
-    trace(4, "seleph  : time=%s sat=%2d iode=%d\n", time_str(time, 3), sat, iode);
+    TRACE_RTK(4, "seleph  : time=%s sat=%2d iode=%d\n", time_str(time, 3), sat, iode);
 
     switch (satsys(sat, nullptr))
         {
@@ -625,8 +783,14 @@ eph_t *seleph(gtime_t time, int sat, int iode, const nav_t *nav)
         }
     tmin = tmax + 1.0;
 
-    for (i = 0; i < nav->n; i++)
+    /* ephemerides of the satellite, if they are indexed */
+    if (nav->orbits != nullptr)
+        {
+            index = nav->orbits->eph_index(nav, sat, &n);
+        }
+    for (k = 0; k < n; k++)
         {
+            i = index ? index[k] : k;
             if (nav->eph[i].sat != sat)
                 {
                     continue;
@@ -651,7 +815,7 @@ eph_t *seleph(gtime_t time, int sat, int iode, const nav_t *nav)
         }
     if (iode >= 0 || j < 0)
         {
-            trace(3, "no broadcast ephemeris: %s sat=%2d iode=%3d\n", time_str(time, 0),
+            TRACE_RTK(3, "no broadcast ephemeris: %s sat=%2d iode=%3d\n", time_str(time, 0),
                 sat, iode);
             return nullptr;
         }
@@ -665,13 +829,21 @@ geph_t *selgeph(gtime_t time, int sat, int iode, const nav_t *nav)
     double t;
     double tmax = MAXDTOE_GLO;
     double tmin = tmax + 1.0;
+    const int *index = nullptr;
+    int n = nav->ng;
     int i;
     int j = -1;
+    int k;
 
-    trace(4, "selgeph : time=%s sat=%2d iode=%2d\n", time_str(time, 3), sat, iode);
+    TRACE_RTK(4, "selgeph : time=%s sat=%2d iode=%2d\n", time_str(time, 3), sat, iode);
 
-    for (i = 0; i < nav->ng; i++)
+    if (nav->orbits != nullptr)
+        {
+            index = nav->orbits->geph_index(nav, sat, &n);
+        }
+    for (k = 0; k < n; k++)
         {
+            i = index ? index[k] : k;
             if (nav->geph[i].sat != sat)
                 {
                     continue;
@@ -696,7 +868,7 @@ geph_t *selgeph(gtime_t time, int sat, int iode, const nav_t *nav)
         }
     if (iode >= 0 || j < 0)
         {
-            trace(3, "no glonass ephemeris  : %s sat=%2d iode=%2d\n", time_str(time, 0),
+            TRACE_RTK(3, "no glonass ephemeris  : %s sat=%2d iode=%2d\n", time_str(time, 0),
                 sat, iode);
             return nullptr;
         }
@@ -713,7 +885,7 @@ seph_t *selseph(gtime_t time, int sat, const nav_t *nav)
     int i;
     int j = -1;
 
-    trace(4, "selseph : time=%s sat=%2d\n", time_str(time, 3), sat);
+    TRACE_RTK(4, "selseph : time=%s sat=%2d\n", time_str(time, 3), sat);
 
     for (i = 0; i < nav->ns; i++)
         {
@@ -733,7 +905,7 @@ seph_t *selseph(gtime_t time, int sat, const nav_t *nav)
         }
     if (j < 0)
         {
-            trace(3, "no sbas ephemeris     : %s sat=%2d\n", time_str(time, 0), sat);
+            TRACE_RTK(3, "no sbas ephemeris     : %s sat=%2d\n", time_str(time, 0), sat);
             return nullptr;
         }
     return nav->seph + j;
@@ -749,7 +921,7 @@ int ephclk(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     seph_t *seph;
     int sys;
 
-    trace(4, "ephclk  : time=%s sat=%2d\n", time_str(time, 3), sat);
+    TRACE_RTK(4, "ephclk  : time=%s sat=%2d\n", time_str(time, 3), sat);
 
     sys = satsys(sat, nullptr);
 
@@ -793,13 +965,9 @@ int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     eph_t *eph;
     geph_t *geph;
     seph_t *seph;
-    double rst[3];
-    double dtst[1];
-    double tt = 1e-3;
-    int i;
     int sys;
 
-    trace(4, "ephpos  : time=%s sat=%2d iode=%d\n", time_str(time, 3), sat, iode);
+    TRACE_RTK(4, "ephpos  : time=%s sat=%2d iode=%d\n", time_str(time, 3), sat, iode);
 
     sys = satsys(sat, nullptr);
 
@@ -811,10 +979,14 @@ int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
                 {
                     return 0;
                 }
-
-            eph2pos(time, eph, rs, dts, var);
-            time = timeadd(time, tt);
-            eph2pos(time, eph, rst, dtst, var);
+            if (nav->orbits != nullptr)
+                {
+                    nav->orbits->eph2posvel(time, eph, rs, dts, var);
+                }
+            else
+                {
+                    eph2posvel(time, eph, rs, dts, var);
+                }
             *svh = eph->svh;
         }
     else if (sys == SYS_GLO)
@@ -823,9 +995,14 @@ int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
                 {
                     return 0;
                 }
-            geph2pos(time, geph, rs, dts, var);
-            time = timeadd(time, tt);
-            geph2pos(time, geph, rst, dtst, var);
+            if (nav->orbits != nullptr)
+                {
+                    nav->orbits->geph2posvel(time, geph, rs, dts, var);
+                }
+            else
+                {
+                    geph2posvel(time, geph, rs, dts, var);
+                }
             *svh = geph->svh;
         }
     else if (sys == SYS_SBS)
@@ -834,10 +1011,7 @@ int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
                 {
                     return 0;
                 }
-
-            seph2pos(time, seph, rs, dts, var);
-            time = timeadd(time, tt);
-            seph2pos(time, seph, rst, dtst, var);
+            seph2posvel(time, seph, rs, dts, var);
             *svh = seph->svh;
         }
     else
@@ -845,13 +1019,6 @@ int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
             return 0;
         }
 
-    /* satellite velocity and clock drift by differential approx */
-    for (i = 0; i < 3; i++)
-        {
-            rs[i + 3] = (rst[i] - rs[i]) / tt;
-        }
-    dts[1] = (dtst[0] - dts[0]) / tt;
-
     return 1;
 }
 
@@ -863,7 +1030,7 @@ int satpos_sbas(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     const sbssatp_t *sbs;
     int i;
 
-    trace(4, "satpos_sbas: time=%s sat=%2d\n", time_str(time, 3), sat);
+    TRACE_RTK(4, "satpos_sbas: time=%s sat=%2d\n", time_str(time, 3), sat);
 
     /* search sbas satellite correciton */
     for (i = 0; i < nav->sbssat.nsat; i++)
@@ -876,7 +1043,7 @@ int satpos_sbas(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
         }
     if (i >= nav->sbssat.nsat)
         {
-            trace(2, "no sbas correction for orbit: %s sat=%2d\n", time_str(time, 0), sat);
+            TRACE_RTK(2, "no sbas correction for orbit: %s sat=%2d\n", time_str(time, 0), sat);
             ephpos(time, teph, sat, nav, -1, rs, dts, var, svh);
             *svh = -1;
             return 0;
@@ -917,24 +1084,24 @@ int satpos_ssr(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     int i;
     int sys;
 
-    trace(4, "satpos_ssr: time=%s sat=%2d\n", time_str(time, 3), sat);
+    TRACE_RTK(4, "satpos_ssr: time=%s sat=%2d\n", time_str(time, 3), sat);
 
     ssr = nav->ssr + sat - 1;
 
     if (!ssr->t0[0].time)
         {
-            trace(2, "no ssr orbit correction: %s sat=%2d\n", time_str(time, 0), sat);
+            TRACE_RTK(2, "no ssr orbit correction: %s sat=%2d\n", time_str(time, 0), sat);
             return 0;
         }
     if (!ssr->t0[1].time)
         {
-            trace(2, "no ssr clock correction: %s sat=%2d\n", time_str(time, 0), sat);
+            TRACE_RTK(2, "no ssr clock correction: %s sat=%2d\n", time_str(time, 0), sat);
             return 0;
         }
     /* inconsistency between orbit and clock correction */
     if (ssr->iod[0] != ssr->iod[1])
         {
-            trace(2, "inconsist ssr correction: %s sat=%2d iod=%d %d\n",
+            TRACE_RTK(2, "inconsist ssr correction: %s sat=%2d iod=%d %d\n",
                 time_str(time, 0), sat, ssr->iod[0], ssr->iod[1]);
             *svh = -1;
             return 0;
@@ -946,7 +1113,7 @@ int satpos_ssr(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     /* ssr orbit and clock correction (ref [4]) */
     if (fabs(t1) > MAXAGESSR || fabs(t2) > MAXAGESSR)
         {
-            trace(2, "age of ssr error: %s sat=%2d t=%.0f %.0f\n", time_str(time, 0),
+            TRACE_RTK(2, "age of ssr error: %s sat=%2d t=%.0f %.0f\n", time_str(time, 0),
                 sat, t1, t2);
             *svh = -1;
             return 0;
@@ -973,7 +1140,7 @@ int satpos_ssr(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
         }
     if (norm_rtk(deph, 3) > MAXECORSSR || fabs(dclk) > MAXCCORSSR)
         {
-            trace(3, "invalid ssr correction: %s deph=%.1f dclk=%.1f\n",
+            TRACE_RTK(3, "invalid ssr correction: %s deph=%.1f dclk=%.1f\n",
                 time_str(time, 0), norm_rtk(deph, 3), dclk);
             *svh = -1;
             return 0;
@@ -1029,7 +1196,7 @@ int satpos_ssr(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     /* variance by ssr ura */
     *var = var_urassr(ssr->ura);
 
-    trace(5, "satpos_ssr: %s sat=%2d deph=%6.3f %6.3f %6.3f er=%6.3f %6.3f %6.3f dclk=%6.3f var=%6.3f\n",
+    TRACE_RTK(5, "satpos_ssr: %s sat=%2d deph=%6.3f %6.3f %6.3f er=%6.3f %6.3f %6.3f dclk=%6.3f var=%6.3f\n",
         time_str(time, 2), sat, deph[0], deph[1], deph[2], er[0], er[1], er[2], dclk, *var);
 
     return 1;
@@ -1056,7 +1223,7 @@ int satpos(gtime_t time, gtime_t teph, int sat, int ephopt,
     const nav_t *nav, double *rs, double *dts, double *var,
     int *svh)
 {
-    trace(4, "satpos  : time=%s sat=%2d ephopt=%d\n", time_str(time, 3), sat, ephopt);
+    TRACE_RTK(4, "satpos  : time=%s sat=%2d ephopt=%d\n", time_str(time, 3), sat, ephopt);
 
     *svh = 0;
 
@@ -1115,13 +1282,13 @@ int satpos(gtime_t time, gtime_t teph, int sat, int ephopt,
 void satposs(gtime_t teph, const obsd_t *obs, int n, const nav_t *nav,
     int ephopt, double *rs, double *dts, double *var, int *svh)
 {
-    std::vector<gtime_t> time(MAXOBS);
+    std::array<gtime_t, MAXOBS> time{};
     double dt;
     double pr;
     int i;
     int j;
 
-    trace(3, "satposs : teph=%s n=%d ephopt=%d\n", time_str(teph, 3), n, ephopt);
+    TRACE_RTK(3, "satposs : teph=%s n=%d ephopt=%d\n", time_str(teph, 3), n, ephopt);
 
     for (i = 0; i < n && i < MAXOBS; i++)
         {
@@ -1147,7 +1314,7 @@ void satposs(gtime_t teph, const obsd_t *obs, int n, const nav_t *nav,
 
             if (j >= NFREQ)
                 {
-                    trace(2, "no pseudorange %s sat=%2d\n", time_str(obs[i].time, 3), obs[i].sat);
+                    TRACE_RTK(2, "no pseudorange %s sat=%2d\n", time_str(obs[i].time, 3), obs[i].sat);
                     continue;
                 }
             /* transmission time by satellite clock */
@@ -1156,7 +1323,7 @@ void satposs(gtime_t teph, const obsd_t *obs, int n, const nav_t *nav,
             /* satellite clock bias by broadcast ephemeris */
             if (!ephclk(time[i], teph, obs[i].sat, nav, &dt))
                 {
-                    trace(3, "no broadcast clock %s sat=%2d\n", time_str(time[i], 3), obs[i].sat);
+                    TRACE_RTK(3, "no broadcast clock %s sat=%2d\n", time_str(time[i], 3), obs[i].sat);
                     continue;
                 }
             time[i] = timeadd(time[i], -dt);
@@ -1165,7 +1332,7 @@ void satposs(gtime_t teph, const obsd_t *obs, int n, const nav_t *nav,
             if (!satpos(time[i], teph, obs[i].sat, ephopt, nav, rs + i * 6, dts + i * 2, var + i,
                     svh + i))
                 {
-                    trace(3, "no ephemeris %s sat=%2d\n", time_str(time[i], 3), obs[i].sat);
+                    TRACE_RTK(3, "no ephemeris %s sat=%2d\n", time_str(time[i], 3), obs[i].sat);
                     continue;
                 }
             /* if no precise clock available, use broadcast clock instead */
@@ -1181,7 +1348,7 @@ void satposs(gtime_t teph, const obsd_t *obs, int n, const nav_t *nav,
         }
     for (i = 0; i < n && i < MAXOBS; i++)
         {
-            trace(4, "%s sat=%2d rs=%13.3f %13.3f %13.3f dts=%12.3f var=%7.3f svh=%02X\n",
+            TRACE_RTK(4, "%s sat=%2d rs=%13.3f %13.3f %13.3f dts=%12.3f var=%7.3f svh=%02X\n",
                 time_str(time[i], 6), obs[i].sat, rs[i * 6], rs[1 + i * 6], rs[2 + i * 6],
                 dts[i * 2] * 1e9, var[i], svh[i]);
         }
@@ -43,15 +43,22 @@ void alm2pos(gtime_t time, const alm_t *alm, double *rs, double *dts);
 double eph2clk(gtime_t time, const eph_t *eph);
 void eph2pos(gtime_t time, const eph_t *eph, double *rs, double *dts,
     double *var);
+void eph2posvel(gtime_t time, const eph_t *eph, double *rs, double *dts,
+    double *var);
 void deq(const double *x, double *xdot, const double *acc);
 void glorbit(double t, double *x, const double *acc);
+void gloprop(double t, const geph_t *geph, int *k, double *x, double *xt);
 double geph2clk(gtime_t time, const geph_t *geph);
 
 void geph2pos(gtime_t time, const geph_t *geph, double *rs, double *dts,
     double *var);
+void geph2posvel(gtime_t time, const geph_t *geph, double *rs, double *dts,
+    double *var);
 double seph2clk(gtime_t time, const seph_t *seph);
 void seph2pos(gtime_t time, const seph_t *seph, double *rs, double *dts,
     double *var);
+void seph2posvel(gtime_t time, const seph_t *seph, double *rs, double *dts,
+    double *var);
 eph_t *seleph(gtime_t time, int sat, int iode, const nav_t *nav);
 geph_t *selgeph(gtime_t time, int sat, int iode, const nav_t *nav);
 seph_t *selseph(gtime_t time, int sat, const nav_t *nav);
@@ -89,7 +89,7 @@ tec_t *addtec(const double *lats, const double *lons, const double *hgts,
     int n;
     int ndata[3];
 
-    trace(3, "addtec  :\n");
+    TRACE_RTK(3, "addtec  :\n");
 
     ndata[0] = nitem(lats);
     ndata[1] = nitem(lons);
@@ -104,7 +104,7 @@ tec_t *addtec(const double *lats, const double *lons, const double *hgts,
             nav->ntmax += 256;
             if (!(nav_tec = static_cast<tec_t *>(realloc(nav->tec, sizeof(tec_t) * nav->ntmax))))
                 {
-                    trace(1, "readionex malloc error ntmax=%d\n", nav->ntmax);
+                    TRACE_RTK(1, "readionex malloc error ntmax=%d\n", nav->ntmax);
                     free(nav->tec);
                     nav->tec = nullptr;
                     nav->nt = nav->ntmax = 0;
@@ -148,7 +148,7 @@ void readionexdcb(FILE *fp, double *dcb, double *rms)
     char id[32];
     char *label;
 
-    trace(3, "readionexdcb:\n");
+    TRACE_RTK(3, "readionexdcb:\n");
 
     for (i = 0; i < MAXSAT; i++)
         {
@@ -170,7 +170,7 @@ void readionexdcb(FILE *fp, double *dcb, double *rms)
                         {
                             if (!(sat = satid2no(id)))
                                 {
-                                    trace(2, "ionex invalid satellite: %s\n", id);
+                                    TRACE_RTK(2, "ionex invalid satellite: %s\n", id);
                                     continue;
                                 }
                             dcb[sat - 1] = str2num(buff, 6, 10);
@@ -193,7 +193,7 @@ double readionexh(FILE *fp, double *lats, double *lons, double *hgts,
     char buff[1024];
     char *label;
 
-    trace(3, "readionexh:\n");
+    TRACE_RTK(3, "readionexh:\n");
 
     while (fgets(buff, sizeof(buff), fp))
         {
@@ -270,7 +270,7 @@ int readionexb(FILE *fp, const double *lats, const double *lons,
     char buff[1024];
     char *label = buff + 60;
 
-    trace(3, "readionexb:\n");
+    TRACE_RTK(3, "readionexb:\n");
 
     while (fgets(buff, sizeof(buff), fp))
         {
@@ -305,7 +305,7 @@ int readionexb(FILE *fp, const double *lats, const double *lons,
                 {
                     if (str2time(buff, 0, 36, &time))
                         {
-                            trace(2, "ionex epoch invalid: %-36.36s\n", buff);
+                            TRACE_RTK(2, "ionex epoch invalid: %-36.36s\n", buff);
                             continue;
                         }
                     if (type == 2)
@@ -378,7 +378,7 @@ void combtec(nav_t *nav)
     int j;
     int n = 0;
 
-    trace(3, "combtec : nav->nt=%d\n", nav->nt);
+    TRACE_RTK(3, "combtec : nav->nt=%d\n", nav->nt);
 
     for (i = 0; i < nav->nt - 1; i++)
         {
@@ -405,7 +405,7 @@ void combtec(nav_t *nav)
         }
     nav->nt = n;
 
-    trace(4, "combtec : nav->nt=%d\n", nav->nt);
+    TRACE_RTK(4, "combtec : nav->nt=%d\n", nav->nt);
 }
 
 
@@ -433,7 +433,7 @@ void readtec(const char *file, nav_t *nav, int opt)
     int n;
     char *efiles[MAXEXFILE];
 
-    trace(3, "readtec : file=%s\n", file);
+    TRACE_RTK(3, "readtec : file=%s\n", file);
 
     /* clear of tec grid data option */
     if (!opt)
@@ -460,14 +460,14 @@ void readtec(const char *file, nav_t *nav, int opt)
         {
             if (!(fp = fopen(efiles[i], "re")))
                 {
-                    trace(2, "ionex file open error %s\n", efiles[i]);
+                    TRACE_RTK(2, "ionex file open error %s\n", efiles[i]);
                     continue;
                 }
 
             /* read ionex header */
             if (readionexh(fp, lats, lons, hgts, &rb, &nexp, dcb.data(), rms.data()) <= 0.0)
                 {
-                    trace(2, "ionex file format error %s\n", efiles[i]);
+                    TRACE_RTK(2, "ionex file format error %s\n", efiles[i]);
                     fclose(fp);
                     continue;
                 }
@@ -510,7 +510,7 @@ int interptec(const tec_t *tec, int k, const double *posp, double *value,
     int n;
     int index;
 
-    trace(3, "interptec: k=%d posp=%.2f %.2f\n", k, posp[0] * R2D, posp[1] * R2D);
+    TRACE_RTK(3, "interptec: k=%d posp=%.2f %.2f\n", k, posp[0] * R2D, posp[1] * R2D);
     *value = *rms = 0.0;
 
     if (tec->lats[2] == 0.0 || tec->lons[2] == 0.0)
@@ -609,7 +609,7 @@ int iondelay(gtime_t time, const tec_t *tec, const double *pos,
     double rp;
     int i;
 
-    trace(3, "iondelay: time=%s pos=%.1f %.1f azel=%.1f %.1f\n", time_str(time, 0),
+    TRACE_RTK(3, "iondelay: time=%s pos=%.1f %.1f azel=%.1f %.1f\n", time_str(time, 0),
         pos[0] * R2D, pos[1] * R2D, azel[0] * R2D, azel[1] * R2D);
 
     *delay = *var = 0.0;
@@ -641,7 +641,7 @@ int iondelay(gtime_t time, const tec_t *tec, const double *pos,
             *delay += fact * fs * vtec;
             *var += fact * fact * fs * fs * rms * rms;
         }
-    trace(4, "iondelay: delay=%7.2f std=%6.2f\n", *delay, sqrt(*var));
+    TRACE_RTK(4, "iondelay: delay=%7.2f std=%6.2f\n", *delay, sqrt(*var));
 
     return 1;
 }
@@ -672,7 +672,7 @@ int iontec(gtime_t time, const nav_t *nav, const double *pos,
     int i;
     int stat[2];
 
-    trace(3, "iontec  : time=%s pos=%.1f %.1f azel=%.1f %.1f\n", time_str(time, 0),
+    TRACE_RTK(3, "iontec  : time=%s pos=%.1f %.1f azel=%.1f %.1f\n", time_str(time, 0),
         pos[0] * R2D, pos[1] * R2D, azel[0] * R2D, azel[1] * R2D);
 
     if (azel[1] < MIN_EL || pos[2] < MIN_HGT)
@@ -690,12 +690,12 @@ int iontec(gtime_t time, const nav_t *nav, const double *pos,
         }
     if (i == 0 || i >= nav->nt)
         {
-            trace(2, "%s: tec grid out of period\n", time_str(time, 0));
+            TRACE_RTK(2, "%s: tec grid out of period\n", time_str(time, 0));
             return 0;
         }
     if ((tt = timediff(nav->tec[i].time, nav->tec[i - 1].time)) == 0.0)
         {
-            trace(2, "tec grid time interval error\n");
+            TRACE_RTK(2, "tec grid time interval error\n");
             return 0;
         }
     /* ionospheric delay by tec grid data */
@@ -704,7 +704,7 @@ int iontec(gtime_t time, const nav_t *nav, const double *pos,
 
     if (!stat[0] && !stat[1])
         {
-            trace(2, "%s: tec grid out of area pos=%6.2f %7.2f azel=%6.1f %5.1f\n",
+            TRACE_RTK(2, "%s: tec grid out of area pos=%6.2f %7.2f azel=%6.1f %5.1f\n",
                 time_str(time, 0), pos[0] * R2D, pos[1] * R2D, azel[0] * R2D, azel[1] * R2D);
             return 0;
         }
@@ -724,6 +724,6 @@ int iontec(gtime_t time, const nav_t *nav, const double *pos,
             *delay = dels[1];
             *var = vars[1];
         }
-    trace(3, "iontec  : delay=%5.2f std=%5.2f\n", *delay, sqrt(*var));
+    TRACE_RTK(3, "iontec  : delay=%5.2f std=%5.2f\n", *delay, sqrt(*var));
     return 1;
 }
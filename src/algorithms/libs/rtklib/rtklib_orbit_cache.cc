@@ -0,0 +1,246 @@
+/*!
+ * \file rtklib_orbit_cache.cc
+ * \brief Per-satellite cache of orbit and clock evaluations for the RTKLIB
+ * solvers
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtklib_orbit_cache.h"
+#include "rtklib_ephemeris.h"
+#include "rtklib_rtkcmn.h"
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+// Length of the interpolation windows. The error of the cubic Hermite
+// interpolation grows with its fourth power, and is about 0.1 mm for 30 s
+constexpr double ORBIT_CACHE_SPAN_S = 30.0;
+
+bool same_time(const gtime_t& a, const gtime_t& b)
+{
+    return a.time == b.time && a.sec == b.sec;
+}
+
+
+// Fields of eph_t used by eph2posvel()
+bool same_ephemeris(const eph_t& a, const eph_t& b)
+{
+    return a.sat == b.sat && a.iode == b.iode && a.sva == b.sva &&
+           same_time(a.toe, b.toe) && same_time(a.toc, b.toc) &&
+           a.A == b.A && a.e == b.e && a.i0 == b.i0 && a.OMG0 == b.OMG0 &&
+           a.omg == b.omg && a.M0 == b.M0 && a.deln == b.deln &&
+           a.OMGd == b.OMGd && a.idot == b.idot && a.crc == b.crc &&
+           a.crs == b.crs && a.cuc == b.cuc && a.cus == b.cus &&
+           a.cic == b.cic && a.cis == b.cis && a.toes == b.toes &&
+           a.f0 == b.f0 && a.f1 == b.f1 && a.f2 == b.f2 &&
+           a.apply_has_corrections == b.apply_has_corrections &&
+           a.has_clock_correction_m == b.has_clock_correction_m &&
+           a.has_orbit_radial_correction_m == b.has_orbit_radial_correction_m &&
+           a.has_orbit_in_track_correction_m == b.has_orbit_in_track_correction_m &&
+           a.has_orbit_cross_track_correction_m == b.has_orbit_cross_track_correction_m;
+}
+
+
+// Fields of geph_t used by geph2posvel()
+bool same_ephemeris(const geph_t& a, const geph_t& b)
+{
+    return a.sat == b.sat && a.iode == b.iode && same_time(a.toe, b.toe) &&
+           std::memcmp(a.pos, b.pos, sizeof(a.pos)) == 0 &&
+           std::memcmp(a.vel, b.vel, sizeof(a.vel)) == 0 &&
+           std::memcmp(a.acc, b.acc, sizeof(a.acc)) == 0 &&
+           a.taun == b.taun && a.gamn == b.gamn;
+}
+}  // namespace
+
+
+Rtklib_Orbit_Cache::Rtklib_Orbit_Cache() : d_satellites(MAXSAT)
+{
+}
+
+
+template <typename T>
+void Rtklib_Orbit_Cache::Ephemeris_Index::build(const T* ephemerides, int num)
+{
+    // Counting sort of the positions by satellite, which keeps their order
+    first.fill(0);
+    for (int i = 0; i < num; i++)
+        {
+            const int sat = ephemerides[i].sat;
+            if (sat >= 1 && sat <= MAXSAT)
+                {
+                    first[sat]++;
+                }
+        }
+    for (int sat = 1; sat <= MAXSAT; sat++)
+        {
+            first[sat] += first[sat - 1];
+        }
+    order.resize(first[MAXSAT]);
+    std::array<int, MAXSAT + 1> next = first;
+    for (int i = 0; i < num; i++)
+        {
+            const int sat = ephemerides[i].sat;
+            if (sat >= 1 && sat <= MAXSAT)
+                {
+                    order[next[sat - 1]++] = i;
+                }
+        }
+    data = ephemerides;
+    n = num;
+}
+
+
+void Rtklib_Orbit_Cache::index(const nav_t* nav)
+{
+    d_eph_index.build(nav->eph, nav->n);
+    d_geph_index.build(nav->geph, nav->ng);
+}
+
+
+const int* Rtklib_Orbit_Cache::eph_index(const nav_t* nav, int sat, int* n) const
+{
+    if (d_eph_index.data != nav->eph || d_eph_index.n != nav->n || sat < 1 || sat > MAXSAT)
+        {
+            return nullptr;
+        }
+    *n = d_eph_index.first[sat] - d_eph_index.first[sat - 1];
+    return d_eph_index.order.data() + d_eph_index.first[sat - 1];
+}
+
+
+const int* Rtklib_Orbit_Cache::geph_index(const nav_t* nav, int sat, int* n) const
+{
+    if (d_geph_index.data != nav->geph || d_geph_index.n != nav->ng || sat < 1 || sat > MAXSAT)
+        {
+            return nullptr;
+        }
+    *n = d_geph_index.first[sat] - d_geph_index.first[sat - 1];
+    return d_geph_index.order.data() + d_geph_index.first[sat - 1];
+}
+
+
+void Rtklib_Orbit_Cache::eph2posvel(gtime_t time, const eph_t* eph, double* rs, double* dts, double* var)
+{
+    if (eph->sat < 1 || eph->sat > MAXSAT || eph->A <= 0.0)
+        {
+            ::eph2posvel(time, eph, rs, dts, var);
+            return;
+        }
+    Satellite& s = d_satellites[eph->sat - 1];
+    const double tk = timediffweekcrossover(time, eph->toe);
+    const auto window = static_cast<int64_t>(std::floor(tk / ORBIT_CACHE_SPAN_S));
+    const bool same = s.sys != 0 && s.sys != SYS_GLO && same_ephemeris(s.eph, *eph);
+    if (!same || window != s.window)
+        {
+            if (same && window == s.window + 1)
+                {
+                    s.nodes[0] = s.nodes[1];
+                }
+            else
+                {
+                    ::eph2posvel(timeadd(eph->toe, window * ORBIT_CACHE_SPAN_S), eph, s.nodes[0].rs.data(), s.nodes[0].dts.data(), &s.var);
+                    d_evaluations++;
+                }
+            ::eph2posvel(timeadd(eph->toe, (window + 1) * ORBIT_CACHE_SPAN_S), eph, s.nodes[1].rs.data(), s.nodes[1].dts.data(), &s.var);
+            d_evaluations++;
+            s.sys = satsys(eph->sat, nullptr);
+            s.eph = *eph;
+            s.window = window;
+        }
+    interpolate(s, tk - window * ORBIT_CACHE_SPAN_S, rs, dts, var);
+}
+
+
+void Rtklib_Orbit_Cache::geph2posvel(gtime_t time, const geph_t* geph, double* rs, double* dts, double* var)
+{
+    if (geph->sat < 1 || geph->sat > MAXSAT)
+        {
+            ::geph2posvel(time, geph, rs, dts, var);
+            return;
+        }
+    Satellite& s = d_satellites[geph->sat - 1];
+    const double t = timediff(time, geph->toe);
+    const auto window = static_cast<int64_t>(std::floor(t / ORBIT_CACHE_SPAN_S));
+    const bool same = s.sys == SYS_GLO && same_ephemeris(s.geph, *geph);
+    if (!same)
+        {
+            s.sys = SYS_GLO;
+            s.geph = *geph;
+            s.steps = 0;
+        }
+    if (!same || window != s.window)
+        {
+            if (same && window == s.window + 1)
+                {
+                    s.nodes[0] = s.nodes[1];
+                }
+            else
+                {
+                    update_glonass_node(s, geph, window, s.nodes[0]);
+                }
+            update_glonass_node(s, geph, window + 1, s.nodes[1]);
+            s.window = window;
+            s.var = std::pow(ERREPH_GLO, 2.0);
+        }
+    interpolate(s, t - window * ORBIT_CACHE_SPAN_S, rs, dts, var);
+}
+
+
+void Rtklib_Orbit_Cache::clear()
+{
+    for (auto& s : d_satellites)
+        {
+            s.sys = 0;
+        }
+}
+
+
+void Rtklib_Orbit_Cache::update_glonass_node(Satellite& s, const geph_t* geph, int64_t window, Node& node)
+{
+    // The integration continues from the last full step of the previous node
+    const double t = window * ORBIT_CACHE_SPAN_S;
+    gloprop(t, geph, &s.steps, s.x.data(), node.rs.data());
+    node.dts[0] = -geph->taun + geph->gamn * t;
+    node.dts[1] = geph->gamn;
+    d_evaluations++;
+}
+
+
+void Rtklib_Orbit_Cache::interpolate(const Satellite& s, double t, double* rs, double* dts, double* var) const
+{
+    // Cubic Hermite basis at the normalized time u in [0, 1), and its derivatives
+    const double h = ORBIT_CACHE_SPAN_S;
+    const double u = t / h;
+    const double u2 = u * u;
+    const double u3 = u2 * u;
+    const double h00 = 2.0 * u3 - 3.0 * u2 + 1.0;
+    const double h10 = (u3 - 2.0 * u2 + u) * h;
+    const double h01 = -2.0 * u3 + 3.0 * u2;
+    const double h11 = (u3 - u2) * h;
+    const double d00 = (6.0 * u2 - 6.0 * u) / h;
+    const double d10 = 3.0 * u2 - 4.0 * u + 1.0;
+    const double d01 = (-6.0 * u2 + 6.0 * u) / h;
+    const double d11 = 3.0 * u2 - 2.0 * u;
+
+    const Node& a = s.nodes[0];
+    const Node& b = s.nodes[1];
+    for (int i = 0; i < 3; i++)
+        {
+            rs[i] = h00 * a.rs[i] + h10 * a.rs[i + 3] + h01 * b.rs[i] + h11 * b.rs[i + 3];
+            rs[i + 3] = d00 * a.rs[i] + d10 * a.rs[i + 3] + d01 * b.rs[i] + d11 * b.rs[i + 3];
+        }
+    dts[0] = h00 * a.dts[0] + h10 * a.dts[1] + h01 * b.dts[0] + h11 * b.dts[1];
+    dts[1] = d00 * a.dts[0] + d10 * a.dts[1] + d01 * b.dts[0] + d11 * b.dts[1];
+    *var = s.var;
+}
@@ -0,0 +1,124 @@
+/*!
+ * \file rtklib_orbit_cache.h
+ * \brief Per-satellite cache of orbit and clock evaluations for the RTKLIB
+ * solvers
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RTKLIB_ORBIT_CACHE_H
+#define GNSS_SDR_RTKLIB_ORBIT_CACHE_H
+
+#include "rtklib.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup RTKLIB_Library
+ * \{ */
+
+
+/*!
+ * \brief Speeds up the evaluation of broadcast orbits and clocks when the
+ * solver is called at a high rate.
+ *
+ * When a nav_t points to an Rtklib_Orbit_Cache (member orbits), seleph() and
+ * selgeph() only scan the ephemerides of the requested satellite, and ephpos()
+ * interpolates the position, velocity and clock of each satellite with cubic
+ * Hermite polynomials. Their nodes are the orbit and clock evaluations at the
+ * edges of windows of ORBIT_CACHE_SPAN_S seconds, aligned with the ephemeris
+ * epoch, and are reused while the ephemeris does not change. The GLONASS
+ * orbit integration continues from the last full step instead of starting
+ * again from the ephemeris epoch.
+ *
+ * The interpolation error is below 1 mm in position and 1 mm/s in velocity.
+ */
+class Rtklib_Orbit_Cache
+{
+public:
+    Rtklib_Orbit_Cache();
+
+    /*!
+     * \brief Indexes the ephemerides of nav by satellite. It must be called
+     * again each time nav->eph, nav->n, nav->geph or nav->ng change.
+     */
+    void index(const nav_t* nav);
+
+    /*!
+     * \brief Positions in nav->eph of the ephemerides of satellite sat, in
+     * order. Returns nullptr, and leaves n unchanged, if the ephemerides of nav
+     * are not the indexed ones.
+     */
+    const int* eph_index(const nav_t* nav, int sat, int* n) const;
+
+    //! Same as eph_index(), for the positions in nav->geph
+    const int* geph_index(const nav_t* nav, int sat, int* n) const;
+
+    //! Same outputs as ::eph2posvel(), interpolated
+    void eph2posvel(gtime_t time, const eph_t* eph, double* rs, double* dts, double* var);
+
+    //! Same outputs as ::geph2posvel(), interpolated
+    void geph2posvel(gtime_t time, const geph_t* geph, double* rs, double* dts, double* var);
+
+    //! Forgets the cached evaluations
+    void clear();
+
+    //! Number of orbit and clock evaluations made since construction
+    inline uint64_t evaluations() const
+    {
+        return d_evaluations;
+    }
+
+private:
+    struct Node
+    {
+        std::array<double, 6> rs;  // position and velocity
+        std::array<double, 2> dts;  // clock bias and drift
+    };
+
+    struct Satellite
+    {
+        int sys{0};  // system of the cached ephemeris, 0 if none
+        eph_t eph{};
+        geph_t geph{};
+        int64_t window{0};  // window index, from the ephemeris epoch
+        std::array<Node, 2> nodes{};
+        double var{0.0};
+        int steps{0};  // GLONASS full integration steps of x
+        std::array<double, 6> x{};
+    };
+
+    struct Ephemeris_Index
+    {
+        template <typename T>
+        void build(const T* ephemerides, int num);
+        const void* data{nullptr};
+        int n{-1};
+        std::array<int, MAXSAT + 1> first{};
+        std::vector<int> order;
+    };
+
+    void interpolate(const Satellite& s, double t, double* rs, double* dts, double* var) const;
+    void update_glonass_node(Satellite& s, const geph_t* geph, int64_t window, Node& node);
+
+    std::vector<Satellite> d_satellites;
+    Ephemeris_Index d_eph_index;
+    Ephemeris_Index d_geph_index;
+    uint64_t d_evaluations{0};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_RTKLIB_ORBIT_CACHE_H
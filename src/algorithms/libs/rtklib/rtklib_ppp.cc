@@ -38,7 +38,7 @@
 #include "rtklib_sbas.h"
 #include "rtklib_tides.h"
 #include <cstring>
-#include <vector>
+#include <array>
 
 /* wave length of LC (m) -----------------------------------------------------*/
 double lam_LC(int i, int j, int k)
@@ -352,7 +352,7 @@ int sel_amb(int *sat1, int *sat2, double *N, double *var, int n)
 {
     int i;
     int j;
-    std::vector<int> flgs(MAXSAT, 0);
+    std::array<int, MAXSAT> flgs{};
     int max_flg = 0;
 
     /* sort by variance */
@@ -420,10 +420,10 @@ int fix_sol(rtk_t *rtk, const int *sat1, const int *sat2,
     /* update states with constraints */
     if ((info = filter(rtk->x, rtk->P, H, v, R, rtk->nx, n)))
         {
-            trace(1, "filter error (info=%d)\n", info);
-            free(v);
-            free(H);
-            free(R);
+            TRACE_RTK(1, "filter error (info=%d)\n", info);
+            matfree(v);
+            matfree(H);
+            matfree(R);
             return 0;
         }
     /* set solution */
@@ -441,9 +441,9 @@ int fix_sol(rtk_t *rtk, const int *sat1, const int *sat2,
             rtk->ambc[sat1[i] - 1].flags[sat2[i] - 1] = 1;
             rtk->ambc[sat2[i] - 1].flags[sat1[i] - 1] = 1;
         }
-    free(v);
-    free(H);
-    free(R);
+    matfree(v);
+    matfree(H);
+    matfree(R);
     return 1;
 }
 
@@ -519,8 +519,8 @@ int fix_amb_ROUND(rtk_t *rtk, int *sat1, int *sat2, const int *NW, int n)
     /* fixed solution */
     stat = fix_sol(rtk, sat1, sat2, NC, m);
 
-    free(NC);
-    free(var);
+    matfree(NC);
+    matfree(var);
 
     return stat && m >= 3;
 }
@@ -547,7 +547,7 @@ int fix_amb_ILS(rtk_t *rtk, int *sat1, int *sat2, int *NW, int n)
     int m = 0;
     int info;
     int stat;
-    std::vector<int> flgs(MAXSAT, 0);
+    std::array<int, MAXSAT> flgs{};
     int max_flg = 0;
 
     lam1 = LAM_CARR[0];
@@ -594,12 +594,12 @@ int fix_amb_ILS(rtk_t *rtk, int *sat1, int *sat2, int *NW, int n)
         }
     if (m < 3)
         {
-            free(B1);
-            free(N1);
-            free(D);
-            free(E);
-            free(Q);
-            free(NC);
+            matfree(B1);
+            matfree(N1);
+            matfree(D);
+            matfree(E);
+            matfree(Q);
+            matfree(NC);
             return 0;
         }
 
@@ -610,23 +610,23 @@ int fix_amb_ILS(rtk_t *rtk, int *sat1, int *sat2, int *NW, int n)
     /* integer least square */
     if ((info = lambda(m, 2, B1, Q, N1, s)))
         {
-            trace(2, "lambda error: info=%d\n", info);
-            free(B1);
-            free(N1);
-            free(D);
-            free(E);
-            free(Q);
-            free(NC);
+            TRACE_RTK(2, "lambda error: info=%d\n", info);
+            matfree(B1);
+            matfree(N1);
+            matfree(D);
+            matfree(E);
+            matfree(Q);
+            matfree(NC);
             return 0;
         }
     if (s[0] <= 0.0)
         {
-            free(B1);
-            free(N1);
-            free(D);
-            free(E);
-            free(Q);
-            free(NC);
+            matfree(B1);
+            matfree(N1);
+            matfree(D);
+            matfree(E);
+            matfree(Q);
+            matfree(NC);
             return 0;
         }
 
@@ -635,16 +635,16 @@ int fix_amb_ILS(rtk_t *rtk, int *sat1, int *sat2, int *NW, int n)
     /* varidation by ratio-test */
     if (rtk->opt.thresar[0] > 0.0 && rtk->sol.ratio < rtk->opt.thresar[0])
         {
-            trace(2, "varidation error: n=%2d ratio=%8.3f\n", m, rtk->sol.ratio);
-            free(B1);
-            free(N1);
-            free(D);
-            free(E);
-            free(Q);
-            free(NC);
+            TRACE_RTK(2, "varidation error: n=%2d ratio=%8.3f\n", m, rtk->sol.ratio);
+            matfree(B1);
+            matfree(N1);
+            matfree(D);
+            matfree(E);
+            matfree(Q);
+            matfree(NC);
             return 0;
         }
-    trace(2, "varidation ok: %s n=%2d ratio=%8.3f\n", time_str(rtk->sol.time, 0), m,
+    TRACE_RTK(2, "varidation ok: %s n=%2d ratio=%8.3f\n", time_str(rtk->sol.time, 0), m,
         rtk->sol.ratio);
 
     /* narrow-lane to iono-free ambiguity */
@@ -655,12 +655,12 @@ int fix_amb_ILS(rtk_t *rtk, int *sat1, int *sat2, int *NW, int n)
     /* fixed solution */
     stat = fix_sol(rtk, sat1, sat2, NC, m);
 
-    free(B1);
-    free(N1);
-    free(D);
-    free(E);
-    free(Q);
-    free(NC);
+    matfree(B1);
+    matfree(N1);
+    matfree(D);
+    matfree(E);
+    matfree(Q);
+    matfree(NC);
 
     return stat;
 }
@@ -684,7 +684,7 @@ int pppamb(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav,
             return 0;
         }
 
-    trace(3, "pppamb: time=%s n=%d\n", time_str(obs[0].time, 0), n);
+    TRACE_RTK(3, "pppamb: time=%s n=%d\n", time_str(obs[0].time, 0), n);
 
     elmask = rtk->opt.elmaskar > 0.0 ? rtk->opt.elmaskar : rtk->opt.elmin;
 
@@ -728,9 +728,9 @@ int pppamb(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav,
         {
             stat = fix_amb_ILS(rtk, sat1, sat2, NW, m);
         }
-    free(sat1);
-    free(sat2);
-    free(NW);
+    matfree(sat1);
+    matfree(sat2);
+    matfree(NW);
 
     return stat;
 }
@@ -753,7 +753,7 @@ void pppoutsolstat(rtk_t *rtk, int level, FILE *fp)
             return;
         }
 
-    trace(3, "pppoutsolstat:\n");
+    TRACE_RTK(3, "pppoutsolstat:\n");
 
     tow = time2gpst(rtk->sol.time, &week);
 
@@ -829,13 +829,13 @@ void testeclipse(const obsd_t *obs, int n, const nav_t *nav, double *rs)
     int j;
     const char *type;
 
-    trace(3, "testeclipse:\n");
+    TRACE_RTK(3, "testeclipse:\n");
 
     /* unit vector of sun direction (ecef) */
     sunmoonpos(gpst2utc(obs[0].time), erpv, rsun, nullptr, nullptr);
     if (normv3(rsun, esun) == 0)
         {
-            trace(1, "Error computing the norm");
+            TRACE_RTK(1, "Error computing the norm");
         }
 
     for (i = 0; i < n; i++)
@@ -864,7 +864,7 @@ void testeclipse(const obsd_t *obs, int n, const nav_t *nav, double *rs)
                     continue;
                 }
 
-            trace(2, "eclipsing sat excluded %s sat=%2d\n", time_str(obs[0].time, 0),
+            TRACE_RTK(2, "eclipsing sat excluded %s sat=%2d\n", time_str(obs[0].time, 0),
                 obs[i].sat);
 
             for (j = 0; j < 3; j++)
@@ -960,7 +960,7 @@ int ifmeas(const obsd_t *obs, const nav_t *nav, const double *azel,
     int j = 1;
     int k;
 
-    trace(4, "ifmeas  :\n");
+    TRACE_RTK(4, "ifmeas  :\n");
 
     /* L1-L2 for GPS/GLO/QZS, L1-L5 for GAL/SBS */
     if (NFREQ >= 3 && (satsys(obs->sat, nullptr) & (SYS_GAL | SYS_SBS)))
@@ -1111,7 +1111,7 @@ int corrmeas(const obsd_t *obs, const nav_t *nav, const double *pos,
     double gamma;
     int i;
 
-    trace(4, "corrmeas:\n");
+    TRACE_RTK(4, "corrmeas:\n");
 
     meas[0] = meas[1] = var[0] = var[1] = 0.0;
 
@@ -1150,7 +1150,7 @@ int corrmeas(const obsd_t *obs, const nav_t *nav, const double *pos,
     /* slant ionospheric delay L1 (m) */
     if (!corr_ion(obs->time, nav, obs->sat, pos, azel, opt->ionoopt, &ion, &vari, brk))
         {
-            trace(2, "iono correction error: time=%s sat=%2d ionoopt=%d\n",
+            TRACE_RTK(2, "iono correction error: time=%s sat=%2d ionoopt=%d\n",
                 time_str(obs->time, 2), obs->sat, opt->ionoopt);
             return 0;
         }
@@ -1196,7 +1196,7 @@ void udpos_ppp(rtk_t *rtk)
 {
     int i;
 
-    trace(3, "udpos_ppp:\n");
+    TRACE_RTK(3, "udpos_ppp:\n");
 
     /* fixed mode */
     if (rtk->opt.mode == PMODE_PPP_FIXED)
@@ -1235,7 +1235,7 @@ void udclk_ppp(rtk_t *rtk)
     double dtr;
     int i;
 
-    trace(3, "udclk_ppp:\n");
+    TRACE_RTK(3, "udclk_ppp:\n");
 
     /* initialize every epoch for clock (white noise) */
     for (i = 0; i < NSYS; i++)
@@ -1265,7 +1265,7 @@ void udtrop_ppp(rtk_t *rtk)
     int i = IT_PPP(&rtk->opt);
     int j;
 
-    trace(3, "udtrop_ppp:\n");
+    TRACE_RTK(3, "udtrop_ppp:\n");
 
     if (rtk->x[i] == 0.0)
         {
@@ -1302,7 +1302,7 @@ void detslp_ll(rtk_t *rtk, const obsd_t *obs, int n)
     int i;
     int j;
 
-    trace(3, "detslp_ll: n=%d\n", n);
+    TRACE_RTK(3, "detslp_ll: n=%d\n", n);
 
     for (i = 0; i < n && i < MAXOBS; i++)
         {
@@ -1313,7 +1313,7 @@ void detslp_ll(rtk_t *rtk, const obsd_t *obs, int n)
                             continue;
                         }
 
-                    trace(3, "detslp_ll: slip detected sat=%2d f=%d\n", obs[i].sat, j + 1);
+                    TRACE_RTK(3, "detslp_ll: slip detected sat=%2d f=%d\n", obs[i].sat, j + 1);
 
                     rtk->ssat[obs[i].sat - 1].slip[j] = 1;
                 }
@@ -1329,7 +1329,7 @@ void detslp_gf(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
     int i;
     int j;
 
-    trace(3, "detslp_gf: n=%d\n", n);
+    TRACE_RTK(3, "detslp_gf: n=%d\n", n);
 
     for (i = 0; i < n && i < MAXOBS; i++)
         {
@@ -1341,11 +1341,11 @@ void detslp_gf(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
             g0 = rtk->ssat[obs[i].sat - 1].gf;
             rtk->ssat[obs[i].sat - 1].gf = g1;
 
-            trace(4, "detslip_gf: sat=%2d gf0=%8.3f gf1=%8.3f\n", obs[i].sat, g0, g1);
+            TRACE_RTK(4, "detslip_gf: sat=%2d gf0=%8.3f gf1=%8.3f\n", obs[i].sat, g0, g1);
 
             if (g0 != 0.0 && fabs(g1 - g0) > rtk->opt.thresslip)
                 {
-                    trace(3, "detslip_gf: slip detected sat=%2d gf=%8.3f->%8.3f\n",
+                    TRACE_RTK(3, "detslip_gf: slip detected sat=%2d gf=%8.3f->%8.3f\n",
                         obs[i].sat, g0, g1);
 
                     for (j = 0; j < rtk->opt.nf; j++)
@@ -1362,7 +1362,7 @@ void udbias_ppp(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
 {
     double meas[2];
     double var[2];
-    std::vector<double> bias(MAXOBS, 0.0);
+    std::array<double, MAXOBS> bias{};
     double offset = 0.0;
     double pos[3] = {0};
     int i;
@@ -1371,7 +1371,7 @@ void udbias_ppp(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
     int sat;
     int brk = 0;
 
-    trace(3, "udbias  : n=%d\n", n);
+    TRACE_RTK(3, "udbias  : n=%d\n", n);
 
     for (i = 0; i < MAXSAT; i++)
         {
@@ -1409,7 +1409,7 @@ void udbias_ppp(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
             if (brk)
                 {
                     rtk->ssat[sat - 1].slip[0] = 1;
-                    trace(2, "%s: sat=%2d correction break\n", time_str(obs[i].time, 0), sat);
+                    TRACE_RTK(2, "%s: sat=%2d correction break\n", time_str(obs[i].time, 0), sat);
                 }
             bias[i] = meas[0] - meas[1];
             if (rtk->x[j] == 0.0 ||
@@ -1431,7 +1431,7 @@ void udbias_ppp(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
                             rtk->x[j] += offset / k;
                         }
                 }
-            trace(2, "phase-code jump corrected: %s n=%2d dt=%12.9fs\n",
+            TRACE_RTK(2, "phase-code jump corrected: %s n=%2d dt=%12.9fs\n",
                 time_str(rtk->sol.time, 0), k, offset / k / SPEED_OF_LIGHT_M_S);
         }
     for (i = 0; i < n && i < MAXOBS; i++)
@@ -1455,7 +1455,7 @@ void udbias_ppp(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
             /* reinitialize phase-bias if detecting cycle slip */
             initx(rtk, bias[i], VAR_BIAS, IB_PPP(sat, &rtk->opt));
 
-            trace(5, "udbias_ppp: sat=%2d bias=%.3f\n", sat, meas[0] - meas[1]);
+            TRACE_RTK(5, "udbias_ppp: sat=%2d bias=%.3f\n", sat, meas[0] - meas[1]);
         }
 }
 
@@ -1463,7 +1463,7 @@ void udbias_ppp(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
 /* temporal update of states --------------------------------------------------*/
 void udstate_ppp(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
 {
-    trace(3, "udstate_ppp: n=%d\n", n);
+    TRACE_RTK(3, "udstate_ppp: n=%d\n", n);
 
     /* temporal update of position */
     udpos_ppp(rtk);
@@ -1562,7 +1562,7 @@ int res_ppp(int iter __attribute__((unused)), const obsd_t *obs, int n, const do
     double dtdx[3];
     double dantr[NFREQ] = {0};
     double dants[NFREQ] = {0};
-    std::vector<double> var(MAXOBS * 2, 0.0);
+    std::array<double, MAXOBS * 2> var{};
     double dtrp = 0.0;
     double vart = 0.0;
     double varm[2] = {0};
@@ -1576,7 +1576,7 @@ int res_ppp(int iter __attribute__((unused)), const obsd_t *obs, int n, const do
     int brk;
     int tideopt;
 
-    trace(3, "res_ppp : n=%d nx=%d\n", n, nx);
+    TRACE_RTK(3, "res_ppp : n=%d nx=%d\n", n, nx);
 
     for (i = 0; i < MAXSAT; i++)
         {
@@ -1663,7 +1663,7 @@ int res_ppp(int iter __attribute__((unused)), const obsd_t *obs, int n, const do
             /* satellite clock and tropospheric delay */
             r += -SPEED_OF_LIGHT_M_S * dts[i * 2] + dtrp;
 
-            trace(5, "sat=%2d azel=%6.1f %5.1f dtrp=%.3f dantr=%6.3f %6.3f dants=%6.3f %6.3f phw=%6.3f\n",
+            TRACE_RTK(5, "sat=%2d azel=%6.1f %5.1f dtrp=%.3f dantr=%6.3f %6.3f dants=%6.3f %6.3f phw=%6.3f\n",
                 sat, azel[i * 2] * R2D, azel[1 + i * 2] * R2D, dtrp, dantr[0], dantr[1], dants[0],
                 dants[1], rtk->ssat[sat - 1].phw);
 
@@ -1727,7 +1727,7 @@ int res_ppp(int iter __attribute__((unused)), const obsd_t *obs, int n, const do
                     if (opt->maxinno > 0.0 && fabs(v[nv]) > opt->maxinno && sys != SYS_GLO)
                         {
 #endif
-                            trace(2, "ppp outlier rejected %s sat=%2d type=%d v=%.3f\n",
+                            TRACE_RTK(2, "ppp outlier rejected %s sat=%2d type=%d v=%.3f\n",
                                 time_str(obs[i].time, 0), sat, j, v[nv]);
                             rtk->ssat[sat - 1].rejc[0]++;
                             continue;
@@ -1746,14 +1746,14 @@ int res_ppp(int iter __attribute__((unused)), const obsd_t *obs, int n, const do
                     R[i + j * nv] = i == j ? var[i] : 0.0;
                 }
         }
-    trace(5, "x=\n");
-    tracemat(5, x, 1, nx, 8, 3);
-    trace(5, "v=\n");
-    tracemat(5, v, 1, nv, 8, 3);
-    trace(5, "H=\n");
-    tracemat(5, H, nx, nv, 8, 3);
-    trace(5, "R=\n");
-    tracemat(5, R, nv, nv, 8, 5);
+    TRACE_RTK(5, "x=\n");
+    TRACEMAT_RTK(5, x, 1, nx, 8, 3);
+    TRACE_RTK(5, "v=\n");
+    TRACEMAT_RTK(5, v, 1, nv, 8, 3);
+    TRACE_RTK(5, "H=\n");
+    TRACEMAT_RTK(5, H, nx, nv, 8, 3);
+    TRACE_RTK(5, "R=\n");
+    TRACEMAT_RTK(5, R, nv, nv, 8, 5);
     return nv;
 }
 
@@ -1781,10 +1781,10 @@ void pppos(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
     int i;
     int nv;
     int info;
-    std::vector<int> svh(MAXOBS);
+    std::array<int, MAXOBS> svh{};
     int stat = SOLQ_SINGLE;
 
-    trace(3, "pppos   : nx=%d n=%d\n", rtk->nx, n);
+    TRACE_RTK(3, "pppos   : nx=%d n=%d\n", rtk->nx, n);
 
     rs = mat(6, n);
     dts = mat(2, n);
@@ -1799,8 +1799,8 @@ void pppos(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
     /* temporal update of states */
     udstate_ppp(rtk, obs, n, nav);
 
-    trace(4, "x(0)=");
-    tracemat(4, rtk->x, 1, NR_PPP(opt), 13, 4);
+    TRACE_RTK(4, "x(0)=");
+    TRACEMAT_RTK(4, rtk->x, 1, NR_PPP(opt), 13, 4);
 
     /* satellite positions and clocks */
     satposs(obs[0].time, obs, n, nav, rtk->opt.sateph, rs, dts, var, svh.data());
@@ -1831,11 +1831,11 @@ void pppos(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
 
             if ((info = filter(xp, Pp, H, v, R, rtk->nx, nv)))
                 {
-                    trace(2, "ppp filter error %s info=%d\n", time_str(rtk->sol.time, 0), info);
+                    TRACE_RTK(2, "ppp filter error %s info=%d\n", time_str(rtk->sol.time, 0), info);
                     break;
                 }
-            trace(4, "x(%d)=", i + 1);
-            tracemat(4, xp, 1, NR_PPP(opt), 13, 4);
+            TRACE_RTK(4, "x(%d)=", i + 1);
+            TRACEMAT_RTK(4, xp, 1, NR_PPP(opt), 13, 4);
 
             stat = SOLQ_PPP;
         }
@@ -1893,13 +1893,13 @@ void pppos(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
                         }
                 }
         }
-    free(rs);
-    free(dts);
-    free(var);
-    free(azel);
-    free(xp);
-    free(Pp);
-    free(v);
-    free(H);
-    free(R);
+    matfree(rs);
+    matfree(dts);
+    matfree(var);
+    matfree(azel);
+    matfree(xp);
+    matfree(Pp);
+    matfree(v);
+    matfree(H);
+    matfree(R);
 }
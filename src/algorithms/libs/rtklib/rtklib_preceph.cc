@@ -88,7 +88,7 @@ int readsp3h(FILE *fp, gtime_t *time, char *type, int *sats,
     int prn;
     char buff[1024];
 
-    trace(3, "readsp3h:\n");
+    TRACE_RTK(3, "readsp3h:\n");
 
     for (i = 0; i < 22; i++)
         {
@@ -126,7 +126,7 @@ int readsp3h(FILE *fp, gtime_t *time, char *type, int *sats,
                     int ret = std::snprintf(tsys, 3, "%s", buff + 9);  // NOLINT(runtime/printf)
                     if (ret < 0 || ret > 3)
                         {
-                            trace(3, "Error reading sp3 header\n");
+                            TRACE_RTK(3, "Error reading sp3 header\n");
                         }
                 }
             else if (i == 14)
@@ -149,7 +149,7 @@ int addpeph(nav_t *nav, peph_t *peph)
             nav->nemax += 256;
             if (!(nav_peph = static_cast<peph_t *>(realloc(nav->peph, sizeof(peph_t) * nav->nemax))))
                 {
-                    trace(1, "readsp3b malloc error n=%d\n", nav->nemax);
+                    TRACE_RTK(1, "readsp3b malloc error n=%d\n", nav->nemax);
                     free(nav->peph);
                     nav->peph = nullptr;
                     nav->ne = nav->nemax = 0;
@@ -182,7 +182,7 @@ void readsp3b(FILE *fp, char type, int *sats __attribute__((unused)), int ns, co
     int v;
     char buff[1024];
 
-    trace(3, "readsp3b: type=%c ns=%d index=%d opt=%d\n", type, ns, index, opt);
+    TRACE_RTK(3, "readsp3b: type=%c ns=%d index=%d opt=%d\n", type, ns, index, opt);
 
     while (fgets(buff, sizeof(buff), fp))
         {
@@ -193,7 +193,7 @@ void readsp3b(FILE *fp, char type, int *sats __attribute__((unused)), int ns, co
 
             if (buff[0] != '*' || str2time(buff, 3, 28, &time))
                 {
-                    trace(2, "sp3 invalid epoch %31.31s\n", buff);
+                    TRACE_RTK(2, "sp3 invalid epoch %31.31s\n", buff);
                     continue;
                 }
             if (!strcmp(tsys, "UTC"))
@@ -323,7 +323,7 @@ void combpeph(nav_t *nav, int opt)
     int k;
     int m;
 
-    trace(3, "combpeph: ne=%d\n", nav->ne);
+    TRACE_RTK(3, "combpeph: ne=%d\n", nav->ne);
 
     qsort(nav->peph, nav->ne, sizeof(peph_t), cmppeph);
 
@@ -367,7 +367,7 @@ void combpeph(nav_t *nav, int opt)
         }
     nav->ne = i + 1;
 
-    trace(4, "combpeph: ne=%d\n", nav->ne);
+    TRACE_RTK(4, "combpeph: ne=%d\n", nav->ne);
 }
 
 
@@ -400,7 +400,7 @@ void readsp3(const char *file, nav_t *nav, int opt)
     char type = ' ';
     char tsys[4] = "";
 
-    trace(3, "readpephs: file=%s\n", file);
+    TRACE_RTK(3, "readpephs: file=%s\n", file);
 
     for (i = 0; i < MAXEXFILE; i++)
         {
@@ -431,7 +431,7 @@ void readsp3(const char *file, nav_t *nav, int opt)
 
             if (!(fp = fopen(efiles[i], "re")))
                 {
-                    trace(2, "sp3 file open error %s\n", efiles[i]);
+                    TRACE_RTK(2, "sp3 file open error %s\n", efiles[i]);
                     continue;
                 }
             /* read sp3 header */
@@ -470,7 +470,7 @@ int readsap(const char *file, gtime_t time, nav_t *nav)
     pcv_t *pcv;
     int i;
 
-    trace(3, "readsap : file=%s time=%s\n", file, time_str(time, 0));
+    TRACE_RTK(3, "readsap : file=%s time=%s\n", file, time_str(time, 0));
 
     if (!readpcv(file, &pcvs))
         {
@@ -500,11 +500,11 @@ int readdcbf(const char *file, nav_t *nav, const sta_t *sta)
     int sat;
     int type = 0;
 
-    trace(3, "readdcbf: file=%s\n", file);
+    TRACE_RTK(3, "readdcbf: file=%s\n", file);
 
     if (!(fp = fopen(file, "re")))
         {
-            trace(2, "dcb parameters file open error: %s\n", file);
+            TRACE_RTK(2, "dcb parameters file open error: %s\n", file);
             return 0;
         }
     while (fgets(buff, sizeof(buff), fp))
@@ -574,7 +574,7 @@ int readdcb(const char *file, nav_t *nav, const sta_t *sta)
     int n;
     char *efiles[MAXEXFILE] = {};
 
-    trace(3, "readdcb : file=%s\n", file);
+    TRACE_RTK(3, "readdcb : file=%s\n", file);
 
     for (i = 0; i < MAXSAT; i++)
         {
@@ -643,7 +643,7 @@ int pephpos(gtime_t time, int sat, const nav_t *nav, double *rs,
     int k;
     int index;
 
-    trace(4, "pephpos : time=%s sat=%2d\n", time_str(time, 3), sat);
+    TRACE_RTK(4, "pephpos : time=%s sat=%2d\n", time_str(time, 3), sat);
 
     rs[0] = rs[1] = rs[2] = dts[0] = 0.0;
 
@@ -651,7 +651,7 @@ int pephpos(gtime_t time, int sat, const nav_t *nav, double *rs,
         timediff(time, nav->peph[0].time) < -MAXDTE ||
         timediff(time, nav->peph[nav->ne - 1].time) > MAXDTE)
         {
-            trace(3, "no prec ephem %s sat=%2d\n", time_str(time, 0), sat);
+            TRACE_RTK(3, "no prec ephem %s sat=%2d\n", time_str(time, 0), sat);
             return 0;
         }
     /* binary search */
@@ -685,7 +685,7 @@ int pephpos(gtime_t time, int sat, const nav_t *nav, double *rs,
             t[j] = timediff(nav->peph[i + j].time, time);
             if (norm_rtk(nav->peph[i + j].pos[sat - 1], 3) <= 0.0)
                 {
-                    trace(3, "prec ephem outage %s sat=%2d\n", time_str(time, 0), sat);
+                    TRACE_RTK(3, "prec ephem outage %s sat=%2d\n", time_str(time, 0), sat);
                     return 0;
                 }
         }
@@ -777,13 +777,13 @@ int pephclk(gtime_t time, int sat, const nav_t *nav, double *dts,
     int k;
     int index;
 
-    trace(4, "pephclk : time=%s sat=%2d\n", time_str(time, 3), sat);
+    TRACE_RTK(4, "pephclk : time=%s sat=%2d\n", time_str(time, 3), sat);
 
     if (nav->nc < 2 ||
         timediff(time, nav->pclk[0].time) < -MAXDTE ||
         timediff(time, nav->pclk[nav->nc - 1].time) > MAXDTE)
         {
-            trace(3, "no prec clock %s sat=%2d\n", time_str(time, 0), sat);
+            TRACE_RTK(3, "no prec clock %s sat=%2d\n", time_str(time, 0), sat);
             return 1;
         }
     /* binary search */
@@ -831,7 +831,7 @@ int pephclk(gtime_t time, int sat, const nav_t *nav, double *dts,
         }
     else
         {
-            trace(3, "prec clock outage %s sat=%2d\n", time_str(time, 0), sat);
+            TRACE_RTK(3, "prec clock outage %s sat=%2d\n", time_str(time, 0), sat);
             return 0;
         }
     if (varc)
@@ -875,7 +875,7 @@ void satantoff(gtime_t time, const double *rs, int sat, const nav_t *nav,
     int j = 0;
     int k = 1;
 
-    trace(4, "satantoff: time=%s sat=%2d\n", time_str(time, 3), sat);
+    TRACE_RTK(4, "satantoff: time=%s sat=%2d\n", time_str(time, 3), sat);
 
     /* sun position in ecef */
     sunmoonpos(gpst2utc(time), erpv, rsun, nullptr, &gmst);
@@ -959,7 +959,7 @@ int peph2pos(gtime_t time, int sat, const nav_t *nav, int opt,
     double tt = 1e-3;
     int i;
 
-    trace(4, "peph2pos: time=%s sat=%2d opt=%d\n", time_str(time, 3), sat, opt);
+    TRACE_RTK(4, "peph2pos: time=%s sat=%2d opt=%d\n", time_str(time, 3), sat, opt);
 
     if (sat <= 0 || MAXSAT < sat)
         {
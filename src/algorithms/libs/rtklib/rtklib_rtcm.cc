@@ -56,7 +56,7 @@ int init_rtcm(rtcm_t *rtcm)
     int i;
     int j;
 
-    trace(3, "init_rtcm:\n");
+    TRACE_RTK(3, "init_rtcm:\n");
 
     rtcm->staid = rtcm->stah = rtcm->seqno = rtcm->outtype = 0;
     rtcm->time = rtcm->time_s = time0;
@@ -103,6 +103,7 @@ int init_rtcm(rtcm_t *rtcm)
     rtcm->obs.data = nullptr;
     rtcm->nav.eph = nullptr;
     rtcm->nav.geph = nullptr;
+    rtcm->nav.orbits = nullptr;
 
     /* reallocate memory for observation and ephemris buffer */
     if (!(rtcm->obs.data = static_cast<obsd_t *>(malloc(sizeof(obsd_t) * MAXOBS))) ||
@@ -138,7 +139,7 @@ int init_rtcm(rtcm_t *rtcm)
  *-----------------------------------------------------------------------------*/
 void free_rtcm(rtcm_t *rtcm)
 {
-    trace(3, "free_rtcm:\n");
+    TRACE_RTK(3, "free_rtcm:\n");
 
     /* free memory for observation and ephemeris buffer */
     free(rtcm->obs.data);
@@ -150,6 +151,7 @@ void free_rtcm(rtcm_t *rtcm)
     free(rtcm->nav.geph);
     rtcm->nav.geph = nullptr;
     rtcm->nav.ng = 0;
+    rtcm->nav.orbits = nullptr; /* the orbit cache is not owned by rtcm */
 }
 
 
@@ -172,7 +174,7 @@ int input_rtcm2(rtcm_t *rtcm, unsigned char data)
     unsigned char preamb;
     int i;
 
-    trace(5, "input_rtcm2: data=%02x\n", data);
+    TRACE_RTK(5, "input_rtcm2: data=%02x\n", data);
 
     if ((data & 0xC0) != 0x40)
         {
@@ -215,7 +217,7 @@ int input_rtcm2(rtcm_t *rtcm, unsigned char data)
             /* check parity */
             if (!decode_word(rtcm->word, rtcm->buff + rtcm->nbyte))
                 {
-                    trace(2, "rtcm2 partity error: i=%d word=%08x\n", i, rtcm->word);
+                    TRACE_RTK(2, "rtcm2 partity error: i=%d word=%08x\n", i, rtcm->word);
                     rtcm->nbyte = 0;
                     rtcm->word &= 0x3;
                     continue;
@@ -306,7 +308,7 @@ int input_rtcm2(rtcm_t *rtcm, unsigned char data)
  *-----------------------------------------------------------------------------*/
 int input_rtcm3(rtcm_t *rtcm, unsigned char data)
 {
-    trace(5, "input_rtcm3: data=%02x\n", data);
+    TRACE_RTK(5, "input_rtcm3: data=%02x\n", data);
 
     /* synchronize frame */
     if (rtcm->nbyte == 0)
@@ -333,7 +335,7 @@ int input_rtcm3(rtcm_t *rtcm, unsigned char data)
     /* check parity */
     if (rtk_crc24q(rtcm->buff, rtcm->len) != getbitu(rtcm->buff, rtcm->len * 8, 24))
         {
-            trace(2, "rtcm3 parity error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 parity error: len=%d\n", rtcm->len);
             return 0;
         }
     /* decode rtcm3 message */
@@ -354,7 +356,7 @@ int input_rtcm2f(rtcm_t *rtcm, FILE *fp)
     int data = 0;
     int ret;
 
-    trace(4, "input_rtcm2f: data=%02x\n", data);
+    TRACE_RTK(4, "input_rtcm2f: data=%02x\n", data);
 
     for (i = 0; i < 4096; i++)
         {
@@ -384,7 +386,7 @@ int input_rtcm3f(rtcm_t *rtcm, FILE *fp)
     int data = 0;
     int ret;
 
-    trace(4, "input_rtcm3f: data=%02x\n", data);
+    TRACE_RTK(4, "input_rtcm3f: data=%02x\n", data);
 
     for (i = 0; i < 4096; i++)
         {
@@ -410,7 +412,7 @@ int input_rtcm3f(rtcm_t *rtcm, FILE *fp)
  *-----------------------------------------------------------------------------*/
 int gen_rtcm2(rtcm_t *rtcm, int type, int sync)
 {
-    trace(4, "gen_rtcm2: type=%d sync=%d\n", type, sync);
+    TRACE_RTK(4, "gen_rtcm2: type=%d sync=%d\n", type, sync);
 
     rtcm->nbit = rtcm->len = rtcm->nbyte = 0;
 
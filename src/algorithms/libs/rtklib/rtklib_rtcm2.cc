@@ -108,7 +108,7 @@ int decode_type1(rtcm_t *rtcm)
     double prc;
     double rrc;
 
-    trace(4, "decode_type1: len=%d\n", rtcm->len);
+    TRACE_RTK(4, "decode_type1: len=%d\n", rtcm->len);
 
     while (i + 40 <= rtcm->len * 8)
         {
@@ -130,7 +130,7 @@ int decode_type1(rtcm_t *rtcm)
                 }
             if (prc == 0x80000000 || rrc == 0xFFFF8000)
                 {
-                    trace(2, "rtcm2 1 prc/rrc indicates satellite problem: prn=%d\n", prn);
+                    TRACE_RTK(2, "rtcm2 1 prc/rrc indicates satellite problem: prn=%d\n", prn);
                     continue;
                 }
             if (rtcm->dgps)
@@ -152,7 +152,7 @@ int decode_type3(rtcm_t *rtcm)
 {
     int i = 48;
 
-    trace(4, "decode_type3: len=%d\n", rtcm->len);
+    TRACE_RTK(4, "decode_type3: len=%d\n", rtcm->len);
 
     if (i + 96 <= rtcm->len * 8)
         {
@@ -164,7 +164,7 @@ int decode_type3(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm2 3 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm2 3 length error: len=%d\n", rtcm->len);
             return -1;
         }
     return 5;
@@ -180,7 +180,7 @@ int decode_type14(rtcm_t *rtcm, bool pre_2009_file)
     int hour;
     int leaps;
 
-    trace(4, "decode_type14: len=%d\n", rtcm->len);
+    TRACE_RTK(4, "decode_type14: len=%d\n", rtcm->len);
 
     zcnt = getbitu(rtcm->buff, 24, 13);
     if (i + 24 <= rtcm->len * 8)
@@ -193,7 +193,7 @@ int decode_type14(rtcm_t *rtcm, bool pre_2009_file)
         }
     else
         {
-            trace(2, "rtcm2 14 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm2 14 length error: len=%d\n", rtcm->len);
             return -1;
         }
     week = adjgpsweek(week, pre_2009_file);
@@ -209,7 +209,7 @@ int decode_type16(rtcm_t *rtcm)
     int i = 48;
     int n = 0;
 
-    trace(4, "decode_type16: len=%d\n", rtcm->len);
+    TRACE_RTK(4, "decode_type16: len=%d\n", rtcm->len);
 
     while (i + 8 <= rtcm->len * 8 && n < 90)
         {
@@ -218,7 +218,7 @@ int decode_type16(rtcm_t *rtcm)
         }
     rtcm->msg[n] = '\0';
 
-    trace(3, "rtcm2 16 message: %s\n", rtcm->msg);
+    TRACE_RTK(3, "rtcm2 16 message: %s\n", rtcm->msg);
     return 9;
 }
 
@@ -236,7 +236,7 @@ int decode_type17(rtcm_t *rtcm, bool pre_2009_file)
     int prn;
     int sat;
 
-    trace(4, "decode_type17: len=%d\n", rtcm->len);
+    TRACE_RTK(4, "decode_type17: len=%d\n", rtcm->len);
 
     if (i + 480 <= rtcm->len * 8)
         {
@@ -300,7 +300,7 @@ int decode_type17(rtcm_t *rtcm, bool pre_2009_file)
         }
     else
         {
-            trace(2, "rtcm2 17 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm2 17 length error: len=%d\n", rtcm->len);
             return -1;
         }
     if (prn == 0)
@@ -337,7 +337,7 @@ int decode_type18(rtcm_t *rtcm)
     int sat;
     int loss;
 
-    trace(4, "decode_type18: len=%d\n", rtcm->len);
+    TRACE_RTK(4, "decode_type18: len=%d\n", rtcm->len);
 
     if (i + 24 <= rtcm->len * 8)
         {
@@ -348,12 +348,12 @@ int decode_type18(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm2 18 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm2 18 length error: len=%d\n", rtcm->len);
             return -1;
         }
     if (freq & 0x1)
         {
-            trace(2, "rtcm2 18 not supported frequency: freq=%d\n", freq);
+            TRACE_RTK(2, "rtcm2 18 not supported frequency: freq=%d\n", freq);
             return -1;
         }
     freq >>= 1;
@@ -378,7 +378,7 @@ int decode_type18(rtcm_t *rtcm)
                 }
             if (!(sat = satno(sys ? SYS_GLO : SYS_GPS, prn)))
                 {
-                    trace(2, "rtcm2 18 satellite number error: sys=%d prn=%d\n", sys, prn);
+                    TRACE_RTK(2, "rtcm2 18 satellite number error: sys=%d prn=%d\n", sys, prn);
                     continue;
                 }
             time = timeadd(rtcm->time, usec * 1E-6);
@@ -422,7 +422,7 @@ int decode_type19(rtcm_t *rtcm)
     int prn;
     int sat;
 
-    trace(4, "decode_type19: len=%d\n", rtcm->len);
+    TRACE_RTK(4, "decode_type19: len=%d\n", rtcm->len);
 
     if (i + 24 <= rtcm->len * 8)
         {
@@ -433,12 +433,12 @@ int decode_type19(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm2 19 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm2 19 length error: len=%d\n", rtcm->len);
             return -1;
         }
     if (freq & 0x1)
         {
-            trace(2, "rtcm2 19 not supported frequency: freq=%d\n", freq);
+            TRACE_RTK(2, "rtcm2 19 not supported frequency: freq=%d\n", freq);
             return -1;
         }
     freq >>= 1;
@@ -461,7 +461,7 @@ int decode_type19(rtcm_t *rtcm)
                 }
             if (!(sat = satno(sys ? SYS_GLO : SYS_GPS, prn)))
                 {
-                    trace(2, "rtcm2 19 satellite number error: sys=%d prn=%d\n", sys, prn);
+                    TRACE_RTK(2, "rtcm2 19 satellite number error: sys=%d prn=%d\n", sys, prn);
                     continue;
                 }
             time = timeadd(rtcm->time, usec * 1E-6);
@@ -496,7 +496,7 @@ int decode_type22(rtcm_t *rtcm)
     int j;
     int noh;
 
-    trace(4, "decode_type22: len=%d\n", rtcm->len);
+    TRACE_RTK(4, "decode_type22: len=%d\n", rtcm->len);
 
     if (i + 24 <= rtcm->len * 8)
         {
@@ -509,7 +509,7 @@ int decode_type22(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm2 22 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm2 22 length error: len=%d\n", rtcm->len);
             return -1;
         }
     if (i + 24 <= rtcm->len * 8)
@@ -604,11 +604,11 @@ int decode_rtcm2(rtcm_t *rtcm)
     int ret = 0;
     int type = getbitu(rtcm->buff, 8, 6);
 
-    trace(3, "decode_rtcm2: type=%2d len=%3d\n", type, rtcm->len);
+    TRACE_RTK(3, "decode_rtcm2: type=%2d len=%3d\n", type, rtcm->len);
 
     if ((zcnt = getbitu(rtcm->buff, 24, 13) * 0.6) >= 3600.0)
         {
-            trace(2, "rtcm2 modified z-count error: zcnt=%.1f\n", zcnt);
+            TRACE_RTK(2, "rtcm2 modified z-count error: zcnt=%.1f\n", zcnt);
             return -1;
         }
     adjhour(rtcm, zcnt);
@@ -617,7 +617,7 @@ int decode_rtcm2(rtcm_t *rtcm)
     stah = getbitu(rtcm->buff, 45, 3);
     if (seqno - rtcm->seqno != 1 && seqno - rtcm->seqno != -7)
         {
-            trace(2, "rtcm2 message outage: seqno=%d->%d\n", rtcm->seqno, seqno);
+            TRACE_RTK(2, "rtcm2 message outage: seqno=%d->%d\n", rtcm->seqno, seqno);
         }
     rtcm->seqno = seqno;
     rtcm->stah = stah;
@@ -631,13 +631,13 @@ int decode_rtcm2(rtcm_t *rtcm)
         {
             if (rtcm->staid != 0 && staid != rtcm->staid)
                 {
-                    trace(2, "rtcm2 station id changed: %d->%d\n", rtcm->staid, staid);
+                    TRACE_RTK(2, "rtcm2 station id changed: %d->%d\n", rtcm->staid, staid);
                 }
             rtcm->staid = staid;
         }
     if (rtcm->staid != 0 && staid != rtcm->staid)
         {
-            trace(2, "rtcm2 station id invalid: %d %d\n", staid, rtcm->staid);
+            TRACE_RTK(2, "rtcm2 station id invalid: %d %d\n", staid, rtcm->staid);
             return -1;
         }
     switch (type)
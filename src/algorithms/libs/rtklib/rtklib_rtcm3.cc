@@ -244,7 +244,7 @@ int test_staid(rtcm_t *rtcm, int staid)
     else if (staid != rtcm->staid)
         {
             type = getbitu(rtcm->buff, 24, 12);
-            trace(2, "rtcm3 %d staid invalid id=%d %d\n", type, staid, rtcm->staid);
+            TRACE_RTK(2, "rtcm3 %d staid invalid id=%d %d\n", type, staid, rtcm->staid);
 
             /* reset station id if station id error */
             rtcm->staid = 0;
@@ -279,7 +279,7 @@ int decode_head1001(rtcm_t *rtcm, int *sync)
         }
     else
         {
-            trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
+            TRACE_RTK(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
             return -1;
         }
     /* test station id */
@@ -290,7 +290,7 @@ int decode_head1001(rtcm_t *rtcm, int *sync)
 
     adjweek(rtcm, tow);
 
-    trace(4, "decode_head1001: time=%s nsat=%d sync=%d\n", time_str(rtcm->time, 2),
+    TRACE_RTK(4, "decode_head1001: time=%s nsat=%d sync=%d\n", time_str(rtcm->time, 2),
         nsat, *sync);
 
     if (rtcm->outtype)
@@ -368,7 +368,7 @@ int decode_type1002(rtcm_t *rtcm)
                 }
             if (!(sat = satno(sys, prn)))
                 {
-                    trace(2, "rtcm3 1002 satellite number error: prn=%d\n", prn);
+                    TRACE_RTK(2, "rtcm3 1002 satellite number error: prn=%d\n", prn);
                     continue;
                 }
             tt = timediff(rtcm->obs.data[0].time, rtcm->time);
@@ -477,7 +477,7 @@ int decode_type1004(rtcm_t *rtcm)
                 }
             if (!(sat = satno(sys, prn)))
                 {
-                    trace(2, "rtcm3 1004 satellite number error: sys=%d prn=%d\n", sys, prn);
+                    TRACE_RTK(2, "rtcm3 1004 satellite number error: sys=%d prn=%d\n", sys, prn);
                     continue;
                 }
             tt = timediff(rtcm->obs.data[0].time, rtcm->time);
@@ -551,7 +551,7 @@ int decode_type1005(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm3 1005 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 1005 length error: len=%d\n", rtcm->len);
             return -1;
         }
     if (rtcm->outtype)
@@ -612,7 +612,7 @@ int decode_type1006(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm3 1006 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 1006 length error: len=%d\n", rtcm->len);
             return -1;
         }
     if (rtcm->outtype)
@@ -670,7 +670,7 @@ int decode_type1007(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm3 1007 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 1007 length error: len=%d\n", rtcm->len);
             return -1;
         }
     if (rtcm->outtype)
@@ -727,7 +727,7 @@ int decode_type1008(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm3 1008 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 1008 length error: len=%d\n", rtcm->len);
             return -1;
         }
     if (rtcm->outtype)
@@ -775,7 +775,7 @@ int decode_head1009(rtcm_t *rtcm, int *sync)
         }
     else
         {
-            trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
+            TRACE_RTK(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
             return -1;
         }
     /* test station id */
@@ -786,7 +786,7 @@ int decode_head1009(rtcm_t *rtcm, int *sync)
 
     adjday_glot(rtcm, tod);
 
-    trace(4, "decode_head1009: time=%s nsat=%d sync=%d\n", time_str(rtcm->time, 2),
+    TRACE_RTK(4, "decode_head1009: time=%s nsat=%d sync=%d\n", time_str(rtcm->time, 2),
         nsat, *sync);
 
     if (rtcm->outtype)
@@ -859,7 +859,7 @@ int decode_type1010(rtcm_t *rtcm)
             i += 8;
             if (!(sat = satno(sys, prn)))
                 {
-                    trace(2, "rtcm3 1010 satellite number error: prn=%d\n", prn);
+                    TRACE_RTK(2, "rtcm3 1010 satellite number error: prn=%d\n", prn);
                     continue;
                 }
             tt = timediff(rtcm->obs.data[0].time, rtcm->time);
@@ -964,7 +964,7 @@ int decode_type1012(rtcm_t *rtcm)
             i += 8;
             if (!(sat = satno(sys, prn)))
                 {
-                    trace(2, "rtcm3 1012 satellite number error: sys=%d prn=%d\n", sys, prn);
+                    TRACE_RTK(2, "rtcm3 1012 satellite number error: sys=%d prn=%d\n", sys, prn);
                     continue;
                 }
             tt = timediff(rtcm->obs.data[0].time, rtcm->time);
@@ -1093,7 +1093,7 @@ int decode_type1019(rtcm_t *rtcm, bool pre_2009_file)
         }
     else
         {
-            trace(2, "rtcm3 1019 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 1019 length error: len=%d\n", rtcm->len);
             return -1;
         }
     if (prn >= 40)
@@ -1101,7 +1101,7 @@ int decode_type1019(rtcm_t *rtcm, bool pre_2009_file)
             sys = SYS_SBS;
             prn += 80;
         }
-    trace(4, "decode_type1019: prn=%d iode=%d toe=%.0f\n", prn, eph.iode, eph.toes);
+    TRACE_RTK(4, "decode_type1019: prn=%d iode=%d toe=%.0f\n", prn, eph.iode, eph.toes);
 
     if (rtcm->outtype)
         {
@@ -1111,7 +1111,7 @@ int decode_type1019(rtcm_t *rtcm, bool pre_2009_file)
         }
     if (!(sat = satno(sys, prn)))
         {
-            trace(2, "rtcm3 1019 satellite number error: prn=%d\n", prn);
+            TRACE_RTK(2, "rtcm3 1019 satellite number error: prn=%d\n", prn);
             return -1;
         }
     eph.sat = sat;
@@ -1194,15 +1194,15 @@ int decode_type1020(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm3 1020 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 1020 length error: len=%d\n", rtcm->len);
             return -1;
         }
     if (!(sat = satno(sys, prn)))
         {
-            trace(2, "rtcm3 1020 satellite number error: prn=%d\n", prn);
+            TRACE_RTK(2, "rtcm3 1020 satellite number error: prn=%d\n", prn);
             return -1;
         }
-    trace(4, "decode_type1020: prn=%d tk=%02.0f:%02.0f:%02.0f\n", prn, tk_h, tk_m, tk_s);
+    TRACE_RTK(4, "decode_type1020: prn=%d tk=%02.0f:%02.0f:%02.0f\n", prn, tk_h, tk_m, tk_s);
 
     if (rtcm->outtype)
         {
@@ -1258,7 +1258,7 @@ int decode_type1020(rtcm_t *rtcm)
 /* decode type 1021: helmert/abridged molodenski -----------------------------*/
 int decode_type1021(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1021: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1021: not supported message\n");
     return 0;
 }
 
@@ -1266,7 +1266,7 @@ int decode_type1021(rtcm_t *rtcm __attribute__((unused)))
 /* decode type 1022: moledenski-badekas transformation -----------------------*/
 int decode_type1022(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1022: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1022: not supported message\n");
     return 0;
 }
 
@@ -1274,7 +1274,7 @@ int decode_type1022(rtcm_t *rtcm __attribute__((unused)))
 /* decode type 1023: residual, ellipoidal grid representation ----------------*/
 int decode_type1023(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1023: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1023: not supported message\n");
     return 0;
 }
 
@@ -1282,7 +1282,7 @@ int decode_type1023(rtcm_t *rtcm __attribute__((unused)))
 /* decode type 1024: residual, plane grid representation ---------------------*/
 int decode_type1024(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1024: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1024: not supported message\n");
     return 0;
 }
 
@@ -1290,7 +1290,7 @@ int decode_type1024(rtcm_t *rtcm __attribute__((unused)))
 /* decode type 1025: projection (types except LCC2SP, OM) ---------------------*/
 int decode_type1025(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1025: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1025: not supported message\n");
     return 0;
 }
 
@@ -1298,7 +1298,7 @@ int decode_type1025(rtcm_t *rtcm __attribute__((unused)))
 /* decode type 1026: projection (LCC2SP - lambert conic conformal (2sp)) -----*/
 int decode_type1026(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1026: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1026: not supported message\n");
     return 0;
 }
 
@@ -1306,7 +1306,7 @@ int decode_type1026(rtcm_t *rtcm __attribute__((unused)))
 /* decode type 1027: projection (type OM - oblique mercator) -----------------*/
 int decode_type1027(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1027: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1027: not supported message\n");
     return 0;
 }
 
@@ -1332,12 +1332,12 @@ int decode_type1029(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm3 1029 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 1029 length error: len=%d\n", rtcm->len);
             return -1;
         }
     if (i + nchar * 8 > rtcm->len * 8)
         {
-            trace(2, "rtcm3 1029 length error: len=%d nchar=%d\n", rtcm->len, nchar);
+            TRACE_RTK(2, "rtcm3 1029 length error: len=%d nchar=%d\n", rtcm->len, nchar);
             return -1;
         }
     for (j = 0; j < nchar && j < 126; j++)
@@ -1359,7 +1359,7 @@ int decode_type1029(rtcm_t *rtcm)
 /* decode type 1030: network rtk residual ------------------------------------*/
 int decode_type1030(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1030: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1030: not supported message\n");
     return 0;
 }
 
@@ -1367,7 +1367,7 @@ int decode_type1030(rtcm_t *rtcm __attribute__((unused)))
 /* decode type 1031: glonass network rtk residual ----------------------------*/
 int decode_type1031(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1031: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1031: not supported message\n");
     return 0;
 }
 
@@ -1375,7 +1375,7 @@ int decode_type1031(rtcm_t *rtcm __attribute__((unused)))
 /* decode type 1032: physical reference station position information ---------*/
 int decode_type1032(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1032: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1032: not supported message\n");
     return 0;
 }
 
@@ -1442,7 +1442,7 @@ int decode_type1033(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm3 1033 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 1033 length error: len=%d\n", rtcm->len);
             return -1;
         }
     if (rtcm->outtype)
@@ -1468,7 +1468,7 @@ int decode_type1033(rtcm_t *rtcm)
     strncpy(rtcm->sta.recsno, rsn, n3);
     rtcm->sta.recsno[n3] = '\0';
 
-    trace(3, "rtcm3 1033: ant=%s:%s rec=%s:%s:%s\n", des, sno, rec, ver, rsn);
+    TRACE_RTK(3, "rtcm3 1033: ant=%s:%s rec=%s:%s:%s\n", des, sno, rec, ver, rsn);
     return 5;
 }
 
@@ -1476,7 +1476,7 @@ int decode_type1033(rtcm_t *rtcm)
 /* decode type 1034: gps network fkp gradient --------------------------------*/
 int decode_type1034(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1034: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1034: not supported message\n");
     return 0;
 }
 
@@ -1484,7 +1484,7 @@ int decode_type1034(rtcm_t *rtcm __attribute__((unused)))
 /* decode type 1035: glonass network fkp gradient ----------------------------*/
 int decode_type1035(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1035: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1035: not supported message\n");
     return 0;
 }
 
@@ -1492,7 +1492,7 @@ int decode_type1035(rtcm_t *rtcm __attribute__((unused)))
 /* decode type 1037: glonass network rtk ionospheric correction difference ---*/
 int decode_type1037(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1037: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1037: not supported message\n");
     return 0;
 }
 
@@ -1500,7 +1500,7 @@ int decode_type1037(rtcm_t *rtcm __attribute__((unused)))
 /* decode type 1038: glonass network rtk geometic correction difference ------*/
 int decode_type1038(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1038: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1038: not supported message\n");
     return 0;
 }
 
@@ -1508,7 +1508,7 @@ int decode_type1038(rtcm_t *rtcm __attribute__((unused)))
 /* decode type 1039: glonass network rtk combined correction difference ------*/
 int decode_type1039(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1039: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1039: not supported message\n");
     return 0;
 }
 
@@ -1590,10 +1590,10 @@ int decode_type1044(rtcm_t *rtcm, bool pre_2009_file)
         }
     else
         {
-            trace(2, "rtcm3 1044 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 1044 length error: len=%d\n", rtcm->len);
             return -1;
         }
-    trace(4, "decode_type1044: prn=%d iode=%d toe=%.0f\n", prn, eph.iode, eph.toes);
+    TRACE_RTK(4, "decode_type1044: prn=%d iode=%d toe=%.0f\n", prn, eph.iode, eph.toes);
 
     if (rtcm->outtype)
         {
@@ -1603,7 +1603,7 @@ int decode_type1044(rtcm_t *rtcm, bool pre_2009_file)
         }
     if (!(sat = satno(sys, prn)))
         {
-            trace(2, "rtcm3 1044 satellite number error: prn=%d\n", prn);
+            TRACE_RTK(2, "rtcm3 1044 satellite number error: prn=%d\n", prn);
             return -1;
         }
     eph.sat = sat;
@@ -1703,10 +1703,10 @@ int decode_type1045(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm3 1045 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 1045 length error: len=%d\n", rtcm->len);
             return -1;
         }
-    trace(4, "decode_type1045: prn=%d iode=%d toe=%.0f\n", prn, eph.iode, eph.toes);
+    TRACE_RTK(4, "decode_type1045: prn=%d iode=%d toe=%.0f\n", prn, eph.iode, eph.toes);
 
     if (rtcm->outtype)
         {
@@ -1716,7 +1716,7 @@ int decode_type1045(rtcm_t *rtcm)
         }
     if (!(sat = satno(sys, prn)))
         {
-            trace(2, "rtcm3 1045 satellite number error: prn=%d\n", prn);
+            TRACE_RTK(2, "rtcm3 1045 satellite number error: prn=%d\n", prn);
             return -1;
         }
     eph.sat = sat;
@@ -1817,10 +1817,10 @@ int decode_type1046(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm3 1046 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 1046 length error: len=%d\n", rtcm->len);
             return -1;
         }
-    trace(4, "decode_type1046: prn=%d iode=%d toe=%.0f\n", prn, eph.iode, eph.toes);
+    TRACE_RTK(4, "decode_type1046: prn=%d iode=%d toe=%.0f\n", prn, eph.iode, eph.toes);
 
     if (rtcm->outtype)
         {
@@ -1830,7 +1830,7 @@ int decode_type1046(rtcm_t *rtcm)
         }
     if (!(sat = satno(sys, prn)))
         {
-            trace(2, "rtcm3 1046 satellite number error: prn=%d\n", prn);
+            TRACE_RTK(2, "rtcm3 1046 satellite number error: prn=%d\n", prn);
             return -1;
         }
     eph.sat = sat;
@@ -1933,10 +1933,10 @@ int decode_type1047(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm3 1047 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 1047 length error: len=%d\n", rtcm->len);
             return -1;
         }
-    trace(4, "decode_type1047: prn=%d iode=%d toe=%.0f\n", prn, eph.iode, eph.toes);
+    TRACE_RTK(4, "decode_type1047: prn=%d iode=%d toe=%.0f\n", prn, eph.iode, eph.toes);
 
     if (rtcm->outtype)
         {
@@ -1946,7 +1946,7 @@ int decode_type1047(rtcm_t *rtcm)
         }
     if (!(sat = satno(sys, prn)))
         {
-            trace(2, "rtcm3 1047 satellite number error: prn=%d\n", prn);
+            TRACE_RTK(2, "rtcm3 1047 satellite number error: prn=%d\n", prn);
             return -1;
         }
     eph.sat = sat;
@@ -2047,10 +2047,10 @@ int decode_type63(rtcm_t *rtcm)
         }
     else
         {
-            trace(2, "rtcm3 63 length error: len=%d\n", rtcm->len);
+            TRACE_RTK(2, "rtcm3 63 length error: len=%d\n", rtcm->len);
             return -1;
         }
-    trace(4, "decode_type63: prn=%d iode=%d toe=%.0f\n", prn, eph.iode, eph.toes);
+    TRACE_RTK(4, "decode_type63: prn=%d iode=%d toe=%.0f\n", prn, eph.iode, eph.toes);
 
     if (rtcm->outtype)
         {
@@ -2060,7 +2060,7 @@ int decode_type63(rtcm_t *rtcm)
         }
     if (!(sat = satno(sys, prn)))
         {
-            trace(2, "rtcm3 63 satellite number error: prn=%d\n", prn);
+            TRACE_RTK(2, "rtcm3 63 satellite number error: prn=%d\n", prn);
             return -1;
         }
     eph.sat = sat;
@@ -2134,7 +2134,7 @@ int decode_ssr1_head(rtcm_t *rtcm, int sys, int *sync, int *iod,
     i += ns;
     *udint = SSRUDINT[udi];
 
-    trace(4, "decode_ssr1_head: time=%s sys=%d nsat=%d sync=%d iod=%d provid=%d solid=%d\n",
+    TRACE_RTK(4, "decode_ssr1_head: time=%s sys=%d nsat=%d sync=%d iod=%d provid=%d solid=%d\n",
         time_str(rtcm->time, 2), sys, nsat, *sync, *iod, provid, solid);
 
     if (rtcm->outtype)
@@ -2196,7 +2196,7 @@ int decode_ssr2_head(rtcm_t *rtcm, int sys, int *sync, int *iod,
     i += ns;
     *udint = SSRUDINT[udi];
 
-    trace(4, "decode_ssr2_head: time=%s sys=%d nsat=%d sync=%d iod=%d provid=%d solid=%d\n",
+    TRACE_RTK(4, "decode_ssr2_head: time=%s sys=%d nsat=%d sync=%d iod=%d provid=%d solid=%d\n",
         time_str(rtcm->time, 2), sys, nsat, *sync, *iod, provid, solid);
 
     if (rtcm->outtype)
@@ -2262,7 +2262,7 @@ int decode_ssr7_head(rtcm_t *rtcm, int sys, int *sync, int *iod,
     i += ns;
     *udint = SSRUDINT[udi];
 
-    trace(4, "decode_ssr7_head: time=%s sys=%d nsat=%d sync=%d iod=%d provid=%d solid=%d\n",
+    TRACE_RTK(4, "decode_ssr7_head: time=%s sys=%d nsat=%d sync=%d iod=%d provid=%d solid=%d\n",
         time_str(rtcm->time, 2), sys, nsat, *sync, *iod, provid, solid);
 
     if (rtcm->outtype)
@@ -2303,7 +2303,7 @@ int decode_ssr1(rtcm_t *rtcm, int sys)
 
     if ((nsat = decode_ssr1_head(rtcm, sys, &sync, &iod, &udint, &refd, &i)) < 0)
         {
-            trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
+            TRACE_RTK(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
             return -1;
         }
     switch (sys)
@@ -2370,7 +2370,7 @@ int decode_ssr1(rtcm_t *rtcm, int sys)
 
             if (!(sat = satno(sys, prn)))
                 {
-                    trace(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
+                    TRACE_RTK(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
                     continue;
                 }
             rtcm->ssr[sat - 1].t0[0] = rtcm->time;
@@ -2412,7 +2412,7 @@ int decode_ssr2(rtcm_t *rtcm, int sys)
 
     if ((nsat = decode_ssr2_head(rtcm, sys, &sync, &iod, &udint, &i)) < 0)
         {
-            trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
+            TRACE_RTK(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
             return -1;
         }
     switch (sys)
@@ -2457,7 +2457,7 @@ int decode_ssr2(rtcm_t *rtcm, int sys)
 
             if (!(sat = satno(sys, prn)))
                 {
-                    trace(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
+                    TRACE_RTK(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
                     continue;
                 }
             rtcm->ssr[sat - 1].t0[1] = rtcm->time;
@@ -2500,7 +2500,7 @@ int decode_ssr3(rtcm_t *rtcm, int sys)
 
     if ((nsat = decode_ssr2_head(rtcm, sys, &sync, &iod, &udint, &i)) < 0)
         {
-            trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
+            TRACE_RTK(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
             return -1;
         }
     switch (sys)
@@ -2567,12 +2567,12 @@ int decode_ssr3(rtcm_t *rtcm, int sys)
                         }
                     else
                         {
-                            trace(2, "rtcm3 %d not supported mode: mode=%d\n", type, mode);
+                            TRACE_RTK(2, "rtcm3 %d not supported mode: mode=%d\n", type, mode);
                         }
                 }
             if (!(sat = satno(sys, prn)))
                 {
-                    trace(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
+                    TRACE_RTK(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
                     continue;
                 }
             rtcm->ssr[sat - 1].t0[4] = rtcm->time;
@@ -2617,7 +2617,7 @@ int decode_ssr4(rtcm_t *rtcm, int sys)
 
     if ((nsat = decode_ssr1_head(rtcm, sys, &sync, &iod, &udint, &refd, &i)) < 0)
         {
-            trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
+            TRACE_RTK(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
             return -1;
         }
     switch (sys)
@@ -2691,7 +2691,7 @@ int decode_ssr4(rtcm_t *rtcm, int sys)
 
             if (!(sat = satno(sys, prn)))
                 {
-                    trace(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
+                    TRACE_RTK(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
                     continue;
                 }
             rtcm->ssr[sat - 1].t0[0] = rtcm->ssr[sat - 1].t0[1] = rtcm->time;
@@ -2733,7 +2733,7 @@ int decode_ssr5(rtcm_t *rtcm, int sys)
 
     if ((nsat = decode_ssr2_head(rtcm, sys, &sync, &iod, &udint, &i)) < 0)
         {
-            trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
+            TRACE_RTK(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
             return -1;
         }
     switch (sys)
@@ -2774,7 +2774,7 @@ int decode_ssr5(rtcm_t *rtcm, int sys)
 
             if (!(sat = satno(sys, prn)))
                 {
-                    trace(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
+                    TRACE_RTK(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
                     continue;
                 }
             rtcm->ssr[sat - 1].t0[3] = rtcm->time;
@@ -2807,7 +2807,7 @@ int decode_ssr6(rtcm_t *rtcm, int sys)
 
     if ((nsat = decode_ssr2_head(rtcm, sys, &sync, &iod, &udint, &i)) < 0)
         {
-            trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
+            TRACE_RTK(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
             return -1;
         }
     switch (sys)
@@ -2848,7 +2848,7 @@ int decode_ssr6(rtcm_t *rtcm, int sys)
 
             if (!(sat = satno(sys, prn)))
                 {
-                    trace(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
+                    TRACE_RTK(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
                     continue;
                 }
             rtcm->ssr[sat - 1].t0[2] = rtcm->time;
@@ -2893,7 +2893,7 @@ int decode_ssr7(rtcm_t *rtcm, int sys)
 
     if ((nsat = decode_ssr7_head(rtcm, sys, &sync, &iod, &udint, &dispe, &mw, &i)) < 0)
         {
-            trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
+            TRACE_RTK(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
             return -1;
         }
     switch (sys)
@@ -2964,12 +2964,12 @@ int decode_ssr7(rtcm_t *rtcm, int sys)
                         }
                     else
                         {
-                            trace(2, "rtcm3 %d not supported mode: mode=%d\n", type, mode);
+                            TRACE_RTK(2, "rtcm3 %d not supported mode: mode=%d\n", type, mode);
                         }
                 }
             if (!(sat = satno(sys, prn)))
                 {
-                    trace(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
+                    TRACE_RTK(2, "rtcm3 %d satellite number error: prn=%d\n", type, prn);
                     continue;
                 }
             rtcm->ssr[sat - 1].t0[5] = rtcm->time;
@@ -3043,11 +3043,11 @@ void sigindex(int sys, const unsigned char *code, const int *freq, int n,
                 }
             else
                 { /* no space in obs data */
-                    trace(2, "rtcm msm: no space in obs data sys=%d code=%d\n", sys, code[i]);
+                    TRACE_RTK(2, "rtcm msm: no space in obs data sys=%d code=%d\n", sys, code[i]);
                     ind[i] = -1;
                 }
 #if 0
-            trace(2, "sig pos: sys=%d code=%d ex=%d ind=%d\n", sys, code[i], ex[i], ind[i]);
+            TRACE_RTK(2, "sig pos: sys=%d code=%d ex=%d ind=%d\n", sys, code[i], ex[i], ind[i]);
 #endif
         }
 }
@@ -3155,10 +3155,10 @@ void save_msm_obs(rtcm_t *rtcm, int sys, msm_h_t *h, const double *r,
                             q += std::snprintf(q, sizeof(rtcm->msmtype[0]), "(%d)%s", h->sigs[i], i < h->nsig - 1 ? ", " : "");
                         }
 
-                    trace(2, "rtcm3 %d: unknown signal id=%2d\n", type, h->sigs[i]);
+                    TRACE_RTK(2, "rtcm3 %d: unknown signal id=%2d\n", type, h->sigs[i]);
                 }
         }
-    trace(3, "rtcm3 %d: signals=%s\n", type, msm_type);
+    TRACE_RTK(3, "rtcm3 %d: signals=%s\n", type, msm_type);
 
     /* get signal index */
     sigindex(sys, code, freq, h->nsig, rtcm->opt, ind);
@@ -3186,7 +3186,7 @@ void save_msm_obs(rtcm_t *rtcm, int sys, msm_h_t *h, const double *r,
                 }
             else
                 {
-                    trace(2, "rtcm3 %d satellite error: prn=%d\n", type, prn);
+                    TRACE_RTK(2, "rtcm3 %d satellite error: prn=%d\n", type, prn);
                 }
             for (k = 0; k < h->nsig; k++)
                 {
@@ -3312,7 +3312,7 @@ int decode_msm_head(rtcm_t *rtcm, int sys, int *sync, int *iod,
         }
     else
         {
-            trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
+            TRACE_RTK(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
             return -1;
         }
     /* test station id */
@@ -3323,13 +3323,13 @@ int decode_msm_head(rtcm_t *rtcm, int sys, int *sync, int *iod,
 
     if (h->nsat * h->nsig > 64)
         {
-            trace(2, "rtcm3 %d number of sats and sigs error: nsat=%d nsig=%d\n",
+            TRACE_RTK(2, "rtcm3 %d number of sats and sigs error: nsat=%d nsig=%d\n",
                 type, h->nsat, h->nsig);
             return -1;
         }
     if (i + h->nsat * h->nsig > rtcm->len * 8)
         {
-            trace(2, "rtcm3 %d length error: len=%d nsat=%d nsig=%d\n", type,
+            TRACE_RTK(2, "rtcm3 %d length error: len=%d nsat=%d nsig=%d\n", type,
                 rtcm->len, h->nsat, h->nsig);
             return -1;
         }
@@ -3344,7 +3344,7 @@ int decode_msm_head(rtcm_t *rtcm, int sys, int *sync, int *iod,
         }
     *hsize = i;
 
-    trace(4, "decode_head_msm: time=%s sys=%d staid=%d nsat=%d nsig=%d sync=%d iod=%d ncell=%d\n",
+    TRACE_RTK(4, "decode_head_msm: time=%s sys=%d staid=%d nsat=%d nsig=%d sync=%d iod=%d ncell=%d\n",
         time_str(rtcm->time, 2), sys, staid, h->nsat, h->nsig, *sync, *iod, ncell);
 
     if (rtcm->outtype)
@@ -3404,7 +3404,7 @@ int decode_msm4(rtcm_t *rtcm, int sys)
 
     if (i + h.nsat * 18 + ncell * 48 > rtcm->len * 8)
         {
-            trace(2, "rtcm3 %d length error: nsat=%d ncell=%d len=%d\n", type, h.nsat,
+            TRACE_RTK(2, "rtcm3 %d length error: nsat=%d ncell=%d len=%d\n", type, h.nsat,
                 ncell, rtcm->len);
             return -1;
         }
@@ -3514,7 +3514,7 @@ int decode_msm5(rtcm_t *rtcm, int sys)
 
     if (i + h.nsat * 36 + ncell * 63 > rtcm->len * 8)
         {
-            trace(2, "rtcm3 %d length error: nsat=%d ncell=%d len=%d\n", type, h.nsat,
+            TRACE_RTK(2, "rtcm3 %d length error: nsat=%d ncell=%d len=%d\n", type, h.nsat,
                 ncell, rtcm->len);
             return -1;
         }
@@ -3643,7 +3643,7 @@ int decode_msm6(rtcm_t *rtcm, int sys)
 
     if (i + h.nsat * 18 + ncell * 65 > rtcm->len * 8)
         {
-            trace(2, "rtcm3 %d length error: nsat=%d ncell=%d len=%d\n", type, h.nsat,
+            TRACE_RTK(2, "rtcm3 %d length error: nsat=%d ncell=%d len=%d\n", type, h.nsat,
                 ncell, rtcm->len);
             return -1;
         }
@@ -3753,7 +3753,7 @@ int decode_msm7(rtcm_t *rtcm, int sys)
 
     if (i + h.nsat * 36 + ncell * 80 > rtcm->len * 8)
         {
-            trace(2, "rtcm3 %d length error: nsat=%d ncell=%d len=%d\n", type, h.nsat,
+            TRACE_RTK(2, "rtcm3 %d length error: nsat=%d ncell=%d len=%d\n", type, h.nsat,
                 ncell, rtcm->len);
             return -1;
         }
@@ -3854,7 +3854,7 @@ int decode_msm7(rtcm_t *rtcm, int sys)
 /* decode type 1230: glonass L1 and L2 code-phase biases ---------------------*/
 int decode_type1230(rtcm_t *rtcm __attribute__((unused)))
 {
-    trace(2, "rtcm3 1230: not supported message\n");
+    TRACE_RTK(2, "rtcm3 1230: not supported message\n");
     return 0;
 }
 
@@ -3867,7 +3867,7 @@ int decode_rtcm3(rtcm_t *rtcm)
     int type = getbitu(rtcm->buff, 24, 12);
     int week;
 
-    trace(3, "decode_rtcm3: len=%3d type=%d\n", rtcm->len, type);
+    TRACE_RTK(3, "decode_rtcm3: len=%3d type=%d\n", rtcm->len, type);
 
     if (rtcm->outtype)
         {
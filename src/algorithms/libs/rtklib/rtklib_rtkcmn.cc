@@ -30,6 +30,8 @@
  *----------------------------------------------------------------------------*/
 
 #include "rtklib_rtkcmn.h"
+#include "rtklib_arena.h"
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstring>
@@ -46,6 +48,7 @@
 #include <glog/logging.h>
 #else
 #include <absl/log/log.h>
+#include <absl/log/vlog_is_on.h>
 #endif
 
 const double GPST0[] = {1980, 1, 6, 0, 0, 0}; /* gps time reference */
@@ -524,7 +527,7 @@ int satexclude(int sat, int svh, const prcopt_t *opt)
 
     if (svh < 0)
         {
-            trace(3, "ephemeris unavailable: sat=%3d svh=%02X\n", sat, svh);
+            TRACE_RTK(3, "ephemeris unavailable: sat=%3d svh=%02X\n", sat, svh);
             return 1; /* ephemeris unavailable */
         }
 
@@ -532,7 +535,7 @@ int satexclude(int sat, int svh, const prcopt_t *opt)
         {
             if (opt->exsats[sat - 1] == 1)
                 {
-                    trace(3, "excluded satellite: sat=%3d svh=%02X\n", sat, svh);
+                    TRACE_RTK(3, "excluded satellite: sat=%3d svh=%02X\n", sat, svh);
                     return 1; /* excluded satellite */
                 }
             if (opt->exsats[sat - 1] == 2)
@@ -541,7 +544,7 @@ int satexclude(int sat, int svh, const prcopt_t *opt)
                 }
             if (!(sys & opt->navsys))
                 {
-                    trace(3, "unselected sat sys: sat=%3d svh=%02X\n", sat, svh);
+                    TRACE_RTK(3, "unselected sat sys: sat=%3d svh=%02X\n", sat, svh);
                     return 1; /* unselected sat sys */
                 }
         }
@@ -551,7 +554,7 @@ int satexclude(int sat, int svh, const prcopt_t *opt)
         }
     if (svh)
         {
-            trace(3, "unhealthy satellite: sat=%3d svh=%02X\n", sat, svh);
+            TRACE_RTK(3, "unhealthy satellite: sat=%3d svh=%02X\n", sat, svh);
             return 1;
         }
     return 0;
@@ -667,7 +670,7 @@ char *code2obs(unsigned char code, int *freq)
  *-----------------------------------------------------------------------------*/
 void setcodepri(int sys, int freq, const char *pri)
 {
-    trace(3, "setcodepri : sys=%d freq=%d pri=%s\n", sys, freq, pri);
+    TRACE_RTK(3, "setcodepri : sys=%d freq=%d pri=%s\n", sys, freq, pri);
 
     if (freq <= 0 || MAXFREQ < freq)
         {
@@ -713,7 +716,7 @@ void setcodepri(int sys, int freq, const char *pri)
         }
     else
         {
-            trace(1, "pri array is too long");
+            TRACE_RTK(1, "pri array is too long");
         }
 }
 
@@ -870,7 +873,7 @@ unsigned int rtk_crc32(const unsigned char *buff, int len)
     int i;
     int j;
 
-    trace(4, "rtk_crc32: len=%d\n", len);
+    TRACE_RTK(4, "rtk_crc32: len=%d\n", len);
 
     for (i = 0; i < len; i++)
         {
@@ -903,7 +906,7 @@ unsigned int rtk_crc24q(const unsigned char *buff, int len)
     unsigned int crc = 0;
     int i;
 
-    trace(4, "rtk_crc24q: len=%d\n", len);
+    TRACE_RTK(4, "rtk_crc24q: len=%d\n", len);
 
     for (i = 0; i < len; i++)
         {
@@ -925,7 +928,7 @@ uint16_t rtk_crc16(const unsigned char *buff, int len)
     uint16_t crc = 0;
     int i;
 
-    trace(4, "rtk_crc16: len=%d\n", len);
+    TRACE_RTK(4, "rtk_crc16: len=%d\n", len);
 
     for (i = 0; i < len; i++)
         {
@@ -952,7 +955,7 @@ int decode_word(unsigned int word, unsigned char *data)
     unsigned int w;
     int i;
 
-    trace(5, "decodeword: word=%08x\n", word);
+    TRACE_RTK(5, "decodeword: word=%08x\n", word);
 
     if (word & 0x40000000)
         {
@@ -993,6 +996,10 @@ double *mat(int n, int m)
         {
             return nullptr;
         }
+    if (Rtklib_Arena *arena = rtklib_active_arena())
+        {
+            return static_cast<double *>(arena->allocate(sizeof(double) * n * m));
+        }
     if (!(p = static_cast<double *>(malloc(sizeof(double) * n * m))))
         {
             fatalerr("matrix memory allocation error: n=%d,m=%d\n", n, m);
@@ -1014,6 +1021,10 @@ int *imat(int n, int m)
         {
             return nullptr;
         }
+    if (Rtklib_Arena *arena = rtklib_active_arena())
+        {
+            return static_cast<int *>(arena->allocate(sizeof(int) * n * m));
+        }
     if (!(p = static_cast<int *>(malloc(sizeof(int) * n * m))))
         {
             fatalerr("integer matrix memory allocation error: n=%d,m=%d\n", n, m);
@@ -1039,6 +1050,12 @@ double *zeros(int n, int m)
         {
             return nullptr;
         }
+    if (Rtklib_Arena *arena = rtklib_active_arena())
+        {
+            p = static_cast<double *>(arena->allocate(sizeof(double) * n * m));
+            std::fill_n(p, n * m, 0.0);
+            return p;
+        }
     if (!(p = static_cast<double *>(calloc(n * m, sizeof(double)))))
         {
             fatalerr("matrix memory allocation error: n=%d,m=%d\n", n, m);
@@ -1069,6 +1086,23 @@ double *eye(int n)
 }
 
 
+/* free matrix -----------------------------------------------------------------
+ * free memory of matrix created by mat(), imat(), zeros() or eye()
+ * args   : void   *p        I   matrix pointer (NULL: no operation)
+ * return : none
+ * notes  : matrices of the active arena are released when the arena is reset
+ *-----------------------------------------------------------------------------*/
+void matfree(void *p)
+{
+    const Rtklib_Arena *arena = rtklib_active_arena();
+    if (arena != nullptr && arena->owns(p))
+        {
+            return;
+        }
+    free(p);
+}
+
+
 /* inner product ---------------------------------------------------------------
  * inner product of vectors
  * args   : double *a,*b     I   vector a,b (n x 1)
@@ -1188,8 +1222,8 @@ int matinv(double *A, int n)
         {
             dgetri_(&n, A, &n, ipiv, work, &lwork, &info);
         }
-    free(ipiv);
-    free(work);
+    matfree(ipiv);
+    matfree(work);
     return info;
 }
 
@@ -1219,8 +1253,8 @@ int solve(const char *tr, const double *A, const double *Y, int n,
         {
             dgetrs_(const_cast<char *>(tr), &n, &m, B, &n, ipiv, X, &n, &info);
         }
-    free(ipiv);
-    free(B);
+    matfree(ipiv);
+    matfree(B);
     return info;
 }
 
@@ -1255,7 +1289,7 @@ int lsq(const double *A, const double *y, int n, int m, double *x,
         {
             matmul("NN", n, 1, n, 1.0, Q, Ay, 0.0, x); /* x=Q^-1*Ay */
         }
-    free(Ay);
+    matfree(Ay);
     return info;
 }
 
@@ -1298,10 +1332,10 @@ int filter_(const double *x, const double *P, const double *H,
             matmul("NT", n, n, m, -1.0, K, H, 1.0, I); /* Pp=(I-K*H')*P */
             matmul("NN", n, n, n, 1.0, I, P, 0.0, Pp);
         }
-    free(F);
-    free(Q);
-    free(K);
-    free(I);
+    matfree(F);
+    matfree(Q);
+    matfree(K);
+    matfree(I);
     return info;
 }
 
@@ -1361,12 +1395,12 @@ int filter(double *x, double *P, const double *H, const double *v,
                     P[ix[i] + ix[j] * n] = Pp_[i + j * k];
                 }
         }
-    free(ix);
-    free(x_);
-    free(xp_);
-    free(P_);
-    free(Pp_);
-    free(H_);
+    matfree(ix);
+    matfree(x_);
+    matfree(xp_);
+    matfree(P_);
+    matfree(Pp_);
+    matfree(H_);
     return info;
 }
 
@@ -1411,9 +1445,9 @@ int smoother(const double *xf, const double *Qf, const double *xb,
                     matmul("NN", n, 1, n, 1.0, Qs, xx, 0.0, xs);
                 }
         }
-    free(invQf);
-    free(invQb);
-    free(xx);
+    matfree(invQf);
+    matfree(invQb);
+    matfree(xx);
     return info;
 }
 
@@ -2595,7 +2629,7 @@ void eci2ecef(gtime_t tutc, const double *erpv, double *U, double *gmst)
     double NP[9];
     int i;
 
-    trace(4, "eci2ecef: tutc=%s\n", time_str(tutc, 3));
+    TRACE_RTK(4, "eci2ecef: tutc=%s\n", time_str(tutc, 3));
 
     if (fabs(timediff(tutc, tutc_)) < 0.01)
         { /* read cache */
@@ -2662,15 +2696,15 @@ void eci2ecef(gtime_t tutc, const double *erpv, double *U, double *gmst)
             *gmst = gmst_;
         }
 
-    trace(5, "gmst=%.12f gast=%.12f\n", gmst_, gast);
-    trace(5, "P=\n");
-    tracemat(5, P, 3, 3, 15, 12);
-    trace(5, "N=\n");
-    tracemat(5, N, 3, 3, 15, 12);
-    trace(5, "W=\n");
-    tracemat(5, W, 3, 3, 15, 12);
-    trace(5, "U=\n");
-    tracemat(5, U, 3, 3, 15, 12);
+    TRACE_RTK(5, "gmst=%.12f gast=%.12f\n", gmst_, gast);
+    TRACE_RTK(5, "P=\n");
+    TRACEMAT_RTK(5, P, 3, 3, 15, 12);
+    TRACE_RTK(5, "N=\n");
+    TRACEMAT_RTK(5, N, 3, 3, 15, 12);
+    TRACE_RTK(5, "W=\n");
+    TRACEMAT_RTK(5, W, 3, 3, 15, 12);
+    TRACE_RTK(5, "U=\n");
+    TRACEMAT_RTK(5, U, 3, 3, 15, 12);
 }
 
 
@@ -2701,7 +2735,7 @@ void addpcv(const pcv_t *pcv, pcvs_t *pcvs)
             pcvs->nmax += 256;
             if (!(pcvs_pcv = static_cast<pcv_t *>(realloc(pcvs->pcv, sizeof(pcv_t) * pcvs->nmax))))
                 {
-                    trace(1, "addpcv: memory allocation error\n");
+                    TRACE_RTK(1, "addpcv: memory allocation error\n");
                     free(pcvs->pcv);
                     pcvs->pcv = nullptr;
                     pcvs->n = pcvs->nmax = 0;
@@ -2739,7 +2773,7 @@ int readngspcv(const char *file, pcvs_t *pcvs)
 
     if (!(fp = fopen(file, "re")))
         {
-            trace(2, "ngs pcv file open error: %s\n", file);
+            TRACE_RTK(2, "ngs pcv file open error: %s\n", file);
             return 0;
         }
     while (fgets(buff, sizeof(buff), fp))
@@ -2817,11 +2851,11 @@ int readantex(const char *file, pcvs_t *pcvs)
     int freqs[] = {1, 2, 5, 6, 7, 8, 0};
     char buff[256];
 
-    trace(3, "readantex: file=%s\n", file);
+    TRACE_RTK(3, "readantex: file=%s\n", file);
 
     if (!(fp = fopen(file, "re")))
         {
-            trace(2, "antex pcv file open error: %s\n", file);
+            TRACE_RTK(2, "antex pcv file open error: %s\n", file);
             return 0;
         }
     while (fgets(buff, sizeof(buff), fp))
@@ -2948,7 +2982,7 @@ int readpcv(const char *file, pcvs_t *pcvs)
     int i;
     int stat;
 
-    trace(3, "readpcv: file=%s\n", file);
+    TRACE_RTK(3, "readpcv: file=%s\n", file);
 
     if (!(ext = strrchr(file, '.')))
         {
@@ -2966,7 +3000,7 @@ int readpcv(const char *file, pcvs_t *pcvs)
     for (i = 0; i < pcvs->n; i++)
         {
             pcv = pcvs->pcv + i;
-            trace(4, "sat=%2d type=%20s code=%s off=%8.4f %8.4f %8.4f  %8.4f %8.4f %8.4f\n",
+            TRACE_RTK(4, "sat=%2d type=%20s code=%s off=%8.4f %8.4f %8.4f  %8.4f %8.4f %8.4f\n",
                 pcv->sat, pcv->type, pcv->code, pcv->off[0][0], pcv->off[0][1],
                 pcv->off[0][2], pcv->off[1][0], pcv->off[1][1], pcv->off[1][2]);
         }
@@ -2993,7 +3027,7 @@ pcv_t *searchpcv(int sat, const char *type, gtime_t time,
     int j;
     int n = 0;
 
-    trace(3, "searchpcv: sat=%2d type=%s\n", sat, type);
+    TRACE_RTK(3, "searchpcv: sat=%2d type=%s\n", sat, type);
 
     if (sat)
         { /* search satellite antenna */
@@ -3024,7 +3058,7 @@ pcv_t *searchpcv(int sat, const char *type, gtime_t time,
                 }
             else
                 {
-                    trace(1, "type array is too long");
+                    TRACE_RTK(1, "type array is too long");
                 }
             for (p = strtok(buff, " "); p && n < 2; p = strtok(nullptr, " "))
                 {
@@ -3060,7 +3094,7 @@ pcv_t *searchpcv(int sat, const char *type, gtime_t time,
                             continue;
                         }
 
-                    trace(2, "pcv without radome is used type=%s\n", type);
+                    TRACE_RTK(2, "pcv without radome is used type=%s\n", type);
                     return pcv;
                 }
         }
@@ -3089,7 +3123,7 @@ void readpos(const char *file, const char *rcv, double *pos)
     char buff[256];
     char str[256];
 
-    trace(3, "readpos: file=%s\n", file);
+    TRACE_RTK(3, "readpos: file=%s\n", file);
 
     if (!(fp = fopen(file, "re")))
         {
@@ -3186,7 +3220,7 @@ int readblq(const char *file, const char *sta, double *odisp)
 
     if (!(fp = fopen(file, "re")))
         {
-            trace(2, "blq file open error: file=%s\n", file);
+            TRACE_RTK(2, "blq file open error: file=%s\n", file);
             return 0;
         }
     while (fgets(buff, sizeof(buff), fp))
@@ -3216,7 +3250,7 @@ int readblq(const char *file, const char *sta, double *odisp)
                 }
         }
     fclose(fp);
-    trace(2, "no otl parameters: sta=%s file=%s\n", sta, file);
+    TRACE_RTK(2, "no otl parameters: sta=%s file=%s\n", sta, file);
     return 0;
 }
 
@@ -3234,11 +3268,11 @@ int readerp(const char *file, erp_t *erp)
     double v[14] = {};
     char buff[256];
 
-    trace(3, "readerp: file=%s\n", file);
+    TRACE_RTK(3, "readerp: file=%s\n", file);
 
     if (!(fp = fopen(file, "re")))
         {
-            trace(2, "erp file open error: file=%s\n", file);
+            TRACE_RTK(2, "erp file open error: file=%s\n", file);
             return 0;
         }
     while (fgets(buff, sizeof(buff), fp))
@@ -3292,7 +3326,7 @@ int geterp(const erp_t *erp, gtime_t time, double *erpv)
     int j;
     int k;
 
-    trace(4, "geterp:\n");
+    TRACE_RTK(4, "geterp:\n");
 
     if (erp->n <= 0)
         {
@@ -3362,7 +3396,7 @@ void uniqeph(nav_t *nav)
     int i;
     int j;
 
-    trace(3, "uniqeph: n=%d\n", nav->n);
+    TRACE_RTK(3, "uniqeph: n=%d\n", nav->n);
 
     if (nav->n <= 0)
         {
@@ -3383,7 +3417,7 @@ void uniqeph(nav_t *nav)
 
     if (!(nav_eph = static_cast<eph_t *>(realloc(nav->eph, sizeof(eph_t) * nav->n))))
         {
-            trace(1, "uniqeph malloc error n=%d\n", nav->n);
+            TRACE_RTK(1, "uniqeph malloc error n=%d\n", nav->n);
             free(nav->eph);
             nav->eph = nullptr;
             nav->n = nav->nmax = 0;
@@ -3392,7 +3426,7 @@ void uniqeph(nav_t *nav)
     nav->eph = nav_eph;
     nav->nmax = nav->n;
 
-    trace(4, "uniqeph: n=%d\n", nav->n);
+    TRACE_RTK(4, "uniqeph: n=%d\n", nav->n);
 }
 
 
@@ -3412,7 +3446,7 @@ void uniqgeph(nav_t *nav)
     int i;
     int j;
 
-    trace(3, "uniqgeph: ng=%d\n", nav->ng);
+    TRACE_RTK(3, "uniqgeph: ng=%d\n", nav->ng);
 
     if (nav->ng <= 0)
         {
@@ -3434,7 +3468,7 @@ void uniqgeph(nav_t *nav)
 
     if (!(nav_geph = static_cast<geph_t *>(realloc(nav->geph, sizeof(geph_t) * nav->ng))))
         {
-            trace(1, "uniqgeph malloc error ng=%d\n", nav->ng);
+            TRACE_RTK(1, "uniqgeph malloc error ng=%d\n", nav->ng);
             free(nav->geph);
             nav->geph = nullptr;
             nav->ng = nav->ngmax = 0;
@@ -3443,7 +3477,7 @@ void uniqgeph(nav_t *nav)
     nav->geph = nav_geph;
     nav->ngmax = nav->ng;
 
-    trace(4, "uniqgeph: ng=%d\n", nav->ng);
+    TRACE_RTK(4, "uniqgeph: ng=%d\n", nav->ng);
 }
 
 
@@ -3463,7 +3497,7 @@ void uniqseph(nav_t *nav)
     int i;
     int j;
 
-    trace(3, "uniqseph: ns=%d\n", nav->ns);
+    TRACE_RTK(3, "uniqseph: ns=%d\n", nav->ns);
 
     if (nav->ns <= 0)
         {
@@ -3484,7 +3518,7 @@ void uniqseph(nav_t *nav)
 
     if (!(nav_seph = static_cast<seph_t *>(realloc(nav->seph, sizeof(seph_t) * nav->ns))))
         {
-            trace(1, "uniqseph malloc error ns=%d\n", nav->ns);
+            TRACE_RTK(1, "uniqseph malloc error ns=%d\n", nav->ns);
             free(nav->seph);
             nav->seph = nullptr;
             nav->ns = nav->nsmax = 0;
@@ -3493,7 +3527,7 @@ void uniqseph(nav_t *nav)
     nav->seph = nav_seph;
     nav->nsmax = nav->ns;
 
-    trace(4, "uniqseph: ns=%d\n", nav->ns);
+    TRACE_RTK(4, "uniqseph: ns=%d\n", nav->ns);
 }
 
 
@@ -3507,7 +3541,7 @@ void uniqnav(nav_t *nav)
     int i;
     int j;
 
-    trace(3, "uniqnav: neph=%d ngeph=%d nseph=%d\n", nav->n, nav->ng, nav->ns);
+    TRACE_RTK(3, "uniqnav: neph=%d ngeph=%d nseph=%d\n", nav->n, nav->ng, nav->ns);
 
     /* unique ephemeris */
     uniqeph(nav);
@@ -3554,7 +3588,7 @@ int sortobs(obs_t *obs)
     int j;
     int n;
 
-    trace(3, "sortobs: nobs=%d\n", obs->n);
+    TRACE_RTK(3, "sortobs: nobs=%d\n", obs->n);
 
     if (obs->n <= 0)
         {
@@ -3627,7 +3661,7 @@ int readnav(const char *file, nav_t *nav)
     int sat;
     int prn;
 
-    trace(3, "loadnav: file=%s\n", file);
+    TRACE_RTK(3, "loadnav: file=%s\n", file);
 
     if (!(fp = fopen(file, "re")))
         {
@@ -3718,7 +3752,7 @@ int savenav(const char *file, const nav_t *nav)
     FILE *fp;
     int i;
 
-    trace(3, "savenav: file=%s\n", file);
+    TRACE_RTK(3, "savenav: file=%s\n", file);
 
     if (!(fp = fopen(file, "we")))
         {
@@ -3930,6 +3964,17 @@ void tracelevel(int level)
     level_trace = level;
 }
 
+
+/* trace level enabled ---------------------------------------------------------
+ * check if a trace level is written to the trace file or to the log
+ * args   : int    level     I   trace level
+ * return : status (1:enabled,0:disabled)
+ *-----------------------------------------------------------------------------*/
+int traceon(int level)
+{
+    return (fp_trace && level <= level_trace) || VLOG_IS_ON(level);
+}
+
 // extern void trace(int level, const char *format, ...)
 // {
 //    va_list ap;
@@ -4112,7 +4157,7 @@ void trace(int level, const char *format, ...)
  *-----------------------------------------------------------------------------*/
 int execcmd(const char *cmd)
 {
-    trace(3, "execcmd: cmd=%s\n", cmd);
+    TRACE_RTK(3, "execcmd: cmd=%s\n", cmd);
     return system(cmd);
 }
 
@@ -4130,7 +4175,7 @@ void createdir(fs::path const &path)
     auto created = fs::create_directory(path, ec);
     if (not created)
         {
-            trace(1, "Error creating folder: %s", path.c_str());
+            TRACE_RTK(1, "Error creating folder: %s", path.c_str());
         }
 }
 
@@ -4412,7 +4457,7 @@ double satazel(const double *pos, const double *e, double *azel)
  *-----------------------------------------------------------------------------*/
 void dops(int ns, const double *azel, double elmin, double *dop)
 {
-    std::vector<double> H(4 * MAXSAT);
+    std::array<double, 4 * MAXSAT> H{};
     double Q[16];
     double cosel;
     double sinel;
@@ -4720,7 +4765,7 @@ double tropmapf(gtime_t time, const double pos[], const double azel[],
     const double ep[] = {2000, 1, 1, 12, 0, 0};
     double mjd, lat, lon, hgt, zd, gmfh, gmfw;
 #endif
-    trace(4, "tropmapf: pos=%10.6f %11.6f %6.1f azel=%5.1f %4.1f\n",
+    TRACE_RTK(4, "tropmapf: pos=%10.6f %11.6f %6.1f azel=%5.1f %4.1f\n",
         pos[0] * R2D, pos[1] * R2D, pos[2], azel[0] * R2D, azel[1] * R2D);
 
     if (pos[2] < -1000.0 || pos[2] > 20000.0)
@@ -4784,7 +4829,7 @@ void antmodel(const pcv_t *pcv, const double *del, const double *azel,
     int i;
     int j;
 
-    trace(4, "antmodel: azel=%6.1f %4.1f opt=%d\n", azel[0] * R2D, azel[1] * R2D, opt);
+    TRACE_RTK(4, "antmodel: azel=%6.1f %4.1f opt=%d\n", azel[0] * R2D, azel[1] * R2D, opt);
 
     e[0] = sin(azel[0]) * cosel;
     e[1] = cos(azel[0]) * cosel;
@@ -4799,7 +4844,7 @@ void antmodel(const pcv_t *pcv, const double *del, const double *azel,
 
             dant[i] = -dot(off, e, 3) + (opt ? interpvar(90.0 - azel[1] * R2D, pcv->var[i]) : 0.0);
         }
-    trace(5, "antmodel: dant=%6.3f %6.3f\n", dant[0], dant[1]);
+    TRACE_RTK(5, "antmodel: dant=%6.3f %6.3f\n", dant[0], dant[1]);
 }
 
 
@@ -4814,13 +4859,13 @@ void antmodel_s(const pcv_t *pcv, double nadir, double *dant)
 {
     int i;
 
-    trace(4, "antmodel_s: nadir=%6.1f\n", nadir * R2D);
+    TRACE_RTK(4, "antmodel_s: nadir=%6.1f\n", nadir * R2D);
 
     for (i = 0; i < NFREQ; i++)
         {
             dant[i] = interpvar(nadir * R2D * 5.0, pcv->var[i]);
         }
-    trace(5, "antmodel_s: dant=%6.3f %6.3f\n", dant[0], dant[1]);
+    TRACE_RTK(5, "antmodel_s: dant=%6.3f %6.3f\n", dant[0], dant[1]);
 }
 
 
@@ -4844,7 +4889,7 @@ void sunmoonpos_eci(gtime_t tut, double *rsun, double *rmoon)
     double sinl;
     double cosl;
 
-    trace(4, "sunmoonpos_eci: tut=%s\n", time_str(tut, 3));
+    TRACE_RTK(4, "sunmoonpos_eci: tut=%s\n", time_str(tut, 3));
 
     t = timediff(tut, epoch2time(ep2000)) / 86400.0 / 36525.0;
 
@@ -4868,7 +4913,7 @@ void sunmoonpos_eci(gtime_t tut, double *rsun, double *rmoon)
             rsun[1] = rs * cose * sinl;
             rsun[2] = rs * sine * sinl;
 
-            trace(5, "rsun =%.3f %.3f %.3f\n", rsun[0], rsun[1], rsun[2]);
+            TRACE_RTK(5, "rsun =%.3f %.3f %.3f\n", rsun[0], rsun[1], rsun[2]);
         }
     /* moon position in eci */
     if (rmoon)
@@ -4888,7 +4933,7 @@ void sunmoonpos_eci(gtime_t tut, double *rsun, double *rmoon)
             rmoon[1] = rm * (cose * cosp * sinl - sine * sinp);
             rmoon[2] = rm * (sine * cosp * sinl + cose * sinp);
 
-            trace(5, "rmoon=%.3f %.3f %.3f\n", rmoon[0], rmoon[1], rmoon[2]);
+            TRACE_RTK(5, "rmoon=%.3f %.3f %.3f\n", rmoon[0], rmoon[1], rmoon[2]);
         }
 }
 
@@ -4911,7 +4956,7 @@ void sunmoonpos(gtime_t tutc, const double *erpv, double *rsun,
     double U[9];
     double gmst_;
 
-    trace(4, "sunmoonpos: tutc=%s\n", time_str(tutc, 3));
+    TRACE_RTK(4, "sunmoonpos: tutc=%s\n", time_str(tutc, 3));
 
     tut = timeadd(tutc, erpv[2]); /* utc -> ut1 */
 
@@ -4962,7 +5007,7 @@ void csmooth(obs_t *obs, int ns)
     n[0].resize(MAXSAT);
     n[1].resize(MAXSAT);
 
-    trace(3, "csmooth: nobs=%d,ns=%d\n", obs->n, ns);
+    TRACE_RTK(3, "csmooth: nobs=%d,ns=%d\n", obs->n, ns);
 
     for (i = 0; i < obs->n; i++)
         {
@@ -5025,7 +5070,7 @@ int rtk_uncompress(const char *file, char *uncfile)
     char *fname;
     char *dir = const_cast<char *>("");
 
-    trace(3, "rtk_uncompress: file=%s\n", file);
+    TRACE_RTK(3, "rtk_uncompress: file=%s\n", file);
 
     if (strlen(file) < 1025)
         {
@@ -5034,7 +5079,7 @@ int rtk_uncompress(const char *file, char *uncfile)
         }
     else
         {
-            trace(1, "file array is too long");
+            TRACE_RTK(1, "file array is too long");
         }
     if (!(p = strrchr(tmpfile, '.')))
         {
@@ -5054,7 +5099,7 @@ int rtk_uncompress(const char *file, char *uncfile)
                 {
                     if (remove(uncfile) != 0)
                         {
-                            trace(1, "Error removing file");
+                            TRACE_RTK(1, "Error removing file");
                         }
                     return -1;
                 }
@@ -5099,7 +5144,7 @@ int rtk_uncompress(const char *file, char *uncfile)
                         {
                             if (remove(tmpfile) != 0)
                                 {
-                                    trace(1, "Error removing file");
+                                    TRACE_RTK(1, "Error removing file");
                                 }
                         }
                     return -1;
@@ -5108,7 +5153,7 @@ int rtk_uncompress(const char *file, char *uncfile)
                 {
                     if (remove(tmpfile) != 0)
                         {
-                            trace(1, "Error removing file");
+                            TRACE_RTK(1, "Error removing file");
                         }
                 }
             stat = 1;
@@ -5124,13 +5169,13 @@ int rtk_uncompress(const char *file, char *uncfile)
                 {
                     if (remove(uncfile) != 0)
                         {
-                            trace(1, "Error removing file");
+                            TRACE_RTK(1, "Error removing file");
                         }
                     if (stat)
                         {
                             if (remove(tmpfile) != 0)
                                 {
-                                    trace(1, "Error removing file");
+                                    TRACE_RTK(1, "Error removing file");
                                 }
                         }
                     return -1;
@@ -5139,12 +5184,12 @@ int rtk_uncompress(const char *file, char *uncfile)
                 {
                     if (remove(tmpfile) != 0)
                         {
-                            trace(1, "Error removing file");
+                            TRACE_RTK(1, "Error removing file");
                         }
                 }
             stat = 1;
         }
-    trace(3, "rtk_uncompress: stat=%d\n", stat);
+    TRACE_RTK(3, "rtk_uncompress: stat=%d\n", stat);
     return stat;
 }
 
@@ -5174,7 +5219,7 @@ int expath(const char *path, char *paths[], int nmax)
     char *q;
     char *r;
 
-    trace(3, "expath  : path=%s nmax=%d\n", path, nmax);
+    TRACE_RTK(3, "expath  : path=%s nmax=%d\n", path, nmax);
 
     // TODO: Fix  invalid conversion from ‘const char*’ to ‘char*’
     // if ((p=strrchr(path,'/')) || (p=strrchr(path,'\\'))) {
@@ -5232,7 +5277,7 @@ int expath(const char *path, char *paths[], int nmax)
                                 }
                             else
                                 {
-                                    trace(1, "Path is too long");
+                                    TRACE_RTK(1, "Path is too long");
                                 }
                             std::strncpy(paths[i], paths[j], 1024);
                             std::strncpy(paths[j], tmp, 1024);
@@ -5242,7 +5287,7 @@ int expath(const char *path, char *paths[], int nmax)
         }
     for (i = 0; i < n; i++)
         {
-            trace(3, "expath  : file=%s\n", paths[i]);
+            TRACE_RTK(3, "expath  : file=%s\n", paths[i]);
         }
 
     return n;
@@ -5272,7 +5317,7 @@ void windupcorr(gtime_t time, const double *rs, const double *rr, double *phw)
     double erpv[5] = {0};
     int i;
 
-    trace(4, "windupcorr: time=%s\n", time_str(time, 0));
+    TRACE_RTK(4, "windupcorr: time=%s\n", time_str(time, 0));
 
     /* sun position in ecef */
     sunmoonpos(gpst2utc(time), erpv, rsun, nullptr, nullptr);
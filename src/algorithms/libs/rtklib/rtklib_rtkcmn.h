@@ -115,6 +115,36 @@ namespace errorlib = boost::system;
         }                                            \
     while (0)
 
+/* debug trace -----------------------------------------------------------------
+ * TRACE_RTK(), TRACET_RTK(), TRACEMAT_RTK() and TRACEOBS_RTK() call trace(),
+ * tracet(), tracemat() and traceobs() only if traceon() accepts the level, so
+ * that their arguments are not evaluated otherwise. Levels above
+ * RTKLIB_TRACE_LEVEL are removed at compile time. By default, release builds
+ * (NDEBUG) remove all of them.
+ *-----------------------------------------------------------------------------*/
+#ifndef RTKLIB_TRACE_LEVEL
+#ifdef NDEBUG
+#define RTKLIB_TRACE_LEVEL 0
+#else
+#define RTKLIB_TRACE_LEVEL 5
+#endif
+#endif
+
+#define TRACE_CALL_RTK(f, level, ...)                            \
+    do                                                           \
+        {                                                        \
+            if ((level) <= RTKLIB_TRACE_LEVEL && traceon(level)) \
+                {                                                \
+                    f(level, __VA_ARGS__);                       \
+                }                                                \
+        }                                                        \
+    while (0)
+
+#define TRACE_RTK(level, ...) TRACE_CALL_RTK(trace, level, __VA_ARGS__)
+#define TRACET_RTK(level, ...) TRACE_CALL_RTK(tracet, level, __VA_ARGS__)
+#define TRACEMAT_RTK(level, ...) TRACE_CALL_RTK(tracemat, level, __VA_ARGS__)
+#define TRACEOBS_RTK(level, ...) TRACE_CALL_RTK(traceobs, level, __VA_ARGS__)
+
 char *strncpy_no_trunc(char *out, size_t outsz, const char *in, size_t insz);
 void fatalerr(const char *format, ...);
 int satno(int sys, int prn);
@@ -139,6 +169,7 @@ double *mat(int n, int m);
 int *imat(int n, int m);
 double *zeros(int n, int m);
 double *eye(int n);
+void matfree(void *p);
 double dot(const double *a, const double *b, int n);
 double norm_rtk(const double *a, int n);
 void cross3(const double *a, const double *b, double *c);
@@ -235,6 +266,7 @@ void traceopen(const char *file);
 void traceclose();
 void tracelevel(int level);
 void traceswap();
+int traceon(int level);
 void trace(int level, const char *format, ...);
 void tracet(int level, const char *format, ...);
 void tracemat(int level, const double *A, int n, int m, int p, int q);
@@ -38,7 +38,7 @@
 #include <cmath>
 #include <cstring>
 #include <string>
-#include <vector>
+#include <array>
 
 static int resamb_WLNL(rtk_t *rtk __attribute((unused)), const obsd_t *obs __attribute((unused)), const int *sat __attribute((unused)),
     const int *iu __attribute((unused)), const int *ir __attribute((unused)), int ns __attribute__((unused)), const nav_t *nav __attribute((unused)),
@@ -127,7 +127,7 @@ int rtkopenstat(const char *file, int level)
     gtime_t time = utc2gpst(timeget());
     std::string path;
 
-    trace(3, "rtkopenstat: file=%s level=%d\n", file, level);
+    TRACE_RTK(3, "rtkopenstat: file=%s level=%d\n", file, level);
 
     if (level <= 0)
         {
@@ -138,7 +138,7 @@ int rtkopenstat(const char *file, int level)
 
     if (!(fp_stat = fopen(path.data(), "we")))
         {
-            trace(1, "rtkopenstat: file open error path=%s\n", path.data());
+            TRACE_RTK(1, "rtkopenstat: file open error path=%s\n", path.data());
             return 0;
         }
     if (strlen(file) < 1025)
@@ -148,7 +148,7 @@ int rtkopenstat(const char *file, int level)
         }
     else
         {
-            trace(1, "File name is too long");
+            TRACE_RTK(1, "File name is too long");
         }
     time_stat = time;
     statlevel = level;
@@ -163,7 +163,7 @@ int rtkopenstat(const char *file, int level)
  *-----------------------------------------------------------------------------*/
 void rtkclosestat()
 {
-    trace(3, "rtkclosestat:\n");
+    TRACE_RTK(3, "rtkclosestat:\n");
 
     if (fp_stat)
         {
@@ -198,7 +198,7 @@ void rtkoutstat(rtk_t *rtk, char *buff __attribute__((unused)))
             return;
         }
 
-    trace(3, "outsolstat:\n");
+    TRACE_RTK(3, "outsolstat:\n");
 
     /* swap solution status file */
     swapsolstat();
@@ -343,10 +343,10 @@ void swapsolstat()
 
     if (!(fp_stat = fopen(path.data(), "we")))
         {
-            trace(2, "swapsolstat: file open error path=%s\n", path.data());
+            TRACE_RTK(2, "swapsolstat: file open error path=%s\n", path.data());
             return;
         }
-    trace(3, "swapsolstat: path=%s\n", path.data());
+    TRACE_RTK(3, "swapsolstat: path=%s\n", path.data());
 }
 
 
@@ -373,7 +373,7 @@ void outsolstat(rtk_t *rtk)
             return;
         }
 
-    trace(3, "outsolstat:\n");
+    TRACE_RTK(3, "outsolstat:\n");
 
     /* swap solution status file */
     swapsolstat();
@@ -509,7 +509,7 @@ void errmsg(rtk_t *rtk, const char *format, ...)
     n = n < MAXERRMSG - rtk->neb ? n : MAXERRMSG - rtk->neb;
     memcpy(rtk->errbuf + rtk->neb, buff, n);
     rtk->neb += n;
-    trace(2, "%s", buff);
+    TRACE_RTK(2, "%s", buff);
 }
 
 
@@ -623,7 +623,7 @@ int selsat(const obsd_t *obs, const double *azel, int nu, int nr,
     int j;
     int k = 0;
 
-    trace(3, "selsat  : nu=%d nr=%d\n", nu, nr);
+    TRACE_RTK(3, "selsat  : nu=%d nr=%d\n", nu, nr);
 
     for (i = 0, j = nu; i < nu && j < nu + nr; i++, j++)
         {
@@ -640,7 +640,7 @@ int selsat(const obsd_t *obs, const double *azel, int nu, int nr,
                     sat[k] = obs[i].sat;
                     iu[k] = i;
                     ir[k++] = j;
-                    trace(4, "(%2d) sat=%3d iu=%2d ir=%2d\n", k - 1, obs[i].sat, i, j);
+                    TRACE_RTK(4, "(%2d) sat=%3d iu=%2d ir=%2d\n", k - 1, obs[i].sat, i, j);
                 }
         }
     return k;
@@ -660,7 +660,7 @@ void udpos(rtk_t *rtk, double tt)
     int i;
     int j;
 
-    trace(3, "udpos   : tt=%.3f\n", tt);
+    TRACE_RTK(3, "udpos   : tt=%.3f\n", tt);
 
     /* fixed mode */
     if (rtk->opt.mode == PMODE_FIXED)
@@ -727,7 +727,7 @@ void udpos(rtk_t *rtk, double tt)
                 {
                     initx_rtk(rtk, 1E-6, VAR_ACC, i);
                 }
-            trace(2, "reset rtk position due to large variance: var=%.3f\n", var);
+            TRACE_RTK(2, "reset rtk position due to large variance: var=%.3f\n", var);
             return;
         }
     /* state transition of position/velocity/acceleration */
@@ -757,9 +757,9 @@ void udpos(rtk_t *rtk, double tt)
                     rtk->P[i + 6 + (j + 6) * rtk->nx] += Qv[i + j * 3];
                 }
         }
-    free(F);
-    free(FP);
-    free(xp);
+    matfree(F);
+    matfree(FP);
+    matfree(xp);
 }
 
 
@@ -771,7 +771,7 @@ void udion(rtk_t *rtk, double tt, double bl, const int *sat, int ns)
     int i;
     int j;
 
-    trace(3, "udion   : tt=%.1f bl=%.0f ns=%d\n", tt, bl, ns);
+    TRACE_RTK(3, "udion   : tt=%.1f bl=%.0f ns=%d\n", tt, bl, ns);
 
     for (i = 1; i <= MAXSAT; i++)
         {
@@ -808,7 +808,7 @@ void udtrop(rtk_t *rtk, double tt, double bl __attribute((unused)))
     int j;
     int k;
 
-    trace(3, "udtrop  : tt=%.1f\n", tt);
+    TRACE_RTK(3, "udtrop  : tt=%.1f\n", tt);
 
     for (i = 0; i < 2; i++)
         {
@@ -848,7 +848,7 @@ void udrcvbias(rtk_t *rtk, double tt)
     int i;
     int j;
 
-    trace(3, "udrcvbias: tt=%.1f\n", tt);
+    TRACE_RTK(3, "udrcvbias: tt=%.1f\n", tt);
 
     for (i = 0; i < NFREQGLO; i++)
         {
@@ -879,7 +879,7 @@ void detslp_ll(rtk_t *rtk, const obsd_t *obs, int i, int rcv)
     int f;
     int sat = obs[i].sat;
 
-    trace(3, "detslp_ll: i=%d rcv=%d\n", i, rcv);
+    TRACE_RTK(3, "detslp_ll: i=%d rcv=%d\n", i, rcv);
 
     for (f = 0; f < rtk->opt.nf; f++)
         {
@@ -949,7 +949,7 @@ void detslp_gf_L1L2(rtk_t *rtk, const obsd_t *obs, int i, int j,
     double g0;
     double g1;
 
-    trace(3, "detslp_gf_L1L2: i=%d j=%d\n", i, j);
+    TRACE_RTK(3, "detslp_gf_L1L2: i=%d j=%d\n", i, j);
 
     if (rtk->opt.nf <= 1 || (g1 = gfobs_L1L2(obs, i, j, nav->lam[sat - 1])) == 0.0)
         {
@@ -977,7 +977,7 @@ void detslp_gf_L1L5(rtk_t *rtk, const obsd_t *obs, int i, int j,
     double g0;
     double g1;
 
-    trace(3, "detslp_gf_L1L5: i=%d j=%d\n", i, j);
+    TRACE_RTK(3, "detslp_gf_L1L5: i=%d j=%d\n", i, j);
 
     if (rtk->opt.nf <= 2 || (g1 = gfobs_L1L5(obs, i, j, nav->lam[sat - 1])) == 0.0)
         {
@@ -1006,7 +1006,7 @@ void detslp_dop(rtk_t *rtk __attribute__((unused)), const obsd_t *obs __attribut
     int f, sat = obs[i].sat;
     double tt, dph, dpt, lam, thres;
 
-    trace(3, "detslp_dop: i=%d rcv=%d\n", i, rcv);
+    TRACE_RTK(3, "detslp_dop: i=%d rcv=%d\n", i, rcv);
 
     for (f = 0; f < rtk->opt.nf; f++)
         {
@@ -1059,7 +1059,7 @@ void udbias(rtk_t *rtk, double tt, const obsd_t *obs, const int *sat,
     int reset;
     int nf = NF_RTK(&rtk->opt);
 
-    trace(3, "udbias  : tt=%.1f ns=%d\n", tt, ns);
+    TRACE_RTK(3, "udbias  : tt=%.1f ns=%d\n", tt, ns);
 
     for (i = 0; i < ns; i++)
         {
@@ -1100,7 +1100,7 @@ void udbias(rtk_t *rtk, double tt, const obsd_t *obs, const int *sat,
                     else if (reset && rtk->x[IB_RTK(i, f, &rtk->opt)] != 0.0)
                         {
                             initx_rtk(rtk, 0.0, 0.0, IB_RTK(i, f, &rtk->opt));
-                            trace(3, "udbias : obs outage counter overflow (sat=%3d L%d n=%d)\n",
+                            TRACE_RTK(3, "udbias : obs outage counter overflow (sat=%3d L%d n=%d)\n",
                                 i, f + 1, rtk->ssat[i - 1].outc[f]);
                         }
                     if (rtk->opt.modear != ARMODE_INST && reset)
@@ -1185,7 +1185,7 @@ void udbias(rtk_t *rtk, double tt, const obsd_t *obs, const int *sat,
                         }
                     initx_rtk(rtk, bias[i], std::pow(rtk->opt.std[0], 2.0), IB_RTK(sat[i], f, &rtk->opt));
                 }
-            free(bias);
+            matfree(bias);
         }
 }
 
@@ -1198,7 +1198,7 @@ void udstate(rtk_t *rtk, const obsd_t *obs, const int *sat,
     double bl = 0.0;
     double dr[3];
 
-    trace(3, "udstate : ns=%d\n", ns);
+    TRACE_RTK(3, "udstate : ns=%d\n", ns);
 
     /* temporal update of position/velocity/acceleration */
     udpos(rtk, tt);
@@ -1313,7 +1313,7 @@ int zdres(int base, const obsd_t *obs, int n, const double *rs,
     int i;
     int nf = NF_RTK(opt);
 
-    trace(3, "zdres   : n=%d\n", n);
+    TRACE_RTK(3, "zdres   : n=%d\n", n);
 
     for (i = 0; i < n * nf * 2; i++)
         {
@@ -1374,16 +1374,16 @@ int zdres(int base, const obsd_t *obs, int n, const double *rs,
             /* undifferenced phase/code residual for satellite */
             zdres_sat(base, r, obs + i, nav, azel + i * 2, dant, opt, y + i * nf * 2);
         }
-    trace(4, "rr_=%.3f %.3f %.3f\n", rr_[0], rr_[1], rr_[2]);
-    trace(4, "pos=%.9f %.9f %.3f\n", pos[0] * R2D, pos[1] * R2D, pos[2]);
+    TRACE_RTK(4, "rr_=%.3f %.3f %.3f\n", rr_[0], rr_[1], rr_[2]);
+    TRACE_RTK(4, "pos=%.9f %.9f %.3f\n", pos[0] * R2D, pos[1] * R2D, pos[2]);
     for (i = 0; i < n; i++)
         {
-            trace(4, "sat=%2d %13.3f %13.3f %13.3f %13.10f %6.1f %5.1f\n",
+            TRACE_RTK(4, "sat=%2d %13.3f %13.3f %13.3f %13.10f %6.1f %5.1f\n",
                 obs[i].sat, rs[i * 6], rs[1 + i * 6], rs[2 + i * 6], dts[i * 2], azel[i * 2] * R2D,
                 azel[1 + i * 2] * R2D);
         }
-    trace(4, "y=\n");
-    tracemat(4, y, nf * 2, n, 13, 3);
+    TRACE_RTK(4, "y=\n");
+    TRACEMAT_RTK(4, y, nf * 2, n, 13, 3);
 
     return 1;
 }
@@ -1407,7 +1407,7 @@ void ddcov(const int *nb, int n, const double *Ri, const double *Rj,
     int k = 0;
     int b;
 
-    trace(3, "ddcov   : n=%d\n", n);
+    TRACE_RTK(3, "ddcov   : n=%d\n", n);
 
     for (i = 0; i < nv * nv; i++)
         {
@@ -1423,8 +1423,8 @@ void ddcov(const int *nb, int n, const double *Ri, const double *Rj,
                         }
                 }
         }
-    trace(5, "R=\n");
-    tracemat(5, R, nv, nv, 8, 6);
+    TRACE_RTK(5, "R=\n");
+    TRACEMAT_RTK(5, R, nv, nv, 8, 6);
 }
 
 
@@ -1439,7 +1439,7 @@ int constbl(rtk_t *rtk, const double *x, const double *P, double *v,
     double var = 0.0;
     int i;
 
-    trace(3, "constbl : \n");
+    TRACE_RTK(3, "constbl : \n");
 
     /* no constraint */
     if (rtk->opt.baseline[0] <= 0.0)
@@ -1467,7 +1467,7 @@ int constbl(rtk_t *rtk, const double *x, const double *P, double *v,
     /* check nonlinearity */
     if (var > thres * thres * bb * bb)
         {
-            trace(3, "constbl : equation nonlinear (bb=%.3f var=%.3f)\n", bb, var);
+            TRACE_RTK(3, "constbl : equation nonlinear (bb=%.3f var=%.3f)\n", bb, var);
             return 0;
         }
     /* constraint to baseline length */
@@ -1482,7 +1482,7 @@ int constbl(rtk_t *rtk, const double *x, const double *P, double *v,
     Ri[index] = 0.0;
     Rj[index] = std::pow(rtk->opt.baseline[1], 2.0);
 
-    trace(4, "baseline len   v=%13.3f R=%8.6f %8.6f\n", v[index], Ri[index], Rj[index]);
+    TRACE_RTK(4, "baseline len   v=%13.3f R=%8.6f %8.6f\n", v[index], Ri[index], Rj[index]);
 
     return 1;
 }
@@ -1599,7 +1599,7 @@ int ddres(rtk_t *rtk, const nav_t *nav, double dt, const double *x,
     int sysj;
     int nf = NF_RTK(opt);
 
-    trace(3, "ddres   : dt=%.1f nx=%d ns=%d\n", dt, rtk->nx, ns);
+    TRACE_RTK(3, "ddres   : dt=%.1f nx=%d ns=%d\n", dt, rtk->nx, ns);
 
     bl = baseline(x, rtk->rb, dr);
     ecef2pos(x, posu);
@@ -1806,7 +1806,7 @@ int ddres(rtk_t *rtk, const nav_t *nav, double dt, const double *x,
                                 {
                                     rtk->ssat[sat[i] - 1].vsat[f - nf] = rtk->ssat[sat[j] - 1].vsat[f - nf] = 1;
                                 }
-                            trace(4, "sat=%3d-%3d %s%d v=%13.3f R=%8.6f %8.6f\n", sat[i],
+                            TRACE_RTK(4, "sat=%3d-%3d %s%d v=%13.3f R=%8.6f %8.6f\n", sat[i],
                                 sat[j], f < nf ? "L" : "P", f % nf + 1, v[nv], Ri[nv], Rj[nv]);
 
                             vflg[nv++] = (sat[i] << 16) | (sat[j] << 8) | ((f < nf ? 0 : 1) << 4) | (f % nf);
@@ -1847,20 +1847,20 @@ int ddres(rtk_t *rtk, const nav_t *nav, double dt, const double *x,
         }
     if (H)
         {
-            trace(5, "H=\n");
-            tracemat(5, H, rtk->nx, nv, 7, 4);
+            TRACE_RTK(5, "H=\n");
+            TRACEMAT_RTK(5, H, rtk->nx, nv, 7, 4);
         }
 
     /* double-differenced measurement error covariance */
     ddcov(nb, b, Ri, Rj, nv, R);
 
-    free(Ri);
-    free(Rj);
-    free(im);
-    free(tropu);
-    free(tropr);
-    free(dtdxu);
-    free(dtdxr);
+    matfree(Ri);
+    matfree(Rj);
+    matfree(im);
+    matfree(tropu);
+    matfree(tropr);
+    matfree(dtdxu);
+    matfree(dtdxr);
 
     return nv;
 }
@@ -1889,7 +1889,7 @@ double intpres(gtime_t time, const obsd_t *obs, int n, const nav_t *nav,
     int k;
     int nf = NF_RTK(opt);
 
-    trace(3, "intpres : n=%d tt=%.1f\n", n, tt);
+    TRACE_RTK(3, "intpres : n=%d tt=%.1f\n", n, tt);
 
     if (nb == 0 || fabs(tt) < DTTOL)
         {
@@ -1955,7 +1955,7 @@ int ddmat(rtk_t *rtk, double *D)
     int nf = NF_RTK(&rtk->opt);
     int nofix;
 
-    trace(3, "ddmat   :\n");
+    TRACE_RTK(3, "ddmat   :\n");
 
     for (i = 0; i < MAXSAT; i++)
         {
@@ -2016,8 +2016,8 @@ int ddmat(rtk_t *rtk, double *D)
                         }
                 }
         }
-    trace(5, "D=\n");
-    tracemat(5, D, nx, na + nb, 2, 0);
+    TRACE_RTK(5, "D=\n");
+    TRACEMAT_RTK(5, D, nx, na + nb, 2, 0);
     return nb;
 }
 
@@ -2029,11 +2029,11 @@ void restamb(rtk_t *rtk, const double *bias, int nb __attribute((unused)), doubl
     int n;
     int m;
     int f;
-    std::vector<int> index(MAXSAT);
+    std::array<int, MAXSAT> index{};
     int nv = 0;
     int nf = NF_RTK(&rtk->opt);
 
-    trace(3, "restamb :\n");
+    TRACE_RTK(3, "restamb :\n");
 
     for (i = 0; i < rtk->nx; i++)
         {
@@ -2083,12 +2083,12 @@ void holdamb(rtk_t *rtk, const double *xa)
     int m;
     int f;
     int info;
-    std::vector<int> index(MAXSAT);
+    std::array<int, MAXSAT> index{};
     int nb = rtk->nx - rtk->na;
     int nv = 0;
     int nf = NF_RTK(&rtk->opt);
 
-    trace(3, "holdamb :\n");
+    TRACE_RTK(3, "holdamb :\n");
 
     v = mat(nb, 1);
     H = zeros(nb, rtk->nx);
@@ -2131,10 +2131,10 @@ void holdamb(rtk_t *rtk, const double *xa)
                 {
                     errmsg(rtk, "filter error (info=%d)\n", info);
                 }
-            free(R);
+            matfree(R);
         }
-    free(v);
-    free(H);
+    matfree(v);
+    matfree(H);
 }
 
 
@@ -2160,7 +2160,7 @@ int resamb_LAMBDA(rtk_t *rtk, double *bias, double *xa)
     double *QQ;
     double s[2];
 
-    trace(3, "resamb_LAMBDA : nx=%d\n", nx);
+    TRACE_RTK(3, "resamb_LAMBDA : nx=%d\n", nx);
 
     rtk->sol.ratio = 0.0;
 
@@ -2174,7 +2174,7 @@ int resamb_LAMBDA(rtk_t *rtk, double *bias, double *xa)
     if ((nb = ddmat(rtk, D)) <= 0)
         {
             errmsg(rtk, "no valid double-difference\n");
-            free(D);
+            matfree(D);
             return 0;
         }
     ny = na + nb;
@@ -2208,16 +2208,16 @@ int resamb_LAMBDA(rtk_t *rtk, double *bias, double *xa)
                 }
         }
 
-    trace(4, "N(0)=");
-    tracemat(4, y + na, 1, nb, 10, 3);
+    TRACE_RTK(4, "N(0)=");
+    TRACEMAT_RTK(4, y + na, 1, nb, 10, 3);
 
     /* lambda/mlambda integer least-square estimation */
     if (!(info = lambda(nb, 2, y + na, Qb, b, s)))
         {
-            trace(4, "N(1)=");
-            tracemat(4, b, 1, nb, 10, 3);
-            trace(4, "N(2)=");
-            tracemat(4, b + nb, 1, nb, 10, 3);
+            TRACE_RTK(4, "N(1)=");
+            TRACEMAT_RTK(4, b, 1, nb, 10, 3);
+            TRACE_RTK(4, "N(2)=");
+            TRACEMAT_RTK(4, b + nb, 1, nb, 10, 3);
 
             rtk->sol.ratio = s[0] > 0 ? static_cast<float>(s[1] / s[0]) : 0.0F;
             if (rtk->sol.ratio > 999.9)
@@ -2251,7 +2251,7 @@ int resamb_LAMBDA(rtk_t *rtk, double *bias, double *xa)
                             matmul("NN", na, nb, nb, 1.0, Qab, Qb, 0.0, QQ);
                             matmul("NT", na, na, nb, -1.0, QQ, Qab, 1.0, rtk->Pa);
 
-                            trace(3, "resamb : validation ok (nb=%d ratio=%.2f s=%.2f/%.2f)\n",
+                            TRACE_RTK(3, "resamb : validation ok (nb=%d ratio=%.2f s=%.2f/%.2f)\n",
                                 nb, s[0] == 0.0 ? 0.0 : s[1] / s[0], s[0], s[1]);
 
                             /* restore single-differenced ambiguity */
@@ -2273,15 +2273,15 @@ int resamb_LAMBDA(rtk_t *rtk, double *bias, double *xa)
         {
             errmsg(rtk, "lambda error (info=%d)\n", info);
         }
-    free(D);
-    free(y);
-    free(Qy);
-    free(DP);
-    free(b);
-    free(db);
-    free(Qb);
-    free(Qab);
-    free(QQ);
+    matfree(D);
+    matfree(y);
+    matfree(Qy);
+    matfree(DP);
+    matfree(b);
+    matfree(db);
+    matfree(Qb);
+    matfree(Qab);
+    matfree(QQ);
 
     return nb; /* number of ambiguities */
 }
@@ -2304,7 +2304,7 @@ int valpos(rtk_t *rtk, const double *v, const double *R, const int *vflg,
     int freq;
     char stype;
 
-    trace(3, "valpos  : nv=%d thres=%.1f\n", nv, thres);
+    TRACE_RTK(3, "valpos  : nv=%d thres=%.1f\n", nv, thres);
 
     /* post-fit residual test */
     for (i = 0; i < nv; i++)
@@ -2335,7 +2335,7 @@ int valpos(rtk_t *rtk, const double *v, const double *R, const int *vflg,
                 }
             else
                 {
-                    trace(3, "valpos : validation ok (%s nv=%d np=%d vv=%.2f cs=%.2f)\n",
+                    TRACE_RTK(3, "valpos : validation ok (%s nv=%d np=%d vv=%.2f cs=%.2f)\n",
                         rtk->tstr, nv, NP(opt), vv, chisqr[nv - NP(opt) - 1]);
                 }
         }
@@ -2371,17 +2371,17 @@ int relpos(rtk_t *rtk, const obsd_t *obs, int nu, int nr,
     int ns;
     int ny;
     int nv;
-    std::vector<int> sat(MAXSAT);
-    std::vector<int> iu(MAXSAT);
-    std::vector<int> ir(MAXSAT);
+    std::array<int, MAXSAT> sat{};
+    std::array<int, MAXSAT> iu{};
+    std::array<int, MAXSAT> ir{};
     int niter;
     int info;
-    std::vector<int> vflg(MAXOBS * NFREQ * 2 + 1);
-    std::vector<int> svh(MAXOBS * 2);
+    std::array<int, MAXOBS * NFREQ * 2 + 1> vflg{};
+    std::array<int, MAXOBS * 2> svh{};
     int stat = rtk->opt.mode <= PMODE_DGPS ? SOLQ_DGPS : SOLQ_FLOAT;
     int nf = opt->ionoopt == IONOOPT_IFLC ? 1 : opt->nf;
 
-    trace(3, "relpos  : nx=%d nu=%d nr=%d\n", rtk->nx, nu, nr);
+    TRACE_RTK(3, "relpos  : nx=%d nu=%d nr=%d\n", rtk->nx, nu, nr);
 
     dt = timediff(time, obs[nu].time);
 
@@ -2409,12 +2409,12 @@ int relpos(rtk_t *rtk, const obsd_t *obs, int nu, int nr,
         {
             errmsg(rtk, "initial base station position error\n");
 
-            free(rs);
-            free(dts);
-            free(var);
-            free(y);
-            free(e);
-            free(azel);
+            matfree(rs);
+            matfree(dts);
+            matfree(var);
+            matfree(y);
+            matfree(e);
+            matfree(azel);
             return 0;
         }
     /* time-interpolation of residuals (for post-processing) */
@@ -2427,19 +2427,19 @@ int relpos(rtk_t *rtk, const obsd_t *obs, int nu, int nr,
         {
             errmsg(rtk, "no common satellite\n");
 
-            free(rs);
-            free(dts);
-            free(var);
-            free(y);
-            free(e);
-            free(azel);
+            matfree(rs);
+            matfree(dts);
+            matfree(var);
+            matfree(y);
+            matfree(e);
+            matfree(azel);
             return 0;
         }
     /* temporal update of states */
     udstate(rtk, obs, sat.data(), iu.data(), ir.data(), ns, nav);
 
-    trace(4, "x(0)=");
-    tracemat(4, rtk->x, 1, NR_RTK(opt), 13, 4);
+    TRACE_RTK(4, "x(0)=");
+    TRACEMAT_RTK(4, rtk->x, 1, NR_RTK(opt), 13, 4);
 
     xp = mat(rtk->nx, 1);
     Pp = zeros(rtk->nx, rtk->nx);
@@ -2479,8 +2479,8 @@ int relpos(rtk_t *rtk, const obsd_t *obs, int nu, int nr,
                     stat = SOLQ_NONE;
                     break;
                 }
-            trace(4, "x(%d)=", i + 1);
-            tracemat(4, xp, 1, NR_RTK(opt), 13, 4);
+            TRACE_RTK(4, "x(%d)=", i + 1);
+            TRACEMAT_RTK(4, xp, 1, NR_RTK(opt), 13, 4);
         }
     if (stat != SOLQ_NONE && zdres(0, obs, nu, rs, dts, svh.data(), nav, xp, opt, 0, y, e, azel))
         {
@@ -2619,19 +2619,19 @@ int relpos(rtk_t *rtk, const obsd_t *obs, int nu, int nr,
                         }
                 }
         }
-    free(rs);
-    free(dts);
-    free(var);
-    free(y);
-    free(e);
-    free(azel);
-    free(xp);
-    free(Pp);
-    free(xa);
-    free(v);
-    free(H);
-    free(R);
-    free(bias);
+    matfree(rs);
+    matfree(dts);
+    matfree(var);
+    matfree(y);
+    matfree(e);
+    matfree(azel);
+    matfree(xp);
+    matfree(Pp);
+    matfree(xa);
+    matfree(v);
+    matfree(H);
+    matfree(R);
+    matfree(bias);
 
     if (stat != SOLQ_NONE)
         {
@@ -2655,7 +2655,7 @@ void rtkinit(rtk_t *rtk, const prcopt_t *opt)
     ssat_t ssat0 = {0, 0, {0.0}, {0.0}, {0.0}, {'0'}, {'0'}, {'0'}, {'0'}, {'0'}, {}, {}, {}, {}, 0.0, 0.0, 0.0, 0.0, {{{0, 0}}, {{0, 0}}}, {{}, {}}};
     int i;
 
-    trace(3, "rtkinit :\n");
+    TRACE_RTK(3, "rtkinit :\n");
 
     rtk->sol = sol0;
     for (i = 0; i < 6; i++)
@@ -2690,16 +2690,16 @@ void rtkinit(rtk_t *rtk, const prcopt_t *opt)
  *-----------------------------------------------------------------------------*/
 void rtkfree(rtk_t *rtk)
 {
-    trace(3, "rtkfree :\n");
+    TRACE_RTK(3, "rtkfree :\n");
 
     rtk->nx = rtk->na = 0;
-    free(rtk->x);
+    matfree(rtk->x);
     rtk->x = nullptr;
-    free(rtk->P);
+    matfree(rtk->P);
     rtk->P = nullptr;
-    free(rtk->xa);
+    matfree(rtk->xa);
     rtk->xa = nullptr;
-    free(rtk->Pa);
+    matfree(rtk->Pa);
     rtk->Pa = nullptr;
 }
 
@@ -2772,9 +2772,9 @@ int rtkpos(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
     int nr;
     char msg[128] = "";
 
-    trace(3, "rtkpos  : time=%s n=%d\n", time_str(obs[0].time, 3), n);
-    trace(4, "obs=\n");
-    traceobs(4, obs, n);
+    TRACE_RTK(3, "rtkpos  : time=%s n=%d\n", time_str(obs[0].time, 3), n);
+    TRACE_RTK(4, "obs=\n");
+    TRACEOBS_RTK(4, obs, n);
     /*trace(5,"nav=\n"); tracenav(5,nav);*/
 
     /* set base station position */
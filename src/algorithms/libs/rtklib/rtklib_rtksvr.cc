@@ -70,7 +70,7 @@ void writesol(rtksvr_t *svr, int index)
     int i;
     int n;
 
-    tracet(4, "writesol: index=%d\n", index);
+    TRACET_RTK(4, "writesol: index=%d\n", index);
 
     for (i = 0; i < 2; i++)
         {
@@ -178,7 +178,7 @@ void updatesvr(rtksvr_t *svr, int ret, obs_t *obs, nav_t *nav, int sat,
     int sys;
     int iode;
 
-    tracet(4, "updatesvr: ret=%d sat=%2d index=%d\n", ret, sat, index);
+    TRACET_RTK(4, "updatesvr: ret=%d sat=%2d index=%d\n", ret, sat, index);
 
     if (ret == 1)
         { /* observation data */
@@ -382,7 +382,7 @@ int decoderaw(rtksvr_t *svr, int index)
     int sat;
     int fobs = 0;
 
-    tracet(4, "decoderaw: index=%d\n", index);
+    TRACET_RTK(4, "decoderaw: index=%d\n", index);
 
     rtksvrlock(svr);
 
@@ -415,7 +415,7 @@ int decoderaw(rtksvr_t *svr, int index)
 #if 0 /* record for receiving tick */
             if (ret == 1)
                 {
-                    trace(0, "%d %10d T=%s NS=%2d\n", index, tickget(),
+                    TRACE_RTK(0, "%d %10d T=%s NS=%2d\n", index, tickget(),
                             time_str(obs->data[0].time, 0), obs->n);
                 }
 #endif
@@ -453,7 +453,7 @@ void decodefile(rtksvr_t *svr, int index)
     char file[1024];
     int nb;
 
-    tracet(4, "decodefile: index=%d\n", index);
+    TRACET_RTK(4, "decodefile: index=%d\n", index);
 
     rtksvrlock(svr);
 
@@ -476,7 +476,7 @@ void decodefile(rtksvr_t *svr, int index)
             readsp3(file, &nav, 0);
             if (nav.ne <= 0)
                 {
-                    tracet(1, "sp3 file read error: %s\n", file);
+                    TRACET_RTK(1, "sp3 file read error: %s\n", file);
                     return;
                 }
             /* update precise ephemeris */
@@ -499,7 +499,7 @@ void decodefile(rtksvr_t *svr, int index)
             /* read rinex clock */  // Disabled!!
             if (true /*readrnxc(file, &nav)<=0 */)
                 {
-                    tracet(1, "rinex clock file read error: %s\n", file);
+                    TRACET_RTK(1, "rinex clock file read error: %s\n", file);
                     return;
                 }
             /* update precise clock */
@@ -537,7 +537,7 @@ void *rtksvrthread(void *arg)
     int cycle;
     int cputime;
 
-    tracet(3, "rtksvrthread:\n");
+    TRACET_RTK(3, "rtksvrthread:\n");
 
     svr->state = 1;
     obs.data = data;
@@ -688,7 +688,7 @@ int rtksvrinit(rtksvr_t *svr)
     int i;
     int j;
 
-    tracet(3, "rtksvrinit:\n");
+    TRACET_RTK(3, "rtksvrinit:\n");
 
     svr->state = svr->cycle = svr->nmeacycle = svr->nmeareq = 0;
     for (i = 0; i < 3; i++)
@@ -753,12 +753,13 @@ int rtksvrinit(rtksvr_t *svr)
     svr->tick = 0;
     svr->thread = 0;  // NOLINT
     svr->cputime = svr->prcout = 0;
+    svr->nav.orbits = nullptr;
 
     if (!(svr->nav.eph = static_cast<eph_t *>(malloc(sizeof(eph_t) * MAXSAT * 2))) ||
         !(svr->nav.geph = static_cast<geph_t *>(malloc(sizeof(geph_t) * NSATGLO * 2))) ||
         !(svr->nav.seph = static_cast<seph_t *>(malloc(sizeof(seph_t) * NSATSBS * 2))))
         {
-            tracet(1, "rtksvrinit: malloc error\n");
+            TRACET_RTK(1, "rtksvrinit: malloc error\n");
             return 0;
         }
     for (i = 0; i < MAXSAT * 2; i++)
@@ -783,7 +784,7 @@ int rtksvrinit(rtksvr_t *svr)
                 {
                     if (!(svr->obs[i][j].data = static_cast<obsd_t *>(malloc(sizeof(obsd_t) * MAXOBS))))
                         {
-                            tracet(1, "rtksvrinit: malloc error\n");
+                            TRACET_RTK(1, "rtksvrinit: malloc error\n");
                             return 0;
                         }
                 }
@@ -817,6 +818,7 @@ void rtksvrfree(rtksvr_t *svr)
     free(svr->nav.eph);
     free(svr->nav.geph);
     free(svr->nav.seph);
+    svr->nav.orbits = nullptr; /* the orbit cache is not owned by the server */
     for (i = 0; i < 3; i++)
         {
             for (j = 0; j < MAXOBSBUF; j++)
@@ -889,7 +891,7 @@ int rtksvrstart(rtksvr_t *svr, int cycle, int buffsize, int *strs,
     int j;
     int rw;
 
-    tracet(3, "rtksvrstart: cycle=%d buffsize=%d navsel=%d nmeacycle=%d nmeareq=%d\n",
+    TRACET_RTK(3, "rtksvrstart: cycle=%d buffsize=%d navsel=%d nmeacycle=%d nmeareq=%d\n",
         cycle, buffsize, navsel, nmeacycle, nmeareq);
 
     if (svr->state)
@@ -923,7 +925,7 @@ int rtksvrstart(rtksvr_t *svr, int cycle, int buffsize, int *strs,
             if (!(svr->buff[i] = static_cast<unsigned char *>(malloc(buffsize))) ||
                 !(svr->pbuf[i] = static_cast<unsigned char *>(malloc(buffsize))))
                 {
-                    tracet(1, "rtksvrstart: malloc error\n");
+                    TRACET_RTK(1, "rtksvrstart: malloc error\n");
                     return 0;
                 }
             for (j = 0; j < 10; j++)
@@ -958,7 +960,7 @@ int rtksvrstart(rtksvr_t *svr, int cycle, int buffsize, int *strs,
         { /* output peek buffer */
             if (!(svr->sbuf[i] = static_cast<unsigned char *>(malloc(buffsize))))
                 {
-                    tracet(1, "rtksvrstart: malloc error\n");
+                    TRACET_RTK(1, "rtksvrstart: malloc error\n");
                     return 0;
                 }
         }
@@ -1057,7 +1059,7 @@ void rtksvrstop(rtksvr_t *svr, char **cmds)
 {
     int i;
 
-    tracet(3, "rtksvrstop:\n");
+    TRACET_RTK(3, "rtksvrstop:\n");
 
     /* write stop commands to input streams */
     rtksvrlock(svr);
@@ -1092,7 +1094,7 @@ void rtksvrstop(rtksvr_t *svr, char **cmds)
 int rtksvropenstr(rtksvr_t *svr, int index, int str, const char *path,
     const solopt_t *solopt)
 {
-    tracet(3, "rtksvropenstr: index=%d str=%d path=%s\n", index, str, path);
+    TRACET_RTK(3, "rtksvropenstr: index=%d str=%d path=%s\n", index, str, path);
 
     if (index < 3 || index > 7 || !svr->state)
         {
@@ -1108,7 +1110,7 @@ int rtksvropenstr(rtksvr_t *svr, int index, int str, const char *path,
         }
     if (!stropen(svr->stream + index, str, STR_MODE_W, path))
         {
-            tracet(2, "stream open error: index=%d\n", index);
+            TRACET_RTK(2, "stream open error: index=%d\n", index);
             rtksvrunlock(svr);
             return 0;
         }
@@ -1134,7 +1136,7 @@ int rtksvropenstr(rtksvr_t *svr, int index, int str, const char *path,
  *-----------------------------------------------------------------------------*/
 void rtksvrclosestr(rtksvr_t *svr, int index)
 {
-    tracet(3, "rtksvrclosestr: index=%d\n", index);
+    TRACET_RTK(3, "rtksvrclosestr: index=%d\n", index);
 
     if (index < 3 || index > 7 || !svr->state)
         {
@@ -1169,7 +1171,7 @@ int rtksvrostat(rtksvr_t *svr, int rcv, gtime_t *time, int *sat,
     int j;
     int ns;
 
-    tracet(4, "rtksvrostat: rcv=%d\n", rcv);
+    TRACET_RTK(4, "rtksvrostat: rcv=%d\n", rcv);
 
     if (!svr->state)
         {
@@ -1217,7 +1219,7 @@ void rtksvrsstat(rtksvr_t *svr, int *sstat, char *msg)
     char s[MAXSTRMSG];
     char *p = msg;
 
-    tracet(4, "rtksvrsstat:\n");
+    TRACET_RTK(4, "rtksvrsstat:\n");
 
     rtksvrlock(svr);
     for (i = 0; i < MAXSTRRTK; i++)
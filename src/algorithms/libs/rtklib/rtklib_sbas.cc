@@ -95,7 +95,7 @@ int decode_sbstype1(const sbsmsg_t *msg, sbssat_t *sbssat)
     int n;
     int sat;
 
-    trace(4, "decode_sbstype1:\n");
+    TRACE_RTK(4, "decode_sbstype1:\n");
 
     for (i = 1, n = 0; i <= 210 && n < MAXSAT; i++)
         {
@@ -139,7 +139,7 @@ int decode_sbstype1(const sbsmsg_t *msg, sbssat_t *sbssat)
     sbssat->iodp = getbitu(msg->msg, 224, 2);
     sbssat->nsat = n;
 
-    trace(5, "decode_sbstype1: nprn=%d iodp=%d\n", n, sbssat->iodp);
+    TRACE_RTK(5, "decode_sbstype1: nprn=%d iodp=%d\n", n, sbssat->iodp);
     return 1;
 }
 
@@ -156,7 +156,7 @@ int decode_sbstype2(const sbsmsg_t *msg, sbssat_t *sbssat)
     double dt;
     gtime_t t0;
 
-    trace(4, "decode_sbstype2:\n");
+    TRACE_RTK(4, "decode_sbstype2:\n");
 
     if (sbssat->iodp != static_cast<int>(getbitu(msg->msg, 16, 2)))
         {
@@ -191,7 +191,7 @@ int decode_sbstype2(const sbsmsg_t *msg, sbssat_t *sbssat)
                 }
             sbssat->sat[j].fcorr.iodf = iodf;
         }
-    trace(5, "decode_sbstype2: type=%d iodf=%d\n", type, iodf);
+    TRACE_RTK(5, "decode_sbstype2: type=%d iodf=%d\n", type, iodf);
     return 1;
 }
 
@@ -203,7 +203,7 @@ int decode_sbstype6(const sbsmsg_t *msg, sbssat_t *sbssat)
     int iodf[4];
     int udre;
 
-    trace(4, "decode_sbstype6:\n");
+    TRACE_RTK(4, "decode_sbstype6:\n");
 
     for (i = 0; i < 4; i++)
         {
@@ -218,7 +218,7 @@ int decode_sbstype6(const sbsmsg_t *msg, sbssat_t *sbssat)
             udre = getbitu(msg->msg, 22 + i * 4, 4);
             sbssat->sat[i].fcorr.udre = udre + 1;
         }
-    trace(5, "decode_sbstype6: iodf=%d %d %d %d\n", iodf[0], iodf[1], iodf[2], iodf[3]);
+    TRACE_RTK(5, "decode_sbstype6: iodf=%d %d %d %d\n", iodf[0], iodf[1], iodf[2], iodf[3]);
     return 1;
 }
 
@@ -228,7 +228,7 @@ int decode_sbstype7(const sbsmsg_t *msg, sbssat_t *sbssat)
 {
     int i;
 
-    trace(4, "decode_sbstype7\n");
+    TRACE_RTK(4, "decode_sbstype7\n");
 
     if (sbssat->iodp != static_cast<int>(getbitu(msg->msg, 18, 2)))
         {
@@ -253,11 +253,11 @@ int decode_sbstype9(const sbsmsg_t *msg, nav_t *nav)
     int sat;
     int t;
 
-    trace(4, "decode_sbstype9:\n");
+    TRACE_RTK(4, "decode_sbstype9:\n");
 
     if (!(sat = satno(SYS_SBS, msg->prn)))
         {
-            trace(2, "invalid prn in sbas type 9: prn=%3d\n", msg->prn);
+            TRACE_RTK(2, "invalid prn in sbas type 9: prn=%3d\n", msg->prn);
             return 0;
         }
     t = static_cast<int>(getbitu(msg->msg, 22, 13)) * 16 - msg->tow % 86400;
@@ -296,7 +296,7 @@ int decode_sbstype9(const sbsmsg_t *msg, nav_t *nav)
     nav->seph[NSATSBS + i] = nav->seph[i]; /* previous */
     nav->seph[i] = seph;                   /* current */
 
-    trace(5, "decode_sbstype9: prn=%d\n", msg->prn);
+    TRACE_RTK(5, "decode_sbstype9: prn=%d\n", msg->prn);
     return 1;
 }
 
@@ -311,7 +311,7 @@ int decode_sbstype18(const sbsmsg_t *msg, sbsion_t *sbsion)
     int m;
     int band = getbitu(msg->msg, 18, 4);
 
-    trace(4, "decode_sbstype18:\n");
+    TRACE_RTK(4, "decode_sbstype18:\n");
 
     if (0 <= band && band <= 8)
         {
@@ -349,7 +349,7 @@ int decode_sbstype18(const sbsmsg_t *msg, sbsion_t *sbsion)
         }
     sbsion[band].nigp = n;
 
-    trace(5, "decode_sbstype18: band=%d nigp=%d\n", band, n);
+    TRACE_RTK(5, "decode_sbstype18: band=%d nigp=%d\n", band, n);
     return 1;
 }
 
@@ -360,7 +360,7 @@ int decode_longcorr0(const sbsmsg_t *msg, int p, sbssat_t *sbssat)
     int i;
     int n = getbitu(msg->msg, p, 6);
 
-    trace(4, "decode_longcorr0:\n");
+    TRACE_RTK(4, "decode_longcorr0:\n");
 
     if (n == 0 || n > MAXSAT)
         {
@@ -378,7 +378,7 @@ int decode_longcorr0(const sbsmsg_t *msg, int p, sbssat_t *sbssat)
     sbssat->sat[n - 1].lcorr.daf1 = 0.0;
     sbssat->sat[n - 1].lcorr.t0 = gpst2time(msg->week, msg->tow);
 
-    trace(5, "decode_longcorr0:sat=%2d\n", sbssat->sat[n - 1].sat);
+    TRACE_RTK(5, "decode_longcorr0:sat=%2d\n", sbssat->sat[n - 1].sat);
     return 1;
 }
 
@@ -390,7 +390,7 @@ int decode_longcorr1(const sbsmsg_t *msg, int p, sbssat_t *sbssat)
     int n = getbitu(msg->msg, p, 6);
     int t;
 
-    trace(4, "decode_longcorr1:\n");
+    TRACE_RTK(4, "decode_longcorr1:\n");
 
     if (n == 0 || n > MAXSAT)
         {
@@ -417,7 +417,7 @@ int decode_longcorr1(const sbsmsg_t *msg, int p, sbssat_t *sbssat)
         }
     sbssat->sat[n - 1].lcorr.t0 = gpst2time(msg->week, msg->tow + t);
 
-    trace(5, "decode_longcorr1: sat=%2d\n", sbssat->sat[n - 1].sat);
+    TRACE_RTK(5, "decode_longcorr1: sat=%2d\n", sbssat->sat[n - 1].sat);
     return 1;
 }
 
@@ -425,7 +425,7 @@ int decode_longcorr1(const sbsmsg_t *msg, int p, sbssat_t *sbssat)
 /* decode half long term correction ------------------------------------------*/
 int decode_longcorrh(const sbsmsg_t *msg, int p, sbssat_t *sbssat)
 {
-    trace(4, "decode_longcorrh:\n");
+    TRACE_RTK(4, "decode_longcorrh:\n");
 
     if (getbitu(msg->msg, p, 1) == 0)
         { /* vel code=0 */
@@ -452,7 +452,7 @@ int decode_sbstype24(const sbsmsg_t *msg, sbssat_t *sbssat)
     int blk;
     int udre;
 
-    trace(4, "decode_sbstype24:\n");
+    TRACE_RTK(4, "decode_sbstype24:\n");
 
     if (sbssat->iodp != static_cast<int>(getbitu(msg->msg, 110, 2)))
         {
@@ -482,7 +482,7 @@ int decode_sbstype24(const sbsmsg_t *msg, sbssat_t *sbssat)
 /* decode type 25: long term satellite error correction ----------------------*/
 int decode_sbstype25(const sbsmsg_t *msg, sbssat_t *sbssat)
 {
-    trace(4, "decode_sbstype25:\n");
+    TRACE_RTK(4, "decode_sbstype25:\n");
 
     return decode_longcorrh(msg, 14, sbssat) && decode_longcorrh(msg, 120, sbssat);
 }
@@ -498,7 +498,7 @@ int decode_sbstype26(const sbsmsg_t *msg, sbsion_t *sbsion)
     int give;
     int band = getbitu(msg->msg, 14, 4);
 
-    trace(4, "decode_sbstype26:\n");
+    TRACE_RTK(4, "decode_sbstype26:\n");
 
     if (band > MAXBAND || sbsion[band].iodi != static_cast<int>(getbitu(msg->msg, 217, 2)))
         {
@@ -525,7 +525,7 @@ int decode_sbstype26(const sbsmsg_t *msg, sbsion_t *sbsion)
                     sbsion[band].igp[j].give = 0;
                 }
         }
-    trace(5, "decode_sbstype26: band=%d block=%d\n", band, block);
+    TRACE_RTK(5, "decode_sbstype26: band=%d block=%d\n", band, block);
     return 1;
 }
 
@@ -544,7 +544,7 @@ int sbsupdatecorr(const sbsmsg_t *msg, nav_t *nav)
     int type = getbitu(msg->msg, 8, 6);
     int stat = -1;
 
-    trace(3, "sbsupdatecorr: type=%d\n", type);
+    TRACE_RTK(3, "sbsupdatecorr: type=%d\n", type);
 
     if (msg->week == 0)
         {
@@ -613,11 +613,11 @@ void readmsgs(const char *file, int sel, gtime_t ts, gtime_t te,
     gtime_t time;
     FILE *fp;
 
-    trace(3, "readmsgs: file=%s sel=%d\n", file, sel);
+    TRACE_RTK(3, "readmsgs: file=%s sel=%d\n", file, sel);
 
     if (!(fp = fopen(file, "re")))
         {
-            trace(2, "sbas message file open error: %s\n", file);
+            TRACE_RTK(2, "sbas message file open error: %s\n", file);
             return;
         }
     while (fgets(buff, sizeof(buff), fp))
@@ -698,7 +698,7 @@ void readmsgs(const char *file, int sel, gtime_t ts, gtime_t te,
                     sbs->nmax = sbs->nmax == 0 ? 1024 : sbs->nmax * 2;
                     if (!(sbs_msgs = static_cast<sbsmsg_t *>(realloc(sbs->msgs, sbs->nmax * sizeof(sbsmsg_t)))))
                         {
-                            trace(1, "readsbsmsg malloc error: nmax=%d\n", sbs->nmax);
+                            TRACE_RTK(1, "readsbsmsg malloc error: nmax=%d\n", sbs->nmax);
                             free(sbs->msgs);
                             sbs->msgs = nullptr;
                             sbs->n = sbs->nmax = 0;
@@ -759,7 +759,7 @@ int sbsreadmsgt(const char *file, int sel, gtime_t ts, gtime_t te,
     int i;
     int n;
 
-    trace(3, "sbsreadmsgt: file=%s sel=%d\n", file, sel);
+    TRACE_RTK(3, "sbsreadmsgt: file=%s sel=%d\n", file, sel);
 
     for (i = 0; i < MAXEXFILE; i++)
         {
@@ -808,7 +808,7 @@ int sbsreadmsg(const char *file, int sel, sbs_t *sbs)
     gtime_t ts = {0, 0};
     gtime_t te = {0, 0};
 
-    trace(3, "sbsreadmsg: file=%s sel=%d\n", file, sel);
+    TRACE_RTK(3, "sbsreadmsg: file=%s sel=%d\n", file, sel);
 
     return sbsreadmsgt(file, sel, ts, te, sbs);
 }
@@ -825,7 +825,7 @@ void sbsoutmsg(FILE *fp, sbsmsg_t *sbsmsg)
     int i;
     int type = sbsmsg->msg[1] >> 2;
 
-    trace(4, "sbsoutmsg:\n");
+    TRACE_RTK(4, "sbsoutmsg:\n");
 
     fprintf(fp, "%4d %6d %3d %2d : ", sbsmsg->week, sbsmsg->tow, sbsmsg->prn, type);
     for (i = 0; i < 29; i++)
@@ -847,7 +847,7 @@ void searchigp(gtime_t time __attribute__((unused)), const double *pos, const sb
     double lon = pos[1] * R2D;
     const sbsigp_t *p;
 
-    trace(4, "searchigp: pos=%.3f %.3f\n", pos[0] * R2D, pos[1] * R2D);
+    TRACE_RTK(4, "searchigp: pos=%.3f %.3f\n", pos[0] * R2D, pos[1] * R2D);
 
     if (lon >= 180.0)
         {
@@ -963,7 +963,7 @@ int sbsioncorr(gtime_t time, const nav_t *nav, const double *pos,
     double w[4] = {};
     const sbsigp_t *igp[4] = {}; /* {ws,wn,es,en} */
 
-    trace(4, "sbsioncorr: pos=%.3f %.3f azel=%.3f %.3f\n", pos[0] * R2D, pos[1] * R2D,
+    TRACE_RTK(4, "sbsioncorr: pos=%.3f %.3f azel=%.3f %.3f\n", pos[0] * R2D, pos[1] * R2D,
         azel[0] * R2D, azel[1] * R2D);
 
     *delay = *var = 0.0;
@@ -1029,7 +1029,7 @@ int sbsioncorr(gtime_t time, const nav_t *nav, const double *pos,
 
     if (err)
         {
-            trace(2, "no sbas iono correction: lat=%3.0f lon=%4.0f\n", posp[0] * R2D,
+            TRACE_RTK(2, "no sbas iono correction: lat=%3.0f lon=%4.0f\n", posp[0] * R2D,
                 posp[1] * R2D);
             return 0;
         }
@@ -1046,7 +1046,7 @@ int sbsioncorr(gtime_t time, const nav_t *nav, const double *pos,
     *delay *= fp;
     *var *= fp * fp;
 
-    trace(5, "sbsioncorr: dion=%7.2f sig=%7.2f\n", *delay, sqrt(*var));
+    TRACE_RTK(5, "sbsioncorr: dion=%7.2f sig=%7.2f\n", *delay, sqrt(*var));
     return 1;
 }
 
@@ -1116,7 +1116,7 @@ double sbstropcorr(gtime_t time, const double *pos, const double *azel,
     double h = pos[2];
     double m;
 
-    trace(4, "sbstropcorr: pos=%.3f %.3f azel=%.3f %.3f\n", pos[0] * R2D, pos[1] * R2D,
+    TRACE_RTK(4, "sbstropcorr: pos=%.3f %.3f azel=%.3f %.3f\n", pos[0] * R2D, pos[1] * R2D,
         azel[0] * R2D, azel[1] * R2D);
 
     if (pos[2] < -100.0 || 10000.0 < pos[2] || azel[1] <= 0)
@@ -1156,7 +1156,7 @@ int sbslongcorr(gtime_t time, int sat, const sbssat_t *sbssat,
     double t;
     int i;
 
-    trace(3, "sbslongcorr: sat=%2d\n", sat);
+    TRACE_RTK(3, "sbslongcorr: sat=%2d\n", sat);
 
     for (p = sbssat->sat; p < sbssat->sat + sbssat->nsat; p++)
         {
@@ -1167,7 +1167,7 @@ int sbslongcorr(gtime_t time, int sat, const sbssat_t *sbssat,
             t = timediff(time, p->lcorr.t0);
             if (fabs(t) > MAXSBSAGEL)
                 {
-                    trace(2, "sbas long-term correction expired: %s sat=%2d t=%5.0f\n",
+                    TRACE_RTK(2, "sbas long-term correction expired: %s sat=%2d t=%5.0f\n",
                         time_str(time, 0), sat, t);
                     return 0;
                 }
@@ -1177,7 +1177,7 @@ int sbslongcorr(gtime_t time, int sat, const sbssat_t *sbssat,
                 }
             *ddts = p->lcorr.daf0 + p->lcorr.daf1 * t;
 
-            trace(5, "sbslongcorr: sat=%2d drs=%7.2f%7.2f%7.2f ddts=%7.2f\n",
+            TRACE_RTK(5, "sbslongcorr: sat=%2d drs=%7.2f%7.2f%7.2f ddts=%7.2f\n",
                 sat, drs[0], drs[1], drs[2], *ddts * SPEED_OF_LIGHT_M_S);
 
             return 1;
@@ -1188,7 +1188,7 @@ int sbslongcorr(gtime_t time, int sat, const sbssat_t *sbssat,
             return 1;
         }
 
-    trace(2, "no sbas long-term correction: %s sat=%2d\n", time_str(time, 0), sat);
+    TRACE_RTK(2, "no sbas long-term correction: %s sat=%2d\n", time_str(time, 0), sat);
     return 0;
 }
 
@@ -1200,7 +1200,7 @@ int sbsfastcorr(gtime_t time, int sat, const sbssat_t *sbssat,
     const sbssatp_t *p;
     double t;
 
-    trace(3, "sbsfastcorr: sat=%2d\n", sat);
+    TRACE_RTK(3, "sbsfastcorr: sat=%2d\n", sat);
 
     for (p = sbssat->sat; p < sbssat->sat + sbssat->nsat; p++)
         {
@@ -1228,11 +1228,11 @@ int sbsfastcorr(gtime_t time, int sat, const sbssat_t *sbssat,
 #endif
             *var = varfcorr(p->fcorr.udre) + degfcorr(p->fcorr.ai) * t * t / 2.0;
 
-            trace(5, "sbsfastcorr: sat=%3d prc=%7.2f sig=%7.2f t=%5.0f\n", sat,
+            TRACE_RTK(5, "sbsfastcorr: sat=%3d prc=%7.2f sig=%7.2f t=%5.0f\n", sat,
                 *prc, sqrt(*var), t);
             return 1;
         }
-    trace(2, "no sbas fast correction: %s sat=%2d\n", time_str(time, 0), sat);
+    TRACE_RTK(2, "no sbas fast correction: %s sat=%2d\n", time_str(time, 0), sat);
     return 0;
 }
 
@@ -1262,7 +1262,7 @@ int sbssatcorr(gtime_t time, int sat, const nav_t *nav, double *rs,
     double prc = 0.0;
     int i;
 
-    trace(3, "sbssatcorr : sat=%2d\n", sat);
+    TRACE_RTK(3, "sbssatcorr : sat=%2d\n", sat);
 
     /* sbas long term corrections */
     if (!sbslongcorr(time, sat, &nav->sbssat, drs, &dclk))
@@ -1281,7 +1281,7 @@ int sbssatcorr(gtime_t time, int sat, const nav_t *nav, double *rs,
 
     dts[0] += dclk + prc / SPEED_OF_LIGHT_M_S;
 
-    trace(5, "sbssatcorr: sat=%2d drs=%6.3f %6.3f %6.3f dclk=%.3f %.3f var=%.3f\n",
+    TRACE_RTK(5, "sbssatcorr: sat=%2d drs=%6.3f %6.3f %6.3f dclk=%.3f %.3f var=%.3f\n",
         sat, drs[0], drs[1], drs[2], dclk, prc / SPEED_OF_LIGHT_M_S, *var);
 
     return 1;
@@ -1304,7 +1304,7 @@ int sbsdecodemsg(gtime_t time, int prn, const unsigned int *words,
     unsigned char f[29];
     double tow;
 
-    trace(5, "sbsdecodemsg: prn=%d\n", prn);
+    TRACE_RTK(5, "sbsdecodemsg: prn=%d\n", prn);
 
     if (time.time == 0)
         {
@@ -166,7 +166,7 @@ int decode_nmearmc(char **val, int n, sol_t *sol)
     char mode = 'A';
     int i;
 
-    trace(4, "decode_nmearmc: n=%d\n", n);
+    TRACE_RTK(4, "decode_nmearmc: n=%d\n", n);
 
     for (i = 0; i < n; i++)
         {
@@ -214,7 +214,7 @@ int decode_nmearmc(char **val, int n, sol_t *sol)
         }
     if ((act != 'A' && act != 'V') || (ns != 'N' && ns != 'S') || (ew != 'E' && ew != 'W'))
         {
-            trace(2, "invalid nmea gprmc format\n");
+            TRACE_RTK(2, "invalid nmea gprmc format\n");
             return 0;
         }
     pos[0] = (ns == 'S' ? -1.0 : 1.0) * dmm2deg(lat) * D2R;
@@ -229,7 +229,7 @@ int decode_nmearmc(char **val, int n, sol_t *sol)
 
     sol->type = 0; /* position type = xyz */
 
-    trace(5, "decode_nmearmc: %s rr=%.3f %.3f %.3f stat=%d ns=%d vel=%.2f dir=%.0f ang=%.0f mew=%c mode=%c\n",
+    TRACE_RTK(5, "decode_nmearmc: %s rr=%.3f %.3f %.3f stat=%d ns=%d vel=%.2f dir=%.0f ang=%.0f mew=%c mode=%c\n",
         time_str(sol->time, 0), sol->rr[0], sol->rr[1], sol->rr[2], sol->stat, sol->ns,
         vel, dir, ang, mew, mode);
 
@@ -258,7 +258,7 @@ int decode_nmeagga(char **val, int n, sol_t *sol)
     int solq = 0;
     int nrcv = 0;
 
-    trace(4, "decode_nmeagga: n=%d\n", n);
+    TRACE_RTK(4, "decode_nmeagga: n=%d\n", n);
 
     for (i = 0; i < n; i++)
         {
@@ -304,12 +304,12 @@ int decode_nmeagga(char **val, int n, sol_t *sol)
         }
     if ((ns != 'N' && ns != 'S') || (ew != 'E' && ew != 'W'))
         {
-            trace(2, "invalid nmea gpgga format\n");
+            TRACE_RTK(2, "invalid nmea gpgga format\n");
             return 0;
         }
     if (sol->time.time == 0.0)
         {
-            trace(2, "no date info for nmea gpgga\n");
+            TRACE_RTK(2, "no date info for nmea gpgga\n");
             return 0;
         }
     pos[0] = (ns == 'N' ? 1.0 : -1.0) * dmm2deg(lat) * D2R;
@@ -338,7 +338,7 @@ int decode_nmeagga(char **val, int n, sol_t *sol)
 
     sol->type = 0; /* position type = xyz */
 
-    trace(5, "decode_nmeagga: %s rr=%.3f %.3f %.3f stat=%d ns=%d hdop=%.1f ua=%c um=%c\n",
+    TRACE_RTK(5, "decode_nmeagga: %s rr=%.3f %.3f %.3f stat=%d ns=%d hdop=%.1f ua=%c um=%c\n",
         time_str(sol->time, 0), sol->rr[0], sol->rr[1], sol->rr[2], sol->stat, sol->ns,
         hdop, ua, um);
 
@@ -354,7 +354,7 @@ int decode_nmea(char *buff, sol_t *sol)
     char *val[MAXFIELD] = {nullptr};
     int n = 0;
 
-    trace(4, "decode_nmea: buff=%s\n", buff);
+    TRACE_RTK(4, "decode_nmea: buff=%s\n", buff);
 
     /* parse fields */
     for (p = buff; *p && n < MAXFIELD; p = q + 1)
@@ -395,7 +395,7 @@ char *decode_soltime(char *buff, const solopt_t *opt, gtime_t *time)
     int n;
     int len;
 
-    trace(4, "decode_soltime:\n");
+    TRACE_RTK(4, "decode_soltime:\n");
 
     if (!strcmp(opt->sep, "\\t"))
         {
@@ -485,7 +485,7 @@ int decode_solxyz(char *buff, const solopt_t *opt, sol_t *sol)
     int n;
     const char *sep = opt2sep(opt);
 
-    trace(4, "decode_solxyz:\n");
+    TRACE_RTK(4, "decode_solxyz:\n");
 
     if ((n = tonum(buff, sep, val)) < 3)
         {
@@ -553,7 +553,7 @@ int decode_solllh(char *buff, const solopt_t *opt, sol_t *sol)
     int n;
     const char *sep = opt2sep(opt);
 
-    trace(4, "decode_solllh:\n");
+    TRACE_RTK(4, "decode_solllh:\n");
 
     n = tonum(buff, sep, val);
 
@@ -636,7 +636,7 @@ int decode_solenu(char *buff, const solopt_t *opt, sol_t *sol)
     int n;
     const char *sep = opt2sep(opt);
 
-    trace(4, "decode_solenu:\n");
+    TRACE_RTK(4, "decode_solenu:\n");
 
     if ((n = tonum(buff, sep, val)) < 3)
         {
@@ -700,7 +700,7 @@ int decode_solgsi(char *buff, const solopt_t *opt __attribute((unused)), sol_t *
     int i = 0;
     int j;
 
-    trace(4, "decode_solgsi:\n");
+    TRACE_RTK(4, "decode_solgsi:\n");
 
     if (tonum(buff, " ", val) < 3)
         {
@@ -722,7 +722,7 @@ int decode_solpos(char *buff, const solopt_t *opt, sol_t *sol)
     sol_t sol0 = {{0, 0}, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}, '0', '0', '0', 0, 0, 0};
     char *p = buff;
 
-    trace(4, "decode_solpos: buff=%s\n", buff);
+    TRACE_RTK(4, "decode_solpos: buff=%s\n", buff);
 
     *sol = sol0;
 
@@ -756,7 +756,7 @@ void decode_refpos(char *buff, const solopt_t *opt, double *rb)
     int n;
     const char *sep = opt2sep(opt);
 
-    trace(3, "decode_refpos: buff=%s\n", buff);
+    TRACE_RTK(3, "decode_refpos: buff=%s\n", buff);
 
     if ((n = tonum(buff, sep, val)) < 3)
         {
@@ -792,7 +792,7 @@ int decode_sol(char *buff, const solopt_t *opt, sol_t *sol, double *rb)
 {
     char *p;
 
-    trace(4, "decode_sol: buff=%s\n", buff);
+    TRACE_RTK(4, "decode_sol: buff=%s\n", buff);
 
     if (!strncmp(buff, COMMENTH, 1))
         { /* reference position */
@@ -836,7 +836,7 @@ void decode_solopt(char *buff, solopt_t *opt)
 {
     char *p;
 
-    trace(4, "decode_solhead: buff=%s\n", buff);
+    TRACE_RTK(4, "decode_solhead: buff=%s\n", buff);
 
     if (strncmp(buff, COMMENTH, 1) != 0 && strncmp(buff, "+", 1) != 0)
         {
@@ -900,7 +900,7 @@ void readsolopt(FILE *fp, solopt_t *opt)
     char buff[MAXSOLMSG + 1];
     int i;
 
-    trace(3, "readsolopt:\n");
+    TRACE_RTK(3, "readsolopt:\n");
 
     for (i = 0; fgets(buff, sizeof(buff), fp) && i < 100; i++)
         { /* only 100 lines */
@@ -926,7 +926,7 @@ int inputsol(unsigned char data, gtime_t ts, gtime_t te, double tint,
     sol_t sol = {{0, 0}, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}, '0', '0', '0', 0, 0, 0};
     int stat;
 
-    trace(4, "inputsol: data=0x%02x\n", data);
+    TRACE_RTK(4, "inputsol: data=0x%02x\n", data);
 
     sol.time = solbuf->time;
 
@@ -946,7 +946,7 @@ int inputsol(unsigned char data, gtime_t ts, gtime_t te, double tint,
     /* check disconnect message */
     if (!strcmp(reinterpret_cast<char *>(solbuf->buff), MSG_DISCONN))
         {
-            trace(3, "disconnect received\n");
+            TRACE_RTK(3, "disconnect received\n");
             return -1;
         }
     /* decode solution */
@@ -969,7 +969,7 @@ int readsoldata(FILE *fp, gtime_t ts, gtime_t te, double tint, int qflag,
 {
     int c;
 
-    trace(3, "readsoldata:\n");
+    TRACE_RTK(3, "readsoldata:\n");
 
     while ((c = fgetc(fp)) != EOF)
         {
@@ -995,7 +995,7 @@ int sort_solbuf(solbuf_t *solbuf)
 {
     sol_t *solbuf_data;
 
-    trace(4, "sort_solbuf: n=%d\n", solbuf->n);
+    TRACE_RTK(4, "sort_solbuf: n=%d\n", solbuf->n);
 
     if (solbuf->n <= 0)
         {
@@ -1004,7 +1004,7 @@ int sort_solbuf(solbuf_t *solbuf)
 
     if (!(solbuf_data = static_cast<sol_t *>(realloc(solbuf->data, sizeof(sol_t) * solbuf->n))))
         {
-            trace(1, "sort_solbuf: memory allocation error\n");
+            TRACE_RTK(1, "sort_solbuf: memory allocation error\n");
             free(solbuf->data);
             solbuf->data = nullptr;
             solbuf->n = solbuf->nmax = 0;
@@ -1037,7 +1037,7 @@ int readsolt(char *files[], int nfile, gtime_t ts, gtime_t te,
     solopt_t opt = SOLOPT_DEFAULT;
     int i;
 
-    trace(3, "readsolt: nfile=%d\n", nfile);
+    TRACE_RTK(3, "readsolt: nfile=%d\n", nfile);
 
     initsolbuf(solbuf, 0, 0);
 
@@ -1045,7 +1045,7 @@ int readsolt(char *files[], int nfile, gtime_t ts, gtime_t te,
         {
             if (!(fp = fopen(files[i], "rbe")))
                 {
-                    trace(1, "readsolt: file open error %s\n", files[i]);
+                    TRACE_RTK(1, "readsolt: file open error %s\n", files[i]);
                     continue;
                 }
             /* read solution options in header */
@@ -1055,7 +1055,7 @@ int readsolt(char *files[], int nfile, gtime_t ts, gtime_t te,
             /* read solution data */
             if (!readsoldata(fp, ts, te, tint, qflag, &opt, solbuf))
                 {
-                    trace(1, "readsolt: no solution in %s\n", files[i]);
+                    TRACE_RTK(1, "readsolt: no solution in %s\n", files[i]);
                 }
             fclose(fp);
         }
@@ -1067,7 +1067,7 @@ int readsol(char *files[], int nfile, solbuf_t *sol)
 {
     gtime_t time = {0, 0.0};
 
-    trace(3, "readsol: nfile=%d\n", nfile);
+    TRACE_RTK(3, "readsol: nfile=%d\n", nfile);
 
     return readsolt(files, nfile, time, time, 0.0, 0, sol);
 }
@@ -1083,7 +1083,7 @@ int addsol(solbuf_t *solbuf, const sol_t *sol)
 {
     sol_t *solbuf_data;
 
-    trace(4, "addsol:\n");
+    TRACE_RTK(4, "addsol:\n");
 
     if (solbuf->cyclic)
         { /* ring buffer */
@@ -1116,7 +1116,7 @@ int addsol(solbuf_t *solbuf, const sol_t *sol)
             solbuf->nmax = solbuf->nmax == 0 ? 8192 : solbuf->nmax * 2;
             if (!(solbuf_data = static_cast<sol_t *>(realloc(solbuf->data, sizeof(sol_t) * solbuf->nmax))))
                 {
-                    trace(1, "addsol: memory allocation error\n");
+                    TRACE_RTK(1, "addsol: memory allocation error\n");
                     free(solbuf->data);
                     solbuf->data = nullptr;
                     solbuf->n = solbuf->nmax = 0;
@@ -1137,7 +1137,7 @@ int addsol(solbuf_t *solbuf, const sol_t *sol)
  *-----------------------------------------------------------------------------*/
 sol_t *getsol(solbuf_t *solbuf, int index)
 {
-    trace(4, "getsol: index=%d\n", index);
+    TRACE_RTK(4, "getsol: index=%d\n", index);
 
     if (index < 0 || solbuf->n <= index)
         {
@@ -1162,7 +1162,7 @@ void initsolbuf(solbuf_t *solbuf, int cyclic, int nmax)
 {
     gtime_t time0 = {0, 0.0};
 
-    trace(3, "initsolbuf: cyclic=%d nmax=%d\n", cyclic, nmax);
+    TRACE_RTK(3, "initsolbuf: cyclic=%d nmax=%d\n", cyclic, nmax);
 
     solbuf->n = solbuf->nmax = solbuf->start = solbuf->end = 0;
     solbuf->cyclic = cyclic;
@@ -1176,7 +1176,7 @@ void initsolbuf(solbuf_t *solbuf, int cyclic, int nmax)
                 }
             if (!(solbuf->data = static_cast<sol_t *>(malloc(sizeof(sol_t) * nmax))))
                 {
-                    trace(1, "initsolbuf: memory allocation error\n");
+                    TRACE_RTK(1, "initsolbuf: memory allocation error\n");
                     return;
                 }
             solbuf->nmax = nmax;
@@ -1191,7 +1191,7 @@ void initsolbuf(solbuf_t *solbuf, int cyclic, int nmax)
  *-----------------------------------------------------------------------------*/
 void freesolbuf(solbuf_t *solbuf)
 {
-    trace(3, "freesolbuf: n=%d\n", solbuf->n);
+    TRACE_RTK(3, "freesolbuf: n=%d\n", solbuf->n);
 
     free(solbuf->data);
     solbuf->n = solbuf->nmax = solbuf->start = solbuf->end = 0;
@@ -1201,7 +1201,7 @@ void freesolbuf(solbuf_t *solbuf)
 
 void freesolstatbuf(solstatbuf_t *solstatbuf)
 {
-    trace(3, "freesolstatbuf: n=%d\n", solstatbuf->n);
+    TRACE_RTK(3, "freesolstatbuf: n=%d\n", solstatbuf->n);
 
     solstatbuf->n = solstatbuf->nmax = 0;
     free(solstatbuf->data);
@@ -1224,7 +1224,7 @@ int sort_solstat(solstatbuf_t *statbuf)
 {
     solstat_t *statbuf_data;
 
-    trace(4, "sort_solstat: n=%d\n", statbuf->n);
+    TRACE_RTK(4, "sort_solstat: n=%d\n", statbuf->n);
 
     if (statbuf->n <= 0)
         {
@@ -1233,7 +1233,7 @@ int sort_solstat(solstatbuf_t *statbuf)
 
     if (!(statbuf_data = static_cast<solstat_t *>(realloc(statbuf->data, sizeof(solstat_t) * statbuf->n))))
         {
-            trace(1, "sort_solstat: memory allocation error\n");
+            TRACE_RTK(1, "sort_solstat: memory allocation error\n");
             free(statbuf->data);
             statbuf->data = nullptr;
             statbuf->n = statbuf->nmax = 0;
@@ -1270,7 +1270,7 @@ int decode_solstat(char *buff, solstat_t *stat)
     char id[32] = "";
     char *p;
 
-    trace(4, "decode_solstat: buff=%s\n", buff);
+    TRACE_RTK(4, "decode_solstat: buff=%s\n", buff);
 
     if (strstr(buff, "$SAT") != buff)
         {
@@ -1291,12 +1291,12 @@ int decode_solstat(char *buff, solstat_t *stat)
 
     if (n < 15)
         {
-            trace(2, "invalid format of solution status: %s\n", buff);
+            TRACE_RTK(2, "invalid format of solution status: %s\n", buff);
             return 0;
         }
     if ((sat = satid2no(id)) <= 0)
         {
-            trace(2, "invalid satellite in solution status: %s\n", id);
+            TRACE_RTK(2, "invalid satellite in solution status: %s\n", id);
             return 0;
         }
     *stat = stat0;
@@ -1322,7 +1322,7 @@ void addsolstat(solstatbuf_t *statbuf, const solstat_t *stat)
 {
     solstat_t *statbuf_data;
 
-    trace(4, "addsolstat:\n");
+    TRACE_RTK(4, "addsolstat:\n");
 
     if (statbuf->n >= statbuf->nmax)
         {
@@ -1330,7 +1330,7 @@ void addsolstat(solstatbuf_t *statbuf, const solstat_t *stat)
             if (!(statbuf_data = static_cast<solstat_t *>(realloc(statbuf->data, sizeof(solstat_t) *
                                                                                      statbuf->nmax))))
                 {
-                    trace(1, "addsolstat: memory allocation error\n");
+                    TRACE_RTK(1, "addsolstat: memory allocation error\n");
                     free(statbuf->data);
                     statbuf->data = nullptr;
                     statbuf->n = statbuf->nmax = 0;
@@ -1349,7 +1349,7 @@ int readsolstatdata(FILE *fp, gtime_t ts, gtime_t te, double tint,
     solstat_t stat = {{0, 0.0}, '0', '0', 0, 0, 0, 0, '0', '0', 0, 0, 0, 0};
     char buff[MAXSOLMSG + 1];
 
-    trace(3, "readsolstatdata:\n");
+    TRACE_RTK(3, "readsolstatdata:\n");
 
     while (fgets(buff, sizeof(buff), fp))
         {
@@ -1386,7 +1386,7 @@ int readsolstatt(char *files[], int nfile, gtime_t ts, gtime_t te,
     char path[1024];
     int i;
 
-    trace(3, "readsolstatt: nfile=%d\n", nfile);
+    TRACE_RTK(3, "readsolstatt: nfile=%d\n", nfile);
 
     statbuf->n = statbuf->nmax = 0;
     statbuf->data = nullptr;
@@ -1396,13 +1396,13 @@ int readsolstatt(char *files[], int nfile, gtime_t ts, gtime_t te,
             std::snprintf(path, sizeof(path), "%s.stat", files[i]);
             if (!(fp = fopen(path, "re")))
                 {
-                    trace(1, "readsolstatt: file open error %s\n", path);
+                    TRACE_RTK(1, "readsolstatt: file open error %s\n", path);
                     continue;
                 }
             /* read solution status data */
             if (!readsolstatdata(fp, ts, te, tint, statbuf))
                 {
-                    trace(1, "readsolt: no solution in %s\n", path);
+                    TRACE_RTK(1, "readsolt: no solution in %s\n", path);
                 }
             fclose(fp);
         }
@@ -1414,7 +1414,7 @@ int readsolstat(char *files[], int nfile, solstatbuf_t *statbuf)
 {
     gtime_t time = {0, 0.0};
 
-    trace(3, "readsolstat: nfile=%d\n", nfile);
+    TRACE_RTK(3, "readsolstat: nfile=%d\n", nfile);
 
     return readsolstatt(files, nfile, time, time, 0.0, statbuf);
 }
@@ -1427,7 +1427,7 @@ int outecef(unsigned char *buff, const char *s, const sol_t *sol,
     const char *sep = opt2sep(opt);
     char *p = reinterpret_cast<char *>(buff);
 
-    trace(3, "outecef:\n");
+    TRACE_RTK(3, "outecef:\n");
 
     p += std::snprintf(p, MAXSOLBUF, "%s%s%14.4f%s%14.4f%s%14.4f%s%3d%s%3d%s%8.4f%s%8.4f%s%8.4f%s%8.4f%s%8.4f%s%8.4f%s%6.2f%s%6.1f\n",
         s, sep, sol->rr[0], sep, sol->rr[1], sep, sol->rr[2], sep, sol->stat, sep,
@@ -1452,7 +1452,7 @@ int outpos(unsigned char *buff, const char *s, const sol_t *sol,
     char *start;
     start = p;
 
-    trace(3, "outpos  :\n");
+    TRACE_RTK(3, "outpos  :\n");
 
     ecef2pos(sol->rr, pos);
     soltocov(sol, P);
@@ -1494,7 +1494,7 @@ int outenu(unsigned char *buff, const char *s, const sol_t *sol,
     const char *sep = opt2sep(opt);
     char *p = reinterpret_cast<char *>(buff);
 
-    trace(3, "outenu  :\n");
+    TRACE_RTK(3, "outenu  :\n");
 
     for (i = 0; i < 3; i++)
         {
@@ -1531,7 +1531,7 @@ int outnmea_rmc(unsigned char *buff, const sol_t *sol)
     char *emag = const_cast<char *>("E");
     const int MSG_TAIL = 6;
 
-    trace(3, "outnmea_rmc:\n");
+    TRACE_RTK(3, "outnmea_rmc:\n");
 
     if (sol->stat <= SOLQ_NONE)
         {
@@ -1598,7 +1598,7 @@ int outnmea_gga(unsigned char *buff, const sol_t *sol)
     char sum;
     const int MSG_TAIL = 6;
 
-    trace(3, "outnmea_gga:\n");
+    TRACE_RTK(3, "outnmea_gga:\n");
 
     if (sol->stat <= SOLQ_NONE)
         {
@@ -1664,7 +1664,7 @@ int outnmea_gsa(unsigned char *buff, const sol_t *sol,
     const int COMMA_LENGTH = 2;
     const int MAX_LENGTH_INT = 10;
 
-    trace(3, "outnmea_gsa:\n");
+    TRACE_RTK(3, "outnmea_gsa:\n");
 
     if (sol->stat <= SOLQ_NONE)
         {
@@ -1869,7 +1869,7 @@ int outnmea_gsv(unsigned char *buff, const sol_t *sol,
     char sum;
     const int MSG_TAIL = 6;
 
-    trace(3, "outnmea_gsv:\n");
+    TRACE_RTK(3, "outnmea_gsv:\n");
 
     if (sol->stat <= SOLQ_NONE)
         {
@@ -2097,7 +2097,7 @@ int outprcopts(unsigned char *buff, const prcopt_t *opt)
     char *s;
     s = p;
 
-    trace(3, "outprcopts:\n");
+    TRACE_RTK(3, "outprcopts:\n");
 
     p += std::snprintf(p, MAXSOLMSG, "%s pos mode  : %s\n", COMMENTH, s1[opt->mode]);
 
@@ -2181,7 +2181,7 @@ int outsolheads(unsigned char *buff, const solopt_t *opt)
     char *s;
     s = p;
 
-    trace(3, "outsolheads:\n");
+    TRACE_RTK(3, "outsolheads:\n");
 
     if (opt->posf == SOLF_NMEA)
         {
@@ -2262,7 +2262,7 @@ int outsols(unsigned char *buff, const sol_t *sol, const double *rb,
     char s[255];
     unsigned char *p = buff;
 
-    trace(3, "outsols :\n");
+    TRACE_RTK(3, "outsols :\n");
 
     if (opt->posf == SOLF_NMEA)
         {
@@ -2340,7 +2340,7 @@ int outsolexs(unsigned char *buff, const sol_t *sol, const ssat_t *ssat,
     gtime_t ts = {0, 0.0};
     unsigned char *p = buff;
 
-    trace(3, "outsolexs:\n");
+    TRACE_RTK(3, "outsolexs:\n");
 
     if (opt->posf == SOLF_NMEA)
         {
@@ -2373,7 +2373,7 @@ void outprcopt(FILE *fp, const prcopt_t *opt)
     unsigned char buff[MAXSOLMSG + 1];
     int n;
 
-    trace(3, "outprcopt:\n");
+    TRACE_RTK(3, "outprcopt:\n");
 
     if ((n = outprcopts(buff, opt)) > 0)
         {
@@ -2393,7 +2393,7 @@ void outsolhead(FILE *fp, const solopt_t *opt)
     unsigned char buff[MAXSOLMSG + 1];
     int n;
 
-    trace(3, "outsolhead:\n");
+    TRACE_RTK(3, "outsolhead:\n");
 
     if ((n = outsolheads(buff, opt)) > 0)
         {
@@ -2416,7 +2416,7 @@ void outsol(FILE *fp, const sol_t *sol, const double *rb,
     unsigned char buff[MAXSOLMSG + 1];
     int n;
 
-    trace(3, "outsol  :\n");
+    TRACE_RTK(3, "outsol  :\n");
 
     if ((n = outsols(buff, sol, rb, opt)) > 0)
         {
@@ -2440,7 +2440,7 @@ void outsolex(FILE *fp, const sol_t *sol, const ssat_t *ssat,
     unsigned char buff[MAXSOLMSG + 1];
     int n;
 
-    trace(3, "outsolex:\n");
+    TRACE_RTK(3, "outsolex:\n");
 
     if ((n = outsolexs(buff, sol, ssat, opt)) > 0)
         {
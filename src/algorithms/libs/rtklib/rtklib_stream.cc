@@ -89,7 +89,7 @@ serial_t *openserial(const char *path, int mode, char *msg)
         B300, B600, B1200, B2400, B4800, B9600, B19200, B38400, B57600, B115200, B230400};
     struct termios ios{};
     int rw = 0;
-    tracet(3, "openserial: path=%s mode=%d\n", path, mode);
+    TRACET_RTK(3, "openserial: path=%s mode=%d\n", path, mode);
 
     if (!(serial = static_cast<serial_t *>(malloc(sizeof(serial_t)))))
         {
@@ -118,7 +118,7 @@ serial_t *openserial(const char *path, int mode, char *msg)
     if (i >= 11)
         {
             std::snprintf(msg, MAXSTRMSG, "bitrate error (%d)", brate);
-            tracet(1, "openserial: %s path=%s\n", msg, path);
+            TRACET_RTK(1, "openserial: %s path=%s\n", msg, path);
             free(serial);
             return nullptr;
         }
@@ -151,7 +151,7 @@ serial_t *openserial(const char *path, int mode, char *msg)
     if ((serial->dev = open(dev, rw | O_NOCTTY | O_NONBLOCK)) < 0)
         {
             std::snprintf(msg, MAXSTRMSG, "device open error (%d)", errno);
-            tracet(1, "openserial: %s dev=%s\n", msg, dev);
+            TRACET_RTK(1, "openserial: %s dev=%s\n", msg, dev);
             free(serial);
             return nullptr;
         }
@@ -180,7 +180,7 @@ void closeserial(serial_t *serial)
         {
             return;
         }
-    tracet(3, "closeserial: dev=%d\n", serial->dev);
+    TRACET_RTK(3, "closeserial: dev=%d\n", serial->dev);
     close(serial->dev);
     free(serial);
 }
@@ -194,12 +194,12 @@ int readserial(serial_t *serial, unsigned char *buff, int n, char *msg __attribu
         {
             return 0;
         }
-    tracet(4, "readserial: dev=%d n=%d\n", serial->dev, n);
+    TRACET_RTK(4, "readserial: dev=%d n=%d\n", serial->dev, n);
     if ((nr = read(serial->dev, buff, n)) < 0)
         {
             return 0;
         }
-    tracet(5, "readserial: exit dev=%d nr=%d\n", serial->dev, nr);
+    TRACET_RTK(5, "readserial: exit dev=%d nr=%d\n", serial->dev, nr);
     return nr;
 }
 
@@ -212,12 +212,12 @@ int writeserial(serial_t *serial, unsigned char *buff, int n, char *msg __attrib
         {
             return 0;
         }
-    tracet(3, "writeserial: dev=%d n=%d\n", serial->dev, n);
+    TRACET_RTK(3, "writeserial: dev=%d n=%d\n", serial->dev, n);
     if ((ns = write(serial->dev, buff, n)) < 0)
         {
             return 0;
         }
-    tracet(5, "writeserial: exit dev=%d ns=%d\n", serial->dev, ns);
+    TRACET_RTK(5, "writeserial: exit dev=%d ns=%d\n", serial->dev, ns);
     return ns;
 }
 
@@ -236,7 +236,7 @@ int openfile_(file_t *file, gtime_t time, char *msg)
     char tagpath[MAXSTRPATH + 4] = "";
     char tagh[TIMETAGH_LEN + 1] = "";
 
-    tracet(3, "openfile_: path=%s time=%s\n", file->path.data(), time_str(time, 0));
+    TRACET_RTK(3, "openfile_: path=%s time=%s\n", file->path.data(), time_str(time, 0));
 
     file->time = utc2gpst(timeget());
     file->tick = file->tick_f = tickget();
@@ -270,10 +270,10 @@ int openfile_(file_t *file, gtime_t time, char *msg)
     if (!(file->fp = fopen(file->openpath.data(), mode)))
         {
             std::snprintf(msg, MAXSTRMSG, "file open error");
-            tracet(1, "openfile: %s\n", msg);
+            TRACET_RTK(1, "openfile: %s\n", msg);
             return 0;
         }
-    tracet(4, "openfile_: open file %s (%s)\n", file->openpath.data(), mode);
+    TRACET_RTK(4, "openfile_: open file %s (%s)\n", file->openpath.data(), mode);
 
     std::snprintf(tagpath, MAXSTRPATH + 4, "%s.tag", file->openpath.data());
 
@@ -282,11 +282,11 @@ int openfile_(file_t *file, gtime_t time, char *msg)
             if (!(file->fp_tag = fopen(tagpath, mode)))
                 {
                     std::snprintf(msg, MAXSTRMSG, "tag open error");
-                    tracet(1, "openfile: %s\n", msg);
+                    TRACET_RTK(1, "openfile: %s\n", msg);
                     fclose(file->fp);
                     return 0;
                 }
-            tracet(4, "openfile_: open tag file %s (%s)\n", tagpath, mode);
+            TRACET_RTK(4, "openfile_: open tag file %s (%s)\n", tagpath, mode);
 
             if (file->mode & STR_MODE_R)
                 {
@@ -321,7 +321,7 @@ int openfile_(file_t *file, gtime_t time, char *msg)
                     fclose(fp);
                     if (remove(tagpath) != 0)
                         {
-                            trace(1, "Error removing file");
+                            TRACE_RTK(1, "Error removing file");
                         }
                 }
         }
@@ -332,7 +332,7 @@ int openfile_(file_t *file, gtime_t time, char *msg)
 /* close file ----------------------------------------------------------------*/
 void closefile_(file_t *file)
 {
-    tracet(3, "closefile_: path=%s\n", file->path.data());
+    TRACET_RTK(3, "closefile_: path=%s\n", file->path.data());
     if (file->fp)
         {
             fclose(file->fp);
@@ -359,7 +359,7 @@ void closefile_(file_t *file)
 /* open file (path=filepath[::T[::+<off>][::x<speed>]][::S=swapintv]) --------*/
 file_t *openfile(std::string const &path, int mode, char *msg)
 {
-    tracet(3, "openfile: path=%s mode=%d\n", path.data(), mode);
+    TRACET_RTK(3, "openfile: path=%s mode=%d\n", path.data(), mode);
 
     if ((mode & (STR_MODE_R | STR_MODE_W)) == 0)
         {
@@ -447,7 +447,7 @@ void closefile(file_t *file)
     if (file)
         {
             std::unique_ptr<file_t> fileH(file);
-            tracet(3, "closefile: fp=%p \n", fileH->fp);
+            TRACET_RTK(3, "closefile: fp=%p \n", fileH->fp);
 
             closefile_(fileH.get());
         }
@@ -459,7 +459,7 @@ void swapfile(file_t *file, gtime_t time, char *msg)
 {
     std::string openpath;
 
-    tracet(3, "swapfile: fp=%p \n time=%s\n", file->fp, time_str(time, 0));
+    TRACET_RTK(3, "swapfile: fp=%p \n time=%s\n", file->fp, time_str(time, 0));
 
     /* return if old swap file open */
     if (file->fp_tmp || file->fp_tag_tmp)
@@ -472,7 +472,7 @@ void swapfile(file_t *file, gtime_t time, char *msg)
 
     if (openpath == file->openpath)
         {
-            tracet(2, "swapfile: no need to swap %s\n", openpath.data());
+            TRACET_RTK(2, "swapfile: no need to swap %s\n", openpath.data());
             return;
         }
     /* save file pointer to temporary pointer */
@@ -487,7 +487,7 @@ void swapfile(file_t *file, gtime_t time, char *msg)
 /* close old swap file -------------------------------------------------------*/
 void swapclose(file_t *file)
 {
-    tracet(3, "swapclose: fp_tmp=%p \n", file->fp_tmp);
+    TRACET_RTK(3, "swapclose: fp_tmp=%p \n", file->fp_tmp);
     if (file->fp_tmp)
         {
             fclose(file->fp_tmp);
@@ -521,7 +521,7 @@ int readfile(file_t *file, unsigned char *buff, int nmax, char *msg)
         {
             return 0;
         }
-    tracet(4, "readfile: fp=%p nmax=%d\n", file->fp, nmax);
+    TRACET_RTK(4, "readfile: fp=%p nmax=%d\n", file->fp, nmax);
 
     if (file->fp == stdin)
         {
@@ -555,7 +555,7 @@ int readfile(file_t *file, unsigned char *buff, int nmax, char *msg)
                         {
                             if (fseek(file->fp, 0, SEEK_END) != 0)
                                 {
-                                    trace(1, "fseek error");
+                                    TRACE_RTK(1, "fseek error");
                                 }
                             std::snprintf(msg, MAXSTRPATH, "end");
                             break;
@@ -578,7 +578,7 @@ int readfile(file_t *file, unsigned char *buff, int nmax, char *msg)
                         {
                             if (fseek(file->fp, fpos, SEEK_SET) != 0)
                                 {
-                                    trace(1, "Error fseek");
+                                    TRACE_RTK(1, "Error fseek");
                                 }
                             file->fpos = fpos;
                             return 0;
@@ -589,7 +589,7 @@ int readfile(file_t *file, unsigned char *buff, int nmax, char *msg)
                         {
                             if (fseek(file->fp_tag, -static_cast<int64_t>(sizeof(tick) + sizeof(fpos)), SEEK_CUR) != 0)
                                 {
-                                    trace(1, "Error fseek");
+                                    TRACE_RTK(1, "Error fseek");
                                 }
                         }
                     break;
@@ -604,7 +604,7 @@ int readfile(file_t *file, unsigned char *buff, int nmax, char *msg)
                     std::snprintf(msg, MAXSTRPATH, "end");
                 }
         }
-    tracet(5, "readfile: fp=%p \n nr=%d fpos=%u\n", file->fp, nr, file->fpos);
+    TRACET_RTK(5, "readfile: fp=%p \n nr=%d fpos=%u\n", file->fp, nr, file->fpos);
     return nr;
 }
 
@@ -627,7 +627,7 @@ int writefile(file_t *file, unsigned char *buff, int n, char *msg)
         {
             return 0;
         }
-    tracet(3, "writefile: fp=%p \n n=%d\n", file->fp, n);
+    TRACET_RTK(3, "writefile: fp=%p \n n=%d\n", file->fp, n);
 
     wtime = utc2gpst(timeget()); /* write time in gpst */
 
@@ -680,7 +680,7 @@ int writefile(file_t *file, unsigned char *buff, int n, char *msg)
                     fflush(file->fp_tag_tmp);
                 }
         }
-    tracet(5, "writefile: fp=%p \n ns=%d tick=%5d fpos=%zd\n", file->fp, ns, tick, fpos);
+    TRACET_RTK(5, "writefile: fp=%p \n ns=%d tick=%5d fpos=%zd\n", file->fp, ns, tick, fpos);
 
     return static_cast<int>(ns);
 }
@@ -707,7 +707,7 @@ void decodetcppath(const char *path, char *addr, char *port, char *user,
     char *p;
     char *q;
 
-    tracet(4, "decodetcpepath: path=%s\n", path);
+    TRACET_RTK(4, "decodetcpepath: path=%s\n", path);
 
     if (port)
         {
@@ -796,7 +796,7 @@ void decodetcppath(const char *path, char *addr, char *port, char *user,
             int ret = std::snprintf(addr, 256, "%s", p);  // NOLINT(runtime/printf)
             if (ret < 0 || ret >= 256)
                 {
-                    tracet(1, "error reading address");
+                    TRACET_RTK(1, "error reading address");
                 }
         }
 }
@@ -813,25 +813,25 @@ int setsock(socket_t sock, char *msg)
     int mode = 1;
     struct timeval tv = {0, 0};
 
-    tracet(3, "setsock: sock=%d\n", sock);
+    TRACET_RTK(3, "setsock: sock=%d\n", sock);
 
     if (setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char *>(&tv), sizeof(tv)) == -1 ||
         setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char *>(&tv), sizeof(tv)) == -1)
         {
             std::snprintf(msg, MAXSTRMSG, "sockopt error: notimeo");
-            tracet(1, "setsock: setsockopt error 1 sock=%d err=%d\n", sock, errsock());
+            TRACET_RTK(1, "setsock: setsockopt error 1 sock=%d err=%d\n", sock, errsock());
             closesocket(sock);
             return 0;
         }
     if (setsockopt(sock, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char *>(&bs), sizeof(bs)) == -1 ||
         setsockopt(sock, SOL_SOCKET, SO_SNDBUF, reinterpret_cast<const char *>(&bs), sizeof(bs)) == -1)
         {
-            tracet(1, "setsock: setsockopt error 2 sock=%d err=%d bs=%d\n", sock, errsock(), bs);
+            TRACET_RTK(1, "setsock: setsockopt error 2 sock=%d err=%d bs=%d\n", sock, errsock(), bs);
             std::snprintf(msg, MAXSTRMSG, "sockopt error: bufsiz");
         }
     if (setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char *>(&mode), sizeof(mode)) == -1)
         {
-            tracet(1, "setsock: setsockopt error 3 sock=%d err=%d\n", sock, errsock());
+            TRACET_RTK(1, "setsock: setsockopt error 3 sock=%d err=%d\n", sock, errsock());
             std::snprintf(msg, MAXSTRMSG, "sockopt error: nodelay");
         }
     return 1;
@@ -865,7 +865,7 @@ int connect_nb(socket_t sock, struct sockaddr *addr, socklen_t len)
     flag = fcntl(sock, F_GETFL, 0);
     if (fcntl(sock, F_SETFL, flag | O_NONBLOCK) == -1)
         {
-            trace(1, "fcntl error");
+            TRACE_RTK(1, "fcntl error");
         }
     if (connect(sock, addr, len) == -1)
         {
@@ -924,13 +924,13 @@ int gentcp(tcp_t *tcp, int type, char *msg)
     int opt = 1;
 #endif
 
-    tracet(3, "gentcp: type=%d\n", type);
+    TRACET_RTK(3, "gentcp: type=%d\n", type);
 
     /* generate socket */
     if ((tcp->sock = socket(AF_INET, SOCK_STREAM, 0)) == -1)
         {
             std::snprintf(msg, MAXSTRMSG, "socket error (%d)", errsock());
-            tracet(1, "gentcp: socket error err=%d\n", errsock());
+            TRACET_RTK(1, "gentcp: socket error err=%d\n", errsock());
             tcp->state = -1;
             return 0;
         }
@@ -953,7 +953,7 @@ int gentcp(tcp_t *tcp, int type, char *msg)
             if (bind(tcp->sock, reinterpret_cast<struct sockaddr *>(&tcp->addr), sizeof(tcp->addr)) == -1)
                 {
                     std::snprintf(msg, MAXSTRMSG, "bind error (%d) : %d", errsock(), tcp->port);
-                    tracet(1, "gentcp: bind error port=%d err=%d\n", tcp->port, errsock());
+                    TRACET_RTK(1, "gentcp: bind error port=%d err=%d\n", tcp->port, errsock());
                     closesocket(tcp->sock);
                     tcp->state = -1;
                     return 0;
@@ -965,7 +965,7 @@ int gentcp(tcp_t *tcp, int type, char *msg)
             if (!(hp = gethostbyname(tcp->saddr)))
                 {
                     std::snprintf(msg, MAXSTRMSG, "address error (%s)", tcp->saddr);
-                    tracet(1, "gentcp: gethostbyname error addr=%s err=%d\n", tcp->saddr, errsock());
+                    TRACET_RTK(1, "gentcp: gethostbyname error addr=%s err=%d\n", tcp->saddr, errsock());
                     closesocket(tcp->sock);
                     tcp->state = 0;
                     tcp->tcon = ticonnect;
@@ -976,7 +976,7 @@ int gentcp(tcp_t *tcp, int type, char *msg)
         }
     tcp->state = 1;
     tcp->tact = tickget();
-    tracet(5, "gentcp: exit sock=%d\n", tcp->sock);
+    TRACET_RTK(5, "gentcp: exit sock=%d\n", tcp->sock);
     return 1;
 }
 
@@ -984,7 +984,7 @@ int gentcp(tcp_t *tcp, int type, char *msg)
 /* disconnect tcp ------------------------------------------------------------*/
 void discontcp(tcp_t *tcp, int tcon)
 {
-    tracet(3, "discontcp: sock=%d tcon=%d\n", tcp->sock, tcon);
+    TRACET_RTK(3, "discontcp: sock=%d tcon=%d\n", tcp->sock, tcon);
     closesocket(tcp->sock);
     tcp->state = 0;
     tcp->tcon = tcon;
@@ -998,7 +998,7 @@ tcpsvr_t *opentcpsvr(const char *path, char *msg)
     tcpsvr_t *tcpsvr;
     tcpsvr_t tcpsvr0{};
     char port[256] = "";
-    tracet(3, "opentcpsvr: path=%s\n", path);
+    TRACET_RTK(3, "opentcpsvr: path=%s\n", path);
 
     if (!(tcpsvr = static_cast<tcpsvr_t *>(malloc(sizeof(tcpsvr_t)))))
         {
@@ -1009,7 +1009,7 @@ tcpsvr_t *opentcpsvr(const char *path, char *msg)
     if (sscanf(port, "%d", &tcpsvr->svr.port) < 1)
         {
             std::snprintf(msg, MAXSTRMSG, "port error: %s", port);
-            tracet(1, "opentcpsvr: port error port=%s\n", port);
+            TRACET_RTK(1, "opentcpsvr: port error port=%s\n", port);
             free(tcpsvr);
             return nullptr;
         }
@@ -1027,7 +1027,7 @@ tcpsvr_t *opentcpsvr(const char *path, char *msg)
 void closetcpsvr(tcpsvr_t *tcpsvr)
 {
     int i;
-    tracet(3, "closetcpsvr:\n");
+    TRACET_RTK(3, "closetcpsvr:\n");
     for (i = 0; i < MAXCLI; i++)
         {
             if (tcpsvr->cli[i].state)
@@ -1048,7 +1048,7 @@ void updatetcpsvr(tcpsvr_t *tcpsvr, char *msg)
     int j;
     int n = 0;
 
-    tracet(3, "updatetcpsvr: state=%d\n", tcpsvr->svr.state);
+    TRACET_RTK(3, "updatetcpsvr: state=%d\n", tcpsvr->svr.state);
 
     if (tcpsvr->svr.state == 0)
         {
@@ -1108,7 +1108,7 @@ int accsock(tcpsvr_t *tcpsvr, char *msg)
     int i;
     int err;
 
-    tracet(3, "accsock: sock=%d\n", tcpsvr->svr.sock);
+    TRACET_RTK(3, "accsock: sock=%d\n", tcpsvr->svr.sock);
 
     for (i = 0; i < MAXCLI; i++)
         {
@@ -1126,7 +1126,7 @@ int accsock(tcpsvr_t *tcpsvr, char *msg)
         {
             err = errsock();
             std::snprintf(msg, MAXSTRMSG, "accept error (%d)", err);
-            tracet(1, "accsock: accept error sock=%d err=%d\n", tcpsvr->svr.sock, err);
+            TRACET_RTK(1, "accsock: accept error sock=%d err=%d\n", tcpsvr->svr.sock, err);
             closesocket(tcpsvr->svr.sock);
             tcpsvr->svr.state = 0;
             return 0;
@@ -1148,7 +1148,7 @@ int accsock(tcpsvr_t *tcpsvr, char *msg)
             tcpsvr->cli[i].saddr[255] = '\0';
         }
     std::snprintf(msg, MAXSTRMSG, "%s", tcpsvr->cli[i].saddr);
-    tracet(2, "accsock: connected sock=%d addr=%s\n", tcpsvr->cli[i].sock, tcpsvr->cli[i].saddr);
+    TRACET_RTK(2, "accsock: connected sock=%d addr=%s\n", tcpsvr->cli[i].sock, tcpsvr->cli[i].saddr);
     tcpsvr->cli[i].state = 2;
     tcpsvr->cli[i].tact = tickget();
     return 1;
@@ -1158,7 +1158,7 @@ int accsock(tcpsvr_t *tcpsvr, char *msg)
 /* wait socket accept --------------------------------------------------------*/
 int waittcpsvr(tcpsvr_t *tcpsvr, char *msg)
 {
-    tracet(4, "waittcpsvr: sock=%d state=%d\n", tcpsvr->svr.sock, tcpsvr->svr.state);
+    TRACET_RTK(4, "waittcpsvr: sock=%d state=%d\n", tcpsvr->svr.sock, tcpsvr->svr.state);
     if (tcpsvr->svr.state <= 0)
         {
             return 0;
@@ -1177,7 +1177,7 @@ int readtcpsvr(tcpsvr_t *tcpsvr, unsigned char *buff, int n, char *msg)
     int nr;
     int err;
 
-    tracet(4, "readtcpsvr: state=%d n=%d\n", tcpsvr->svr.state, n);
+    TRACET_RTK(4, "readtcpsvr: state=%d n=%d\n", tcpsvr->svr.state, n);
 
     if (!waittcpsvr(tcpsvr, msg) || tcpsvr->cli[0].state != 2)
         {
@@ -1187,7 +1187,7 @@ int readtcpsvr(tcpsvr_t *tcpsvr, unsigned char *buff, int n, char *msg)
     if ((nr = recv_nb(tcpsvr->cli[0].sock, buff, n)) == -1)
         {
             err = errsock();
-            tracet(1, "readtcpsvr: recv error sock=%d err=%d\n", tcpsvr->cli[0].sock, err);
+            TRACET_RTK(1, "readtcpsvr: recv error sock=%d err=%d\n", tcpsvr->cli[0].sock, err);
             std::snprintf(msg, MAXSTRMSG, "recv error (%d)", err);
             discontcp(&tcpsvr->cli[0], ticonnect);
             updatetcpsvr(tcpsvr, msg);
@@ -1197,7 +1197,7 @@ int readtcpsvr(tcpsvr_t *tcpsvr, unsigned char *buff, int n, char *msg)
         {
             tcpsvr->cli[0].tact = tickget();
         }
-    tracet(5, "readtcpsvr: exit sock=%d nr=%d\n", tcpsvr->cli[0].sock, nr);
+    TRACET_RTK(5, "readtcpsvr: exit sock=%d nr=%d\n", tcpsvr->cli[0].sock, nr);
     return nr;
 }
 
@@ -1209,7 +1209,7 @@ int writetcpsvr(tcpsvr_t *tcpsvr, unsigned char *buff, int n, char *msg)
     int ns = 0;
     int err;
 
-    tracet(3, "writetcpsvr: state=%d n=%d\n", tcpsvr->svr.state, n);
+    TRACET_RTK(3, "writetcpsvr: state=%d n=%d\n", tcpsvr->svr.state, n);
 
     if (!waittcpsvr(tcpsvr, msg))
         {
@@ -1226,7 +1226,7 @@ int writetcpsvr(tcpsvr_t *tcpsvr, unsigned char *buff, int n, char *msg)
             if ((ns = send_nb(tcpsvr->cli[i].sock, buff, n)) == -1)
                 {
                     err = errsock();
-                    tracet(1, "writetcpsvr: send error i=%d sock=%d err=%d\n", i, tcpsvr->cli[i].sock, err);
+                    TRACET_RTK(1, "writetcpsvr: send error i=%d sock=%d err=%d\n", i, tcpsvr->cli[i].sock, err);
                     std::snprintf(msg, MAXSTRMSG, "send error (%d)", err);
                     discontcp(&tcpsvr->cli[i], ticonnect);
                     updatetcpsvr(tcpsvr, msg);
@@ -1236,7 +1236,7 @@ int writetcpsvr(tcpsvr_t *tcpsvr, unsigned char *buff, int n, char *msg)
                 {
                     tcpsvr->cli[i].tact = tickget();
                 }
-            tracet(5, "writetcpsvr: send i=%d ns=%d\n", i, ns);
+            TRACET_RTK(5, "writetcpsvr: send i=%d ns=%d\n", i, ns);
         }
     return ns;
 }
@@ -1255,7 +1255,7 @@ int consock(tcpcli_t *tcpcli, char *msg)
     int stat;
     int err;
 
-    tracet(3, "consock: sock=%d\n", tcpcli->svr.sock);
+    TRACET_RTK(3, "consock: sock=%d\n", tcpcli->svr.sock);
 
     /* wait re-connect */
     if (tcpcli->svr.tcon < 0 || (tcpcli->svr.tcon > 0 &&
@@ -1269,7 +1269,7 @@ int consock(tcpcli_t *tcpcli, char *msg)
         {
             err = errsock();
             std::snprintf(msg, MAXSTRMSG, "connect error (%d)", err);
-            tracet(1, "consock: connect error sock=%d err=%d\n", tcpcli->svr.sock, err);
+            TRACET_RTK(1, "consock: connect error sock=%d err=%d\n", tcpcli->svr.sock, err);
             closesocket(tcpcli->svr.sock);
             tcpcli->svr.state = 0;
             return 0;
@@ -1280,7 +1280,7 @@ int consock(tcpcli_t *tcpcli, char *msg)
             return 0;
         }
     std::snprintf(msg, MAXSTRMSG, "%s", tcpcli->svr.saddr);
-    tracet(2, "consock: connected sock=%d addr=%s\n", tcpcli->svr.sock, tcpcli->svr.saddr);
+    TRACET_RTK(2, "consock: connected sock=%d addr=%s\n", tcpcli->svr.sock, tcpcli->svr.saddr);
     tcpcli->svr.state = 2;
     tcpcli->svr.tact = tickget();
     return 1;
@@ -1294,7 +1294,7 @@ tcpcli_t *opentcpcli(const char *path, char *msg)
     tcpcli_t tcpcli0{};
     char port[256] = "";
 
-    tracet(3, "opentcpcli: path=%s\n", path);
+    TRACET_RTK(3, "opentcpcli: path=%s\n", path);
 
     if (!(tcpcli = static_cast<tcpcli_t *>(malloc(sizeof(tcpcli_t)))))
         {
@@ -1305,7 +1305,7 @@ tcpcli_t *opentcpcli(const char *path, char *msg)
     if (sscanf(port, "%d", &tcpcli->svr.port) < 1)
         {
             std::snprintf(msg, MAXSTRMSG, "port error: %s", port);
-            tracet(1, "opentcp: port error port=%s\n", port);
+            TRACET_RTK(1, "opentcp: port error port=%s\n", port);
             free(tcpcli);
             return nullptr;
         }
@@ -1319,7 +1319,7 @@ tcpcli_t *opentcpcli(const char *path, char *msg)
 /* close tcp client ----------------------------------------------------------*/
 void closetcpcli(tcpcli_t *tcpcli)
 {
-    tracet(3, "closetcpcli: sock=%d\n", tcpcli->svr.sock);
+    TRACET_RTK(3, "closetcpcli: sock=%d\n", tcpcli->svr.sock);
     closesocket(tcpcli->svr.sock);
     free(tcpcli);
 }
@@ -1328,7 +1328,7 @@ void closetcpcli(tcpcli_t *tcpcli)
 /* wait socket connect -------------------------------------------------------*/
 int waittcpcli(tcpcli_t *tcpcli, char *msg)
 {
-    tracet(4, "waittcpcli: sock=%d state=%d\n", tcpcli->svr.sock, tcpcli->svr.state);
+    TRACET_RTK(4, "waittcpcli: sock=%d state=%d\n", tcpcli->svr.sock, tcpcli->svr.state);
 
     if (tcpcli->svr.state < 0)
         {
@@ -1355,7 +1355,7 @@ int waittcpcli(tcpcli_t *tcpcli, char *msg)
                 static_cast<int>(tickget() - tcpcli->svr.tact) > tcpcli->toinact)
                 {
                     std::snprintf(msg, MAXSTRMSG, "timeout");
-                    tracet(2, "waittcpcli: inactive timeout sock=%d\n", tcpcli->svr.sock);
+                    TRACET_RTK(2, "waittcpcli: inactive timeout sock=%d\n", tcpcli->svr.sock);
                     discontcp(&tcpcli->svr, tcpcli->tirecon);
                     return 0;
                 }
@@ -1370,7 +1370,7 @@ int readtcpcli(tcpcli_t *tcpcli, unsigned char *buff, int n, char *msg)
     int nr;
     int err;
 
-    tracet(4, "readtcpcli: sock=%d state=%d n=%d\n", tcpcli->svr.sock, tcpcli->svr.state, n);
+    TRACET_RTK(4, "readtcpcli: sock=%d state=%d n=%d\n", tcpcli->svr.sock, tcpcli->svr.state, n);
 
     if (!waittcpcli(tcpcli, msg))
         {
@@ -1380,7 +1380,7 @@ int readtcpcli(tcpcli_t *tcpcli, unsigned char *buff, int n, char *msg)
     if ((nr = recv_nb(tcpcli->svr.sock, buff, n)) == -1)
         {
             err = errsock();
-            tracet(1, "readtcpcli: recv error sock=%d err=%d\n", tcpcli->svr.sock, err);
+            TRACET_RTK(1, "readtcpcli: recv error sock=%d err=%d\n", tcpcli->svr.sock, err);
             std::snprintf(msg, MAXSTRMSG, "recv error (%d)", err);
             discontcp(&tcpcli->svr, tcpcli->tirecon);
             return 0;
@@ -1389,7 +1389,7 @@ int readtcpcli(tcpcli_t *tcpcli, unsigned char *buff, int n, char *msg)
         {
             tcpcli->svr.tact = tickget();
         }
-    tracet(5, "readtcpcli: exit sock=%d nr=%d\n", tcpcli->svr.sock, nr);
+    TRACET_RTK(5, "readtcpcli: exit sock=%d nr=%d\n", tcpcli->svr.sock, nr);
     return nr;
 }
 
@@ -1400,7 +1400,7 @@ int writetcpcli(tcpcli_t *tcpcli, unsigned char *buff, int n, char *msg)
     int ns;
     int err;
 
-    tracet(3, "writetcpcli: sock=%d state=%d n=%d\n", tcpcli->svr.sock, tcpcli->svr.state, n);
+    TRACET_RTK(3, "writetcpcli: sock=%d state=%d n=%d\n", tcpcli->svr.sock, tcpcli->svr.state, n);
 
     if (!waittcpcli(tcpcli, msg))
         {
@@ -1410,7 +1410,7 @@ int writetcpcli(tcpcli_t *tcpcli, unsigned char *buff, int n, char *msg)
     if ((ns = send_nb(tcpcli->svr.sock, buff, n)) == -1)
         {
             err = errsock();
-            tracet(1, "writetcp: send error sock=%d err=%d\n", tcpcli->svr.sock, err);
+            TRACET_RTK(1, "writetcp: send error sock=%d err=%d\n", tcpcli->svr.sock, err);
             std::snprintf(msg, MAXSTRMSG, "send error (%d)", err);
             discontcp(&tcpcli->svr, tcpcli->tirecon);
             return 0;
@@ -1419,7 +1419,7 @@ int writetcpcli(tcpcli_t *tcpcli, unsigned char *buff, int n, char *msg)
         {
             tcpcli->svr.tact = tickget();
         }
-    tracet(5, "writetcpcli: exit sock=%d ns=%d\n", tcpcli->svr.sock, ns);
+    TRACET_RTK(5, "writetcpcli: exit sock=%d ns=%d\n", tcpcli->svr.sock, ns);
     return ns;
 }
 
@@ -1441,7 +1441,7 @@ int encbase64(char *str, const unsigned char *byte, int n)
     int k;
     int b;
 
-    tracet(4, "encbase64: n=%d\n", n);
+    TRACET_RTK(4, "encbase64: n=%d\n", n);
 
     for (i = j = 0; i / 8 < n;)
         {
@@ -1460,7 +1460,7 @@ int encbase64(char *str, const unsigned char *byte, int n)
             str[j++] = '=';
         }
     str[j] = '\0';
-    tracet(5, "encbase64: str=%s\n", str);
+    TRACET_RTK(5, "encbase64: str=%s\n", str);
     return j;
 }
 
@@ -1473,7 +1473,7 @@ int reqntrip_s(ntrip_t *ntrip, char *msg)
     char *s;
     s = p;
 
-    tracet(3, "reqntrip_s: state=%d\n", ntrip->state);
+    TRACET_RTK(3, "reqntrip_s: state=%d\n", ntrip->state);
 
     p += std::snprintf(p, 256 + NTRIP_MAXSTR, "SOURCE %s %s\r\n", ntrip->passwd, ntrip->mntpnt);
     p += std::snprintf(p, NTRIP_MAXSTR - (p - s), "Source-Agent: NTRIP %s\r\n", NTRIP_AGENT);
@@ -1485,8 +1485,8 @@ int reqntrip_s(ntrip_t *ntrip, char *msg)
             return 0;
         }
 
-    tracet(2, "reqntrip_s: send request state=%d ns=%" PRIdPTR "\n", ntrip->state, p - buff);
-    tracet(5, "reqntrip_s: n=%" PRIdPTR " buff=\n%s\n", p - buff, buff);
+    TRACET_RTK(2, "reqntrip_s: send request state=%d ns=%" PRIdPTR "\n", ntrip->state, p - buff);
+    TRACET_RTK(5, "reqntrip_s: n=%" PRIdPTR " buff=\n%s\n", p - buff, buff);
     ntrip->state = 1;
     return 1;
 }
@@ -1501,7 +1501,7 @@ int reqntrip_c(ntrip_t *ntrip, char *msg)
     char *s;
     s = p;
 
-    tracet(3, "reqntrip_c: state=%d\n", ntrip->state);
+    TRACET_RTK(3, "reqntrip_c: state=%d\n", ntrip->state);
 
     p += std::snprintf(p, NTRIP_MAXSTR, "GET %s/%s HTTP/1.0\r\n", ntrip->url, ntrip->mntpnt);
     p += std::snprintf(p, NTRIP_MAXSTR - (p - s), "User-Agent: NTRIP %s\r\n", NTRIP_AGENT);
@@ -1525,8 +1525,8 @@ int reqntrip_c(ntrip_t *ntrip, char *msg)
             return 0;
         }
 
-    tracet(2, "reqntrip_c: send request state=%d ns=%" PRIdPTR "\n", ntrip->state, p - buff);
-    tracet(5, "reqntrip_c: n=%" PRIdPTR " buff=\n%s\n", p - buff, buff);
+    TRACET_RTK(2, "reqntrip_c: send request state=%d ns=%" PRIdPTR "\n", ntrip->state, p - buff);
+    TRACET_RTK(5, "reqntrip_c: n=%" PRIdPTR " buff=\n%s\n", p - buff, buff);
     ntrip->state = 1;
     return 1;
 }
@@ -1540,9 +1540,9 @@ int rspntrip_s(ntrip_t *ntrip, char *msg)
     char *p;
     char *q;
 
-    tracet(3, "rspntrip_s: state=%d nb=%d\n", ntrip->state, ntrip->nb);
+    TRACET_RTK(3, "rspntrip_s: state=%d nb=%d\n", ntrip->state, ntrip->nb);
     ntrip->buff[ntrip->nb] = '0';
-    tracet(5, "rspntrip_s: n=%d buff=\n%s\n", ntrip->nb, ntrip->buff);
+    TRACET_RTK(5, "rspntrip_s: n=%d buff=\n%s\n", ntrip->nb, ntrip->buff);
 
     if ((p = strstr(reinterpret_cast<char *>(ntrip->buff), NTRIP_RSP_OK_SVR)))
         { /* ok */
@@ -1555,7 +1555,7 @@ int rspntrip_s(ntrip_t *ntrip, char *msg)
                 }
             ntrip->state = 2;
             std::snprintf(msg, MAXSTRMSG, "%s/%s", ntrip->tcp->svr.saddr, ntrip->mntpnt);
-            tracet(2, "rspntrip_s: response ok nb=%d\n", ntrip->nb);
+            TRACET_RTK(2, "rspntrip_s: response ok nb=%d\n", ntrip->nb);
             return 1;
         }
     if ((p = strstr(reinterpret_cast<char *>(ntrip->buff), NTRIP_RSP_ERROR)))
@@ -1570,7 +1570,7 @@ int rspntrip_s(ntrip_t *ntrip, char *msg)
                 }
 
             msg[nb] = 0;
-            tracet(1, "rspntrip_s: %s nb=%d\n", msg, ntrip->nb);
+            TRACET_RTK(1, "rspntrip_s: %s nb=%d\n", msg, ntrip->nb);
             ntrip->nb = 0;
             ntrip->buff[0] = '\0';
             ntrip->state = 0;
@@ -1579,13 +1579,13 @@ int rspntrip_s(ntrip_t *ntrip, char *msg)
     else if (ntrip->nb >= NTRIP_MAXRSP)
         { /* buffer overflow */
             std::snprintf(msg, MAXSTRMSG, "response overflow");
-            tracet(1, "rspntrip_s: response overflow nb=%d\n", ntrip->nb);
+            TRACET_RTK(1, "rspntrip_s: response overflow nb=%d\n", ntrip->nb);
             ntrip->nb = 0;
             ntrip->buff[0] = '\0';
             ntrip->state = 0;
             discontcp(&ntrip->tcp->svr, ntrip->tcp->tirecon);
         }
-    tracet(5, "rspntrip_s: exit state=%d nb=%d\n", ntrip->state, ntrip->nb);
+    TRACET_RTK(5, "rspntrip_s: exit state=%d nb=%d\n", ntrip->state, ntrip->nb);
     return 0;
 }
 
@@ -1597,9 +1597,9 @@ int rspntrip_c(ntrip_t *ntrip, char *msg)
     char *p;
     char *q;
 
-    tracet(3, "rspntrip_c: state=%d nb=%d\n", ntrip->state, ntrip->nb);
+    TRACET_RTK(3, "rspntrip_c: state=%d nb=%d\n", ntrip->state, ntrip->nb);
     ntrip->buff[ntrip->nb] = '0';
-    tracet(5, "rspntrip_c: n=%d buff=\n%s\n", ntrip->nb, ntrip->buff);
+    TRACET_RTK(5, "rspntrip_c: n=%d buff=\n%s\n", ntrip->nb, ntrip->buff);
 
     if ((p = strstr(reinterpret_cast<char *>(ntrip->buff), NTRIP_RSP_OK_CLI)))
         { /* ok */
@@ -1612,7 +1612,7 @@ int rspntrip_c(ntrip_t *ntrip, char *msg)
                 }
             ntrip->state = 2;
             std::snprintf(msg, MAXSTRMSG, "%s/%s", ntrip->tcp->svr.saddr, ntrip->mntpnt);
-            tracet(2, "rspntrip_c: response ok nb=%d\n", ntrip->nb);
+            TRACET_RTK(2, "rspntrip_c: response ok nb=%d\n", ntrip->nb);
             return 1;
         }
     if ((p = strstr(reinterpret_cast<char *>(ntrip->buff), NTRIP_RSP_SRCTBL)))
@@ -1621,11 +1621,11 @@ int rspntrip_c(ntrip_t *ntrip, char *msg)
                 { /* source table request */
                     ntrip->state = 2;
                     std::snprintf(msg, MAXSTRMSG, "source table received");
-                    tracet(2, "rspntrip_c: receive source table nb=%d\n", ntrip->nb);
+                    TRACET_RTK(2, "rspntrip_c: receive source table nb=%d\n", ntrip->nb);
                     return 1;
                 }
             std::snprintf(msg, MAXSTRMSG, "no mountp. reconnect...");
-            tracet(2, "rspntrip_c: no mount point nb=%d\n", ntrip->nb);
+            TRACET_RTK(2, "rspntrip_c: no mount point nb=%d\n", ntrip->nb);
             ntrip->nb = 0;
             ntrip->buff[0] = '\0';
             ntrip->state = 0;
@@ -1642,7 +1642,7 @@ int rspntrip_c(ntrip_t *ntrip, char *msg)
                     ntrip->buff[128] = '\0';
                 }
             std::strncpy(msg, p, MAXSTRMSG);
-            tracet(1, "rspntrip_s: %s nb=%d\n", msg, ntrip->nb);
+            TRACET_RTK(1, "rspntrip_s: %s nb=%d\n", msg, ntrip->nb);
             ntrip->nb = 0;
             ntrip->buff[0] = '\0';
             ntrip->state = 0;
@@ -1651,13 +1651,13 @@ int rspntrip_c(ntrip_t *ntrip, char *msg)
     else if (ntrip->nb >= NTRIP_MAXRSP)
         { /* buffer overflow */
             std::snprintf(msg, MAXSTRMSG, "response overflow");
-            tracet(1, "rspntrip_s: response overflow nb=%d\n", ntrip->nb);
+            TRACET_RTK(1, "rspntrip_s: response overflow nb=%d\n", ntrip->nb);
             ntrip->nb = 0;
             ntrip->buff[0] = '\0';
             ntrip->state = 0;
             discontcp(&ntrip->tcp->svr, ntrip->tcp->tirecon);
         }
-    tracet(5, "rspntrip_c: exit state=%d nb=%d\n", ntrip->state, ntrip->nb);
+    TRACET_RTK(5, "rspntrip_c: exit state=%d nb=%d\n", ntrip->state, ntrip->nb);
     return 0;
 }
 
@@ -1668,7 +1668,7 @@ int waitntrip(ntrip_t *ntrip, char *msg)
     int n;
     char *p;
 
-    tracet(4, "waitntrip: state=%d nb=%d\n", ntrip->state, ntrip->nb);
+    TRACET_RTK(4, "waitntrip: state=%d nb=%d\n", ntrip->state, ntrip->nb);
 
     if (ntrip->state < 0)
         {
@@ -1686,14 +1686,14 @@ int waitntrip(ntrip_t *ntrip, char *msg)
                 {
                     return 0;
                 }
-            tracet(2, "waitntrip: state=%d nb=%d\n", ntrip->state, ntrip->nb);
+            TRACET_RTK(2, "waitntrip: state=%d nb=%d\n", ntrip->state, ntrip->nb);
         }
     if (ntrip->state == 1)
         { /* read response */
             p = reinterpret_cast<char *>(ntrip->buff) + ntrip->nb;
             if ((n = readtcpcli(ntrip->tcp, reinterpret_cast<unsigned char *>(p), NTRIP_MAXRSP - ntrip->nb - 1, msg)) == 0)
                 {
-                    tracet(5, "waitntrip: readtcp n=%d\n", n);
+                    TRACET_RTK(5, "waitntrip: readtcp n=%d\n", n);
                     return 0;
                 }
             ntrip->nb += n;
@@ -1715,7 +1715,7 @@ ntrip_t *openntrip(const char *path, int type, char *msg)
     char port[256] = "";
     char tpath[MAXSTRPATH];
 
-    tracet(3, "openntrip: path=%s type=%d\n", path, type);
+    TRACET_RTK(3, "openntrip: path=%s type=%d\n", path, type);
 
     if (!(ntrip = static_cast<ntrip_t *>(malloc(sizeof(ntrip_t)))))
         {
@@ -1760,7 +1760,7 @@ ntrip_t *openntrip(const char *path, int type, char *msg)
     /* open tcp client stream */
     if (!(ntrip->tcp = opentcpcli(tpath, msg)))
         {
-            tracet(1, "openntrip: opentcp error\n");
+            TRACET_RTK(1, "openntrip: opentcp error\n");
             free(ntrip);
             return nullptr;
         }
@@ -1771,7 +1771,7 @@ ntrip_t *openntrip(const char *path, int type, char *msg)
 /* close ntrip ---------------------------------------------------------------*/
 void closentrip(ntrip_t *ntrip)
 {
-    tracet(3, "closentrip: state=%d\n", ntrip->state);
+    TRACET_RTK(3, "closentrip: state=%d\n", ntrip->state);
     closetcpcli(ntrip->tcp);
     free(ntrip);
 }
@@ -1782,7 +1782,7 @@ int readntrip(ntrip_t *ntrip, unsigned char *buff, int n, char *msg)
 {
     int nb;
 
-    tracet(4, "readntrip: n=%d\n", n);
+    TRACET_RTK(4, "readntrip: n=%d\n", n);
 
     if (!waitntrip(ntrip, msg))
         {
@@ -1802,7 +1802,7 @@ int readntrip(ntrip_t *ntrip, unsigned char *buff, int n, char *msg)
 /* write ntrip ---------------------------------------------------------------*/
 int writentrip(ntrip_t *ntrip, unsigned char *buff, int n, char *msg)
 {
-    tracet(3, "writentrip: n=%d\n", n);
+    TRACET_RTK(3, "writentrip: n=%d\n", n);
 
     if (!waitntrip(ntrip, msg))
         {
@@ -1827,7 +1827,7 @@ void decodeftppath(const char *path, char *addr, char *file, char *user,
     char *p;
     char *q;
 
-    tracet(4, "decodeftpath: path=%s\n", path);
+    TRACET_RTK(4, "decodeftpath: path=%s\n", path);
 
     if (user)
         {
@@ -1905,7 +1905,7 @@ gtime_t nextdltime(const int *topts, int stat)
     int week;
     int tint;
 
-    tracet(3, "nextdltime: topts=%d %d %d %d stat=%d\n", topts[0], topts[1],
+    TRACET_RTK(3, "nextdltime: topts=%d %d %d %d stat=%d\n", topts[0], topts[1],
         topts[2], topts[3], stat);
 
     /* current time (gpst) */
@@ -1932,11 +1932,11 @@ void *ftpthread(void *arg)
 {
     auto *ftp = static_cast<ftp_t *>(arg);
 
-    tracet(3, "ftpthread:\n");
+    TRACET_RTK(3, "ftpthread:\n");
 
     if (!*localdir)
         {
-            tracet(1, "no local directory\n");
+            TRACET_RTK(1, "no local directory\n");
             ftp->error = 11;
             ftp->state = 3;
             return nullptr;
@@ -1967,7 +1967,7 @@ void *ftpthread(void *arg)
     if (fs::exists(tmpfile))
         {
             std::snprintf(ftp->local, 1024, "%s", tmpfile.c_str());  // NOLINT(runtime/printf)
-            tracet(3, "ftpthread: file exists %s\n", ftp->local);
+            TRACET_RTK(3, "ftpthread: file exists %s\n", ftp->local);
             ftp->state = 2;
             return nullptr;
         }
@@ -2010,16 +2010,16 @@ void *ftpthread(void *arg)
         {
             if (fs::remove(local, ec) == false)
                 {
-                    trace(1, "Error removing file %s", local.c_str());
+                    TRACE_RTK(1, "Error removing file %s", local.c_str());
                 }
-            tracet(1, "execcmd error: cmd=%s ret=%d\n", cmd_str.data(), ret);
+            TRACET_RTK(1, "execcmd error: cmd=%s ret=%d\n", cmd_str.data(), ret);
             ftp->error = ret;
             ftp->state = 3;
             return nullptr;
         }
     if (fs::remove(errfile, ec) == false)
         {
-            trace(1, "Error removing file %s", errfile.c_str());
+            TRACE_RTK(1, "Error removing file %s", errfile.c_str());
         }
 
     /* uncompress downloaded file */
@@ -2033,13 +2033,13 @@ void *ftpthread(void *arg)
                         {
                             if (fs::remove(local, ec) == false)
                                 {
-                                    trace(1, "Error removing file %s", local.c_str());
+                                    TRACE_RTK(1, "Error removing file %s", local.c_str());
                                 }
                             local = tmpfile_arg;
                         }
                     else
                         {
-                            tracet(1, "file uncompact error: %s\n", local.c_str());
+                            TRACET_RTK(1, "file uncompact error: %s\n", local.c_str());
                             ftp->error = 12;
                             ftp->state = 3;
                             return nullptr;
@@ -2050,11 +2050,11 @@ void *ftpthread(void *arg)
     int ret2 = std::snprintf(ftp->local, 1024, "%s", local.c_str());  // NOLINT(runtime/printf)
     if (ret2 < 0 || ret2 >= 1024)
         {
-            tracet(3, "Error reading ftp local\n");
+            TRACET_RTK(3, "Error reading ftp local\n");
         }
     ftp->state = 2; /* ftp completed */
 
-    tracet(3, "ftpthread: complete cmd=%s\n", cmd_str.data());
+    TRACET_RTK(3, "ftpthread: complete cmd=%s\n", cmd_str.data());
     return nullptr;
 }
 
@@ -2064,7 +2064,7 @@ ftp_t *openftp(const char *path, int type, char *msg)
 {
     ftp_t *ftp;
 
-    tracet(3, "openftp: path=%s type=%d\n", path, type);
+    TRACET_RTK(3, "openftp: path=%s type=%d\n", path, type);
 
     msg[0] = '\0';
 
@@ -2092,7 +2092,7 @@ ftp_t *openftp(const char *path, int type, char *msg)
 /* close ftp -----------------------------------------------------------------*/
 void closeftp(ftp_t *ftp)
 {
-    tracet(3, "closeftp: state=%d\n", ftp->state);
+    TRACET_RTK(3, "closeftp: state=%d\n", ftp->state);
 
     if (ftp->state != 1)
         {
@@ -2108,7 +2108,7 @@ int readftp(ftp_t *ftp, unsigned char *buff, int n, char *msg)
     unsigned char *p;
     unsigned char *q;
 
-    tracet(4, "readftp: n=%d\n", n);
+    TRACET_RTK(4, "readftp: n=%d\n", n);
 
     time = utc2gpst(timeget());
 
@@ -2121,12 +2121,12 @@ int readftp(ftp_t *ftp, unsigned char *buff, int n, char *msg)
             ftp->state = 1;
             if (std::snprintf(msg, sizeof(ftp->addr), "%s://%s", ftp->proto ? "http" : "ftp", ftp->addr) < 0)
                 {
-                    tracet(1, "readftp: ftp address truncation\n");
+                    TRACET_RTK(1, "readftp: ftp address truncation\n");
                 }
 
             if (pthread_create(&ftp->thread, nullptr, ftpthread, ftp))
                 {
-                    tracet(1, "readftp: ftp thread create error\n");
+                    TRACET_RTK(1, "readftp: ftp thread create error\n");
                     ftp->state = 3;
                     std::strncpy(msg, "ftp thread error", 17);
                     return 0;
@@ -2141,7 +2141,7 @@ int readftp(ftp_t *ftp, unsigned char *buff, int n, char *msg)
         { /* ftp error */
             if (std::snprintf(msg, sizeof(ftp->addr), "%s error (%d)", ftp->proto ? "http" : "ftp", ftp->error) < 0)
                 {
-                    tracet(1, "readftp: ftp address truncation\n");
+                    TRACET_RTK(1, "readftp: ftp address truncation\n");
                 }
 
             /* set next retry time */
@@ -2182,7 +2182,7 @@ int stateftp(ftp_t *ftp)
  *-----------------------------------------------------------------------------*/
 void strinitcom()
 {
-    tracet(3, "strinitcom:\n");
+    TRACET_RTK(3, "strinitcom:\n");
 }
 
 
@@ -2193,7 +2193,7 @@ void strinitcom()
  *-----------------------------------------------------------------------------*/
 void strinit(stream_t *stream)
 {
-    tracet(3, "strinit:\n");
+    TRACET_RTK(3, "strinit:\n");
 
     stream->type = 0;
     stream->mode = 0;
@@ -2244,7 +2244,7 @@ void strinit(stream_t *stream)
  *-----------------------------------------------------------------------------*/
 int stropen(stream_t *stream, int type, int mode, const char *path)
 {
-    tracet(3, "stropen: type=%d mode=%d path=%s\n", type, mode, path);
+    TRACET_RTK(3, "stropen: type=%d mode=%d path=%s\n", type, mode, path);
 
     stream->type = type;
     stream->mode = mode;
@@ -2300,7 +2300,7 @@ int stropen(stream_t *stream, int type, int mode, const char *path)
  *-----------------------------------------------------------------------------*/
 void strclose(stream_t *stream)
 {
-    tracet(3, "strclose: type=%d mode=%d\n", stream->type, stream->mode);
+    TRACET_RTK(3, "strclose: type=%d mode=%d\n", stream->type, stream->mode);
 
     if (stream->port)
         {
@@ -2334,7 +2334,7 @@ void strclose(stream_t *stream)
         }
     else
         {
-            trace(2, "no port to close stream: type=%d\n", stream->type);
+            TRACE_RTK(2, "no port to close stream: type=%d\n", stream->type);
         }
     stream->type = 0;
     stream->mode = 0;
@@ -2394,7 +2394,7 @@ int strread(stream_t *stream, unsigned char *buff, int n)
     char *msg = stream->msg;
     int nr;
 
-    tracet(4, "strread: n=%d\n", n);
+    TRACET_RTK(4, "strread: n=%d\n", n);
 
     if (!(stream->mode & STR_MODE_R) || !stream->port)
         {
@@ -2462,7 +2462,7 @@ int strwrite(stream_t *stream, unsigned char *buff, int n)
     char *msg = stream->msg;
     int ns;
 
-    tracet(3, "strwrite: n=%d\n", n);
+    TRACET_RTK(3, "strwrite: n=%d\n", n);
 
     if (!(stream->mode & STR_MODE_W) || !stream->port)
         {
@@ -2523,7 +2523,7 @@ int strstat(stream_t *stream, char *msg)
 {
     int state;
 
-    tracet(4, "strstat:\n");
+    TRACET_RTK(4, "strstat:\n");
 
     strlock(stream);
     if (msg)
@@ -2590,7 +2590,7 @@ int strstat(stream_t *stream, char *msg)
  *-----------------------------------------------------------------------------*/
 void strsum(stream_t *stream, int *inb, int *inr, int *outb, int *outr)
 {
-    tracet(4, "strsum:\n");
+    TRACET_RTK(4, "strsum:\n");
 
     strlock(stream);
     if (inb)
@@ -2628,7 +2628,7 @@ void strsum(stream_t *stream, int *inb, int *inr, int *outb, int *outr)
  *-----------------------------------------------------------------------------*/
 void strsetopt(const int *opt)
 {
-    tracet(3, "strsetopt: opt=%d %d %d %d %d %d %d %d\n", opt[0], opt[1], opt[2],
+    TRACET_RTK(3, "strsetopt: opt=%d %d %d %d %d %d %d %d\n", opt[0], opt[1], opt[2],
         opt[3], opt[4], opt[5], opt[6], opt[7]);
 
     toinact = 0 < opt[0] && opt[0] < 1000 ? 1000 : opt[0]; /* >=1s */
@@ -2650,7 +2650,7 @@ void strsettimeout(stream_t *stream, int inactive_timeout, int tirecon)
 {
     tcpcli_t *tcpcli;
 
-    tracet(3, "strsettimeout: toinact=%d tirecon=%d\n", inactive_timeout, tirecon);
+    TRACET_RTK(3, "strsettimeout: toinact=%d tirecon=%d\n", inactive_timeout, tirecon);
 
     if (stream->type == STR_TCPCLI)
         {
@@ -2677,7 +2677,7 @@ void strsettimeout(stream_t *stream, int inactive_timeout, int tirecon)
  *-----------------------------------------------------------------------------*/
 void strsetdir(const char *dir)
 {
-    tracet(3, "strsetdir: dir=%s\n", dir);
+    TRACET_RTK(3, "strsetdir: dir=%s\n", dir);
     if (strlen(dir) < 1024)
         {
             std::strncpy(localdir, dir, 1024);
@@ -2693,7 +2693,7 @@ void strsetdir(const char *dir)
  *-----------------------------------------------------------------------------*/
 void strsetproxy(const char *addr)
 {
-    tracet(3, "strsetproxy: addr=%s\n", addr);
+    TRACET_RTK(3, "strsetproxy: addr=%s\n", addr);
     if (strlen(addr) < 256)
         {
             std::strncpy(proxyaddr, addr, 256);
@@ -2732,7 +2732,7 @@ void strsendnmea(stream_t *stream, const double *pos)
     int i;
     int n;
 
-    tracet(3, "strsendnmea: pos=%.3f %.3f %.3f\n", pos[0], pos[1], pos[2]);
+    TRACET_RTK(3, "strsendnmea: pos=%.3f %.3f %.3f\n", pos[0], pos[1], pos[2]);
 
     sol.stat = SOLQ_SINGLE;
     sol.time = utc2gpst(timeget());
@@ -2756,7 +2756,7 @@ int gen_hex(const char *msg, unsigned char *buff)
     int i;
     int narg = 0;
 
-    trace(4, "gen_hex: msg=%s\n", msg);
+    TRACE_RTK(4, "gen_hex: msg=%s\n", msg);
 
     strncpy(mbuff, msg, 1023);
     mbuff[1022] = '\0';
@@ -2792,7 +2792,7 @@ void strsendcmd(stream_t *str, const char *cmd)
     int m;
     int ms;
 
-    tracet(3, "strsendcmd: cmd=%s\n", cmd);
+    TRACET_RTK(3, "strsendcmd: cmd=%s\n", cmd);
 
     for (;;)
         {
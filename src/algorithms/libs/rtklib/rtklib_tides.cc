@@ -58,7 +58,7 @@ void tide_pl(const double *eu, const double *rp, double GMp,
     double cosl;
     int i;
 
-    trace(4, "tide_pl : pos=%.3f %.3f\n", pos[0] * R2D, pos[1] * R2D);
+    TRACE_RTK(4, "tide_pl : pos=%.3f %.3f\n", pos[0] * R2D, pos[1] * R2D);
 
     if ((r = norm_rtk(rp, 3)) <= 0.0)
         {
@@ -98,7 +98,7 @@ void tide_pl(const double *eu, const double *rp, double GMp,
     dr[1] = dp * ep[1] + du * eu[1];
     dr[2] = dp * ep[2] + du * eu[2];
 
-    trace(5, "tide_pl : dr=%.3f %.3f %.3f\n", dr[0], dr[1], dr[2]);
+    TRACE_RTK(5, "tide_pl : dr=%.3f %.3f %.3f\n", dr[0], dr[1], dr[2]);
 }
 
 
@@ -115,7 +115,7 @@ void tide_solid(const double *rsun, const double *rmoon,
     double sinl;
     double sin2l;
 
-    trace(3, "tide_solid: pos=%.3f %.3f opt=%d\n", pos[0] * R2D, pos[1] * R2D, opt);
+    TRACE_RTK(3, "tide_solid: pos=%.3f %.3f opt=%d\n", pos[0] * R2D, pos[1] * R2D, opt);
 
     /* step1: time domain */
     eu[0] = E[2];
@@ -142,7 +142,7 @@ void tide_solid(const double *rsun, const double *rmoon,
             dr[1] += du * E[5] + dn * E[4];
             dr[2] += du * E[8] + dn * E[7];
         }
-    trace(5, "tide_solid: dr=%.3f %.3f %.3f\n", dr[0], dr[1], dr[2]);
+    TRACE_RTK(5, "tide_solid: dr=%.3f %.3f %.3f\n", dr[0], dr[1], dr[2]);
 }
 // #endif /* !IERS_MODEL */
 
@@ -176,7 +176,7 @@ void tide_oload(gtime_t tut, const double *odisp, double *denu)
     int i;
     int j;
 
-    trace(3, "tide_oload:\n");
+    TRACE_RTK(3, "tide_oload:\n");
 
     /* angular argument: see subroutine arg.f for reference [1] */
     time2epoch(tut, ep);
@@ -210,7 +210,7 @@ void tide_oload(gtime_t tut, const double *odisp, double *denu)
     denu[1] = -dp[2];
     denu[2] = dp[0];
 
-    trace(5, "tide_oload: denu=%.3f %.3f %.3f\n", denu[0], denu[1], denu[2]);
+    TRACE_RTK(5, "tide_oload: denu=%.3f %.3f %.3f\n", denu[0], denu[1], denu[2]);
 }
 
 
@@ -250,7 +250,7 @@ void tide_pole(gtime_t tut, const double *pos, const double *erpv,
     double cosl;
     double sinl;
 
-    trace(3, "tide_pole: pos=%.3f %.3f\n", pos[0] * R2D, pos[1] * R2D);
+    TRACE_RTK(3, "tide_pole: pos=%.3f %.3f\n", pos[0] * R2D, pos[1] * R2D);
 
     /* iers mean pole (mas) */
     iers_mean_pole(tut, &xp_bar, &yp_bar);
@@ -266,7 +266,7 @@ void tide_pole(gtime_t tut, const double *pos, const double *erpv,
     denu[1] = -9E-3 * cos(2.0 * pos[0]) * (m1 * cosl + m2 * sinl);  /* dn=-Stheta  (m) */
     denu[2] = -33E-3 * sin(2.0 * pos[0]) * (m1 * cosl + m2 * sinl); /* du= Sr      (m) */
 
-    trace(5, "tide_pole : denu=%.3f %.3f %.3f\n", denu[0], denu[1], denu[2]);
+    TRACE_RTK(5, "tide_pole : denu=%.3f %.3f %.3f\n", denu[0], denu[1], denu[2]);
 }
 
 
@@ -313,7 +313,7 @@ void tidedisp(gtime_t tutc, const double *rr, int opt, const erp_t *erp,
     int year, mon, day;
 #endif
 
-    trace(3, "tidedisp: tutc=%s\n", time_str(tutc, 0));
+    TRACE_RTK(3, "tidedisp: tutc=%s\n", time_str(tutc, 0));
 
     if (erp)
         {
@@ -373,5 +373,5 @@ void tidedisp(gtime_t tutc, const double *rr, int opt, const erp_t *erp,
                     dr[i] += drt[i];
                 }
         }
-    trace(5, "tidedisp: dr=%.3f %.3f %.3f\n", dr[0], dr[1], dr[2]);
+    TRACE_RTK(5, "tidedisp: dr=%.3f %.3f %.3f\n", dr[0], dr[1], dr[2]);
 }
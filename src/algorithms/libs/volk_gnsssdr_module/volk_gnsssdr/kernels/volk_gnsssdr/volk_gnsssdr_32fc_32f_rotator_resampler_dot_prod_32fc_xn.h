@@ -0,0 +1,772 @@
+/*!
+ * \file volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn.h
+ * \brief VOLK_GNSSSDR kernel: resamples N real local code replicas on the fly,
+ * multiplies them by a common phase rotated complex vector and accumulates the
+ * results in N float complex outputs.
+ * \authors <ul>
+ *          <li> Carles Fernandez Prades, 2026. cfernandez(at)cttc.es
+ *          </ul>
+ *
+ * VOLK_GNSSSDR kernel that computes, for each sample, the index of the local
+ * code chip of each tap from the code phase and code phase step, and multiplies
+ * the chip value by the phase-rotated input sample, accumulating the results in
+ * N 32 bits float complex outputs. The resampled replicas are never written to
+ * memory, so the correlation is done in a single pass over the input.
+ * It is optimized to perform the N tap correlation process in GNSS receivers.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn
+ *
+ * \b Overview
+ *
+ * Rotates the reference complex vector and multiplies it by an arbitrary number
+ * of real local code replicas, which are resampled on the fly from \p local_code,
+ * accumulates the results and stores them in the output vector.
+ * The rotation is done at a fixed rate per sample, from an initial \p phase offset.
+ * The result is the same as calling volk_gnsssdr_32f_xn_resampler_32f_xn
+ * followed by volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn, without storing
+ * the resampled replicas, except for samples lying on a chip boundary: the
+ * chip index is computed here in double precision, so that all the
+ * implementations pick the same chip.
+ * This function can be used for Doppler wipe-off and multiple correlator.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li in_common:             Pointer to one of the vectors to be rotated, multiplied and accumulated (reference vector).
+ * \li phase_inc:             Phase increment = lv_cmake(cos(phase_step_rad), sin(phase_step_rad))
+ * \li phase:                 Initial phase = lv_cmake(cos(initial_phase_rad), sin(initial_phase_rad))
+ * \li local_code:            One period of the local code, one sample per chip.
+ * \li rem_code_phase_chips:  Remnant code phase [chips].
+ * \li code_phase_step_chips: Phase increment per sample [chips/sample].
+ * \li shifts_chips:          Vector of floats that defines the spacing (in chips) between the replicas of \p local_code.
+ * \li code_length_chips:     Code length in chips.
+ * \li num_a_vectors:         Number of code replicas to be multiplied by the reference vector and accumulated.
+ * \li num_points:            Number of complex values to be multiplied together, accumulated and stored into \p result.
+ *
+ * \b Outputs
+ * \li phase:                 Final phase.
+ * \li result:                Vector of \p num_a_vectors components with the code replicas multiplied by the rotated \p in_common and accumulated.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_H
+#define INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_H
+
+
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+#include <volk_gnsssdr/volk_gnsssdr_malloc.h>
+#include <math.h>
+
+/*
+ * Index of the local code chip of sample n. The product of the code phase step
+ * and the sample index is exact in double precision, and the terms are always
+ * added in the same order, so every implementation picks the same chip for a
+ * sample lying on a chip boundary, whether or not the compiler contracts the
+ * operations into FMA instructions.
+ */
+static inline int volk_gnsssdr_32fc_32f_rotator_resampler_chip_index(float rem_code_phase_chips, float code_phase_step_chips, float shift_chips, unsigned int code_length_chips, unsigned int n)
+{
+    double code_phase = floor((double)code_phase_step_chips * (double)n + (double)shift_chips - (double)rem_code_phase_chips);
+    // Take into account that in multitap correlators, the shifts can be negative!
+    code_phase -= floor(code_phase / (double)code_length_chips) * (double)code_length_chips;
+    return (int)code_phase;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_generic(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    lv_32fc_t tmp32_1;
+    int n_vec;
+    int local_code_chip_index;
+    unsigned int n;
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0.0f, 0.0f);
+        }
+    for (n = 0; n < num_points; n++)
+        {
+            tmp32_1 = *in_common++ * (*phase);
+
+            // Regenerate phase
+            if (n % 256 == 0)
+                {
+#ifdef __cplusplus
+                    (*phase) /= std::abs((*phase));
+#else
+                    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+#endif
+                }
+
+            (*phase) *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index = volk_gnsssdr_32fc_32f_rotator_resampler_chip_index(rem_code_phase_chips, code_phase_step_chips, shifts_chips[n_vec], code_length_chips, n);
+                    result[n_vec] += tmp32_1 * local_code[local_code_chip_index];
+                }
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <volk_gnsssdr/volk_gnsssdr_sse3_intrinsics.h>
+#include <smmintrin.h>
+
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_u_sse4_1(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* aPtr = (const float*)in_common;
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+    int n_vec;
+    int i;
+    int local_code_chip_index_;
+    unsigned int number;
+
+    __VOLK_ATTR_ALIGNED(16)
+    int local_code_chip_index[4];
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t phase_vec[4];
+
+    const __m128d fours = _mm_set1_pd(4.0);
+    const __m128d code_phase_step_chips_reg = _mm_set1_pd((double)code_phase_step_chips);
+    const __m128d rem_code_phase_chips_reg = _mm_set1_pd((double)rem_code_phase_chips);
+    const __m128d code_length_chips_reg = _mm_set1_pd((double)code_length_chips);
+    __m128d indexn_lo = _mm_set_pd(1.0, 0.0);
+    __m128d indexn_hi = _mm_set_pd(3.0, 2.0);
+    __m128d shift_reg, aux_lo, aux_hi;
+    __m128 a0Val, a1Val, b0Val, b1Val, tmp1, tmp2;
+    __m128i local_code_chip_index_reg;
+
+    __m128* acc = (__m128*)volk_gnsssdr_malloc(num_a_vectors * sizeof(__m128), volk_gnsssdr_get_alignment());
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            acc[n_vec] = _mm_setzero_ps();
+        }
+
+    // Set up the complex rotator
+    __m128 z0, z1, dz_reg;
+    for (i = 0; i < 4; ++i)
+        {
+            phase_vec[i] = _phase;
+            _phase *= phase_inc;
+        }
+    z0 = _mm_load_ps((float*)phase_vec);
+    z1 = _mm_load_ps((float*)(phase_vec + 2));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^4;
+    phase_vec[0] = dz;
+    phase_vec[1] = dz;
+    dz_reg = _mm_load_ps((float*)phase_vec);
+
+    for (number = 0; number < quarterPoints; number++)
+        {
+            a0Val = _mm_loadu_ps(aPtr);
+            a1Val = _mm_loadu_ps(aPtr + 4);
+            a0Val = _mm_complexmul_ps(a0Val, z0);
+            a1Val = _mm_complexmul_ps(a1Val, z1);
+            z0 = _mm_complexmul_ps(z0, dz_reg);
+            z1 = _mm_complexmul_ps(z1, dz_reg);
+
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // code phase in double precision, as in volk_gnsssdr_32fc_32f_rotator_resampler_chip_index
+                    shift_reg = _mm_set1_pd((double)shifts_chips[n_vec]);
+                    aux_lo = _mm_sub_pd(_mm_add_pd(_mm_mul_pd(code_phase_step_chips_reg, indexn_lo), shift_reg), rem_code_phase_chips_reg);
+                    aux_hi = _mm_sub_pd(_mm_add_pd(_mm_mul_pd(code_phase_step_chips_reg, indexn_hi), shift_reg), rem_code_phase_chips_reg);
+                    // floor
+                    aux_lo = _mm_floor_pd(aux_lo);
+                    aux_hi = _mm_floor_pd(aux_hi);
+
+                    // modulo code length, also for negative code phases
+                    aux_lo = _mm_sub_pd(aux_lo, _mm_mul_pd(_mm_floor_pd(_mm_div_pd(aux_lo, code_length_chips_reg)), code_length_chips_reg));
+                    aux_hi = _mm_sub_pd(aux_hi, _mm_mul_pd(_mm_floor_pd(_mm_div_pd(aux_hi, code_length_chips_reg)), code_length_chips_reg));
+                    local_code_chip_index_reg = _mm_unpacklo_epi64(_mm_cvttpd_epi32(aux_lo), _mm_cvttpd_epi32(aux_hi));
+                    _mm_store_si128((__m128i*)local_code_chip_index, local_code_chip_index_reg);
+
+                    // gather the chips, duplicated for the real and imaginary parts
+                    b0Val = _mm_set_ps(local_code[local_code_chip_index[1]], local_code[local_code_chip_index[1]], local_code[local_code_chip_index[0]], local_code[local_code_chip_index[0]]);
+                    b1Val = _mm_set_ps(local_code[local_code_chip_index[3]], local_code[local_code_chip_index[3]], local_code[local_code_chip_index[2]], local_code[local_code_chip_index[2]]);
+
+                    acc[n_vec] = _mm_add_ps(acc[n_vec], _mm_mul_ps(a0Val, b0Val));
+                    acc[n_vec] = _mm_add_ps(acc[n_vec], _mm_mul_ps(a1Val, b1Val));
+                }
+            indexn_lo = _mm_add_pd(indexn_lo, fours);
+            indexn_hi = _mm_add_pd(indexn_hi, fours);
+
+            // Force the rotators back onto the unit circle
+            if ((number % 128) == 0)
+                {
+                    tmp1 = _mm_mul_ps(z0, z0);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    z0 = _mm_div_ps(z0, _mm_sqrt_ps(tmp1));
+                    tmp1 = _mm_mul_ps(z1, z1);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    z1 = _mm_div_ps(z1, _mm_sqrt_ps(tmp1));
+                }
+            aPtr += 8;
+        }
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            _mm_store_ps((float*)phase_vec, acc[n_vec]);  // Store the results back into the dot product vector
+            result[n_vec] = phase_vec[0] + phase_vec[1];
+        }
+    volk_gnsssdr_free(acc);
+
+    tmp1 = _mm_mul_ps(z0, z0);
+    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+    z0 = _mm_div_ps(z0, _mm_sqrt_ps(tmp1));
+    _mm_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+
+    for (number = quarterPoints * 4; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index_ = volk_gnsssdr_32fc_32f_rotator_resampler_chip_index(rem_code_phase_chips, code_phase_step_chips, shifts_chips[n_vec], code_length_chips, number);
+                    result[n_vec] += wo * local_code[local_code_chip_index_];
+                }
+        }
+    (*phase) = _phase;
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <volk_gnsssdr/volk_gnsssdr_sse3_intrinsics.h>
+#include <smmintrin.h>
+
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_a_sse4_1(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* aPtr = (const float*)in_common;
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+    int n_vec;
+    int i;
+    int local_code_chip_index_;
+    unsigned int number;
+
+    __VOLK_ATTR_ALIGNED(16)
+    int local_code_chip_index[4];
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t phase_vec[4];
+
+    const __m128d fours = _mm_set1_pd(4.0);
+    const __m128d code_phase_step_chips_reg = _mm_set1_pd((double)code_phase_step_chips);
+    const __m128d rem_code_phase_chips_reg = _mm_set1_pd((double)rem_code_phase_chips);
+    const __m128d code_length_chips_reg = _mm_set1_pd((double)code_length_chips);
+    __m128d indexn_lo = _mm_set_pd(1.0, 0.0);
+    __m128d indexn_hi = _mm_set_pd(3.0, 2.0);
+    __m128d shift_reg, aux_lo, aux_hi;
+    __m128 a0Val, a1Val, b0Val, b1Val, tmp1, tmp2;
+    __m128i local_code_chip_index_reg;
+
+    __m128* acc = (__m128*)volk_gnsssdr_malloc(num_a_vectors * sizeof(__m128), volk_gnsssdr_get_alignment());
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            acc[n_vec] = _mm_setzero_ps();
+        }
+
+    // Set up the complex rotator
+    __m128 z0, z1, dz_reg;
+    for (i = 0; i < 4; ++i)
+        {
+            phase_vec[i] = _phase;
+            _phase *= phase_inc;
+        }
+    z0 = _mm_load_ps((float*)phase_vec);
+    z1 = _mm_load_ps((float*)(phase_vec + 2));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^4;
+    phase_vec[0] = dz;
+    phase_vec[1] = dz;
+    dz_reg = _mm_load_ps((float*)phase_vec);
+
+    for (number = 0; number < quarterPoints; number++)
+        {
+            a0Val = _mm_load_ps(aPtr);
+            a1Val = _mm_load_ps(aPtr + 4);
+            a0Val = _mm_complexmul_ps(a0Val, z0);
+            a1Val = _mm_complexmul_ps(a1Val, z1);
+            z0 = _mm_complexmul_ps(z0, dz_reg);
+            z1 = _mm_complexmul_ps(z1, dz_reg);
+
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // code phase in double precision, as in volk_gnsssdr_32fc_32f_rotator_resampler_chip_index
+                    shift_reg = _mm_set1_pd((double)shifts_chips[n_vec]);
+                    aux_lo = _mm_sub_pd(_mm_add_pd(_mm_mul_pd(code_phase_step_chips_reg, indexn_lo), shift_reg), rem_code_phase_chips_reg);
+                    aux_hi = _mm_sub_pd(_mm_add_pd(_mm_mul_pd(code_phase_step_chips_reg, indexn_hi), shift_reg), rem_code_phase_chips_reg);
+                    // floor
+                    aux_lo = _mm_floor_pd(aux_lo);
+                    aux_hi = _mm_floor_pd(aux_hi);
+
+                    // modulo code length, also for negative code phases
+                    aux_lo = _mm_sub_pd(aux_lo, _mm_mul_pd(_mm_floor_pd(_mm_div_pd(aux_lo, code_length_chips_reg)), code_length_chips_reg));
+                    aux_hi = _mm_sub_pd(aux_hi, _mm_mul_pd(_mm_floor_pd(_mm_div_pd(aux_hi, code_length_chips_reg)), code_length_chips_reg));
+                    local_code_chip_index_reg = _mm_unpacklo_epi64(_mm_cvttpd_epi32(aux_lo), _mm_cvttpd_epi32(aux_hi));
+                    _mm_store_si128((__m128i*)local_code_chip_index, local_code_chip_index_reg);
+
+                    // gather the chips, duplicated for the real and imaginary parts
+                    b0Val = _mm_set_ps(local_code[local_code_chip_index[1]], local_code[local_code_chip_index[1]], local_code[local_code_chip_index[0]], local_code[local_code_chip_index[0]]);
+                    b1Val = _mm_set_ps(local_code[local_code_chip_index[3]], local_code[local_code_chip_index[3]], local_code[local_code_chip_index[2]], local_code[local_code_chip_index[2]]);
+
+                    acc[n_vec] = _mm_add_ps(acc[n_vec], _mm_mul_ps(a0Val, b0Val));
+                    acc[n_vec] = _mm_add_ps(acc[n_vec], _mm_mul_ps(a1Val, b1Val));
+                }
+            indexn_lo = _mm_add_pd(indexn_lo, fours);
+            indexn_hi = _mm_add_pd(indexn_hi, fours);
+
+            // Force the rotators back onto the unit circle
+            if ((number % 128) == 0)
+                {
+                    tmp1 = _mm_mul_ps(z0, z0);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    z0 = _mm_div_ps(z0, _mm_sqrt_ps(tmp1));
+                    tmp1 = _mm_mul_ps(z1, z1);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    z1 = _mm_div_ps(z1, _mm_sqrt_ps(tmp1));
+                }
+            aPtr += 8;
+        }
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            _mm_store_ps((float*)phase_vec, acc[n_vec]);  // Store the results back into the dot product vector
+            result[n_vec] = phase_vec[0] + phase_vec[1];
+        }
+    volk_gnsssdr_free(acc);
+
+    tmp1 = _mm_mul_ps(z0, z0);
+    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+    z0 = _mm_div_ps(z0, _mm_sqrt_ps(tmp1));
+    _mm_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+
+    for (number = quarterPoints * 4; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index_ = volk_gnsssdr_32fc_32f_rotator_resampler_chip_index(rem_code_phase_chips, code_phase_step_chips, shifts_chips[n_vec], code_length_chips, number);
+                    result[n_vec] += wo * local_code[local_code_chip_index_];
+                }
+        }
+    (*phase) = _phase;
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_u_avx2(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* aPtr = (const float*)in_common;
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+    int n_vec;
+    int i;
+    int local_code_chip_index_;
+    unsigned int number;
+
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[8];
+
+    const __m256d eights = _mm256_set1_pd(8.0);
+    const __m256d code_phase_step_chips_reg = _mm256_set1_pd((double)code_phase_step_chips);
+    const __m256d rem_code_phase_chips_reg = _mm256_set1_pd((double)rem_code_phase_chips);
+    const __m256d code_length_chips_reg = _mm256_set1_pd((double)code_length_chips);
+    __m256d indexn_lo = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+    __m256d indexn_hi = _mm256_set_pd(7.0, 6.0, 5.0, 4.0);
+    __m256d shift_reg, aux_lo, aux_hi;
+    __m256 a0Val, a1Val, b0Val, b1Val, chips, chips_lo, chips_hi;
+    __m256i local_code_chip_index_reg;
+
+    __m256* acc = (__m256*)volk_gnsssdr_malloc(num_a_vectors * sizeof(__m256), volk_gnsssdr_get_alignment());
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            acc[n_vec] = _mm256_setzero_ps();
+        }
+
+    // Set up the complex rotator
+    __m256 z0, z1, dz_reg;
+    for (i = 0; i < 8; ++i)
+        {
+            phase_vec[i] = _phase;
+            _phase *= phase_inc;
+        }
+    z0 = _mm256_load_ps((float*)phase_vec);
+    z1 = _mm256_load_ps((float*)(phase_vec + 4));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^8;
+    for (i = 0; i < 4; ++i)
+        {
+            phase_vec[i] = dz;
+        }
+    dz_reg = _mm256_load_ps((float*)phase_vec);
+    dz_reg = _mm256_complexnormalise_ps(dz_reg);
+
+    for (number = 0; number < eighthPoints; number++)
+        {
+            a0Val = _mm256_loadu_ps(aPtr);
+            a1Val = _mm256_loadu_ps(aPtr + 8);
+            a0Val = _mm256_complexmul_ps(a0Val, z0);
+            a1Val = _mm256_complexmul_ps(a1Val, z1);
+            z0 = _mm256_complexmul_ps(z0, dz_reg);
+            z1 = _mm256_complexmul_ps(z1, dz_reg);
+
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // code phase in double precision, as in volk_gnsssdr_32fc_32f_rotator_resampler_chip_index
+                    shift_reg = _mm256_set1_pd((double)shifts_chips[n_vec]);
+                    aux_lo = _mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(code_phase_step_chips_reg, indexn_lo), shift_reg), rem_code_phase_chips_reg);
+                    aux_hi = _mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(code_phase_step_chips_reg, indexn_hi), shift_reg), rem_code_phase_chips_reg);
+                    // floor
+                    aux_lo = _mm256_floor_pd(aux_lo);
+                    aux_hi = _mm256_floor_pd(aux_hi);
+
+                    // modulo code length, also for negative code phases
+                    aux_lo = _mm256_sub_pd(aux_lo, _mm256_mul_pd(_mm256_floor_pd(_mm256_div_pd(aux_lo, code_length_chips_reg)), code_length_chips_reg));
+                    aux_hi = _mm256_sub_pd(aux_hi, _mm256_mul_pd(_mm256_floor_pd(_mm256_div_pd(aux_hi, code_length_chips_reg)), code_length_chips_reg));
+                    local_code_chip_index_reg = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(aux_lo)), _mm256_cvttpd_epi32(aux_hi), 1);
+
+                    // gather the chips, duplicated for the real and imaginary parts
+                    chips = _mm256_i32gather_ps(local_code, local_code_chip_index_reg, 4);  // t0|t1|t2|t3|t4|t5|t6|t7
+                    chips_lo = _mm256_unpacklo_ps(chips, chips);                            // t0|t0|t1|t1|t4|t4|t5|t5
+                    chips_hi = _mm256_unpackhi_ps(chips, chips);                            // t2|t2|t3|t3|t6|t6|t7|t7
+                    b0Val = _mm256_permute2f128_ps(chips_lo, chips_hi, 0x20);               // t0|t0|t1|t1|t2|t2|t3|t3
+                    b1Val = _mm256_permute2f128_ps(chips_lo, chips_hi, 0x31);               // t4|t4|t5|t5|t6|t6|t7|t7
+
+                    acc[n_vec] = _mm256_add_ps(acc[n_vec], _mm256_mul_ps(a0Val, b0Val));
+                    acc[n_vec] = _mm256_add_ps(acc[n_vec], _mm256_mul_ps(a1Val, b1Val));
+                }
+            indexn_lo = _mm256_add_pd(indexn_lo, eights);
+            indexn_hi = _mm256_add_pd(indexn_hi, eights);
+
+            // Force the rotators back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    z0 = _mm256_complexnormalise_ps(z0);
+                    z1 = _mm256_complexnormalise_ps(z1);
+                }
+            aPtr += 16;
+        }
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            _mm256_store_ps((float*)phase_vec, acc[n_vec]);  // Store the results back into the dot product vector
+            result[n_vec] = lv_cmake(0.0f, 0.0f);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[n_vec] += phase_vec[i];
+                }
+        }
+    volk_gnsssdr_free(acc);
+
+    z0 = _mm256_complexnormalise_ps(z0);
+    _mm256_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+
+    for (number = eighthPoints * 8; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index_ = volk_gnsssdr_32fc_32f_rotator_resampler_chip_index(rem_code_phase_chips, code_phase_step_chips, shifts_chips[n_vec], code_length_chips, number);
+                    result[n_vec] += wo * local_code[local_code_chip_index_];
+                }
+        }
+    (*phase) = _phase;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_a_avx2(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* aPtr = (const float*)in_common;
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+    int n_vec;
+    int i;
+    int local_code_chip_index_;
+    unsigned int number;
+
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[8];
+
+    const __m256d eights = _mm256_set1_pd(8.0);
+    const __m256d code_phase_step_chips_reg = _mm256_set1_pd((double)code_phase_step_chips);
+    const __m256d rem_code_phase_chips_reg = _mm256_set1_pd((double)rem_code_phase_chips);
+    const __m256d code_length_chips_reg = _mm256_set1_pd((double)code_length_chips);
+    __m256d indexn_lo = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+    __m256d indexn_hi = _mm256_set_pd(7.0, 6.0, 5.0, 4.0);
+    __m256d shift_reg, aux_lo, aux_hi;
+    __m256 a0Val, a1Val, b0Val, b1Val, chips, chips_lo, chips_hi;
+    __m256i local_code_chip_index_reg;
+
+    __m256* acc = (__m256*)volk_gnsssdr_malloc(num_a_vectors * sizeof(__m256), volk_gnsssdr_get_alignment());
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            acc[n_vec] = _mm256_setzero_ps();
+        }
+
+    // Set up the complex rotator
+    __m256 z0, z1, dz_reg;
+    for (i = 0; i < 8; ++i)
+        {
+            phase_vec[i] = _phase;
+            _phase *= phase_inc;
+        }
+    z0 = _mm256_load_ps((float*)phase_vec);
+    z1 = _mm256_load_ps((float*)(phase_vec + 4));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^8;
+    for (i = 0; i < 4; ++i)
+        {
+            phase_vec[i] = dz;
+        }
+    dz_reg = _mm256_load_ps((float*)phase_vec);
+    dz_reg = _mm256_complexnormalise_ps(dz_reg);
+
+    for (number = 0; number < eighthPoints; number++)
+        {
+            a0Val = _mm256_load_ps(aPtr);
+            a1Val = _mm256_load_ps(aPtr + 8);
+            a0Val = _mm256_complexmul_ps(a0Val, z0);
+            a1Val = _mm256_complexmul_ps(a1Val, z1);
+            z0 = _mm256_complexmul_ps(z0, dz_reg);
+            z1 = _mm256_complexmul_ps(z1, dz_reg);
+
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // code phase in double precision, as in volk_gnsssdr_32fc_32f_rotator_resampler_chip_index
+                    shift_reg = _mm256_set1_pd((double)shifts_chips[n_vec]);
+                    aux_lo = _mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(code_phase_step_chips_reg, indexn_lo), shift_reg), rem_code_phase_chips_reg);
+                    aux_hi = _mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(code_phase_step_chips_reg, indexn_hi), shift_reg), rem_code_phase_chips_reg);
+                    // floor
+                    aux_lo = _mm256_floor_pd(aux_lo);
+                    aux_hi = _mm256_floor_pd(aux_hi);
+
+                    // modulo code length, also for negative code phases
+                    aux_lo = _mm256_sub_pd(aux_lo, _mm256_mul_pd(_mm256_floor_pd(_mm256_div_pd(aux_lo, code_length_chips_reg)), code_length_chips_reg));
+                    aux_hi = _mm256_sub_pd(aux_hi, _mm256_mul_pd(_mm256_floor_pd(_mm256_div_pd(aux_hi, code_length_chips_reg)), code_length_chips_reg));
+                    local_code_chip_index_reg = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(aux_lo)), _mm256_cvttpd_epi32(aux_hi), 1);
+
+                    // gather the chips, duplicated for the real and imaginary parts
+                    chips = _mm256_i32gather_ps(local_code, local_code_chip_index_reg, 4);  // t0|t1|t2|t3|t4|t5|t6|t7
+                    chips_lo = _mm256_unpacklo_ps(chips, chips);                            // t0|t0|t1|t1|t4|t4|t5|t5
+                    chips_hi = _mm256_unpackhi_ps(chips, chips);                            // t2|t2|t3|t3|t6|t6|t7|t7
+                    b0Val = _mm256_permute2f128_ps(chips_lo, chips_hi, 0x20);               // t0|t0|t1|t1|t2|t2|t3|t3
+                    b1Val = _mm256_permute2f128_ps(chips_lo, chips_hi, 0x31);               // t4|t4|t5|t5|t6|t6|t7|t7
+
+                    acc[n_vec] = _mm256_add_ps(acc[n_vec], _mm256_mul_ps(a0Val, b0Val));
+                    acc[n_vec] = _mm256_add_ps(acc[n_vec], _mm256_mul_ps(a1Val, b1Val));
+                }
+            indexn_lo = _mm256_add_pd(indexn_lo, eights);
+            indexn_hi = _mm256_add_pd(indexn_hi, eights);
+
+            // Force the rotators back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    z0 = _mm256_complexnormalise_ps(z0);
+                    z1 = _mm256_complexnormalise_ps(z1);
+                }
+            aPtr += 16;
+        }
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            _mm256_store_ps((float*)phase_vec, acc[n_vec]);  // Store the results back into the dot product vector
+            result[n_vec] = lv_cmake(0.0f, 0.0f);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[n_vec] += phase_vec[i];
+                }
+        }
+    volk_gnsssdr_free(acc);
+
+    z0 = _mm256_complexnormalise_ps(z0);
+    _mm256_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+
+    for (number = eighthPoints * 8; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index_ = volk_gnsssdr_32fc_32f_rotator_resampler_chip_index(rem_code_phase_chips, code_phase_step_chips, shifts_chips[n_vec], code_length_chips, number);
+                    result[n_vec] += wo * local_code[local_code_chip_index_];
+                }
+        }
+    (*phase) = _phase;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <volk_gnsssdr/volk_gnsssdr_neon_intrinsics.h>
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_neon(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 4;
+    const lv_32fc_t* _in_common = in_common;
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+    int n_vec;
+    int i;
+    int32_t local_code_chip_index_;
+    unsigned int number;
+
+    __VOLK_ATTR_ALIGNED(16)
+    float32_t chips_vec[4];
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t dotProductVector[4];
+
+    float32x4_t chips, inv_mag;
+    float32x4x2_t b_val, phase_val, phase4_val;
+
+    float32x4x2_t* acc = (float32x4x2_t*)volk_gnsssdr_malloc(num_a_vectors * sizeof(float32x4x2_t), volk_gnsssdr_get_alignment());
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            acc[n_vec].val[0] = vdupq_n_f32(0.0f);
+            acc[n_vec].val[1] = vdupq_n_f32(0.0f);
+        }
+
+    // Set up the complex rotator, real and imaginary parts in separate registers
+    for (i = 0; i < 4; ++i)
+        {
+            dotProductVector[i] = _phase;
+            _phase *= phase_inc;
+        }
+    phase_val = vld2q_f32((float32_t*)dotProductVector);
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^4;
+    phase4_val.val[0] = vdupq_n_f32(lv_creal(dz));
+    phase4_val.val[1] = vdupq_n_f32(lv_cimag(dz));
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            /* load 4 complex numbers (float 32 bits each component) and rotate them */
+            b_val = vld2q_f32((float32_t*)_in_common);
+            __VOLK_GNSSSDR_PREFETCH(_in_common + 8);
+            _in_common += 4;
+            b_val = _vmultiply_complexq_f32(b_val, phase_val);
+
+            /* compute next four phases */
+            phase_val = _vmultiply_complexq_f32(phase_val, phase4_val);
+
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // ARMv7 NEON has no double precision lanes, so the chip indexes are
+                    // computed as in the generic implementation
+                    for (i = 0; i < 4; ++i)
+                        {
+                            chips_vec[i] = local_code[volk_gnsssdr_32fc_32f_rotator_resampler_chip_index(rem_code_phase_chips, code_phase_step_chips, shifts_chips[n_vec], code_length_chips, number * 4 + i)];
+                        }
+                    chips = vld1q_f32(chips_vec);
+
+                    acc[n_vec].val[0] = vmlaq_f32(acc[n_vec].val[0], b_val.val[0], chips);
+                    acc[n_vec].val[1] = vmlaq_f32(acc[n_vec].val[1], b_val.val[1], chips);
+                }
+
+            // Force the rotators back onto the unit circle
+            if ((number % 128) == 0)
+                {
+                    inv_mag = _vinvsqrtq_f32(_vmagnitudesquaredq_f32(phase_val));
+                    phase_val.val[0] = vmulq_f32(phase_val.val[0], inv_mag);
+                    phase_val.val[1] = vmulq_f32(phase_val.val[1], inv_mag);
+                }
+        }
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            vst2q_f32((float32_t*)dotProductVector, acc[n_vec]);  // Store the results back into the dot product vector
+            result[n_vec] = lv_cmake(0.0f, 0.0f);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[n_vec] += dotProductVector[i];
+                }
+        }
+    volk_gnsssdr_free(acc);
+
+    vst2q_f32((float32_t*)dotProductVector, phase_val);
+    _phase = dotProductVector[0];
+
+    for (number = neon_iters * 4; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index_ = volk_gnsssdr_32fc_32f_rotator_resampler_chip_index(rem_code_phase_chips, code_phase_step_chips, shifts_chips[n_vec], code_length_chips, number);
+                    result[n_vec] += wo * local_code[local_code_chip_index_];
+                }
+        }
+    (*phase) = _phase;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_H */
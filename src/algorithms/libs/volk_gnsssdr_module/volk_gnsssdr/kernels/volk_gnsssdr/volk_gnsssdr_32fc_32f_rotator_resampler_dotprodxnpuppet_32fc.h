@@ -0,0 +1,279 @@
+/*!
+ * \file volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc.h
+ * \brief Volk puppet for the on-the-fly resampling rotator dot product kernel.
+ * \authors <ul>
+ *          <li> Carles Fernandez Prades, 2026. cfernandez(at)cttc.es
+ *          </ul>
+ *
+ * Volk puppet for integrating the kernel into volk's test system. The
+ * *_two_pass implementations store the resampled replicas in memory and then
+ * run the rotator dot product kernel on them, so volk_gnsssdr_profile reports
+ * the speedup of the one-pass implementations against them. Their resampling
+ * pass follows volk_gnsssdr_32f_xn_resampler_32f_xn, but computes the chip
+ * indexes as the one-pass kernel does, so that both paths correlate against the
+ * same chips and pass the QA.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_H
+#define INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_H
+
+#include "volk_gnsssdr/volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn.h"
+#include "volk_gnsssdr/volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_malloc.h>
+#include <math.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_generic(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    // phases must be normalized. Phase rotator expects a complex exponential input!
+    float rem_carrier_phase_in_rad = 0.25;
+    float phase_step_rad = 0.1;
+    lv_32fc_t phase[1];
+    phase[0] = lv_cmake(cos(rem_carrier_phase_in_rad), sin(rem_carrier_phase_in_rad));
+    lv_32fc_t phase_inc[1];
+    phase_inc[0] = lv_cmake(cos(phase_step_rad), sin(phase_step_rad));
+    unsigned int code_length_chips = 2046;
+    float code_phase_step_chips = ((float)(code_length_chips) + 0.1) / ((float)num_points);
+    float rem_code_phase_chips = -0.234;
+    int num_a_vectors = 3;
+    float shifts_chips[3] = {-0.1, 0.0, 0.1};
+
+    volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_generic(result, local_code, phase_inc[0], phase, in, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+}
+
+#endif  // Generic
+
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_generic_two_pass(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    // Reference two-pass path: resampled replicas are stored in memory and read back
+    float rem_carrier_phase_in_rad = 0.25;
+    float phase_step_rad = 0.1;
+    lv_32fc_t phase[1];
+    phase[0] = lv_cmake(cos(rem_carrier_phase_in_rad), sin(rem_carrier_phase_in_rad));
+    lv_32fc_t phase_inc[1];
+    phase_inc[0] = lv_cmake(cos(phase_step_rad), sin(phase_step_rad));
+    unsigned int code_length_chips = 2046;
+    float code_phase_step_chips = ((float)(code_length_chips) + 0.1) / ((float)num_points);
+    float rem_code_phase_chips = -0.234;
+    int n;
+    unsigned int k;
+    int num_a_vectors = 3;
+    float shifts_chips[3] = {-0.1, 0.0, 0.1};
+
+    float** in_a = (float**)volk_gnsssdr_malloc(sizeof(float*) * num_a_vectors, volk_gnsssdr_get_alignment());
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            in_a[n] = (float*)volk_gnsssdr_malloc(sizeof(float) * num_points, volk_gnsssdr_get_alignment());
+        }
+
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            for (k = 0; k < num_points; k++)
+                {
+                    in_a[n][k] = in[volk_gnsssdr_32fc_32f_rotator_resampler_chip_index(rem_code_phase_chips, code_phase_step_chips, shifts_chips[n], code_length_chips, k)];
+                }
+        }
+    volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_generic(result, local_code, phase_inc[0], phase, (const float**)in_a, num_a_vectors, num_points);
+
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            volk_gnsssdr_free(in_a[n]);
+        }
+    volk_gnsssdr_free(in_a);
+}
+
+#endif  // Generic
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_u_avx_two_pass(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    // Reference two-pass path: resampled replicas are stored in memory and read back
+    float rem_carrier_phase_in_rad = 0.25;
+    float phase_step_rad = 0.1;
+    lv_32fc_t phase[1];
+    phase[0] = lv_cmake(cos(rem_carrier_phase_in_rad), sin(rem_carrier_phase_in_rad));
+    lv_32fc_t phase_inc[1];
+    phase_inc[0] = lv_cmake(cos(phase_step_rad), sin(phase_step_rad));
+    unsigned int code_length_chips = 2046;
+    float code_phase_step_chips = ((float)(code_length_chips) + 0.1) / ((float)num_points);
+    float rem_code_phase_chips = -0.234;
+    int n;
+    unsigned int k;
+    int i;
+    int num_a_vectors = 3;
+    float shifts_chips[3] = {-0.1, 0.0, 0.1};
+    const unsigned int quarterPoints = num_points / 4;
+
+    __VOLK_ATTR_ALIGNED(16)
+    int local_code_chip_index[4];
+    const __m256d fours = _mm256_set1_pd(4.0);
+    const __m256d code_phase_step_chips_reg = _mm256_set1_pd((double)code_phase_step_chips);
+    const __m256d rem_code_phase_chips_reg = _mm256_set1_pd((double)rem_code_phase_chips);
+    const __m256d code_length_chips_reg = _mm256_set1_pd((double)code_length_chips);
+    __m256d indexn, shift_reg, aux;
+
+    float** in_a = (float**)volk_gnsssdr_malloc(sizeof(float*) * num_a_vectors, volk_gnsssdr_get_alignment());
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            in_a[n] = (float*)volk_gnsssdr_malloc(sizeof(float) * num_points, volk_gnsssdr_get_alignment());
+        }
+
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            shift_reg = _mm256_set1_pd((double)shifts_chips[n]);
+            indexn = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+            for (k = 0; k < quarterPoints; k++)
+                {
+                    aux = _mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(code_phase_step_chips_reg, indexn), shift_reg), rem_code_phase_chips_reg);
+                    aux = _mm256_floor_pd(aux);
+                    aux = _mm256_sub_pd(aux, _mm256_mul_pd(_mm256_floor_pd(_mm256_div_pd(aux, code_length_chips_reg)), code_length_chips_reg));
+                    _mm_store_si128((__m128i*)local_code_chip_index, _mm256_cvttpd_epi32(aux));
+                    for (i = 0; i < 4; i++)
+                        {
+                            in_a[n][k * 4 + i] = in[local_code_chip_index[i]];
+                        }
+                    indexn = _mm256_add_pd(indexn, fours);
+                }
+            for (k = quarterPoints * 4; k < num_points; k++)
+                {
+                    in_a[n][k] = in[volk_gnsssdr_32fc_32f_rotator_resampler_chip_index(rem_code_phase_chips, code_phase_step_chips, shifts_chips[n], code_length_chips, k)];
+                }
+        }
+    volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx(result, local_code, phase_inc[0], phase, (const float**)in_a, num_a_vectors, num_points);
+
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            volk_gnsssdr_free(in_a[n]);
+        }
+    volk_gnsssdr_free(in_a);
+}
+
+#endif  // AVX
+
+
+#ifdef LV_HAVE_SSE4_1
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_u_sse4_1(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    // phases must be normalized. Phase rotator expects a complex exponential input!
+    float rem_carrier_phase_in_rad = 0.25;
+    float phase_step_rad = 0.1;
+    lv_32fc_t phase[1];
+    phase[0] = lv_cmake(cos(rem_carrier_phase_in_rad), sin(rem_carrier_phase_in_rad));
+    lv_32fc_t phase_inc[1];
+    phase_inc[0] = lv_cmake(cos(phase_step_rad), sin(phase_step_rad));
+    unsigned int code_length_chips = 2046;
+    float code_phase_step_chips = ((float)(code_length_chips) + 0.1) / ((float)num_points);
+    float rem_code_phase_chips = -0.234;
+    int num_a_vectors = 3;
+    float shifts_chips[3] = {-0.1, 0.0, 0.1};
+
+    volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_u_sse4_1(result, local_code, phase_inc[0], phase, in, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+}
+
+#endif  // SSE4.1
+
+
+#ifdef LV_HAVE_SSE4_1
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_a_sse4_1(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    // phases must be normalized. Phase rotator expects a complex exponential input!
+    float rem_carrier_phase_in_rad = 0.25;
+    float phase_step_rad = 0.1;
+    lv_32fc_t phase[1];
+    phase[0] = lv_cmake(cos(rem_carrier_phase_in_rad), sin(rem_carrier_phase_in_rad));
+    lv_32fc_t phase_inc[1];
+    phase_inc[0] = lv_cmake(cos(phase_step_rad), sin(phase_step_rad));
+    unsigned int code_length_chips = 2046;
+    float code_phase_step_chips = ((float)(code_length_chips) + 0.1) / ((float)num_points);
+    float rem_code_phase_chips = -0.234;
+    int num_a_vectors = 3;
+    float shifts_chips[3] = {-0.1, 0.0, 0.1};
+
+    volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_a_sse4_1(result, local_code, phase_inc[0], phase, in, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+}
+
+#endif  // SSE4.1
+
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_u_avx2(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    // phases must be normalized. Phase rotator expects a complex exponential input!
+    float rem_carrier_phase_in_rad = 0.25;
+    float phase_step_rad = 0.1;
+    lv_32fc_t phase[1];
+    phase[0] = lv_cmake(cos(rem_carrier_phase_in_rad), sin(rem_carrier_phase_in_rad));
+    lv_32fc_t phase_inc[1];
+    phase_inc[0] = lv_cmake(cos(phase_step_rad), sin(phase_step_rad));
+    unsigned int code_length_chips = 2046;
+    float code_phase_step_chips = ((float)(code_length_chips) + 0.1) / ((float)num_points);
+    float rem_code_phase_chips = -0.234;
+    int num_a_vectors = 3;
+    float shifts_chips[3] = {-0.1, 0.0, 0.1};
+
+    volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_u_avx2(result, local_code, phase_inc[0], phase, in, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+}
+
+#endif  // AVX2
+
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_a_avx2(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    // phases must be normalized. Phase rotator expects a complex exponential input!
+    float rem_carrier_phase_in_rad = 0.25;
+    float phase_step_rad = 0.1;
+    lv_32fc_t phase[1];
+    phase[0] = lv_cmake(cos(rem_carrier_phase_in_rad), sin(rem_carrier_phase_in_rad));
+    lv_32fc_t phase_inc[1];
+    phase_inc[0] = lv_cmake(cos(phase_step_rad), sin(phase_step_rad));
+    unsigned int code_length_chips = 2046;
+    float code_phase_step_chips = ((float)(code_length_chips) + 0.1) / ((float)num_points);
+    float rem_code_phase_chips = -0.234;
+    int num_a_vectors = 3;
+    float shifts_chips[3] = {-0.1, 0.0, 0.1};
+
+    volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_a_avx2(result, local_code, phase_inc[0], phase, in, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+}
+
+#endif  // AVX2
+
+
+#ifdef LV_HAVE_NEON
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_neon(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    // phases must be normalized. Phase rotator expects a complex exponential input!
+    float rem_carrier_phase_in_rad = 0.25;
+    float phase_step_rad = 0.1;
+    lv_32fc_t phase[1];
+    phase[0] = lv_cmake(cos(rem_carrier_phase_in_rad), sin(rem_carrier_phase_in_rad));
+    lv_32fc_t phase_inc[1];
+    phase_inc[0] = lv_cmake(cos(phase_step_rad), sin(phase_step_rad));
+    unsigned int code_length_chips = 2046;
+    float code_phase_step_chips = ((float)(code_length_chips) + 0.1) / ((float)num_points);
+    float rem_code_phase_chips = -0.234;
+    int num_a_vectors = 3;
+    float shifts_chips[3] = {-0.1, 0.0, 0.1};
+
+    volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_neon(result, local_code, phase_inc[0], phase, in, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+}
+
+#endif  // NEON
+
+#endif  // INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_H
@@ -0,0 +1,219 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack2bit_8i.h
+ * \brief VOLK_GNSSSDR kernel: unpacks 2-bit samples packed in bytes into 8 bits (char) scalars.
+ * \authors <ul>
+ *          <li> Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *          </ul>
+ *
+ * VOLK_GNSSSDR kernel that unpacks four 2-bit two's complement samples per
+ * byte into 8 bits (char) scalars
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack2bit_8i
+ *
+ * \b Overview
+ *
+ * Unpacks a vector of bytes, each one holding four 2-bit samples, into one
+ * char per sample. The first sample of each byte is in its two least
+ * significant bits. Letting x be the two's complement interpretation of the
+ * two bits of a sample, the output value is 2 * x + 1:
+ *
+ *  x_1  x_0     Value
+ *   0    0       +1
+ *   0    1       +3
+ *   1    0       -3
+ *   1    1       -1
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack2bit_8i(char* outputVector, const unsigned char* inputVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The packed bytes. It must hold at least (num_points + 3) / 4 bytes.
+ * \li num_points: The number of samples to unpack.
+ *
+ * \b Outputs
+ * \li outputVector: The unpacked samples.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack2bit_8i_H
+#define INCLUDED_volk_gnsssdr_8u_unpack2bit_8i_H
+
+#include <volk_gnsssdr/volk_gnsssdr_common.h>
+
+
+static inline void volk_gnsssdr_8u_unpack2bit_8i_tail(char* outputVector, const unsigned char* inputVector, unsigned int num_points)
+{
+    static const char values[4] = {1, 3, -3, -1};
+    unsigned int n;
+    for (n = 0; n < num_points; n++)
+        {
+            outputVector[n] = values[(inputVector[n / 4] >> (2 * (n % 4))) & 3];
+        }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack2bit_8i_generic(char* outputVector, const unsigned char* inputVector, unsigned int num_points)
+{
+    volk_gnsssdr_8u_unpack2bit_8i_tail(outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_8i_u_ssse3(char* outputVector, const unsigned char* inputVector, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 64;
+    unsigned int number;
+    char* outPtr = outputVector;
+    const unsigned char* inPtr = inputVector;
+
+    // Value of each 2-bit code, looked up with a byte shuffle
+    const __m128i values = _mm_setr_epi8(1, 3, -3, -1, 1, 3, -3, -1, 1, 3, -3, -1, 1, 3, -3, -1);
+    const __m128i mask = _mm_set1_epi8(0x03);
+    __m128i packed, v0, v1, v2, v3, v01lo, v01hi, v23lo, v23hi;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            packed = _mm_loadu_si128((__m128i*)inPtr);
+
+            // Sample k of each byte. 16-bit shifts are fine, the mask
+            // discards the bits coming from the neighbor byte
+            v0 = _mm_shuffle_epi8(values, _mm_and_si128(packed, mask));
+            v1 = _mm_shuffle_epi8(values, _mm_and_si128(_mm_srli_epi16(packed, 2), mask));
+            v2 = _mm_shuffle_epi8(values, _mm_and_si128(_mm_srli_epi16(packed, 4), mask));
+            v3 = _mm_shuffle_epi8(values, _mm_and_si128(_mm_srli_epi16(packed, 6), mask));
+
+            // Interleave to s0 s1 s2 s3 of byte 0, s0 s1 s2 s3 of byte 1, ...
+            v01lo = _mm_unpacklo_epi8(v0, v1);
+            v01hi = _mm_unpackhi_epi8(v0, v1);
+            v23lo = _mm_unpacklo_epi8(v2, v3);
+            v23hi = _mm_unpackhi_epi8(v2, v3);
+            _mm_storeu_si128((__m128i*)outPtr, _mm_unpacklo_epi16(v01lo, v23lo));
+            _mm_storeu_si128((__m128i*)(outPtr + 16), _mm_unpackhi_epi16(v01lo, v23lo));
+            _mm_storeu_si128((__m128i*)(outPtr + 32), _mm_unpacklo_epi16(v01hi, v23hi));
+            _mm_storeu_si128((__m128i*)(outPtr + 48), _mm_unpackhi_epi16(v01hi, v23hi));
+
+            inPtr += 16;
+            outPtr += 64;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_8i_tail(outPtr, inPtr, num_points - sse_iters * 64);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_8i_u_avx2(char* outputVector, const unsigned char* inputVector, unsigned int num_points)
+{
+    const unsigned int avx_iters = num_points / 128;
+    unsigned int number;
+    char* outPtr = outputVector;
+    const unsigned char* inPtr = inputVector;
+
+    const __m256i values = _mm256_setr_epi8(1, 3, -3, -1, 1, 3, -3, -1, 1, 3, -3, -1, 1, 3, -3, -1,
+        1, 3, -3, -1, 1, 3, -3, -1, 1, 3, -3, -1, 1, 3, -3, -1);
+    const __m256i mask = _mm256_set1_epi8(0x03);
+    __m256i packed, v0, v1, v2, v3, v01lo, v01hi, v23lo, v23hi, q0, q1, q2, q3;
+
+    for (number = 0; number < avx_iters; number++)
+        {
+            packed = _mm256_loadu_si256((__m256i*)inPtr);
+
+            v0 = _mm256_shuffle_epi8(values, _mm256_and_si256(packed, mask));
+            v1 = _mm256_shuffle_epi8(values, _mm256_and_si256(_mm256_srli_epi16(packed, 2), mask));
+            v2 = _mm256_shuffle_epi8(values, _mm256_and_si256(_mm256_srli_epi16(packed, 4), mask));
+            v3 = _mm256_shuffle_epi8(values, _mm256_and_si256(_mm256_srli_epi16(packed, 6), mask));
+
+            // The unpacks work within each 128-bit lane: q0 holds the
+            // samples of bytes 0-3 and 16-19, q1 of bytes 4-7 and 20-23,
+            // q2 of bytes 8-11 and 24-27, and q3 of bytes 12-15 and 28-31
+            v01lo = _mm256_unpacklo_epi8(v0, v1);
+            v01hi = _mm256_unpackhi_epi8(v0, v1);
+            v23lo = _mm256_unpacklo_epi8(v2, v3);
+            v23hi = _mm256_unpackhi_epi8(v2, v3);
+            q0 = _mm256_unpacklo_epi16(v01lo, v23lo);
+            q1 = _mm256_unpackhi_epi16(v01lo, v23lo);
+            q2 = _mm256_unpacklo_epi16(v01hi, v23hi);
+            q3 = _mm256_unpackhi_epi16(v01hi, v23hi);
+            _mm256_storeu_si256((__m256i*)outPtr, _mm256_permute2x128_si256(q0, q1, 0x20));
+            _mm256_storeu_si256((__m256i*)(outPtr + 32), _mm256_permute2x128_si256(q2, q3, 0x20));
+            _mm256_storeu_si256((__m256i*)(outPtr + 64), _mm256_permute2x128_si256(q0, q1, 0x31));
+            _mm256_storeu_si256((__m256i*)(outPtr + 96), _mm256_permute2x128_si256(q2, q3, 0x31));
+
+            inPtr += 32;
+            outPtr += 128;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_8i_tail(outPtr, inPtr, num_points - avx_iters * 128);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_8i_neon(char* outputVector, const unsigned char* inputVector, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 64;
+    unsigned int number;
+    char* outPtr = outputVector;
+    const unsigned char* inPtr = inputVector;
+
+    const uint8x16_t mask = vdupq_n_u8(0x03);
+    const int8x16_t two = vdupq_n_s8(2);
+    const int8x16_t one = vdupq_n_s8(1);
+    uint8x16_t packed;
+    int8x16_t x;
+    int8x16x4_t samples;
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            packed = vld1q_u8(inPtr);
+            __VOLK_GNSSSDR_PREFETCH(inPtr + 16);
+
+            // Sign extension of the 2-bit code: (x ^ 2) - 2. Then 2 * x + 1
+            x = vsubq_s8(veorq_s8(vreinterpretq_s8_u8(vandq_u8(packed, mask)), two), two);
+            samples.val[0] = vaddq_s8(vshlq_n_s8(x, 1), one);
+            x = vsubq_s8(veorq_s8(vreinterpretq_s8_u8(vandq_u8(vshrq_n_u8(packed, 2), mask)), two), two);
+            samples.val[1] = vaddq_s8(vshlq_n_s8(x, 1), one);
+            x = vsubq_s8(veorq_s8(vreinterpretq_s8_u8(vandq_u8(vshrq_n_u8(packed, 4), mask)), two), two);
+            samples.val[2] = vaddq_s8(vshlq_n_s8(x, 1), one);
+            x = vsubq_s8(veorq_s8(vreinterpretq_s8_u8(vshrq_n_u8(packed, 6)), two), two);
+            samples.val[3] = vaddq_s8(vshlq_n_s8(x, 1), one);
+
+            // Interleaved store: s0 s1 s2 s3 of byte 0, s0 s1 s2 s3 of byte 1, ...
+            vst4q_s8((int8_t*)outPtr, samples);
+
+            inPtr += 16;
+            outPtr += 64;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_8i_tail(outPtr, inPtr, num_points - neon_iters * 64);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack2bit_8i_H */
@@ -29,7 +29,7 @@
 #include <algorithm>  // for std::min
 #include <array>
 #include <cmath>      // for round
-#include <cstdlib>    // for size_t, llabs
+#include <cstdlib>    // for size_t
 #include <exception>  // for exception
 #include <iostream>   // for cerr, cout
 #include <limits>     // for numeric_limits
@@ -97,6 +97,7 @@ hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_)
     this->message_port_register_out(pmt::mp("status"));
 
     d_gnss_synchro_history = std::make_unique<Gnss_circular_deque<Gnss_Synchro>>(1000, d_nchannels_out);
+    d_sample_counter_history = std::make_unique<Gnss_circular_deque<uint64_t>>(1000, d_nchannels_out);
 
     d_Rx_clock_buffer.set_capacity(std::min(std::max(300U / d_T_rx_step_ms, 3U), 20U));
     d_Rx_clock_buffer.clear();
@@ -214,6 +215,7 @@ void hybrid_observables_gs::msg_handler_pvt_to_observables(const pmt::pmt_t &msg
                     for (uint32_t n = 0; n < d_nchannels_out; n++)
                         {
                             d_gnss_synchro_history->clear(n);
+                            d_sample_counter_history->clear(n);
                         }
 
                     LOG(INFO) << "Corrected new RX Time offset: " << static_cast<int>(round(new_rx_clock_offset_s * 1000.0)) << "[ms]";
@@ -230,6 +232,7 @@ void hybrid_observables_gs::msg_handler_pvt_to_observables(const pmt::pmt_t &msg
                             for (uint32_t n = 0; n < d_nchannels_out; n++)
                                 {
                                     d_gnss_synchro_history->clear(n);
+                                    d_sample_counter_history->clear(n);
                                 }
                             LOG(INFO) << "Received reset observables TOW command from PVT";
                             break;
@@ -388,19 +391,78 @@ double hybrid_observables_gs::compute_T_rx_s(const Gnss_Synchro &a) const
 }
 
 
-bool hybrid_observables_gs::interp_trk_obs(Gnss_Synchro &interpolated_obs, uint32_t ch, uint64_t rx_clock) const
+void hybrid_observables_gs::store_trk_obs(uint32_t ch, const Gnss_Synchro &trk_obs)
 {
+    if (d_gnss_synchro_history->size(ch) > 0)
+        {
+            // Check if the last Gnss_Synchro comes from the same satellite as the previous ones.
+            // The sample counters in the history must be increasing for the lookup in interp_trk_obs
+            if (d_gnss_synchro_history->front(ch).PRN != trk_obs.PRN or
+                d_sample_counter_history->back(ch) >= trk_obs.Tracking_sample_counter)
+                {
+                    d_gnss_synchro_history->clear(ch);
+                    d_sample_counter_history->clear(ch);
+                    // LOG(INFO) << "Channel " << d_gnss_synchro_history->front(ch).Channel_ID << " changed satellite to PRN " << trk_obs.PRN;
+                }
+        }
+    d_gnss_synchro_history->push_back(ch, trk_obs);
+    d_gnss_synchro_history->back(ch).RX_time = compute_T_rx_s(trk_obs);
+    d_sample_counter_history->push_back(ch, trk_obs.Tracking_sample_counter);
+}
+
+
+int32_t hybrid_observables_gs::find_nearest_trk_obs(uint32_t ch, uint64_t rx_clock, int64_t &abs_diff) const
+{
+    // The sample counters of a channel history are increasing, so the nearest
+    // element is found by a binary search on the compact copy of the counters
+    const uint32_t history_size = d_sample_counter_history->size(ch);
+    if (history_size == 0)
+        {
+            abs_diff = std::numeric_limits<int64_t>::max();
+            return -1;
+        }
+    // First element with a sample counter not lower than rx_clock
+    uint32_t first = 0;
+    uint32_t count = history_size;
+    while (count > 0)
+        {
+            const uint32_t step = count / 2;
+            if (d_sample_counter_history->get(ch, first + step) < rx_clock)
+                {
+                    first += step + 1;
+                    count -= step + 1;
+                }
+            else
+                {
+                    count = step;
+                }
+        }
+
+    // The nearest element is either that one or the previous one (on a tie, the previous one)
     int32_t nearest_element = -1;
-    int64_t old_abs_diff = std::numeric_limits<int64_t>::max();
-    for (uint32_t i = 0; i < d_gnss_synchro_history->size(ch); i++)
+    abs_diff = std::numeric_limits<int64_t>::max();
+    if (first > 0)
         {
-            const int64_t abs_diff = llabs(static_cast<int64_t>(rx_clock) - static_cast<int64_t>(d_gnss_synchro_history->get(ch, i).Tracking_sample_counter));
-            if (old_abs_diff > abs_diff)
+            nearest_element = static_cast<int32_t>(first - 1);
+            abs_diff = static_cast<int64_t>(rx_clock - d_sample_counter_history->get(ch, first - 1));
+        }
+    if (first < history_size)
+        {
+            const auto diff = static_cast<int64_t>(d_sample_counter_history->get(ch, first) - rx_clock);
+            if (diff < abs_diff)
                 {
-                    old_abs_diff = abs_diff;
-                    nearest_element = static_cast<int32_t>(i);
+                    nearest_element = static_cast<int32_t>(first);
+                    abs_diff = diff;
                 }
         }
+    return nearest_element;
+}
+
+
+bool hybrid_observables_gs::interp_trk_obs(Gnss_Synchro &interpolated_obs, uint32_t ch, uint64_t rx_clock) const
+{
+    int64_t old_abs_diff;
+    const int32_t nearest_element = find_nearest_trk_obs(ch, rx_clock, old_abs_diff);
 
     if (nearest_element != -1 and nearest_element != static_cast<int32_t>(d_gnss_synchro_history->size(ch)))
         {
@@ -739,17 +801,7 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
                                             continue;
                                         }
                                 }
-                            if (d_gnss_synchro_history->size(n) > 0)
-                                {
-                                    // Check if the last Gnss_Synchro comes from the same satellite as the previous ones
-                                    if (d_gnss_synchro_history->front(n).PRN != in[n][m].PRN)
-                                        {
-                                            d_gnss_synchro_history->clear(n);
-                                            // LOG(INFO) << "Channel " << d_gnss_synchro_history->front(n).Channel_ID << " changed satellite to PRN " << in[n][m].PRN;
-                                        }
-                                }
-                            d_gnss_synchro_history->push_back(n, in[n][m]);
-                            d_gnss_synchro_history->back(n).RX_time = compute_T_rx_s(in[n][m]);
+                            store_trk_obs(n, in[n][m]);
                         }
                 }
             consume(n, ninput_items[n]);
@@ -20,7 +20,11 @@
 #ifndef GNSS_SDR_HYBRID_OBSERVABLES_GS_H
 #define GNSS_SDR_HYBRID_OBSERVABLES_GS_H
 
+#define FRIEND_TEST(test_case_name, test_name) \
+    friend class test_case_name##_##test_name##_Test
+
 #include "gnss_block_interface.h"
+#include "gnss_sdr_dump_file.h"
 #include "gnss_time.h"  // for timetags produced by Tracking
 #include "obs_conf.h"
 #include <boost/circular_buffer.hpp>  // for boost::circular_buffer
@@ -65,6 +69,11 @@ public:
 
 private:
     friend hybrid_observables_gs_sptr hybrid_observables_gs_make(const Obs_Conf& conf_);
+    FRIEND_TEST(HybridObservablesLookupTest, NearestAtEntry);
+    FRIEND_TEST(HybridObservablesLookupTest, NearestBetweenEntries);
+    FRIEND_TEST(HybridObservablesLookupTest, NearestOutsideEntries);
+    FRIEND_TEST(HybridObservablesLookupTest, MatchesLinearScan);
+    FRIEND_TEST(HybridObservablesLookupTest, ResetOnNonIncreasingCounter);
 
     explicit hybrid_observables_gs(const Obs_Conf& conf_);
 
@@ -73,6 +82,8 @@ private:
 
     void msg_handler_pvt_to_observables(const pmt::pmt_t& msg);
     double compute_T_rx_s(const Gnss_Synchro& a) const;
+    void store_trk_obs(uint32_t ch, const Gnss_Synchro& trk_obs);
+    int32_t find_nearest_trk_obs(uint32_t ch, uint64_t rx_clock, int64_t& abs_diff) const;
     bool interp_trk_obs(Gnss_Synchro& interpolated_obs, uint32_t ch, uint64_t rx_clock) const;
     void update_TOW(const std::vector<Gnss_Synchro>& data);
     void compute_pranges(std::vector<Gnss_Synchro>& data) const;
@@ -84,6 +95,7 @@ private:
     Obs_Conf d_conf;
 
     std::unique_ptr<Gnss_circular_deque<Gnss_Synchro>> d_gnss_synchro_history;  // Tracking observable history
+    std::unique_ptr<Gnss_circular_deque<uint64_t>> d_sample_counter_history;    // Tracking_sample_counter of each element in d_gnss_synchro_history
 
     boost::circular_buffer<uint64_t> d_Rx_clock_buffer;  // time history
 
@@ -96,7 +108,7 @@ private:
 
     std::string d_dump_filename;
 
-    std::ofstream d_dump_file;
+    Gnss_Sdr_Dump_File d_dump_file;
 
     double d_smooth_filter_M;
     double d_T_rx_step_s;
@@ -10,7 +10,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -21,6 +21,7 @@
 #include "INIReader.h"
 #include "command_event.h"
 #include "gnss_sdr_make_unique.h"
+#include "sample_unpacking.h"
 #include <gnuradio/io_signature.h>
 #include <algorithm>
 #include <array>
@@ -37,6 +38,40 @@
 #endif
 
 
+namespace
+{
+// Two bits per sample (I, Q), four samples per byte, the first one in the
+// most significant bits
+const Byte_Unpacking_Table<gr_complex, 4> &labsat_2bit_table()
+{
+    static const Byte_Unpacking_Table<gr_complex, 4> table([](uint8_t byte, int k) {
+        return gr_complex(static_cast<float>(2 * ((byte >> (7 - 2 * k)) & 1) - 1),
+            static_cast<float>(2 * ((byte >> (6 - 2 * k)) & 1) - 1));
+    });
+    return table;
+}
+
+
+// Four bits per sample (I sign, Q sign, I magnitude, Q magnitude), two
+// samples per byte, the first one in the most significant nibble
+const Byte_Unpacking_Table<gr_complex, 2> &labsat_4bit_table()
+{
+    static const Byte_Unpacking_Table<gr_complex, 2> table([](uint8_t byte, int k) {
+        const int nibble = (byte >> (4 - 4 * k)) & 0x0F;
+        const auto component = [](int sign, int magnitude) {
+            if (sign)
+                {
+                    return magnitude ? -1.0F : -2.0F;
+                }
+            return magnitude ? 2.0F : 1.0F;
+        };
+        return gr_complex(component(nibble & 8, nibble & 2), component(nibble & 4, nibble & 1));
+    });
+    return table;
+}
+}  // namespace
+
+
 labsat23_source_sptr labsat23_make_source_sptr(const char *signal_file_basename, const std::vector<int> &channel_selector, Concurrent_Queue<pmt::pmt_t> *queue, bool digital_io_enabled)
 {
     return labsat23_source_sptr(new labsat23_source(signal_file_basename, channel_selector, queue, digital_io_enabled));
@@ -363,72 +398,25 @@ int labsat23_source::parse_header()
 
 void labsat23_source::decode_samples_one_channel(int16_t input_short, gr_complex *out, int type)
 {
-    std::bitset<16> bs(input_short);
+    const auto high_byte = static_cast<uint8_t>(static_cast<uint16_t>(input_short) >> 8);
+    const auto low_byte = static_cast<uint8_t>(input_short & 0xFF);
     switch (type)
         {
         case 2:
             // two bits per sample, 8 samples per int16
-            for (int i = 0; i < 8; i++)
-                {
-                    out[i] = gr_complex(static_cast<float>(bs[15 - (2 * i)]),
-                        static_cast<float>(bs[14 - (2 * i)]));
-                    out[i] = out[i] * gr_complex(2, 0) - gr_complex(1, 1);
-                }
+            {
+                const auto &table = labsat_2bit_table();
+                std::copy(table[high_byte].cbegin(), table[high_byte].cend(), out);
+                std::copy(table[low_byte].cbegin(), table[low_byte].cend(), out + 4);
+            }
             break;
         case 4:
             //  bits per sample, 4 samples per int16
-            for (int i = 0; i < 4; i++)
-                {
-                    // out[i] = gr_complex(0.0, 0.0);
-                    // In-Phase
-                    if (bs[15 - 4 * i])
-                        {
-                            if (bs[13 - 4 * i])  // 11
-                                {
-                                    out[i] = gr_complex(-1, 0);
-                                }
-                            else  // 10
-                                {
-                                    out[i] = gr_complex(-2, 0);
-                                }
-                        }
-                    else
-                        {
-                            if (bs[13 - 4 * i])  // 01
-                                {
-                                    out[i] = gr_complex(2, 0);
-                                }
-                            else
-                                {
-                                    out[i] = gr_complex(1, 0);
-                                }
-                        }
-
-                    // Quadrature
-                    if (bs[14 - 4 * i])
-                        {
-                            if (bs[12 - 4 * i])  // 11
-                                {
-                                    out[i] += gr_complex(0, -1);
-                                }
-                            else  // 10
-                                {
-                                    out[i] += gr_complex(0, -2);
-                                }
-                        }
-                    else
-                        {
-                            if (bs[12 - 4 * i])  // 01
-                                {
-                                    out[i] += gr_complex(0, 2);
-                                }
-                            else
-                                {
-                                    out[i] += gr_complex(0, 1);
-                                }
-                        }
-                    // out[i] += gr_complex(0.5, 0.5);
-                }
+            {
+                const auto &table = labsat_4bit_table();
+                std::copy(table[high_byte].cbegin(), table[high_byte].cend(), out);
+                std::copy(table[low_byte].cbegin(), table[low_byte].cend(), out + 2);
+            }
             break;
         default:
             break;
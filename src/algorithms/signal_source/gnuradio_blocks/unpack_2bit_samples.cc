@@ -9,7 +9,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -18,23 +18,10 @@
 
 #include "unpack_2bit_samples.h"
 #include <gnuradio/io_signature.h>
+#include <array>
 
-struct byte_2bit_struct
+namespace
 {
-    signed sample_0 : 2;  // <- 2 bits wide only
-    signed sample_1 : 2;  // <- 2 bits wide only
-    signed sample_2 : 2;  // <- 2 bits wide only
-    signed sample_3 : 2;  // <- 2 bits wide only
-};
-
-
-union byte_and_samples
-{
-    int8_t byte;
-    byte_2bit_struct samples;
-};
-
-
 bool systemIsBigEndian()
 {
     union
@@ -47,37 +34,23 @@ bool systemIsBigEndian()
 }
 
 
-bool systemBytesAreBigEndian()
+// Position (shift) of the two bits of each output sample in the input byte
+Byte_Unpacking_Table<int8_t, 4> make_2bit_table(bool big_endian_bytes, bool reverse_interleaving)
 {
-    byte_and_samples b{};
-    b.byte = static_cast<int8_t>(0x01);
-    if (*reinterpret_cast<char *>(&b.byte) == 1)
+    std::array<int, 4> shifts{0, 2, 4, 6};
+    if (reverse_interleaving)
         {
-            return false;
+            shifts = big_endian_bytes ? std::array<int, 4>{4, 6, 0, 2} : std::array<int, 4>{2, 0, 6, 4};
         }
-
-    return true;
-}
-
-
-void swapEndianness(int8_t const *in, std::vector<int8_t> &out, size_t item_size, unsigned int ninput_items)
-{
-    unsigned int i;
-    unsigned int j = 0;
-    int k = 0;
-    int l = 0;
-    size_t skip = item_size - 1;
-
-    for (i = 0; i < ninput_items; ++i)
+    else if (big_endian_bytes)
         {
-            k = static_cast<int>(j + skip);
-            l = static_cast<int>(j);
-            while (k >= l)
-                {
-                    out[j++] = in[k--];
-                }
+            shifts = {6, 4, 2, 0};
         }
+    return Byte_Unpacking_Table<int8_t, 4>([&shifts](uint8_t byte, int k) {
+        return static_cast<int8_t>(2 * twos_complement(byte >> shifts[k], 2) + 1);
+    });
 }
+}  // namespace
 
 
 unpack_2bit_samples_sptr make_unpack_2bit_samples(bool big_endian_bytes,
@@ -101,6 +74,7 @@ unpack_2bit_samples::unpack_2bit_samples(bool big_endian_bytes,
           gr::io_signature::make(1, 1, item_size),
           gr::io_signature::make(1, 1, sizeof(char)),
           4 * item_size),  // we make 4 bytes out for every byte in
+      table_(make_2bit_table(big_endian_bytes, reverse_interleaving)),
       item_size_(item_size),
       big_endian_bytes_(big_endian_bytes),
       big_endian_items_(big_endian_items),
@@ -113,10 +87,6 @@ unpack_2bit_samples::unpack_2bit_samples(bool big_endian_bytes,
     // endianness is not the same as the item endianness:
     swap_endian_items_ = (item_size_ > 1) &&
                          (big_endian_system != big_endian_items);
-
-    bool big_endian_bytes_system = systemBytesAreBigEndian();
-
-    swap_endian_bytes_ = (big_endian_bytes_system != big_endian_bytes_);
 }
 
 
@@ -124,86 +94,29 @@ int unpack_2bit_samples::work(int noutput_items,
     gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
-    auto const *in = reinterpret_cast<signed char const *>(input_items[0]);
+    const auto *in = reinterpret_cast<const uint8_t *>(input_items[0]);
     auto *out = reinterpret_cast<int8_t *>(output_items[0]);
 
-    size_t ninput_bytes = noutput_items / 4;
-    size_t ninput_items = ninput_bytes / item_size_;
+    const size_t ninput_bytes = noutput_items / 4;
 
-    // Handle endian swap if needed
     if (swap_endian_items_)
         {
-            work_buffer_ = std::vector<int8_t>(ninput_bytes);
-            swapEndianness(in, work_buffer_, item_size_, ninput_items);
-
-            in = const_cast<signed char const *>(&work_buffer_[0]);
-        }
-
-    // Here the in pointer can be interpreted as a stream of bytes to be
-    // converted. But we now have two possibilities:
-    // 1) The samples in a byte are in big endian order
-    // 2) The samples in a byte are in little endian order
-
-    byte_and_samples raw_byte{};
-    int n = 0;
-
-    if (!reverse_interleaving_)
-        {
-            if (swap_endian_bytes_)
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                        }
-                }
-            else
+            // Read the bytes of each item in reverse order
+            for (size_t i = 0; i < ninput_bytes; i += item_size_)
                 {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
+                    for (size_t j = item_size_; j > 0; j--)
                         {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
+                            out = table_.unpack(in + i + j - 1, 1, out);
                         }
                 }
         }
+    else if (!big_endian_bytes_ && !reverse_interleaving_)
+        {
+            unpack_2bit_samples_to_int8(in, ninput_bytes, out);
+        }
     else
         {
-            if (swap_endian_bytes_)
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                        }
-                }
-            else
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                        }
-                }
+            table_.unpack(in, ninput_bytes, out);
         }
 
     return noutput_items;
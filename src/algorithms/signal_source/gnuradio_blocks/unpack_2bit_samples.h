@@ -46,7 +46,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -56,9 +56,9 @@
 #define GNSS_SDR_UNPACK_2BIT_SAMPLES_H
 
 #include "gnss_block_interface.h"
+#include "sample_unpacking.h"
 #include <gnuradio/sync_interpolator.h>
 #include <cstdint>
-#include <vector>
 
 /** \addtogroup Signal_Source
  * \{ */
@@ -102,12 +102,11 @@ private:
         bool big_endian_items,
         bool reverse_interleaving);
 
-    std::vector<int8_t> work_buffer_;
+    Byte_Unpacking_Table<int8_t, 4> table_;
     size_t item_size_;
     bool big_endian_bytes_;
     bool big_endian_items_;
     bool swap_endian_items_;
-    bool swap_endian_bytes_;
     bool reverse_interleaving_;
 };
 
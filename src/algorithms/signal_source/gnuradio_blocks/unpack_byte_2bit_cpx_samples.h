@@ -13,7 +13,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -23,7 +23,9 @@
 #define GNSS_SDR_UNPACK_BYTE_2BIT_CPX_SAMPLES_H
 
 #include "gnss_block_interface.h"
+#include "sample_unpacking.h"
 #include <gnuradio/sync_interpolator.h>
+#include <cstdint>
 
 /** \addtogroup Signal_Source
  * \{ */
@@ -52,6 +54,7 @@ public:
 
 private:
     friend unpack_byte_2bit_cpx_samples_sptr make_unpack_byte_2bit_cpx_samples_sptr();
+    Byte_Unpacking_Table<int16_t, 4> table_;
 };
 
 
@@ -10,7 +10,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -28,7 +28,10 @@ unpack_byte_4bit_samples_sptr make_unpack_byte_4bit_samples()
 unpack_byte_4bit_samples::unpack_byte_4bit_samples() : sync_interpolator("unpack_byte_4bit_samples",
                                                            gr::io_signature::make(1, 1, sizeof(int8_t)),
                                                            gr::io_signature::make(1, 1, sizeof(int16_t)),
-                                                           2)
+                                                           2),
+                                                       table_([](uint8_t byte, int k) {
+                                                           return static_cast<int16_t>(2 * twos_complement(byte >> (4 * k), 4) + 1);
+                                                       })
 {
 }
 
@@ -37,31 +40,10 @@ int unpack_byte_4bit_samples::work(int noutput_items,
     gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
-    const auto *in = reinterpret_cast<const int8_t *>(input_items[0]);
+    const auto *in = reinterpret_cast<const uint8_t *>(input_items[0]);
     auto *out = reinterpret_cast<int16_t *>(output_items[0]);
-    int n = 0;
-    unsigned char tmp_char2;
-    for (int i = 0; i < noutput_items / 2; i++)
-        {
-            tmp_char2 = in[i] & 0x0F;
-            if (tmp_char2 >= 8)
-                {
-                    out[n++] = static_cast<int16_t>(2 * (tmp_char2 - 16) + 1);
-                }
-            else
-                {
-                    out[n++] = static_cast<int16_t>(2 * tmp_char2 + 1);
-                }
-            tmp_char2 = in[i] >> 4;
-            tmp_char2 = tmp_char2 & 0x0F;
-            if (tmp_char2 >= 8)
-                {
-                    out[n++] = static_cast<int16_t>(2 * (tmp_char2 - 16) + 1);
-                }
-            else
-                {
-                    out[n++] = static_cast<int16_t>(2 * tmp_char2 + 1);
-                }
-        }
+
+    // Low nibble first
+    table_.unpack(in, noutput_items / 2, out);
     return noutput_items;
 }
@@ -8,7 +8,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is not part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -28,7 +28,11 @@ unpack_intspir_1bit_samples_sptr make_unpack_intspir_1bit_samples()
 unpack_intspir_1bit_samples::unpack_intspir_1bit_samples() : sync_interpolator("unpack_intspir_1bit_samples",
                                                                  gr::io_signature::make(1, 1, sizeof(int)),
                                                                  gr::io_signature::make(1, 1, sizeof(float)),
-                                                                 2)
+                                                                 2),
+                                                             table_([](uint8_t byte, int k) {
+                                                                 // For historical reasons, values are float versions of short int limits (32767)
+                                                                 return ((byte >> k) & 1) == 1 ? 32767.0F : -32767.0F;
+                                                             })
 {
 }
 
@@ -40,29 +44,12 @@ int unpack_intspir_1bit_samples::work(int noutput_items,
     const auto *in = reinterpret_cast<const signed int *>(input_items[0]);
     auto *out = reinterpret_cast<float *>(output_items[0]);
 
-    int n = 0;
-    int channel = 1;
     for (int i = 0; i < noutput_items / 2; i++)
         {
-            // Read packed input sample (1 byte = 1 complex sample)
-            // For historical reasons, values are float versions of short int limits (32767)
-            signed int val = in[i];
-            if (((val >> ((channel - 1) * 2)) & 1) == 1)
-                {
-                    out[n++] = static_cast<float>(32767.0);
-                }
-            else
-                {
-                    out[n++] = static_cast<float>(-32767.0);
-                }
-            if (((val >> (2 * channel - 1)) & 1) == 1)
-                {
-                    out[n++] = static_cast<float>(32767.0);
-                }
-            else
-                {
-                    out[n++] = static_cast<float>(-32767.0);
-                }
+            // Read packed input sample (1 int = 1 complex sample, in its two least significant bits)
+            const auto &sample = table_[static_cast<uint8_t>(in[i] & 0xFF)];
+            *out++ = sample[0];
+            *out++ = sample[1];
         }
     return noutput_items;
 }
@@ -9,7 +9,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is not part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -19,6 +19,7 @@
 #define GNSS_SDR_UNPACK_INTSPIR_1BIT_SAMPLES_H
 
 #include "gnss_block_interface.h"
+#include "sample_unpacking.h"
 #include <gnuradio/sync_interpolator.h>
 
 
@@ -49,6 +50,7 @@ public:
 
 private:
     friend unpack_intspir_1bit_samples_sptr make_unpack_intspir_1bit_samples_sptr();
+    Byte_Unpacking_Table<float, 2> table_;
 };
 
 
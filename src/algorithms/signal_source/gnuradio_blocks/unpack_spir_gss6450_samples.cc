@@ -9,7 +9,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is not part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -18,7 +18,6 @@
 
 #include "unpack_spir_gss6450_samples.h"
 #include <gnuradio/io_signature.h>
-#include <cmath>
 
 unpack_spir_gss6450_samples_sptr make_unpack_spir_gss6450_samples(int adc_nbit_)
 {
@@ -30,6 +29,18 @@ unpack_spir_gss6450_samples::unpack_spir_gss6450_samples(int adc_nbit)
     : gr::sync_interpolator("unpack_spir_gss6450_samples",
           gr::io_signature::make(1, 1, sizeof(int32_t)),
           gr::io_signature::make(1, 1, sizeof(gr_complex)), 16 / adc_nbit),
+      table_2bit_([](uint8_t byte, int k) {
+          // Two samples per byte, the first one in the most significant
+          // nibble. I in the two least significant bits of each nibble
+          const uint32_t nibble = (k == 0) ? (byte >> 4) : byte;
+          return gr_complex(static_cast<float>(twos_complement(nibble, 2)),
+              static_cast<float>(twos_complement(nibble >> 2, 2)));
+      }),
+      table_4bit_([](uint8_t byte, int /* k */) {
+          // One sample per byte, I in the least significant nibble
+          return gr_complex(static_cast<float>(twos_complement(byte, 4)),
+              static_cast<float>(twos_complement(byte >> 4, 4)));
+      }),
       adc_bits(adc_nbit),
       samples_per_int(16 / adc_bits)
 {
@@ -38,67 +49,23 @@ unpack_spir_gss6450_samples::unpack_spir_gss6450_samples(int adc_nbit)
 
 void unpack_spir_gss6450_samples::decode_4bits_word(uint32_t input_uint32, gr_complex* out, int adc_bits_)
 {
-    int8_t tmp_char;
-    float Q;
-    float I;
+    // The last sample of the word is in its least significant bits
     switch (adc_bits_)
         {
         case 2:
             // four bits per complex sample (2 I + 2 Q), 8 samples per int32[s0,s1,s2,s3,s4,s5,s6,s7]
-            for (int i = 0; i < 8; i++)
+            for (int j = 0; j < 4; j++)
                 {
-                    tmp_char = input_uint32 & 3;
-
-                    if (tmp_char >= 2)
-                        {
-                            I = static_cast<float>(tmp_char - 4);
-                        }
-                    else
-                        {
-                            I = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 2;
-                    tmp_char = input_uint32 & 3;
-                    if (tmp_char >= 2)
-                        {
-                            Q = static_cast<float>(tmp_char - 4);
-                        }
-                    else
-                        {
-                            Q = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 2;
-
-                    out[7 - i] = gr_complex(I, Q);
+                    const auto& samples = table_2bit_[static_cast<uint8_t>(input_uint32 >> (8 * j))];
+                    out[6 - 2 * j] = samples[0];
+                    out[7 - 2 * j] = samples[1];
                 }
             break;
         case 4:
             // eight bits per complex sample (4 I + 4 Q), 4 samples per int32= [s0,s1,s2,s3]
-            for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 4; j++)
                 {
-                    tmp_char = input_uint32 & 0x0F;
-
-                    if (tmp_char >= 8)
-                        {
-                            I = static_cast<float>(tmp_char - 16);
-                        }
-                    else
-                        {
-                            I = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 4;
-                    tmp_char = input_uint32 & 0x0F;
-                    if (tmp_char >= 8)
-                        {
-                            Q = static_cast<float>(tmp_char - 16);
-                        }
-                    else
-                        {
-                            Q = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 4;
-
-                    out[3 - i] = gr_complex(I, Q);
+                    out[3 - j] = table_4bit_[static_cast<uint8_t>(input_uint32 >> (8 * j))][0];
                 }
             break;
         }
@@ -107,16 +74,14 @@ void unpack_spir_gss6450_samples::decode_4bits_word(uint32_t input_uint32, gr_co
 int unpack_spir_gss6450_samples::work(int noutput_items,
     gr_vector_const_void_star& input_items, gr_vector_void_star& output_items)
 {
-    const auto* in = reinterpret_cast<const int32_t*>(input_items[0]);
+    const auto* in = reinterpret_cast<const uint32_t*>(input_items[0]);
     auto* out = reinterpret_cast<gr_complex*>(output_items[0]);
-    int n_sample = 0;
-    int in_counter = 0;
-    do
+    const int nwords = noutput_items / samples_per_int;
+    for (int i = 0; i < nwords; i++)
         {
-            decode_4bits_word(in[in_counter++], &out[n_sample], adc_bits);
-            n_sample += samples_per_int;
+            decode_4bits_word(in[i], out, adc_bits);
+            out += samples_per_int;
         }
-    while (n_sample < noutput_items);
 
     return noutput_items;
 }
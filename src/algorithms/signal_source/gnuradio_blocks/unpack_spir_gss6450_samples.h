@@ -9,7 +9,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is not part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -19,7 +19,9 @@
 #define GNSS_SDR_UNPACK_SPIR_GSS6450_SAMPLES_H
 
 #include "gnss_block_interface.h"
+#include "sample_unpacking.h"
 #include <gnuradio/sync_interpolator.h>
+#include <cstdint>
 
 /** \addtogroup Signal_Source
  * \{ */
@@ -45,6 +47,8 @@ public:
 
 private:
     friend unpack_spir_gss6450_samples_sptr make_unpack_spir_gss6450_samples_sptr(int adc_nbit);
+    Byte_Unpacking_Table<gr_complex, 2> table_2bit_;
+    Byte_Unpacking_Table<gr_complex, 1> table_4bit_;
     int adc_bits;
     int samples_per_int;
 };
@@ -8,13 +8,14 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
  */
 
 #include "ion_gsms_chunk_data.h"
+#include "sample_unpacking.h"
 #include <cstring>
 #if USE_GLOG_AND_GFLAGS
 #include <glog/logging.h>
@@ -23,6 +24,54 @@
 #endif
 
 
+namespace
+{
+// Four 2-bit samples per byte, the first one in the most significant bits,
+// for each of the stream encodings
+const std::vector<Byte_Unpacking_Table<int8_t, 4>>& two_bit_unpacking_tables()
+{
+    static const std::vector<Byte_Unpacking_Table<int8_t, 4>> tables = [] {
+        std::vector<Byte_Unpacking_Table<int8_t, 4>> t;
+        for (int encoding = 0; encoding < 11; encoding++)
+            {
+                t.emplace_back([encoding](uint8_t byte, int k) {
+                    return GnssMetadata::two_bit_look_up<int8_t>[encoding][(byte >> (6 - 2 * k)) & 3];
+                });
+            }
+        return t;
+    }();
+    return tables;
+}
+
+
+// Other word and sample types are decoded sample by sample
+template <typename WT, typename OT>
+bool write_byte_aligned_2bit_samples(IONGSMSChunkUnpackingCtx<WT>& /* ctx */, std::size_t /* sample_count */, GnssMetadata::StreamEncoding /* stream_encoding */, OT* /* out */)
+{
+    return false;
+}
+
+
+// Byte-aligned 2-bit samples in 8-bit words: decode a whole byte per lookup.
+// Returns false if the samples are not aligned to the bytes
+bool write_byte_aligned_2bit_samples(IONGSMSChunkUnpackingCtx<int8_t>& ctx, std::size_t sample_count, GnssMetadata::StreamEncoding stream_encoding, int8_t* out)
+{
+    if (ctx.word_shift_direction_ != GnssMetadata::Chunk::Left || ctx.bitshift_ != 0 ||
+        sample_count % 4 != 0 || stream_encoding >= 11)
+        {
+            return false;
+        }
+    const auto& table = two_bit_unpacking_tables()[stream_encoding];
+    for (std::size_t i = 0; i < sample_count / 4; ++i)
+        {
+            out = table.unpack(reinterpret_cast<const uint8_t*>(&ctx.current_word_), 1, out);
+            ctx.shift_current_word(8);
+        }
+    return true;
+}
+}  // namespace
+
+
 IONGSMSChunkData::IONGSMSChunkData(const GnssMetadata::Chunk& chunk, const std::vector<std::string>& stream_ids, std::size_t output_stream_offset)
     : chunk_(chunk),
       sizeword_(chunk_.SizeWord()),
@@ -216,6 +265,13 @@ void IONGSMSChunkData::write_n_samples(
     GnssMetadata::StreamEncoding stream_encoding,
     OT** out)
 {
+    if (sample_bitsize == 2 && lump_shift != GnssMetadata::Lump::shiftRight &&
+        write_byte_aligned_2bit_samples(ctx, sample_count, stream_encoding, *out))
+        {
+            (*out) += sample_count;
+            return;
+        }
+
     if (lump_shift == GnssMetadata::Lump::shiftRight)
         {
             auto* sample = static_cast<OT*>(*out);
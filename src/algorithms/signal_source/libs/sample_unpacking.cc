@@ -0,0 +1,25 @@
+/*!
+ * \file sample_unpacking.cc
+ * \brief Lookup tables and kernels for unpacking samples of front-ends that
+ * pack several samples in each byte
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "sample_unpacking.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+
+
+void unpack_2bit_samples_to_int8(const uint8_t* in, size_t num_bytes, int8_t* out)
+{
+    volk_gnsssdr_8u_unpack2bit_8i(reinterpret_cast<char*>(out), in, static_cast<unsigned int>(4 * num_bytes));
+}
@@ -0,0 +1,96 @@
+/*!
+ * \file sample_unpacking.h
+ * \brief Lookup tables and kernels for unpacking samples of front-ends that
+ * pack several samples in each byte
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_SAMPLE_UNPACKING_H
+#define GNSS_SDR_SAMPLE_UNPACKING_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_libs
+ * \{ */
+
+
+/*!
+ * \brief Table with the N samples of type T packed in each of the 256
+ * possible byte values.
+ *
+ * The table is filled once, calling sample(byte, k) for the k-th sample
+ * of each byte, and unpacking becomes a copy of N samples per input byte.
+ */
+template <typename T, int N>
+class Byte_Unpacking_Table
+{
+public:
+    template <typename F>
+    explicit Byte_Unpacking_Table(F sample)
+    {
+        for (int byte = 0; byte < 256; byte++)
+            {
+                for (int k = 0; k < N; k++)
+                    {
+                        d_table[byte][k] = sample(static_cast<uint8_t>(byte), k);
+                    }
+            }
+    }
+
+    //! Samples packed in byte
+    inline const std::array<T, N>& operator[](uint8_t byte) const
+    {
+        return d_table[byte];
+    }
+
+    //! Unpacks num_bytes bytes into N * num_bytes samples. Returns the end of the output
+    inline T* unpack(const uint8_t* in, size_t num_bytes, T* out) const
+    {
+        for (size_t i = 0; i < num_bytes; i++)
+            {
+                out = std::copy(d_table[in[i]].cbegin(), d_table[in[i]].cend(), out);
+            }
+        return out;
+    }
+
+private:
+    std::array<std::array<T, N>, 256> d_table{};
+};
+
+
+/*!
+ * \brief Value of a code of the given number of bits in two's complement
+ */
+inline int32_t twos_complement(uint32_t code, int bits)
+{
+    const uint32_t sign = 1U << (bits - 1);
+    return static_cast<int32_t>((code & ((sign << 1) - 1)) ^ sign) - static_cast<int32_t>(sign);
+}
+
+
+/*!
+ * \brief Unpacks four 2-bit samples per byte, the first one in the two least
+ * significant bits, into 2 * x + 1 values, being x the two's complement
+ * interpretation of each sample. Uses the SIMD kernels of VOLK_GNSSSDR.
+ */
+void unpack_2bit_samples_to_int8(const uint8_t* in, size_t num_bytes, int8_t* out);
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_SAMPLE_UNPACKING_H
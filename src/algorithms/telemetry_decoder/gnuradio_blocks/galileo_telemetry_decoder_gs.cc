@@ -11,7 +11,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -384,29 +384,17 @@ void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, in
     d_viterbi->decode(page_part_bits, page_part_symbols_soft_value);
 
     // 3. Call the Galileo page decoder
-    std::string page_String;
-    page_String.reserve(decoded_length);
-    for (int32_t i = 0; i < decoded_length; i++)
-        {
-            if (page_part_bits[i] > 0)
-                {
-                    page_String.push_back('1');
-                }
-            else
-                {
-                    page_String.push_back('0');
-                }
-        }
+    const Gnss_Packed_Frame<GALILEO_INAV_PAGE_PART_BITS> page_part(page_part_bits);
 
     if (d_enable_navdata_monitor)
         {
-            d_nav_msg_packet.nav_message = page_String;
+            d_nav_msg_packet.nav_message = page_part.to_string();
         }
 
     if (page_part_bits[0] == 1)
         {
             // DECODE COMPLETE WORD (even + odd) and TEST CRC
-            d_inav_nav.split_page(std::move(page_String), d_flag_even_word_arrived);
+            d_inav_nav.split_page(page_part, d_flag_even_word_arrived);
             if (d_inav_nav.get_flag_CRC_test() == true)
                 {
                     if (d_band == '1')
@@ -434,7 +422,7 @@ void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, in
     else
         {
             // STORE HALF WORD (even page)
-            d_inav_nav.split_page(std::move(page_String), d_flag_even_word_arrived);
+            d_inav_nav.split_page(page_part, d_flag_even_word_arrived);
             d_flag_even_word_arrived = 1;
         }
 
@@ -640,27 +628,15 @@ void galileo_telemetry_decoder_gs::decode_FNAV_word(float *page_symbols, int32_t
     d_viterbi->decode(page_bits, page_symbols_soft_value);
 
     // 3. Call the Galileo page decoder
-    std::string page_String;
-    page_String.reserve(decoded_length);
-    for (int32_t i = 0; i < decoded_length; i++)
-        {
-            if (page_bits[i] > 0)
-                {
-                    page_String.push_back('1');
-                }
-            else
-                {
-                    page_String.push_back('0');
-                }
-        }
+    const Gnss_Packed_Frame<GALILEO_FNAV_PAGE_BITS> page(page_bits);
 
     if (d_enable_navdata_monitor)
         {
-            d_nav_msg_packet.nav_message = page_String;
+            d_nav_msg_packet.nav_message = page.to_string();
         }
 
     // DECODE COMPLETE WORD (even + odd) and TEST CRC
-    d_fnav_nav.split_page(page_String);
+    d_fnav_nav.split_page(page);
     if (d_fnav_nav.get_flag_CRC_test() == true)
         {
             DLOG(INFO) << "Galileo E5a CRC correct in channel " << d_channel << " from satellite " << d_satellite << " with CN0=" << cn0 << " dB-Hz";
@@ -26,6 +26,7 @@
 #include "galileo_inav_message.h"     // for Galileo_Inav_Message
 #include "gnss_block_interface.h"     // for gnss_shared_ptr (adapts smart pointer type to GNU Radio version)
 #include "gnss_satellite.h"           // for Gnss_Satellite
+#include "gnss_sdr_dump_file.h"
 #include "gnss_time.h"                // for GnssTime
 #include "nav_message_packet.h"       // for Nav_Message_Packet
 #include "tlm_conf.h"                 // for Tlm_Conf
@@ -92,7 +93,7 @@ private:
     std::vector<float> d_page_part_symbols;
 
     std::string d_dump_filename;
-    std::ofstream d_dump_file;
+    Gnss_Sdr_Dump_File d_dump_file;
 
     boost::circular_buffer<float> d_symbol_history;
 
@@ -23,6 +23,7 @@
 #include "glonass_gnav_navigation_message.h"
 #include "gnss_block_interface.h"
 #include "gnss_satellite.h"
+#include "gnss_sdr_dump_file.h"
 #include "gnss_synchro.h"
 #include "nav_message_packet.h"
 #include "tlm_conf.h"
@@ -100,7 +101,7 @@ private:
     std::unique_ptr<Tlm_CRC_Stats> d_Tlm_CRC_Stats;
 
     std::string d_dump_filename;
-    std::ofstream d_dump_file;
+    Gnss_Sdr_Dump_File d_dump_file;
 
     double d_preamble_time_samples;
     double d_TOW_at_current_symbol;
@@ -19,6 +19,7 @@
 #include "GPS_L1_CA.h"
 #include "gnss_block_interface.h"
 #include "gnss_satellite.h"
+#include "gnss_sdr_dump_file.h"
 #include "gnss_synchro.h"
 #include "gnss_time.h"  // for timetags produced by Tracking
 #include "gps_navigation_message.h"
@@ -87,7 +88,7 @@ private:
     std::array<int32_t, GPS_CA_PREAMBLE_LENGTH_BITS> d_preamble_samples{};
 
     std::string d_dump_filename;
-    std::ofstream d_dump_file;
+    Gnss_Sdr_Dump_File d_dump_file;
 
     boost::circular_buffer<float> d_symbol_history;
 
@@ -20,6 +20,7 @@
 #include "GPS_L5.h"  // for GPS_L5I_NH_CODE_LENGTH
 #include "gnss_block_interface.h"
 #include "gnss_satellite.h"               // for Gnss_Satellite
+#include "gnss_sdr_dump_file.h"
 #include "gps_cnav_navigation_message.h"  // for Gps_CNAV_Navigation_Message
 #include "nav_message_packet.h"
 #include "tlm_conf.h"
@@ -82,7 +83,7 @@ private:
     std::unique_ptr<Tlm_CRC_Stats> d_Tlm_CRC_Stats;
 
     std::string d_dump_filename;
-    std::ofstream d_dump_file;
+    Gnss_Sdr_Dump_File d_dump_file;
 
     uint64_t d_sample_counter;
     uint64_t d_last_valid_preamble;
@@ -16,7 +16,7 @@
 
 #include "viterbi_decoder.h"
 #include <volk_gnsssdr/volk_gnsssdr.h>  // for volk_gnsssdr_32f_index_max_32u
-#include <algorithm>                    // for std::copy
+#include <algorithm>                    // for std::copy, std::max, std::max_element
 
 Viterbi_Decoder::Viterbi_Decoder(int32_t KK,
     int32_t nn,
@@ -41,11 +41,34 @@ Viterbi_Decoder::Viterbi_Decoder(int32_t KK,
     d_state1 = std::vector<int32_t>(d_states);
     nsc_transit(d_out0, d_state0, 0);
     nsc_transit(d_out1, d_state1, 1);
+
+    d_use_k7 = (d_KK == 7) && (d_nn == 2);
+    if (d_use_k7)
+        {
+            // The new bit enters the state register at the MSB, so next states
+            // j and j+32 both come from states 2j and 2j+1
+            for (int32_t j = 0; j < 32; j++)
+                {
+                    const std::array<int32_t, 4> symbols{d_out0[2 * j], d_out0[2 * j + 1], d_out1[2 * j], d_out1[2 * j + 1]};
+                    for (int32_t b = 0; b < 4; b++)
+                        {
+                            d_k7_weight0[b][j] = (symbols[b] & 2) ? 1.0F : 0.0F;
+                            d_k7_weight1[b][j] = (symbols[b] & 1) ? 1.0F : 0.0F;
+                        }
+                }
+            d_k7_decisions = std::vector<uint64_t>(d_LL + d_mm);
+        }
 }
 
 
 void Viterbi_Decoder::decode(std::vector<int32_t>& output_u_int, const std::vector<float>& input_c)
 {
+    if (d_use_k7)
+        {
+            decode_k7(output_u_int, input_c);
+            return;
+        }
+
     int32_t i;
     int32_t t;
     int32_t state;
@@ -58,7 +81,7 @@ void Viterbi_Decoder::decode(std::vector<int32_t>& output_u_int, const std::vect
     // go through trellis
     for (t = 0; t < d_LL + d_mm; t++)
         {
-            std::copy(input_c.begin() + d_nn * t, input_c.begin() + d_nn * t + (d_nn - 1), d_rec_array.begin());
+            std::copy(input_c.begin() + d_nn * t, input_c.begin() + d_nn * t + d_nn, d_rec_array.begin());
 
             // precompute all possible branch metrics
             for (i = 0; i < d_number_symbols; i++)
@@ -120,6 +143,79 @@ void Viterbi_Decoder::decode(std::vector<int32_t>& output_u_int, const std::vect
 }
 
 
+void Viterbi_Decoder::decode_k7(std::vector<int32_t>& output_u_int, const std::vector<float>& input_c)
+{
+    std::array<float, 32> even{};
+    std::array<float, 32> odd{};
+    std::array<std::array<float, 32>, 4> metric{};
+    std::array<int32_t, 64> decision{};
+    float* prev = d_prev_section.data();
+    float* next = d_next_section.data();
+
+    prev[0] = 0.0;  //  start in all-zeros state
+
+    // go through trellis
+    for (int32_t t = 0; t < d_LL + d_mm; t++)
+        {
+            const float r0 = input_c[2 * t];
+            const float r1 = input_c[2 * t + 1];
+            for (int32_t j = 0; j < 32; j++)
+                {
+                    even[j] = prev[2 * j];
+                    odd[j] = prev[2 * j + 1];
+                }
+
+            // path metrics of the 4 branches of each butterfly
+            for (int32_t b = 0; b < 4; b++)
+                {
+                    const float* previous = (b % 2 == 0) ? even.data() : odd.data();
+                    for (int32_t j = 0; j < 32; j++)
+                        {
+                            metric[b][j] = previous[j] + (d_k7_weight0[b][j] * r0 + d_k7_weight1[b][j] * r1);
+                        }
+                }
+
+            // compare-select. On a tie, the path from the even state survives.
+            // Metrics never go below -d_MAXLOG.
+            for (int32_t j = 0; j < 32; j++)
+                {
+                    decision[j] = metric[1][j] > metric[0][j];
+                    decision[j + 32] = metric[3][j] > metric[2][j];
+                    next[j] = std::max(std::max(metric[0][j], metric[1][j]), -d_MAXLOG);
+                    next[j + 32] = std::max(std::max(metric[2][j], metric[3][j]), -d_MAXLOG);
+                }
+            uint64_t decisions = 0;
+            for (int32_t state = 0; state < 64; state++)
+                {
+                    decisions |= static_cast<uint64_t>(decision[state]) << state;
+                }
+            d_k7_decisions[t] = decisions;
+
+            // normalize
+            const float max_val = *std::max_element(next, next + 64);
+            for (int32_t state = 0; state < 64; state++)
+                {
+                    prev[state] = next[state] - max_val;
+                }
+        }
+
+    // trace-back operation
+    uint32_t state = 0;
+
+    // tail, no need to output
+    for (int32_t t = d_LL + d_mm - 1; t >= d_LL; t--)
+        {
+            state = ((state & 31U) << 1U) | ((d_k7_decisions[t] >> state) & 1U);
+        }
+
+    for (int32_t t = d_LL - 1; t >= 0; t--)
+        {
+            output_u_int[t] = static_cast<int32_t>(state >> 5U);
+            state = ((state & 31U) << 1U) | ((d_k7_decisions[t] >> state) & 1U);
+        }
+}
+
+
 void Viterbi_Decoder::reset()
 {
     d_out0 = std::vector<int32_t>(d_states);
@@ -30,6 +30,12 @@
 
 /*!
  * \brief Class that implements a Viterbi decoder
+ *
+ * For the constraint length 7, rate 1/2 codes (Galileo I/NAV, F/NAV and
+ * C/NAV, among others), the trellis is processed in butterflies, with no
+ * branches and no indexed state lookups, and survivor decisions are stored
+ * as one bit per state. This gives the same output as the generic
+ * state-by-state implementation used for other codes.
  */
 class Viterbi_Decoder
 {
@@ -57,6 +63,11 @@ public:
     void reset();
 
 private:
+    /*
+     * Viterbi decoding of constraint length 7, rate 1/2 codes
+     */
+    void decode_k7(std::vector<int32_t>& output_u_int, const std::vector<float>& input_c);
+
     /*
      * Function that creates the transit and output vectors
      */
@@ -115,6 +126,14 @@ private:
     std::vector<int32_t> d_state0;
     std::vector<int32_t> d_state1;
 
+    // Constraint length 7, rate 1/2 codes: for each butterfly j (predecessor
+    // states 2j and 2j+1, next states j and j+32) and each of its 4 branches,
+    // weights of the two received symbols in the branch metric
+    std::array<std::array<float, 32>, 4> d_k7_weight0{};
+    std::array<std::array<float, 32>, 4> d_k7_weight1{};
+    std::vector<uint64_t> d_k7_decisions{};  // one bit per state and trellis step
+    bool d_use_k7{false};
+
     float d_MAXLOG = 1e7;  // Define infinity
     int32_t d_KK{};
     int32_t d_nn{};
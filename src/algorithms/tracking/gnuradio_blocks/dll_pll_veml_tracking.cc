@@ -530,15 +530,24 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
     // Enable Data component prompt correlator (slave to Pilot prompt) if tracking uses Pilot signal
     if (d_trk_parameters.track_pilot)
         {
-            // Extra correlator for the data component
-            d_correlator_data_cpu.init(static_cast<int>(2 * d_trk_parameters.vector_length), 1);
-            d_correlator_data_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
+            // Extra correlator for the data component, fused with the pilot correlators
             d_data_code.resize(2 * d_code_length_chips, 0.0);
         }
 
     // --- Initializations ---
     d_Prompt_circular_buffer.set_capacity(d_secondary_code_length);
     d_multicorrelator_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
+    if (d_trk_parameters.batch_correlator)
+        {
+            if (d_trk_parameters.high_dyn)
+                {
+                    LOG(WARNING) << "The batch correlator does not support high_dyn=true, using the channel's own correlator";
+                }
+            else
+                {
+                    d_batch_correlator = Tracking_Batch_Correlator::get_instance(d_systemName + "_" + d_signal_type, d_trk_parameters.batch_correlator_max_channels);
+                }
+        }
 
     // CN0 estimation and lock detector buffers
     d_Prompt_buffer = volk_gnsssdr::vector<gr_complex>(d_trk_parameters.cn0_samples);
@@ -679,7 +688,7 @@ void dll_pll_veml_tracking::start_tracking()
                     gps_l5q_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN);
                     gps_l5i_code_gen_float(d_data_code, d_acquisition_gnss_synchro->PRN);
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_multicorrelator_cpu.set_fused_code_and_tap(d_code_length_chips, d_data_code.data(), d_prompt_data_shift, d_Prompt_Data.data());
                 }
             else
                 {
@@ -694,7 +703,7 @@ void dll_pll_veml_tracking::start_tracking()
                     galileo_e1_code_gen_sinboc11_float(d_tracking_code, pilot_signal, d_acquisition_gnss_synchro->PRN);
                     galileo_e1_code_gen_sinboc11_float(d_data_code, Signal_, d_acquisition_gnss_synchro->PRN);
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_multicorrelator_cpu.set_fused_code_and_tap(d_code_samples_per_chip * d_code_length_chips, d_data_code.data(), d_prompt_data_shift, d_Prompt_Data.data());
                 }
             else
                 {
@@ -715,7 +724,7 @@ void dll_pll_veml_tracking::start_tracking()
                             d_data_code[i] = aux_code[i].real();  // the same because it is generated the full signal (E5aI + E5aQ)
                         }
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_multicorrelator_cpu.set_fused_code_and_tap(d_code_length_chips, d_data_code.data(), d_prompt_data_shift, d_Prompt_Data.data());
                 }
             else
                 {
@@ -739,7 +748,7 @@ void dll_pll_veml_tracking::start_tracking()
                             d_data_code[i] = aux_code[i].real();  // the same because it is generated the full signal (E5bI + E5bsQ)
                         }
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_multicorrelator_cpu.set_fused_code_and_tap(d_code_length_chips, d_data_code.data(), d_prompt_data_shift, d_Prompt_Data.data());
                 }
             else
                 {
@@ -757,7 +766,7 @@ void dll_pll_veml_tracking::start_tracking()
                     galileo_e6_b_code_gen_float_primary(d_data_code, d_acquisition_gnss_synchro->PRN);
                     galileo_e6_c_code_gen_float_primary(d_tracking_code, d_acquisition_gnss_synchro->PRN);
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_multicorrelator_cpu.set_fused_code_and_tap(d_code_samples_per_chip * d_code_length_chips, d_data_code.data(), d_prompt_data_shift, d_Prompt_Data.data());
                 }
             else
                 {
@@ -914,10 +923,6 @@ dll_pll_veml_tracking::~dll_pll_veml_tracking()
         }
     try
         {
-            if (d_trk_parameters.track_pilot)
-                {
-                    d_correlator_data_cpu.free();
-                }
             d_multicorrelator_cpu.free();
         }
     catch (const std::exception &ex)
@@ -1042,7 +1047,32 @@ bool dll_pll_veml_tracking::cn0_and_tracking_lock_status(double coh_integration_
 void dll_pll_veml_tracking::do_correlation_step(const gr_complex *input_samples)
 {
     // ################# CARRIER WIPEOFF AND CORRELATORS ##############################
-    // perform carrier wipe-off and compute Early, Prompt and Late correlation
+    // perform carrier wipe-off and compute Early, Prompt and Late correlation.
+    // If tracking the pilot signal, the data prompt correlator is computed in the same pass
+    if (d_batch_correlator)
+        {
+            // Correlated together with the other channels of the same signal
+            Tracking_Batch_Request request;
+            request.sig_in = input_samples;
+            request.corr_out = d_correlator_outs.data();
+            request.local_code = d_tracking_code.data();
+            request.shifts_chips = d_local_code_shift_chips.data();
+            if (d_trk_parameters.track_pilot)
+                {
+                    request.fused_code = d_data_code.data();
+                    request.fused_shift_chips = d_prompt_data_shift;
+                    request.fused_corr_out = d_Prompt_Data.data();
+                }
+            request.rem_carrier_phase_rad = d_rem_carr_phase_rad;
+            request.phase_step_rad = static_cast<float>(d_carrier_phase_step_rad);
+            request.rem_code_phase_chips = static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip);
+            request.code_phase_step_chips = static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip);
+            request.code_length_chips = d_code_samples_per_chip * d_code_length_chips;
+            request.n_correlators = d_n_correlator_taps;
+            request.n_samples = static_cast<int32_t>(d_trk_parameters.vector_length);
+            d_batch_correlator->correlate(request);
+            return;
+        }
     d_multicorrelator_cpu.set_input_output_vectors(d_correlator_outs.data(), input_samples);
     d_multicorrelator_cpu.Carrier_wipeoff_multicorrelator_resampler(
         d_rem_carr_phase_rad,
@@ -1051,19 +1081,6 @@ void dll_pll_veml_tracking::do_correlation_step(const gr_complex *input_samples)
         static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
         static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip),
         d_trk_parameters.vector_length);
-
-    // DATA CORRELATOR (if tracking tracks the pilot signal)
-    if (d_trk_parameters.track_pilot)
-        {
-            d_correlator_data_cpu.set_input_output_vectors(d_Prompt_Data.data(), input_samples);
-            d_correlator_data_cpu.Carrier_wipeoff_multicorrelator_resampler(
-                d_rem_carr_phase_rad,
-                static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
-                static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip),
-                static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
-                static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip),
-                d_trk_parameters.vector_length);
-        }
 }
 
 
@@ -22,8 +22,10 @@
 #include "dll_pll_conf.h"
 #include "exponential_smoother.h"
 #include "gnss_block_interface.h"
+#include "gnss_sdr_dump_file.h"
 #include "gnss_time.h"                // for timetags produced by File_Timestamp_Signal_Source
 #include "tracking_FLL_PLL_filter.h"  // for PLL/FLL filter
+#include "tracking_batch_correlator.h"
 #include "tracking_loop_filter.h"     // for DLL filter
 #include <boost/circular_buffer.hpp>
 #include <gnuradio/block.h>                   // for block
@@ -34,6 +36,7 @@
 #include <cstddef>                            // for size_t
 #include <cstdint>                            // for int32_t
 #include <fstream>                            // for ofstream
+#include <memory>                             // for shared_ptr
 #include <string>                             // for string
 #include <typeinfo>                           // for typeid
 #include <utility>                            // for pair
@@ -88,7 +91,7 @@ private:
     int32_t save_matfile() const;
 
     Cpu_Multicorrelator_Real_Codes d_multicorrelator_cpu;
-    Cpu_Multicorrelator_Real_Codes d_correlator_data_cpu;  // for data channel
+    std::shared_ptr<Tracking_Batch_Correlator> d_batch_correlator;
 
     Dll_Pll_Conf d_trk_parameters;
 
@@ -163,7 +166,7 @@ private:
     std::string d_signal_pretty_name;
     std::string d_dump_filename;
 
-    std::ofstream d_dump_file;
+    Gnss_Sdr_Dump_File d_dump_file;
 
     // uint64_t d_sample_counter;
     uint64_t d_acq_sample_stamp;
@@ -21,6 +21,7 @@
 #include "dll_pll_conf_fpga.h"
 #include "exponential_smoother.h"
 #include "gnss_block_interface.h"
+#include "gnss_sdr_dump_file.h"
 #include "tracking_FLL_PLL_filter.h"  // for PLL/FLL filter
 #include "tracking_loop_filter.h"     // for DLL filter
 #include <boost/circular_buffer.hpp>
@@ -143,7 +144,7 @@ private:
     std::string d_signal_pretty_name;
     std::string d_dump_filename;
 
-    std::ofstream d_dump_file;
+    Gnss_Sdr_Dump_File d_dump_file;
 
     std::shared_ptr<Fpga_Multicorrelator_8sc> d_multicorrelator_fpga;
 
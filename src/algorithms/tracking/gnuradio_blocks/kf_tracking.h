@@ -28,6 +28,7 @@
 #include "cpu_multicorrelator_real_codes.h"
 #include "exponential_smoother.h"
 #include "gnss_block_interface.h"
+#include "gnss_sdr_dump_file.h"
 #include "gnss_time.h"  // for timetags produced by File_Timestamp_Signal_Source
 #include "kf_conf.h"
 #include "tracking_FLL_PLL_filter.h"  // for PLL/FLL filter
@@ -95,7 +96,6 @@ private:
     int32_t save_matfile() const;
 
     Cpu_Multicorrelator_Real_Codes d_multicorrelator_cpu;
-    Cpu_Multicorrelator_Real_Codes d_correlator_data_cpu;  // for data channel
 
     Kf_Conf d_trk_parameters;
 
@@ -136,7 +136,7 @@ private:
     std::string d_signal_pretty_name;
     std::string d_dump_filename;
 
-    std::ofstream d_dump_file;
+    Gnss_Sdr_Dump_File d_dump_file;
 
     gr_complex *d_Very_Early;
     gr_complex *d_Early;
@@ -40,12 +40,17 @@ bool Cpu_Multicorrelator_Real_Codes::init(
     // ALLOCATE MEMORY FOR INTERNAL vectors
     size_t size = max_signal_length_samples * sizeof(float);
 
-    d_local_codes_resampled = static_cast<float**>(volk_gnsssdr_malloc(n_correlators * sizeof(float*), volk_gnsssdr_get_alignment()));
+    // One extra slot for the fused correlator, allocated only if it is enabled
+    d_local_codes_resampled = static_cast<float**>(volk_gnsssdr_malloc((n_correlators + 1) * sizeof(float*), volk_gnsssdr_get_alignment()));
     for (int n = 0; n < n_correlators; n++)
         {
             d_local_codes_resampled[n] = static_cast<float*>(volk_gnsssdr_malloc(size, volk_gnsssdr_get_alignment()));
         }
+    d_local_codes_resampled[n_correlators] = nullptr;
+    d_all_corr_out = static_cast<std::complex<float>*>(volk_gnsssdr_malloc((n_correlators + 1) * sizeof(std::complex<float>), volk_gnsssdr_get_alignment()));
+    d_max_signal_length_samples = max_signal_length_samples;
     d_n_correlators = n_correlators;
+    d_n_fused = 0;
     return true;
 }
 
@@ -63,6 +68,29 @@ bool Cpu_Multicorrelator_Real_Codes::set_local_code_and_taps(
 }
 
 
+bool Cpu_Multicorrelator_Real_Codes::set_fused_code_and_tap(
+    int code_length_chips,
+    const float* local_code_in,
+    float* shift_chips,
+    std::complex<float>* corr_out)
+{
+    if (d_local_codes_resampled == nullptr)
+        {
+            return false;
+        }
+    if (d_local_codes_resampled[d_n_correlators] == nullptr)
+        {
+            d_local_codes_resampled[d_n_correlators] = static_cast<float*>(volk_gnsssdr_malloc(d_max_signal_length_samples * sizeof(float), volk_gnsssdr_get_alignment()));
+        }
+    d_fused_code_in = local_code_in;
+    d_fused_shift_chips = shift_chips;
+    d_fused_code_length_chips = code_length_chips;
+    d_fused_corr_out = corr_out;
+    d_n_fused = 1;
+    return true;
+}
+
+
 bool Cpu_Multicorrelator_Real_Codes::set_input_output_vectors(std::complex<float>* corr_out, const std::complex<float>* sig_in)
 {
     // Save CPU pointers
@@ -85,6 +113,18 @@ void Cpu_Multicorrelator_Real_Codes::update_local_code(int correlator_length_sam
                 d_code_length_chips,
                 d_n_correlators,
                 correlator_length_samples);
+            if (d_n_fused > 0)
+                {
+                    volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn(&d_local_codes_resampled[d_n_correlators],
+                        d_fused_code_in,
+                        rem_code_phase_chips,
+                        code_phase_step_chips,
+                        code_phase_rate_step_chips,
+                        d_fused_shift_chips,
+                        d_fused_code_length_chips,
+                        1,
+                        correlator_length_samples);
+                }
         }
     else
         {
@@ -96,10 +136,31 @@ void Cpu_Multicorrelator_Real_Codes::update_local_code(int correlator_length_sam
                 d_code_length_chips,
                 d_n_correlators,
                 correlator_length_samples);
+            if (d_n_fused > 0)
+                {
+                    volk_gnsssdr_32f_xn_resampler_32f_xn(&d_local_codes_resampled[d_n_correlators],
+                        d_fused_code_in,
+                        rem_code_phase_chips,
+                        code_phase_step_chips,
+                        d_fused_shift_chips,
+                        d_fused_code_length_chips,
+                        1,
+                        correlator_length_samples);
+                }
         }
 }
 
 
+void Cpu_Multicorrelator_Real_Codes::split_fused_outputs()
+{
+    for (int n = 0; n < d_n_correlators; n++)
+        {
+            d_corr_out[n] = d_all_corr_out[n];
+        }
+    *d_fused_corr_out = d_all_corr_out[d_n_correlators];
+}
+
+
 bool Cpu_Multicorrelator_Real_Codes::Carrier_wipeoff_multicorrelator_resampler(
     float rem_carrier_phase_in_rad,
     float phase_step_rad,
@@ -114,13 +175,19 @@ bool Cpu_Multicorrelator_Real_Codes::Carrier_wipeoff_multicorrelator_resampler(
     lv_32fc_t phase_offset_as_complex[1];
     phase_offset_as_complex[0] = lv_cmake(std::cos(rem_carrier_phase_in_rad), -std::sin(rem_carrier_phase_in_rad));
     // call VOLK_GNSSSDR kernel
+    // The fused correlator, if any, shares the rotated input with the main taps
+    std::complex<float>* corr_out = d_n_fused > 0 ? d_all_corr_out : d_corr_out;
     if (d_use_high_dynamics_resampler)
         {
-            volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn(d_corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), std::exp(lv_32fc_t(0.0, -phase_rate_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators, signal_length_samples);
+            volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn(corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), std::exp(lv_32fc_t(0.0, -phase_rate_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators + d_n_fused, signal_length_samples);
         }
     else
         {
-            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(d_corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators, signal_length_samples);
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators + d_n_fused, signal_length_samples);
+        }
+    if (d_n_fused > 0)
+        {
+            split_fused_outputs();
         }
     return true;
 }
@@ -139,7 +206,12 @@ bool Cpu_Multicorrelator_Real_Codes::Carrier_wipeoff_multicorrelator_resampler(
     lv_32fc_t phase_offset_as_complex[1];
     phase_offset_as_complex[0] = lv_cmake(std::cos(rem_carrier_phase_in_rad), -std::sin(rem_carrier_phase_in_rad));
     // call VOLK_GNSSSDR kernel
-    volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(d_corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators, signal_length_samples);
+    std::complex<float>* corr_out = d_n_fused > 0 ? d_all_corr_out : d_corr_out;
+    volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators + d_n_fused, signal_length_samples);
+    if (d_n_fused > 0)
+        {
+            split_fused_outputs();
+        }
     return true;
 }
 
@@ -153,9 +225,19 @@ bool Cpu_Multicorrelator_Real_Codes::free()
                 {
                     volk_gnsssdr_free(d_local_codes_resampled[n]);
                 }
+            if (d_local_codes_resampled[d_n_correlators] != nullptr)
+                {
+                    volk_gnsssdr_free(d_local_codes_resampled[d_n_correlators]);
+                }
             volk_gnsssdr_free(d_local_codes_resampled);
             d_local_codes_resampled = nullptr;
         }
+    if (d_all_corr_out != nullptr)
+        {
+            volk_gnsssdr_free(d_all_corr_out);
+            d_all_corr_out = nullptr;
+        }
+    d_n_fused = 0;
     return true;
 }
 
@@ -43,20 +43,38 @@ public:
     bool init(int max_signal_length_samples, int n_correlators);
     bool set_local_code_and_taps(int code_length_chips, const float *local_code_in, float *shifts_chips);
     bool set_input_output_vectors(std::complex<float> *corr_out, const std::complex<float> *sig_in);
+
+    /*!
+     * \brief Adds one correlator with a second local code (e.g., the data
+     * component when tracking the pilot) that shares the carrier wipe-off and
+     * code phase of the main taps. Its output is written to corr_out, and the
+     * input samples are rotated and read only once for all the correlators.
+     * Must be called after init().
+     */
+    bool set_fused_code_and_tap(int code_length_chips, const float *local_code_in, float *shift_chips, std::complex<float> *corr_out);
     void update_local_code(int correlator_length_samples, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips = 0.0);
     bool Carrier_wipeoff_multicorrelator_resampler(float rem_carrier_phase_in_rad, float phase_step_rad, float phase_rate_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
     bool Carrier_wipeoff_multicorrelator_resampler(float rem_carrier_phase_in_rad, float phase_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
     bool free();
 
 private:
+    void split_fused_outputs();
+
     // Allocate the device input vectors
     const std::complex<float> *d_sig_in{nullptr};
     const float *d_local_code_in{nullptr};
     std::complex<float> *d_corr_out{nullptr};
     float **d_local_codes_resampled{nullptr};
     float *d_shifts_chips{nullptr};
+    const float *d_fused_code_in{nullptr};
+    float *d_fused_shift_chips{nullptr};
+    std::complex<float> *d_fused_corr_out{nullptr};
+    std::complex<float> *d_all_corr_out{nullptr};
+    int d_max_signal_length_samples{0};
     int d_code_length_chips{0};
+    int d_fused_code_length_chips{0};
     int d_n_correlators{0};
+    int d_n_fused{0};
     bool d_use_high_dynamics_resampler{true};
 };
 
@@ -60,6 +60,7 @@ public:
     uint32_t bit_synchronization_time_limit_s{20U};
     uint32_t vector_length{0U};
     uint32_t smoother_length{10U};
+    uint32_t batch_correlator_max_channels{16U};
     int32_t fll_filter_order{1};
     int32_t pll_filter_order{3};
     int32_t dll_filter_order{2};
@@ -78,6 +79,7 @@ public:
     bool enable_doppler_correction{false};
     bool carrier_aiding{true};
     bool high_dyn{false};
+    bool batch_correlator{false};
     bool dump{false};
     bool dump_mat{true};
 };
@@ -0,0 +1,310 @@
+/*!
+ * \file tracking_batch_correlator.cc
+ * \brief Carrier wipe-off and multi-correlator shared by the tracking
+ * channels of the same signal, which correlates several channels in a single
+ * pass over the input samples.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "tracking_batch_correlator.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>     // for std::ptrdiff_t
+#include <functional>  // for std::less
+#include <map>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+namespace
+{
+// Input samples (8 KiB) kept in the L1 cache while all the channels that
+// share them are correlated
+constexpr int32_t TILE_SAMPLES = 1024;
+
+// Smallest piece of work handed to a thread
+constexpr int32_t MIN_CHUNK_SAMPLES = 4 * TILE_SAMPLES;
+
+// Contiguous stretch of input samples, shared by the requests in
+// [first_request, last_request)
+struct Batch_Chunk
+{
+    size_t first_request;
+    size_t last_request;
+    const gr_complex* begin;
+    const gr_complex* end;
+};
+
+
+// Requests sorted by the position of their input samples, grouped in spans
+// of overlapping samples, and split in chunks that can be correlated
+// independently. Each chunk accumulates its own partial correlations.
+class Batch_Plan
+{
+public:
+    void build(const Tracking_Batch_Request* const* requests, size_t n, size_t n_workers)
+    {
+        d_requests.assign(requests, requests + n);
+        std::sort(d_requests.begin(), d_requests.end(), [](const Tracking_Batch_Request* a, const Tracking_Batch_Request* b) {
+            return std::less<const gr_complex*>()(a->sig_in, b->sig_in);
+        });
+
+        d_tap_offset.clear();
+        d_n_taps = 0;
+        for (size_t k = 0; k < n; k++)
+            {
+                d_tap_offset.push_back(d_n_taps);
+                d_n_taps += d_requests[k]->n_correlators + (d_requests[k]->fused_code != nullptr ? 1 : 0);
+            }
+
+        // Requests reading from the same stretch of the input buffer share
+        // a span
+        d_spans.clear();
+        std::ptrdiff_t total_samples = 0;
+        size_t first = 0;
+        while (first < n)
+            {
+                const gr_complex* begin = d_requests[first]->sig_in;
+                const gr_complex* end = begin + d_requests[first]->n_samples;
+                size_t last = first + 1;
+                while (last < n && !std::less<const gr_complex*>()(end, d_requests[last]->sig_in))
+                    {
+                        end = std::max(end, d_requests[last]->sig_in + d_requests[last]->n_samples, std::less<const gr_complex*>());
+                        last++;
+                    }
+                d_spans.push_back({first, last, begin, end});
+                total_samples += end - begin;
+                first = last;
+            }
+
+        // Spans are split in at least one chunk per worker
+        const auto workers = static_cast<std::ptrdiff_t>(std::max(n_workers, static_cast<size_t>(1)));
+        const std::ptrdiff_t chunk_samples = std::max(static_cast<std::ptrdiff_t>(MIN_CHUNK_SAMPLES), (total_samples + workers - 1) / workers);
+        chunks.clear();
+        for (const auto& span : d_spans)
+            {
+                for (std::ptrdiff_t offset = 0; offset < span.end - span.begin; offset += chunk_samples)
+                    {
+                        const std::ptrdiff_t length = std::min(chunk_samples, span.end - span.begin - offset);
+                        chunks.push_back({span.first_request, span.last_request, span.begin + offset, span.begin + offset + length});
+                    }
+            }
+        d_partial.assign(chunks.size() * d_n_taps, gr_complex(0.0, 0.0));
+    }
+
+    // Correlates the samples of chunk c with all the requests that use them
+    void correlate_chunk(size_t c)
+    {
+        thread_local volk_gnsssdr::vector<gr_complex> corr;
+        const Batch_Chunk& chunk = chunks[c];
+        gr_complex* partial = &d_partial[c * d_n_taps];
+        for (std::ptrdiff_t tile_offset = 0; tile_offset < chunk.end - chunk.begin; tile_offset += TILE_SAMPLES)
+            {
+                const gr_complex* tile = chunk.begin + tile_offset;
+                const gr_complex* tile_end = tile + std::min(static_cast<std::ptrdiff_t>(TILE_SAMPLES), chunk.end - tile);
+                for (size_t k = chunk.first_request; k < chunk.last_request; k++)
+                    {
+                        const Tracking_Batch_Request& r = *d_requests[k];
+                        const gr_complex* begin = std::max(tile, r.sig_in, std::less<const gr_complex*>());
+                        const gr_complex* end = std::min(tile_end, r.sig_in + r.n_samples, std::less<const gr_complex*>());
+                        if (!std::less<const gr_complex*>()(begin, end))
+                            {
+                                continue;
+                            }
+                        const auto n_points = static_cast<unsigned int>(end - begin);
+                        const auto offset = static_cast<double>(begin - r.sig_in);
+
+                        // Carrier phase and code phase at the first sample of the tile.
+                        // Same sign convention as Cpu_Multicorrelator_Real_Codes
+                        const double carrier_phase = static_cast<double>(r.rem_carrier_phase_rad) + static_cast<double>(r.phase_step_rad) * offset;
+                        const lv_32fc_t phase_inc = std::exp(lv_32fc_t(0.0, -r.phase_step_rad));
+                        double rem_code_phase = static_cast<double>(r.rem_code_phase_chips) - static_cast<double>(r.code_phase_step_chips) * offset;
+                        rem_code_phase -= std::floor(rem_code_phase / r.code_length_chips) * r.code_length_chips;
+
+                        // Code replicas resampled on the fly, sharing the tile with the other channels
+                        corr.resize(r.n_correlators);
+                        lv_32fc_t phase(static_cast<float>(std::cos(carrier_phase)), static_cast<float>(-std::sin(carrier_phase)));
+                        volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn(corr.data(), begin, phase_inc, &phase, r.local_code,
+                            static_cast<float>(rem_code_phase), r.code_phase_step_chips, r.shifts_chips, r.code_length_chips, r.n_correlators, n_points);
+                        gr_complex* acc = &partial[d_tap_offset[k]];
+                        for (int32_t tap = 0; tap < r.n_correlators; tap++)
+                            {
+                                acc[tap] += corr[tap];
+                            }
+                        if (r.fused_code != nullptr)
+                            {
+                                phase = lv_32fc_t(static_cast<float>(std::cos(carrier_phase)), static_cast<float>(-std::sin(carrier_phase)));
+                                volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn(corr.data(), begin, phase_inc, &phase, r.fused_code,
+                                    static_cast<float>(rem_code_phase), r.code_phase_step_chips, r.fused_shift_chips, r.code_length_chips, 1, n_points);
+                                acc[r.n_correlators] += corr[0];
+                            }
+                    }
+            }
+    }
+
+    // Adds up the partial correlations of all the chunks into the outputs
+    void reduce() const
+    {
+        for (size_t k = 0; k < d_requests.size(); k++)
+            {
+                const Tracking_Batch_Request& r = *d_requests[k];
+                const int32_t n_taps = r.n_correlators + (r.fused_code != nullptr ? 1 : 0);
+                for (int32_t tap = 0; tap < n_taps; tap++)
+                    {
+                        gr_complex sum(0.0, 0.0);
+                        for (size_t c = 0; c < chunks.size(); c++)
+                            {
+                                sum += d_partial[c * d_n_taps + d_tap_offset[k] + tap];
+                            }
+                        *(tap < r.n_correlators ? &r.corr_out[tap] : r.fused_corr_out) = sum;
+                    }
+            }
+    }
+
+    std::vector<Batch_Chunk> chunks;
+
+private:
+    std::vector<const Tracking_Batch_Request*> d_requests;
+    std::vector<Batch_Chunk> d_spans;
+    std::vector<size_t> d_tap_offset;   // first partial correlation of each request
+    std::vector<gr_complex> d_partial;  // chunks.size() x d_n_taps
+    size_t d_n_taps{0};
+};
+}  // namespace
+
+
+// Batch being served, and the threads working on it
+struct Tracking_Batch_Correlator::Batch
+{
+    Batch_Plan plan;
+    std::vector<Pending*> members;
+    std::vector<const Tracking_Batch_Request*> requests;
+    size_t next_chunk{0};
+    size_t done_chunks{0};
+};
+
+
+std::shared_ptr<Tracking_Batch_Correlator> Tracking_Batch_Correlator::get_instance(const std::string& signal, uint32_t max_channels)
+{
+    static std::mutex registry_mutex;
+    static std::map<std::string, std::weak_ptr<Tracking_Batch_Correlator>> registry;
+
+    std::lock_guard<std::mutex> lk(registry_mutex);
+    auto engine = registry[signal].lock();
+    if (!engine)
+        {
+            engine = std::make_shared<Tracking_Batch_Correlator>(max_channels);
+            registry[signal] = engine;
+            DLOG(INFO) << "Created batch tracking correlator for signal " << signal;
+        }
+    return engine;
+}
+
+
+Tracking_Batch_Correlator::Tracking_Batch_Correlator(uint32_t max_channels)
+    : d_max_channels(std::max(max_channels, 1U))
+{
+}
+
+
+void Tracking_Batch_Correlator::correlate(const Tracking_Batch_Request& request)
+{
+    // Batch started by this thread. The members of a batch only use it
+    // until their requests are done, so it can be reused in the next call.
+    thread_local Batch batch;
+
+    Pending own{&request, nullptr, false};
+    std::unique_lock<std::mutex> lk(d_mutex);
+    d_pending.push_back(&own);
+    while (!own.done)
+        {
+            if (own.batch == nullptr)
+                {
+                    // Serve this request, together with the ones waiting to be served
+                    batch.members.clear();
+                    batch.requests.clear();
+                    own.batch = &batch;
+                    batch.members.push_back(&own);
+                    batch.requests.push_back(&request);
+                    auto it = d_pending.begin();
+                    while (it != d_pending.end())
+                        {
+                            if (*it == &own)
+                                {
+                                    it = d_pending.erase(it);
+                                }
+                            else if (batch.members.size() < d_max_channels)
+                                {
+                                    (*it)->batch = &batch;
+                                    batch.members.push_back(*it);
+                                    batch.requests.push_back((*it)->request);
+                                    it = d_pending.erase(it);
+                                }
+                            else
+                                {
+                                    ++it;
+                                }
+                        }
+                    batch.plan.build(batch.requests.data(), batch.requests.size(), batch.members.size());
+                    batch.next_chunk = 0;
+                    batch.done_chunks = 0;
+                    // Wake up the other members, so they take part of the work
+                    d_cv.notify_all();
+                }
+
+            Batch& b = *own.batch;
+            if (b.next_chunk < b.plan.chunks.size())
+                {
+                    const size_t c = b.next_chunk++;
+                    lk.unlock();
+                    b.plan.correlate_chunk(c);
+                    lk.lock();
+                    if (++b.done_chunks == b.plan.chunks.size())
+                        {
+                            b.plan.reduce();
+                            for (auto* p : b.members)
+                                {
+                                    p->done = true;
+                                }
+                            d_served += b.members.size();
+                            d_batches++;
+                            d_max_batch = std::max(d_max_batch, b.members.size());
+                            d_cv.notify_all();
+                        }
+                }
+            else
+                {
+                    // Other members are finishing the last chunks
+                    d_cv.wait(lk);
+                }
+        }
+}
+
+
+void Tracking_Batch_Correlator::correlate_batch(const Tracking_Batch_Request* const* requests, size_t n)
+{
+    thread_local Batch_Plan plan;
+    plan.build(requests, n, 1);
+    for (size_t c = 0; c < plan.chunks.size(); c++)
+        {
+            plan.correlate_chunk(c);
+        }
+    plan.reduce();
+}
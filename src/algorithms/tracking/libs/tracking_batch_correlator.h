@@ -0,0 +1,140 @@
+/*!
+ * \file tracking_batch_correlator.h
+ * \brief Carrier wipe-off and multi-correlator shared by the tracking
+ * channels of the same signal, which correlates several channels in a single
+ * pass over the input samples.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * Each tracking channel keeps running its own loop filters in its own
+ * thread, and submits its correlation request to the shared engine. The
+ * requests that are pending at a given time are served together: the input
+ * samples they share are read once, in tiles that stay in cache while the
+ * VOLK_GNSSSDR kernel correlates all the channels that use them, and the
+ * tiles are split among the requesting threads, which work in parallel.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_TRACKING_BATCH_CORRELATOR_H
+#define GNSS_SDR_TRACKING_BATCH_CORRELATOR_H
+
+#include <gnuradio/gr_complex.h>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/** \addtogroup Tracking
+ * \{ */
+/** \addtogroup Tracking_libs
+ * \{ */
+
+
+/*!
+ * \brief Correlation step of one tracking channel. Arguments have the same
+ * meaning as in Cpu_Multicorrelator_Real_Codes, with code phases expressed
+ * in local code samples.
+ */
+struct Tracking_Batch_Request
+{
+    const gr_complex* sig_in{nullptr};
+    gr_complex* corr_out{nullptr};
+    const float* local_code{nullptr};
+    const float* shifts_chips{nullptr};
+    // Optional fused correlator (e.g., data prompt when tracking the pilot)
+    const float* fused_code{nullptr};
+    const float* fused_shift_chips{nullptr};
+    gr_complex* fused_corr_out{nullptr};
+    float rem_carrier_phase_rad{0.0};
+    float phase_step_rad{0.0};
+    float rem_code_phase_chips{0.0};
+    float code_phase_step_chips{0.0};
+    int32_t code_length_chips{0};
+    int32_t n_correlators{0};
+    int32_t n_samples{0};
+};
+
+
+/*!
+ * \brief Carrier wipe-off and multi-correlator shared among tracking
+ * channels.
+ *
+ * Instances are obtained through get_instance(), which returns the same
+ * engine to all the channels of the same signal.
+ */
+class Tracking_Batch_Correlator
+{
+public:
+    /*!
+     * \brief Returns the engine shared by all the tracking channels of
+     * signal, creating it if needed.
+     */
+    static std::shared_ptr<Tracking_Batch_Correlator> get_instance(const std::string& signal, uint32_t max_channels);
+
+    explicit Tracking_Batch_Correlator(uint32_t max_channels);
+
+    /*!
+     * \brief Computes the correlators of request and returns when its
+     * outputs are ready. Requests submitted concurrently by other channels
+     * are served in the same pass, and the calling threads share its work.
+     */
+    void correlate(const Tracking_Batch_Request& request);
+
+    /*!
+     * \brief Computes the correlators of n requests in a single pass over
+     * the input samples, in the calling thread.
+     */
+    static void correlate_batch(const Tracking_Batch_Request* const* requests, size_t n);
+
+    inline uint64_t served_requests() const
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        return d_served;
+    }
+
+    inline uint64_t served_batches() const
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        return d_batches;
+    }
+
+    inline size_t max_batch_size() const
+    {
+        std::lock_guard<std::mutex> lk(d_mutex);
+        return d_max_batch;
+    }
+
+private:
+    struct Batch;
+
+    struct Pending
+    {
+        const Tracking_Batch_Request* request;
+        Batch* batch;  // batch serving the request, once taken
+        bool done;
+    };
+
+    std::vector<Pending*> d_pending;
+    mutable std::mutex d_mutex;
+    std::condition_variable d_cv;
+    uint64_t d_served{0ULL};
+    uint64_t d_batches{0ULL};
+    size_t d_max_batch{0};
+    size_t d_max_channels;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_TRACKING_BATCH_CORRELATOR_H
@@ -69,6 +69,9 @@ int gnss_synchro_monitor::general_work(int noutput_items __attribute__((unused))
     // Get the input buffer pointer
     const auto** in = reinterpret_cast<const Gnss_Synchro**>(&input_items[0]);
 
+    // Items of all the channels are sent together
+    std::vector<Gnss_Synchro> stocks;
+
     // Loop through each input stream channel
     for (int channel_index = 0; channel_index < d_nchannels; channel_index++)
         {
@@ -79,18 +82,18 @@ int gnss_synchro_monitor::general_work(int noutput_items __attribute__((unused))
                     count++;
                     if (count >= d_decimation_factor)
                         {
-                            // Convert to a vector and write to the UDP sink
-                            std::vector<Gnss_Synchro> stocks;
                             stocks.push_back(in[channel_index][item_index]);
-                            udp_sink_ptr->write_gnss_synchro(stocks);
                             // Reset count variable
                             count = 0;
-                            // Consume the number of items for the input stream channel
-                            consume(channel_index, ninput_items[channel_index]);
                         }
                 }
+            // Consume the number of items for the input stream channel
+            consume(channel_index, ninput_items[channel_index]);
         }
 
+    // Hand the batch to the I/O thread of the UDP sink
+    udp_sink_ptr->write_gnss_synchro(std::move(stocks));
+
     // Not producing any outputs
     return 0;
 }
@@ -19,14 +19,27 @@
 #include <boost/archive/binary_oarchive.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/serialization/vector.hpp>
+#include <algorithm>
+#include <exception>
 #include <iostream>
 #include <sstream>
+#include <utility>
+
+namespace
+{
+// Keeps each datagram well below the maximum UDP payload size
+constexpr size_t MAX_GNSS_SYNCHRO_PER_DATAGRAM = 128;
+}  // namespace
+
 
 Gnss_Synchro_Udp_Sink::Gnss_Synchro_Udp_Sink(
     const std::vector<std::string>& addresses,
     const std::vector<std::string>& ports,
-    bool enable_protobuf)
-    : socket{io_context},
+    bool enable_protobuf,
+    size_t queue_size)
+    : socket_v4{io_context},
+      socket_v6{io_context},
+      queue(queue_size),
       use_protobuf(enable_protobuf)
 {
     if (enable_protobuf)
@@ -47,29 +60,87 @@ Gnss_Synchro_Udp_Sink::Gnss_Synchro_Udp_Sink(
                     endpoints.push_back(endpoint);
                 }
         }
+    io_thread = std::thread(&Gnss_Synchro_Udp_Sink::run, this);
+}
+
+
+Gnss_Synchro_Udp_Sink::~Gnss_Synchro_Udp_Sink()
+{
+    // An empty batch stops the I/O thread
+    queue.push(std::vector<Gnss_Synchro>());
+    if (io_thread.joinable())
+        {
+            io_thread.join();
+        }
 }
 
 
-bool Gnss_Synchro_Udp_Sink::write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks)
+bool Gnss_Synchro_Udp_Sink::write_gnss_synchro(std::vector<Gnss_Synchro> stocks)
 {
-    std::string outbound_data;
-    if (use_protobuf == false)
+    if (stocks.empty())
         {
-            std::ostringstream archive_stream;
-            boost::archive::binary_oarchive oa{archive_stream};
-            oa << stocks;
-            outbound_data = archive_stream.str();
+            return true;
         }
-    else
+    if (!queue.try_push(std::move(stocks)))
         {
-            outbound_data = serdes.createProtobuffer(stocks);
+            dropped++;
+            return false;
+        }
+    return true;
+}
+
+
+void Gnss_Synchro_Udp_Sink::run()
+{
+    std::vector<Gnss_Synchro> stocks;
+    while (true)
+        {
+            queue.wait_and_pop(stocks);
+            if (stocks.empty())
+                {
+                    return;
+                }
+            for (size_t first = 0; first < stocks.size(); first += MAX_GNSS_SYNCHRO_PER_DATAGRAM)
+                {
+                    const size_t last = std::min(first + MAX_GNSS_SYNCHRO_PER_DATAGRAM, stocks.size());
+                    if (first == 0 and last == stocks.size())
+                        {
+                            send(stocks);
+                        }
+                    else
+                        {
+                            send(std::vector<Gnss_Synchro>(stocks.begin() + first, stocks.begin() + last));
+                        }
+                }
         }
+}
+
 
+bool Gnss_Synchro_Udp_Sink::send(const std::vector<Gnss_Synchro>& stocks)
+{
     try
         {
+            std::string outbound_data;
+            if (use_protobuf == false)
+                {
+                    std::ostringstream archive_stream;
+                    boost::archive::binary_oarchive oa{archive_stream};
+                    oa << stocks;
+                    outbound_data = archive_stream.str();
+                }
+            else
+                {
+                    outbound_data = serdes.createProtobuffer(stocks);
+                }
+
             for (const auto& endpoint : endpoints)
                 {
-                    socket.open(endpoint.protocol(), error);  // NOLINT(bugprone-unused-return-value)
+                    // Each protocol needs its own socket
+                    boost::asio::ip::udp::socket& socket = endpoint.address().is_v6() ? socket_v6 : socket_v4;
+                    if (!socket.is_open())
+                        {
+                            socket.open(endpoint.protocol(), error);  // NOLINT(bugprone-unused-return-value)
+                        }
 
                     if (socket.send_to(boost::asio::buffer(outbound_data), endpoint) == 0)  // this can throw
                         {
@@ -82,6 +153,12 @@ bool Gnss_Synchro_Udp_Sink::write_gnss_synchro(const std::vector<Gnss_Synchro>&
             std::cerr << "Error sending data: " << e.what() << '\n';
             return false;
         }
+    catch (const std::exception& e)
+        {
+            // Serialization errors must not end the I/O thread
+            std::cerr << "Error serializing data: " << e.what() << '\n';
+            return false;
+        }
 
     return true;
 }
@@ -18,12 +18,16 @@
 #ifndef GNSS_SDR_GNSS_SYNCHRO_UDP_SINK_H
 #define GNSS_SDR_GNSS_SYNCHRO_UDP_SINK_H
 
+#include "concurrent_ring_queue.h"
 #include "gnss_synchro.h"
 #include "serdes_gnss_synchro.h"
 #include <boost/asio.hpp>
 #include <boost/system/error_code.hpp>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <thread>
 #include <vector>
 
 /** \addtogroup Core
@@ -41,19 +45,41 @@ using b_io_context = boost::asio::io_service;
 /*!
  * \brief This class sends serialized Gnss_Synchro objects
  * over UDP to one or multiple endpoints.
+ *
+ * Serialization and sending are done by a dedicated I/O thread, so
+ * write_gnss_synchro() never blocks the caller on the network.
  */
 class Gnss_Synchro_Udp_Sink
 {
 public:
-    Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const std::vector<std::string>& ports, bool enable_protobuf);
-    bool write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks);
+    Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const std::vector<std::string>& ports, bool enable_protobuf, size_t queue_size = 64);
+    ~Gnss_Synchro_Udp_Sink();
+
+    /*!
+     * \brief Queues stocks to be sent to all the endpoints. Returns false,
+     * and drops them, if the I/O thread is lagging more than queue_size
+     * batches behind.
+     */
+    bool write_gnss_synchro(std::vector<Gnss_Synchro> stocks);
+
+    inline uint64_t dropped_batches() const
+    {
+        return dropped.load();
+    }
 
 private:
+    void run();
+    bool send(const std::vector<Gnss_Synchro>& stocks);
+
     b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
+    boost::asio::ip::udp::socket socket_v4;  // for IPv4 endpoints
+    boost::asio::ip::udp::socket socket_v6;  // for IPv6 endpoints
     boost::system::error_code error;
     std::vector<boost::asio::ip::udp::endpoint> endpoints;
     Serdes_Gnss_Synchro serdes;
+    Concurrent_Ring_Queue<std::vector<Gnss_Synchro>> queue;
+    std::thread io_thread;
+    std::atomic<uint64_t> dropped{0};
     bool use_protobuf;
 };
 
@@ -736,6 +736,100 @@ bool ControlThread::read_assistance_from_XML()
 }
 
 
+/*
+ * Returns true if the store holds navigation data of the configured signals
+ */
+bool ControlThread::read_assistance_from_store(const std::string &filename)
+{
+    Nav_Data_Store store(filename);
+    if (!store.load())
+        {
+            return false;
+        }
+    size_t records = 0;
+
+    if (configuration_->property("Channels_1C.count", 0) > 0)
+        {
+            for (const auto &eph : store.gps_ephemeris_map)
+                {
+                    flowgraph_->send_telemetry_msg(pmt::make_any(std::make_shared<Gps_Ephemeris>(eph.second)));
+                    records++;
+                }
+            for (const auto &alm : store.gps_almanac_map)
+                {
+                    flowgraph_->send_telemetry_msg(pmt::make_any(std::make_shared<Gps_Almanac>(alm.second)));
+                    records++;
+                }
+            if (store.gps_iono)
+                {
+                    flowgraph_->send_telemetry_msg(pmt::make_any(store.gps_iono));
+                    records++;
+                }
+            if (store.gps_utc_model)
+                {
+                    flowgraph_->send_telemetry_msg(pmt::make_any(store.gps_utc_model));
+                    records++;
+                }
+        }
+
+    if ((configuration_->property("Channels_1B.count", 0) > 0) || (configuration_->property("Channels_5X.count", 0) > 0) ||
+        (configuration_->property("Channels_7X.count", 0) > 0) || (configuration_->property("Channels_E6.count", 0) > 0))
+        {
+            for (const auto &eph : store.galileo_ephemeris_map)
+                {
+                    flowgraph_->send_telemetry_msg(pmt::make_any(std::make_shared<Galileo_Ephemeris>(eph.second)));
+                    records++;
+                }
+            for (const auto &alm : store.galileo_almanac_map)
+                {
+                    flowgraph_->send_telemetry_msg(pmt::make_any(std::make_shared<Galileo_Almanac>(alm.second)));
+                    records++;
+                }
+            if (store.galileo_iono)
+                {
+                    flowgraph_->send_telemetry_msg(pmt::make_any(store.galileo_iono));
+                    records++;
+                }
+            if (store.galileo_utc_model)
+                {
+                    flowgraph_->send_telemetry_msg(pmt::make_any(store.galileo_utc_model));
+                    records++;
+                }
+        }
+
+    if ((configuration_->property("Channels_2S.count", 0) > 0) || (configuration_->property("Channels_L5.count", 0) > 0))
+        {
+            for (const auto &eph : store.gps_cnav_ephemeris_map)
+                {
+                    flowgraph_->send_telemetry_msg(pmt::make_any(std::make_shared<Gps_CNAV_Ephemeris>(eph.second)));
+                    records++;
+                }
+            if (store.gps_cnav_utc_model)
+                {
+                    flowgraph_->send_telemetry_msg(pmt::make_any(store.gps_cnav_utc_model));
+                    records++;
+                }
+        }
+
+    if ((configuration_->property("Channels_1G.count", 0) > 0) || (configuration_->property("Channels_2G.count", 0) > 0))
+        {
+            for (const auto &eph : store.glonass_gnav_ephemeris_map)
+                {
+                    flowgraph_->send_telemetry_msg(pmt::make_any(std::make_shared<Glonass_Gnav_Ephemeris>(eph.second)));
+                    records++;
+                }
+            if (store.glonass_gnav_utc_model)
+                {
+                    flowgraph_->send_telemetry_msg(pmt::make_any(store.glonass_gnav_utc_model));
+                    records++;
+                }
+        }
+
+    std::cout << "Read " << records << " navigation data records from " << filename << '\n';
+    return records > 0;
+}
+
+
 void ControlThread::assist_GNSS()
 {
     // ######### GNSS Assistance #################################
@@ -932,8 +1026,17 @@ void ControlThread::assist_GNSS()
 
     if ((enable_gps_supl_assistance == false) && (enable_agnss_xml == true))
         {
+            // If GNSS-SDR.AGNSS_store_file is set, the navigation data store
+            // written by the PVT block is preferred over the XML files
+            const std::string agnss_store_file = configuration_->property("GNSS-SDR.AGNSS_store_file", std::string(""));
+            bool assistance_from_store = false;
+            if (!agnss_store_file.empty())
+                {
+                    assistance_from_store = read_assistance_from_store(agnss_store_file);
+                }
+
             // read assistance from file
-            if (read_assistance_from_XML())
+            if ((assistance_from_store == false) && read_assistance_from_XML())
                 {
                     std::cout << "GNSS assistance data loaded from local XML file(s).\n";
                 }
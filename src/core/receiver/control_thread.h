@@ -142,6 +142,9 @@ private:
     // Read {ephemeris, iono, utc, ref loc, ref time} assistance from a local XML file previously recorded
     bool read_assistance_from_XML();
 
+    // Read {ephemeris, almanac, iono, utc} assistance from the navigation data store written by the PVT block
+    bool read_assistance_from_store(const std::string &filename);
+
     /*
      * Blocking function that reads the GPS assistance queue
      */
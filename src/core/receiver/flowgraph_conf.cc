@@ -0,0 +1,48 @@
+/*!
+ * \file flowgraph_conf.cc
+ * \brief Class that contains the configuration parameters read by the
+ * flowgraph each time it assigns signals to channels.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "flowgraph_conf.h"
+#include <exception>
+#include <string>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+void Flowgraph_Conf::SetFromConfiguration(const ConfigurationInterface* configuration,
+    int channels_count,
+    bool multiband)
+{
+    channel_satellite = std::vector<unsigned int>(channels_count, 0);
+    for (int i = 0; i < channels_count; i++)
+        {
+            try
+                {
+                    channel_satellite[i] = configuration->property("Channel" + std::to_string(i) + ".satellite", 0);
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(WARNING) << e.what();
+                }
+        }
+    assist_dual_frequency_acq = configuration->property("GNSS-SDR.assist_dual_frequency_acq", multiband);
+    there_are_gps_l1_channels = configuration->property("Channels_1C.count", 0) > 0;
+    there_are_gal_e1_channels = configuration->property("Channels_1B.count", 0) > 0;
+}
@@ -0,0 +1,51 @@
+/*!
+ * \file flowgraph_conf.h
+ * \brief Class that contains the configuration parameters read by the
+ * flowgraph each time it assigns signals to channels.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FLOWGRAPH_CONF_H
+#define GNSS_SDR_FLOWGRAPH_CONF_H
+
+#include "configuration_interface.h"
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+/*!
+ * \brief Configuration parameters used by the acquisition manager of
+ * GNSSFlowgraph, read once when the flowgraph is created instead of each time
+ * a channel reports an event.
+ */
+class Flowgraph_Conf
+{
+public:
+    Flowgraph_Conf() = default;
+
+    void SetFromConfiguration(const ConfigurationInterface* configuration, int channels_count, bool multiband);
+
+    std::vector<unsigned int> channel_satellite;  // PRN set by ChannelN.satellite, or 0
+    bool assist_dual_frequency_acq{false};
+    bool there_are_gps_l1_channels{false};
+    bool there_are_gal_e1_channels{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FLOWGRAPH_CONF_H
@@ -28,6 +28,7 @@
 #include "Galileo_E5b.h"
 #include "Galileo_E6.h"
 #include "Galileo_OSNMA.h"
+#include "acq_task_pool.h"
 #include "channel.h"
 #include "channel_fsm.h"
 #include "channel_interface.h"
@@ -35,6 +36,7 @@
 #include "gnss_block_factory.h"
 #include "gnss_block_interface.h"
 #include "gnss_satellite.h"
+#include "gnss_sdr_fft_cache.h"
 #include "gnss_sdr_make_unique.h"
 #include "gnss_synchro_monitor.h"
 #include "nav_message_monitor.h"
@@ -108,6 +110,14 @@ void GNSSFlowgraph::init()
      */
     auto block_factory = std::make_unique<GNSSBlockFactory>();
 
+    // Reuse FFTW plans measured in previous runs, if available
+    const std::string fftw_wisdom_file = configuration_->property("GNSS-SDR.fftw_wisdom_file", std::string(""));
+    if (!fftw_wisdom_file.empty())
+        {
+            Gnss_Fft_Cache::instance().import_wisdom(fftw_wisdom_file);
+        }
+    Gnss_Fft_Cache::instance().set_max_idle_plans(static_cast<size_t>(std::max(configuration_->property("GNSS-SDR.fft_plan_cache_size", 256), 0)));
+
     channels_status_ = channel_status_msg_receiver_make();
 
     if (configuration_->property("Channels_E6.count", 0) > 0)
@@ -200,6 +210,7 @@ void GNSSFlowgraph::init()
             std::shared_ptr<GNSSBlockInterface> chan_ = std::move(channels->at(i));
             channels_.push_back(std::dynamic_pointer_cast<ChannelInterface>(chan_));
         }
+    update_conf();
 
     top_block_ = gr::make_top_block("GNSSFlowgraph");
 
@@ -321,6 +332,13 @@ void GNSSFlowgraph::init()
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
             NavDataMonitor_ = nav_message_monitor_make(udp_addr_vec, configuration_->property("NavDataMonitor.port", 1237));
         }
+
+    if (!fftw_wisdom_file.empty())
+        {
+            Gnss_Fft_Cache::instance().export_wisdom(fftw_wisdom_file);
+        }
+    LOG(INFO) << "FFT plan cache: " << Gnss_Fft_Cache::instance().hits() << " plans reused, "
+              << Gnss_Fft_Cache::instance().misses() << " plans created";
 }
 
 
@@ -369,6 +387,7 @@ void GNSSFlowgraph::stop()
             top_block_->wait();
         }
 
+    Acq_Task_Pool::instance().stop();
     running_ = false;
 }
 
@@ -1088,6 +1107,13 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
                 {
                     LOG(WARNING) << e.what();
                 }
+            // Acquisition channels only share their input snapshots with
+            // channels fed by the same RF channel
+            std::shared_ptr<Channel> channel_ptr = std::dynamic_pointer_cast<Channel>(channels_.at(i));
+            if (channel_ptr)
+                {
+                    channel_ptr->acquisition()->set_rf_channel(selected_signal_conditioner_ID);
+                }
             try
                 {
                     // Enable automatic resampler for the acquisition, if required
@@ -1175,7 +1201,6 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
                                             top_block_->connect(acq_resamplers_.at(map_key), 0,
                                                 channels_.at(i)->get_left_block_acq(), 0);
 
-                                            std::shared_ptr<Channel> channel_ptr = std::dynamic_pointer_cast<Channel>(channels_.at(i));
                                             channel_ptr->acquisition()->set_resampler_latency((taps.size() - 1) / 2);
                                         }
                                     else
@@ -1492,19 +1517,12 @@ void GNSSFlowgraph::check_signal_conditioners()
 
 int GNSSFlowgraph::assign_channels()
 {
+    const auto conf = get_conf();
     // Put channels fixed to a given satellite at the beginning of the vector, then the rest
     std::vector<unsigned int> vector_of_channels;
     for (int i = 0; i < channels_count_; i++)
         {
-            unsigned int sat = 0;
-            try
-                {
-                    sat = configuration_->property("Channel" + std::to_string(i) + ".satellite", 0);
-                }
-            catch (const std::exception& e)
-                {
-                    LOG(WARNING) << e.what();
-                }
+            const unsigned int sat = conf->channel_satellite[i];
             if (sat == 0)
                 {
                     vector_of_channels.push_back(i);
@@ -1609,15 +1627,7 @@ int GNSSFlowgraph::assign_channels()
     for (unsigned int& i : vector_of_channels)
         {
             const std::string gnss_signal_str = channels_.at(i)->get_signal().get_signal_str();  // use channel's implicit signal
-            unsigned int sat = 0;
-            try
-                {
-                    sat = configuration_->property("Channel" + std::to_string(i) + ".satellite", 0);
-                }
-            catch (const std::exception& e)
-                {
-                    LOG(WARNING) << e.what();
-                }
+            const unsigned int sat = conf->channel_satellite[i];
             if (sat == 0)
                 {
                     bool assistance_available;
@@ -1756,57 +1766,46 @@ void GNSSFlowgraph::push_back_signal(const Gnss_Signal& gs)
     switch (mapStringValues_[gs.get_signal_str()])
         {
         case evGPS_1C:
-            available_GPS_1C_signals_.remove(gs);
             available_GPS_1C_signals_.push_back(gs);
             break;
 
         case evGPS_2S:
-            available_GPS_2S_signals_.remove(gs);
             available_GPS_2S_signals_.push_back(gs);
             break;
 
         case evGPS_L5:
-            available_GPS_L5_signals_.remove(gs);
             available_GPS_L5_signals_.push_back(gs);
             break;
 
         case evGAL_1B:
-            available_GAL_1B_signals_.remove(gs);
             available_GAL_1B_signals_.push_back(gs);
             break;
 
         case evGAL_5X:
-            available_GAL_5X_signals_.remove(gs);
             available_GAL_5X_signals_.push_back(gs);
             break;
 
         case evGAL_7X:
-            available_GAL_7X_signals_.remove(gs);
             available_GAL_7X_signals_.push_back(gs);
             break;
 
         case evGAL_E6:
-            available_GAL_E6_signals_.remove(gs);
             available_GAL_E6_signals_.push_back(gs);
             break;
 
         case evGLO_1G:
-            available_GLO_1G_signals_.remove(gs);
             available_GLO_1G_signals_.push_back(gs);
             break;
 
         case evGLO_2G:
-            available_GLO_2G_signals_.remove(gs);
             available_GLO_2G_signals_.push_back(gs);
             break;
 
         case evBDS_B1:
-            available_BDS_B1_signals_.remove(gs);
             available_BDS_B1_signals_.push_back(gs);
             break;
 
         case evBDS_B3:
-            available_BDS_B3_signals_.remove(gs);
             available_BDS_B3_signals_.push_back(gs);
             break;
 
@@ -1898,19 +1897,12 @@ double GNSSFlowgraph::project_doppler(const std::string& searched_signal, double
 
 void GNSSFlowgraph::acquisition_manager(unsigned int who)
 {
+    const auto conf = get_conf();
     unsigned int current_channel;
     for (int i = 0; i < channels_count_; i++)
         {
             current_channel = (i + who + 1) % channels_count_;
-            unsigned int sat_ = 0;
-            try
-                {
-                    sat_ = configuration_->property("Channel" + std::to_string(current_channel) + ".satellite", 0);
-                }
-            catch (const std::exception& e)
-                {
-                    LOG(WARNING) << e.what();
-                }
+            const unsigned int sat_ = conf->channel_satellite[current_channel];
             if ((acq_channels_count_ < max_acq_channels_) && (channels_state_[current_channel] == 0))
                 {
                     bool is_primary_freq = true;
@@ -1928,7 +1920,7 @@ void GNSSFlowgraph::acquisition_manager(unsigned int who)
                                 estimated_doppler,
                                 RX_time);
                             channels_[current_channel]->set_signal(gnss_signal);
-                            start_acquisition = is_primary_freq or assistance_available or !configuration_->property("GNSS-SDR.assist_dual_frequency_acq", multiband_);
+                            start_acquisition = is_primary_freq or assistance_available or !conf->assist_dual_frequency_acq;
                         }
                     else
                         {
@@ -1943,7 +1935,7 @@ void GNSSFlowgraph::acquisition_manager(unsigned int who)
                             DLOG(INFO) << "Channel " << current_channel
                                        << " Starting acquisition " << channels_[current_channel]->get_signal().get_satellite()
                                        << ", Signal " << channels_[current_channel]->get_signal().get_signal_str();
-                            if (assistance_available == true and configuration_->property("GNSS-SDR.assist_dual_frequency_acq", multiband_))
+                            if (assistance_available == true and conf->assist_dual_frequency_acq)
                                 {
                                     channels_[current_channel]->assist_acquisition_doppler(project_doppler(channels_[current_channel]->get_signal().get_signal_str(), estimated_doppler));
                                 }
@@ -2012,13 +2004,10 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
     Gnss_Signal gs;
     if (who < 200)
         {
-            try
-                {
-                    sat = configuration_->property("Channel" + std::to_string(who) + ".satellite", 0);
-                }
-            catch (const std::exception& e)
+            const auto conf = get_conf();
+            if (who < conf->channel_satellite.size())
                 {
-                    LOG(WARNING) << e.what();
+                    sat = conf->channel_satellite[who];
                 }
         }
     switch (what)
@@ -2113,32 +2102,34 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
 
 void GNSSFlowgraph::priorize_satellites(const std::vector<std::pair<int, Gnss_Satellite>>& visible_satellites)
 {
-    size_t old_size;
+    // Pending searches in the acquisition task pool are served by elevation
+    auto& acq_pool = Acq_Task_Pool::instance();
+    acq_pool.clear_satellite_priorities();
+    for (const auto& visible_satellite : visible_satellites)
+        {
+            acq_pool.set_satellite_priority(visible_satellite.second.get_system_short()[0], visible_satellite.second.get_PRN(), visible_satellite.first);
+        }
+
+    // Move the visible satellites still available to the beginning of the search order
     Gnss_Signal gs;
     for (const auto& visible_satellite : visible_satellites)
         {
             if (visible_satellite.second.get_system() == "GPS")
                 {
                     gs = Gnss_Signal(visible_satellite.second, "1C");
-                    old_size = available_GPS_1C_signals_.size();
-                    available_GPS_1C_signals_.remove(gs);
-                    if (old_size > available_GPS_1C_signals_.size())
+                    if (available_GPS_1C_signals_.remove(gs))
                         {
                             available_GPS_1C_signals_.push_front(gs);
                         }
 
                     gs = Gnss_Signal(visible_satellite.second, "2S");
-                    old_size = available_GPS_2S_signals_.size();
-                    available_GPS_2S_signals_.remove(gs);
-                    if (old_size > available_GPS_2S_signals_.size())
+                    if (available_GPS_2S_signals_.remove(gs))
                         {
                             available_GPS_2S_signals_.push_front(gs);
                         }
 
                     gs = Gnss_Signal(visible_satellite.second, "L5");
-                    old_size = available_GPS_L5_signals_.size();
-                    available_GPS_L5_signals_.remove(gs);
-                    if (old_size > available_GPS_L5_signals_.size())
+                    if (available_GPS_L5_signals_.remove(gs))
                         {
                             available_GPS_L5_signals_.push_front(gs);
                         }
@@ -2146,33 +2137,25 @@ void GNSSFlowgraph::priorize_satellites(const std::vector<std::pair<int, Gnss_Sa
             else if (visible_satellite.second.get_system() == "Galileo")
                 {
                     gs = Gnss_Signal(visible_satellite.second, "1B");
-                    old_size = available_GAL_1B_signals_.size();
-                    available_GAL_1B_signals_.remove(gs);
-                    if (old_size > available_GAL_1B_signals_.size())
+                    if (available_GAL_1B_signals_.remove(gs))
                         {
                             available_GAL_1B_signals_.push_front(gs);
                         }
 
                     gs = Gnss_Signal(visible_satellite.second, "5X");
-                    old_size = available_GAL_5X_signals_.size();
-                    available_GAL_5X_signals_.remove(gs);
-                    if (old_size > available_GAL_5X_signals_.size())
+                    if (available_GAL_5X_signals_.remove(gs))
                         {
                             available_GAL_5X_signals_.push_front(gs);
                         }
 
                     gs = Gnss_Signal(visible_satellite.second, "7X");
-                    old_size = available_GAL_7X_signals_.size();
-                    available_GAL_7X_signals_.remove(gs);
-                    if (old_size > available_GAL_7X_signals_.size())
+                    if (available_GAL_7X_signals_.remove(gs))
                         {
                             available_GAL_7X_signals_.push_front(gs);
                         }
 
                     gs = Gnss_Signal(visible_satellite.second, "E6");
-                    old_size = available_GAL_E6_signals_.size();
-                    available_GAL_E6_signals_.remove(gs);
-                    if (old_size > available_GAL_E6_signals_.size())
+                    if (available_GAL_E6_signals_.remove(gs))
                         {
                             available_GAL_E6_signals_.push_front(gs);
                         }
@@ -2193,6 +2176,23 @@ void GNSSFlowgraph::set_configuration(const std::shared_ptr<ConfigurationInterfa
             LOG(WARNING) << "Unable to update configuration while flowgraph connected";
         }
     configuration_ = configuration;
+    update_conf();
+}
+
+
+void GNSSFlowgraph::update_conf()
+{
+    auto conf = std::make_shared<Flowgraph_Conf>();
+    conf->SetFromConfiguration(configuration_.get(), channels_count_, multiband_);
+    std::lock_guard<std::mutex> lock(conf_mutex_);
+    conf_ = std::move(conf);
+}
+
+
+std::shared_ptr<const Flowgraph_Conf> GNSSFlowgraph::get_conf() const
+{
+    std::lock_guard<std::mutex> lock(conf_mutex_);
+    return conf_;
 }
 
 
@@ -2721,249 +2721,113 @@ Gnss_Signal GNSSFlowgraph::search_next_signal(const std::string& searched_signal
 {
     is_primary_frequency = false;
     assistance_available = false;
+    const auto conf = get_conf();
     Gnss_Signal result{};
-    bool found_signal = false;
     switch (mapStringValues_[searched_signal])
         {
         case evGPS_1C:
             // todo: assist the satellite selection with almanac and current PVT here (reuse priorize_satellite function used in control_thread)
-            result = available_GPS_1C_signals_.front();
-            available_GPS_1C_signals_.pop_front();
-            available_GPS_1C_signals_.push_back(result);
+            result = available_GPS_1C_signals_.rotate();
             is_primary_frequency = true;  // indicate that the searched satellite signal belongs to "primary" link (L1, E1, B1, etc..)
             break;
 
         case evGPS_2S:
-            if (configuration_->property("Channels_1C.count", 0) > 0)
-                {
-                    // 1. Get the current channel status map
-                    std::map<int, std::shared_ptr<Gnss_Synchro>> current_channels_status = channels_status_->get_current_status_map();
-                    // 2. search the currently tracked GPS L1 satellites and assist the GPS L2 acquisition if the satellite is not tracked on L2
-                    for (auto& current_status : current_channels_status)
-                        {
-                            if (std::string(current_status.second->Signal) == "1C")
-                                {
-                                    std::list<Gnss_Signal>::iterator it2;
-                                    it2 = std::find_if(std::begin(available_GPS_2S_signals_), std::end(available_GPS_2S_signals_),
-                                        [&](Gnss_Signal const& sig) { return sig.get_satellite().get_PRN() == current_status.second->PRN; });
-
-                                    if (it2 != available_GPS_2S_signals_.end())
-                                        {
-                                            estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
-                                            RX_time = current_status.second->RX_time;
-                                            // 3. return the GPS L2 satellite and remove it from list
-                                            result = *it2;
-                                            available_GPS_2S_signals_.erase(it2);
-                                            found_signal = true;
-                                            assistance_available = true;
-                                            break;
-                                        }
-                                }
-                        }
-                }
-            // fallback: pick the front satellite because there is no tracked satellites in L1 to assist L2
-            if (found_signal == false)
+            // assist the GPS L2 acquisition with a satellite tracked in L1
+            assistance_available = conf->there_are_gps_l1_channels && take_assisted_signal("1C", available_GPS_2S_signals_, result, estimated_doppler, RX_time);
+            if (!assistance_available)
                 {
-                    result = available_GPS_2S_signals_.front();
-                    available_GPS_2S_signals_.pop_front();
-                    available_GPS_2S_signals_.push_back(result);
+                    result = available_GPS_2S_signals_.rotate();
                 }
             break;
 
         case evGPS_L5:
-            if (configuration_->property("Channels_1C.count", 0) > 0)
-                {
-                    // 1. Get the current channel status map
-                    std::map<int, std::shared_ptr<Gnss_Synchro>> current_channels_status = channels_status_->get_current_status_map();
-                    // 2. search the currently tracked GPS L1 satellites and assist the GPS L5 acquisition if the satellite is not tracked on L5
-                    for (auto& current_status : current_channels_status)
-                        {
-                            if (std::string(current_status.second->Signal) == "1C")
-                                {
-                                    std::list<Gnss_Signal>::iterator it2;
-                                    it2 = std::find_if(std::begin(available_GPS_L5_signals_), std::end(available_GPS_L5_signals_),
-                                        [&](Gnss_Signal const& sig) { return sig.get_satellite().get_PRN() == current_status.second->PRN; });
-
-                                    if (it2 != available_GPS_L5_signals_.end())
-                                        {
-                                            estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
-                                            RX_time = current_status.second->RX_time;
-                                            // std::cout << " Channel: " << it->first << " => Doppler: " << estimated_doppler << "[Hz] \n";
-                                            // 3. return the GPS L5 satellite and remove it from list
-                                            result = *it2;
-                                            available_GPS_L5_signals_.erase(it2);
-                                            found_signal = true;
-                                            assistance_available = true;
-                                            break;
-                                        }
-                                }
-                        }
-                }
-            // fallback: pick the front satellite because there is no tracked satellites in L1 to assist L5
-            if (found_signal == false)
+            // assist the GPS L5 acquisition with a satellite tracked in L1
+            assistance_available = conf->there_are_gps_l1_channels && take_assisted_signal("1C", available_GPS_L5_signals_, result, estimated_doppler, RX_time);
+            if (!assistance_available)
                 {
-                    result = available_GPS_L5_signals_.front();
-                    available_GPS_L5_signals_.pop_front();
-                    available_GPS_L5_signals_.push_back(result);
+                    result = available_GPS_L5_signals_.rotate();
                 }
             break;
 
         case evGAL_1B:
-            result = available_GAL_1B_signals_.front();
-            available_GAL_1B_signals_.pop_front();
-            available_GAL_1B_signals_.push_back(result);
+            result = available_GAL_1B_signals_.rotate();
             is_primary_frequency = true;  // indicate that the searched satellite signal belongs to "primary" link (L1, E1, B1, etc..)
             break;
 
         case evGAL_5X:
-            if (configuration_->property("Channels_1B.count", 0) > 0)
-                {
-                    // 1. Get the current channel status map
-                    std::map<int, std::shared_ptr<Gnss_Synchro>> current_channels_status = channels_status_->get_current_status_map();
-                    // 2. search the currently tracked Galileo E1 satellites and assist the Galileo E5 acquisition if the satellite is not tracked on E5
-                    for (auto& current_status : current_channels_status)
-                        {
-                            if (std::string(current_status.second->Signal) == "1B")
-                                {
-                                    std::list<Gnss_Signal>::iterator it2;
-                                    it2 = std::find_if(std::begin(available_GAL_5X_signals_), std::end(available_GAL_5X_signals_),
-                                        [&](Gnss_Signal const& sig) { return sig.get_satellite().get_PRN() == current_status.second->PRN; });
-
-                                    if (it2 != available_GAL_5X_signals_.end())
-                                        {
-                                            estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
-                                            RX_time = current_status.second->RX_time;
-                                            // std::cout << " Channel: " << it->first << " => Doppler: " << estimated_doppler << "[Hz] \n";
-                                            // 3. return the Gal 5X satellite and remove it from list
-                                            result = *it2;
-                                            available_GAL_5X_signals_.erase(it2);
-                                            found_signal = true;
-                                            assistance_available = true;
-                                            break;
-                                        }
-                                }
-                        }
-                }
-            // fallback: pick the front satellite because there is no tracked satellites in E1 to assist E5
-            if (found_signal == false)
+            // assist the Galileo E5a acquisition with a satellite tracked in E1
+            assistance_available = conf->there_are_gal_e1_channels && take_assisted_signal("1B", available_GAL_5X_signals_, result, estimated_doppler, RX_time);
+            if (!assistance_available)
                 {
-                    result = available_GAL_5X_signals_.front();
-                    available_GAL_5X_signals_.pop_front();
-                    available_GAL_5X_signals_.push_back(result);
+                    result = available_GAL_5X_signals_.rotate();
                 }
             break;
 
         case evGAL_7X:
-            if (configuration_->property("Channels_1B.count", 0) > 0)
+            // assist the Galileo E5b acquisition with a satellite tracked in E1
+            assistance_available = conf->there_are_gal_e1_channels && take_assisted_signal("1B", available_GAL_7X_signals_, result, estimated_doppler, RX_time);
+            if (!assistance_available)
                 {
-                    // 1. Get the current channel status map
-                    std::map<int, std::shared_ptr<Gnss_Synchro>> current_channels_status = channels_status_->get_current_status_map();
-                    // 2. search the currently tracked Galileo E1 satellites and assist the Galileo E5 acquisition if the satellite is not tracked on E5
-                    for (auto& current_status : current_channels_status)
-                        {
-                            if (std::string(current_status.second->Signal) == "1B")
-                                {
-                                    std::list<Gnss_Signal>::iterator it2;
-                                    it2 = std::find_if(std::begin(available_GAL_7X_signals_), std::end(available_GAL_7X_signals_),
-                                        [&](Gnss_Signal const& sig) { return sig.get_satellite().get_PRN() == current_status.second->PRN; });
-
-                                    if (it2 != available_GAL_7X_signals_.end())
-                                        {
-                                            estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
-                                            RX_time = current_status.second->RX_time;
-                                            // std::cout << " Channel: " << it->first << " => Doppler: " << estimated_doppler << "[Hz] \n";
-                                            // 3. return the Gal 7X satellite and remove it from list
-                                            result = *it2;
-                                            available_GAL_7X_signals_.erase(it2);
-                                            found_signal = true;
-                                            assistance_available = true;
-                                            break;
-                                        }
-                                }
-                        }
-                }
-            // fallback: pick the front satellite because there is no tracked satellites in E1 to assist E5
-            if (found_signal == false)
-                {
-                    result = available_GAL_7X_signals_.front();
-                    available_GAL_7X_signals_.pop_front();
-                    available_GAL_7X_signals_.push_back(result);
+                    result = available_GAL_7X_signals_.rotate();
                 }
             break;
 
         case evGAL_E6:
-            if (configuration_->property("Channels_1B.count", 0) > 0)
-                {
-                    // 1. Get the current channel status map
-                    std::map<int, std::shared_ptr<Gnss_Synchro>> current_channels_status = channels_status_->get_current_status_map();
-                    // 2. search the currently tracked Galileo E1 satellites and assist the Galileo E5 acquisition if the satellite is not tracked on E5
-                    for (auto& current_status : current_channels_status)
-                        {
-                            if (std::string(current_status.second->Signal) == "1B")
-                                {
-                                    std::list<Gnss_Signal>::iterator it2;
-                                    it2 = std::find_if(std::begin(available_GAL_E6_signals_), std::end(available_GAL_E6_signals_),
-                                        [&](Gnss_Signal const& sig) { return sig.get_satellite().get_PRN() == current_status.second->PRN; });
-
-                                    if (it2 != available_GAL_E6_signals_.end())
-                                        {
-                                            estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
-                                            RX_time = current_status.second->RX_time;
-                                            // std::cout << " Channel: " << it->first << " => Doppler: " << estimated_doppler << "[Hz] \n";
-                                            // 3. return the Gal E6 satellite and remove it from list
-                                            result = *it2;
-                                            available_GAL_E6_signals_.erase(it2);
-                                            found_signal = true;
-                                            assistance_available = true;
-                                            break;
-                                        }
-                                }
-                        }
-                }
-            // fallback: pick the front satellite because there is no tracked satellites in E1 to assist E6
-            if (found_signal == false)
+            // assist the Galileo E6 acquisition with a satellite tracked in E1
+            assistance_available = conf->there_are_gal_e1_channels && take_assisted_signal("1B", available_GAL_E6_signals_, result, estimated_doppler, RX_time);
+            if (!assistance_available)
                 {
-                    result = available_GAL_E6_signals_.front();
-                    available_GAL_E6_signals_.pop_front();
-                    available_GAL_E6_signals_.push_back(result);
+                    result = available_GAL_E6_signals_.rotate();
                 }
             break;
 
         case evGLO_1G:
-            result = available_GLO_1G_signals_.front();
-            available_GLO_1G_signals_.pop_front();
-            available_GLO_1G_signals_.push_back(result);
+            result = available_GLO_1G_signals_.rotate();
             is_primary_frequency = true;  // indicate that the searched satellite signal belongs to "primary" link (L1, E1, B1, etc..)
             break;
 
         case evGLO_2G:
-            result = available_GLO_2G_signals_.front();
-            available_GLO_2G_signals_.pop_front();
-            available_GLO_2G_signals_.push_back(result);
+            result = available_GLO_2G_signals_.rotate();
             break;
 
         case evBDS_B1:
-            result = available_BDS_B1_signals_.front();
-            available_BDS_B1_signals_.pop_front();
-            available_BDS_B1_signals_.push_back(result);
+            result = available_BDS_B1_signals_.rotate();
             is_primary_frequency = true;  // indicate that the searched satellite signal belongs to "primary" link (L1, E1, B1, etc..)
             break;
 
         case evBDS_B3:
-            result = available_BDS_B3_signals_.front();
-            available_BDS_B3_signals_.pop_front();
-            available_BDS_B3_signals_.push_back(result);
+            result = available_BDS_B3_signals_.rotate();
             break;
 
         default:
             LOG(ERROR) << "This should not happen :-(";
             if (!available_GPS_1C_signals_.empty())
                 {
-                    result = available_GPS_1C_signals_.front();
-                    available_GPS_1C_signals_.pop_front();
-                    available_GPS_1C_signals_.push_back(result);
+                    result = available_GPS_1C_signals_.rotate();
                 }
             break;
         }
     return result;
 }
+
+
+bool GNSSFlowgraph::take_assisted_signal(const std::string& primary_signal,
+    Gnss_Signal_Pool& pool,
+    Gnss_Signal& result,
+    float& estimated_doppler,
+    double& RX_time)
+{
+    // Search the satellites tracked in the primary band that are still
+    // available in the band of pool, and take the first one
+    const std::map<int, std::shared_ptr<Gnss_Synchro>> current_channels_status = channels_status_->get_current_status_map();
+    for (const auto& current_status : current_channels_status)
+        {
+            if (primary_signal == current_status.second->Signal && pool.take(current_status.second->PRN, result))
+                {
+                    estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
+                    RX_time = current_status.second->RX_time;
+                    return true;
+                }
+        }
+    return false;
+}
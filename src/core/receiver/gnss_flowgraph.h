@@ -26,16 +26,17 @@
 
 #include "channel_status_msg_receiver.h"
 #include "concurrent_queue.h"
+#include "flowgraph_conf.h"
 #include "galileo_e6_has_msg_receiver.h"
 #include "galileo_tow_map.h"
 #include "gnss_sdr_sample_counter.h"
 #include "gnss_signal.h"
+#include "gnss_signal_pool.h"
 #include "osnma_msg_receiver.h"
 #include "pvt_interface.h"
 #include <gnuradio/blocks/null_sink.h>  // for null_sink
 #include <gnuradio/runtime_types.h>     // for basic_block_sptr, top_block_sptr
 #include <pmt/pmt.h>                    // for pmt_t
-#include <list>                         // for list
 #include <map>                          // for map
 #include <memory>                       // for for shared_ptr, dynamic_pointer_cast
 #include <mutex>                        // for mutex
@@ -204,6 +205,12 @@ private:
         float& estimated_doppler,
         double& RX_time);
 
+    bool take_assisted_signal(const std::string& primary_signal,
+        Gnss_Signal_Pool& pool,
+        Gnss_Signal& result,
+        float& estimated_doppler,
+        double& RX_time);
+
     void push_back_signal(const Gnss_Signal& gs);
     void remove_signal(const Gnss_Signal& gs);
     void print_help();
@@ -211,6 +218,8 @@ private:
 
     double project_doppler(const std::string& searched_signal, double primary_freq_doppler_hz);
     bool is_multiband() const;
+    void update_conf();  // reads the configuration parameters used by the acquisition manager
+    std::shared_ptr<const Flowgraph_Conf> get_conf() const;
 
     std::vector<std::string> split_string(const std::string& s, char delim);
     std::vector<bool> signal_conditioner_connected_;
@@ -218,6 +227,7 @@ private:
     gr::top_block_sptr top_block_;
 
     std::shared_ptr<ConfigurationInterface> configuration_;
+    std::shared_ptr<const Flowgraph_Conf> conf_;  // replaced as a whole by set_configuration()
     std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue_;
 
     std::vector<std::shared_ptr<SignalSourceInterface>> sig_source_;
@@ -245,18 +255,18 @@ private:
 
     std::vector<unsigned int> channels_state_;
 
-    std::list<Gnss_Signal> available_GPS_1C_signals_;
-    std::list<Gnss_Signal> available_GPS_2S_signals_;
-    std::list<Gnss_Signal> available_GPS_L5_signals_;
-    std::list<Gnss_Signal> available_SBAS_1C_signals_;
-    std::list<Gnss_Signal> available_GAL_1B_signals_;
-    std::list<Gnss_Signal> available_GAL_5X_signals_;
-    std::list<Gnss_Signal> available_GAL_7X_signals_;
-    std::list<Gnss_Signal> available_GAL_E6_signals_;
-    std::list<Gnss_Signal> available_GLO_1G_signals_;
-    std::list<Gnss_Signal> available_GLO_2G_signals_;
-    std::list<Gnss_Signal> available_BDS_B1_signals_;
-    std::list<Gnss_Signal> available_BDS_B3_signals_;
+    Gnss_Signal_Pool available_GPS_1C_signals_;
+    Gnss_Signal_Pool available_GPS_2S_signals_;
+    Gnss_Signal_Pool available_GPS_L5_signals_;
+    Gnss_Signal_Pool available_SBAS_1C_signals_;
+    Gnss_Signal_Pool available_GAL_1B_signals_;
+    Gnss_Signal_Pool available_GAL_5X_signals_;
+    Gnss_Signal_Pool available_GAL_7X_signals_;
+    Gnss_Signal_Pool available_GAL_E6_signals_;
+    Gnss_Signal_Pool available_GLO_1G_signals_;
+    Gnss_Signal_Pool available_GLO_2G_signals_;
+    Gnss_Signal_Pool available_BDS_B1_signals_;
+    Gnss_Signal_Pool available_BDS_B3_signals_;
 
     enum StringValue
     {
@@ -279,6 +289,7 @@ private:
     std::string help_hint_;
 
     std::mutex signal_list_mutex_;
+    mutable std::mutex conf_mutex_;
 
     int sources_count_;
     int channels_count_;
@@ -0,0 +1,197 @@
+/*!
+ * \file gnss_signal_pool.cc
+ * \brief Ordered set of the GNSS signals of one band available for
+ * acquisition, indexed by PRN.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_signal_pool.h"
+
+
+void Gnss_Signal_Pool::push_back(const Gnss_Signal& signal)
+{
+    const uint32_t prn = signal.get_satellite().get_PRN();
+    unlink(prn);
+    node(prn).signal = signal;
+    link_back(prn);
+}
+
+
+void Gnss_Signal_Pool::emplace_back(const Gnss_Satellite& satellite, const std::string& signal)
+{
+    push_back(Gnss_Signal(satellite, signal));
+}
+
+
+void Gnss_Signal_Pool::push_front(const Gnss_Signal& signal)
+{
+    const uint32_t prn = signal.get_satellite().get_PRN();
+    unlink(prn);
+    node(prn).signal = signal;
+    link_front(prn);
+}
+
+
+bool Gnss_Signal_Pool::remove(const Gnss_Signal& signal)
+{
+    const uint32_t prn = signal.get_satellite().get_PRN();
+    if (!contains(prn))
+        {
+            return false;
+        }
+    unlink(prn);
+    return true;
+}
+
+
+bool Gnss_Signal_Pool::take(uint32_t prn, Gnss_Signal& signal)
+{
+    if (!contains(prn))
+        {
+            return false;
+        }
+    signal = d_nodes[prn].signal;
+    unlink(prn);
+    return true;
+}
+
+
+bool Gnss_Signal_Pool::contains(uint32_t prn) const
+{
+    return prn < d_nodes.size() && d_nodes[prn].in_pool;
+}
+
+
+Gnss_Signal Gnss_Signal_Pool::rotate()
+{
+    if (d_head < 0)
+        {
+            return d_empty;
+        }
+    const auto prn = static_cast<uint32_t>(d_head);
+    if (d_head != d_tail)
+        {
+            unlink(prn);
+            link_back(prn);
+        }
+    return d_nodes[prn].signal;
+}
+
+
+const Gnss_Signal& Gnss_Signal_Pool::front() const
+{
+    if (d_head < 0)
+        {
+            return d_empty;
+        }
+    return d_nodes[d_head].signal;
+}
+
+
+void Gnss_Signal_Pool::pop_front()
+{
+    if (d_head >= 0)
+        {
+            unlink(static_cast<uint32_t>(d_head));
+        }
+}
+
+
+std::vector<Gnss_Signal> Gnss_Signal_Pool::signals() const
+{
+    std::vector<Gnss_Signal> result;
+    result.reserve(d_size);
+    for (int32_t i = d_head; i >= 0; i = d_nodes[i].next)
+        {
+            result.push_back(d_nodes[i].signal);
+        }
+    return result;
+}
+
+
+Gnss_Signal_Pool::Node& Gnss_Signal_Pool::node(uint32_t prn)
+{
+    if (prn >= d_nodes.size())
+        {
+            d_nodes.resize(prn + 1);
+        }
+    return d_nodes[prn];
+}
+
+
+void Gnss_Signal_Pool::unlink(uint32_t prn)
+{
+    if (!contains(prn))
+        {
+            return;
+        }
+    Node& n = d_nodes[prn];
+    if (n.prev >= 0)
+        {
+            d_nodes[n.prev].next = n.next;
+        }
+    else
+        {
+            d_head = n.next;
+        }
+    if (n.next >= 0)
+        {
+            d_nodes[n.next].prev = n.prev;
+        }
+    else
+        {
+            d_tail = n.prev;
+        }
+    n.prev = -1;
+    n.next = -1;
+    n.in_pool = false;
+    d_size--;
+}
+
+
+void Gnss_Signal_Pool::link_back(uint32_t prn)
+{
+    Node& n = d_nodes[prn];
+    n.prev = d_tail;
+    n.next = -1;
+    if (d_tail >= 0)
+        {
+            d_nodes[d_tail].next = static_cast<int32_t>(prn);
+        }
+    else
+        {
+            d_head = static_cast<int32_t>(prn);
+        }
+    d_tail = static_cast<int32_t>(prn);
+    n.in_pool = true;
+    d_size++;
+}
+
+
+void Gnss_Signal_Pool::link_front(uint32_t prn)
+{
+    Node& n = d_nodes[prn];
+    n.prev = -1;
+    n.next = d_head;
+    if (d_head >= 0)
+        {
+            d_nodes[d_head].prev = static_cast<int32_t>(prn);
+        }
+    else
+        {
+            d_tail = static_cast<int32_t>(prn);
+        }
+    d_head = static_cast<int32_t>(prn);
+    n.in_pool = true;
+    d_size++;
+}
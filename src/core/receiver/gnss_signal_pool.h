@@ -0,0 +1,118 @@
+/*!
+ * \file gnss_signal_pool.h
+ * \brief Ordered set of the GNSS signals of one band available for
+ * acquisition, indexed by PRN.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * The signals are kept in a doubly linked list stored in a vector indexed by
+ * PRN, so finding, removing and reinserting a satellite are O(1) operations.
+ * The order of the list is the order in which satellites are searched.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SIGNAL_POOL_H
+#define GNSS_SDR_GNSS_SIGNAL_POOL_H
+
+#include "gnss_satellite.h"
+#include "gnss_signal.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+/*!
+ * \brief Signals of one band available for acquisition, in search order.
+ * A satellite (PRN) appears at most once.
+ */
+class Gnss_Signal_Pool
+{
+public:
+    Gnss_Signal_Pool() = default;
+
+    /*!
+     * \brief Adds the signal at the end of the search order. If it was
+     * already in the pool, it is moved there.
+     */
+    void push_back(const Gnss_Signal& signal);
+    void emplace_back(const Gnss_Satellite& satellite, const std::string& signal);
+
+    /*!
+     * \brief Adds the signal at the beginning of the search order. If it was
+     * already in the pool, it is moved there.
+     */
+    void push_front(const Gnss_Signal& signal);
+
+    /*!
+     * \brief Removes the signal. Returns false if it was not in the pool.
+     */
+    bool remove(const Gnss_Signal& signal);
+
+    /*!
+     * \brief Removes the signal of satellite prn and copies it to signal.
+     * Returns false, leaving signal untouched, if it was not in the pool.
+     */
+    bool take(uint32_t prn, Gnss_Signal& signal);
+
+    bool contains(uint32_t prn) const;
+
+    /*!
+     * \brief Returns the first signal and moves it to the end of the search
+     * order. The pool must not be empty.
+     */
+    Gnss_Signal rotate();
+
+    const Gnss_Signal& front() const;
+    void pop_front();
+
+    size_t size() const
+    {
+        return d_size;
+    }
+
+    bool empty() const
+    {
+        return d_size == 0;
+    }
+
+    std::vector<Gnss_Signal> signals() const;  //!< Signals in search order
+
+private:
+    struct Node
+    {
+        Gnss_Signal signal;
+        int32_t prev{-1};
+        int32_t next{-1};
+        bool in_pool{false};
+    };
+
+    void unlink(uint32_t prn);
+    void link_back(uint32_t prn);
+    void link_front(uint32_t prn);
+    Node& node(uint32_t prn);
+
+    std::vector<Node> d_nodes;  // indexed by PRN
+    Gnss_Signal d_empty;
+    int32_t d_head{-1};
+    int32_t d_tail{-1};
+    size_t d_size{0};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SIGNAL_POOL_H
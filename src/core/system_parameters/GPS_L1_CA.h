@@ -8,7 +8,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -20,9 +20,8 @@
 
 #include "MATH_CONSTANTS.h"
 #include "gnss_frequencies.h"
+#include "gnss_packed_frame.h"
 #include <cstdint>
-#include <utility>  // std::pair
-#include <vector>
 
 /** \addtogroup Core
  * \{ */
@@ -77,177 +76,177 @@ constexpr char GPS_CA_PREAMBLE_SYMBOLS_STR[161] = "11111111111111111111000000000
 
 // SUBFRAME 1-5 (TLM and HOW)
 
-const std::vector<std::pair<int32_t, int32_t>> TOW({{31, 17}});
-const std::vector<std::pair<int32_t, int32_t>> INTEGRITY_STATUS_FLAG({{23, 1}});
-const std::vector<std::pair<int32_t, int32_t>> ALERT_FLAG({{48, 1}});
-const std::vector<std::pair<int32_t, int32_t>> ANTI_SPOOFING_FLAG({{49, 1}});
-const std::vector<std::pair<int32_t, int32_t>> SUBFRAME_ID({{50, 3}});
+constexpr Gnss_Frame_Field<1> TOW{{{31, 17}}};
+constexpr Gnss_Frame_Field<1> INTEGRITY_STATUS_FLAG{{{23, 1}}};
+constexpr Gnss_Frame_Field<1> ALERT_FLAG{{{48, 1}}};
+constexpr Gnss_Frame_Field<1> ANTI_SPOOFING_FLAG{{{49, 1}}};
+constexpr Gnss_Frame_Field<1> SUBFRAME_ID{{{50, 3}}};
 
 // SUBFRAME 1
-const std::vector<std::pair<int32_t, int32_t>> GPS_WEEK({{61, 10}});
-const std::vector<std::pair<int32_t, int32_t>> CA_OR_P_ON_L2({{71, 2}});  //*
-const std::vector<std::pair<int32_t, int32_t>> SV_ACCURACY({{73, 4}});
-const std::vector<std::pair<int32_t, int32_t>> SV_HEALTH({{77, 6}});
-const std::vector<std::pair<int32_t, int32_t>> L2_P_DATA_FLAG({{91, 1}});
-const std::vector<std::pair<int32_t, int32_t>> T_GD({{197, 8}});
+constexpr Gnss_Frame_Field<1> GPS_WEEK{{{61, 10}}};
+constexpr Gnss_Frame_Field<1> CA_OR_P_ON_L2{{{71, 2}}};  //*
+constexpr Gnss_Frame_Field<1> SV_ACCURACY{{{73, 4}}};
+constexpr Gnss_Frame_Field<1> SV_HEALTH{{{77, 6}}};
+constexpr Gnss_Frame_Field<1> L2_P_DATA_FLAG{{{91, 1}}};
+constexpr Gnss_Frame_Field<1> T_GD{{{197, 8}}};
 constexpr double T_GD_LSB = TWO_N31;
-const std::vector<std::pair<int32_t, int32_t>> IODC({{83, 2}, {211, 8}});
-const std::vector<std::pair<int32_t, int32_t>> T_OC({{219, 16}});
+constexpr Gnss_Frame_Field<2> IODC{{{83, 2}, {211, 8}}};
+constexpr Gnss_Frame_Field<1> T_OC{{{219, 16}}};
 constexpr int32_t T_OC_LSB = static_cast<int32_t>(TWO_P4);
-const std::vector<std::pair<int32_t, int32_t>> A_F2({{241, 8}});
+constexpr Gnss_Frame_Field<1> A_F2{{{241, 8}}};
 constexpr double A_F2_LSB = TWO_N55;
-const std::vector<std::pair<int32_t, int32_t>> A_F1({{249, 16}});
+constexpr Gnss_Frame_Field<1> A_F1{{{249, 16}}};
 constexpr double A_F1_LSB = TWO_N43;
-const std::vector<std::pair<int32_t, int32_t>> A_F0({{271, 22}});
+constexpr Gnss_Frame_Field<1> A_F0{{{271, 22}}};
 constexpr double A_F0_LSB = TWO_N31;
 
 // SUBFRAME 2
-const std::vector<std::pair<int32_t, int32_t>> IODE_SF2({{61, 8}});
-const std::vector<std::pair<int32_t, int32_t>> C_RS({{69, 16}});
+constexpr Gnss_Frame_Field<1> IODE_SF2{{{61, 8}}};
+constexpr Gnss_Frame_Field<1> C_RS{{{69, 16}}};
 constexpr double C_RS_LSB = TWO_N5;
-const std::vector<std::pair<int32_t, int32_t>> DELTA_N({{91, 16}});
+constexpr Gnss_Frame_Field<1> DELTA_N{{{91, 16}}};
 constexpr double DELTA_N_LSB = PI_TWO_N43;
-const std::vector<std::pair<int32_t, int32_t>> M_0({{107, 8}, {121, 24}});
+constexpr Gnss_Frame_Field<2> M_0{{{107, 8}, {121, 24}}};
 constexpr double M_0_LSB = PI_TWO_N31;
-const std::vector<std::pair<int32_t, int32_t>> C_UC({{151, 16}});
+constexpr Gnss_Frame_Field<1> C_UC{{{151, 16}}};
 constexpr double C_UC_LSB = TWO_N29;
-const std::vector<std::pair<int32_t, int32_t>> ECCENTRICITY({{167, 8}, {181, 24}});
+constexpr Gnss_Frame_Field<2> ECCENTRICITY{{{167, 8}, {181, 24}}};
 constexpr double ECCENTRICITY_LSB = TWO_N33;
-const std::vector<std::pair<int32_t, int32_t>> C_US({{211, 16}});
+constexpr Gnss_Frame_Field<1> C_US{{{211, 16}}};
 constexpr double C_US_LSB = TWO_N29;
-const std::vector<std::pair<int32_t, int32_t>> SQRT_A({{227, 8}, {241, 24}});
+constexpr Gnss_Frame_Field<2> SQRT_A{{{227, 8}, {241, 24}}};
 constexpr double SQRT_A_LSB = TWO_N19;
-const std::vector<std::pair<int32_t, int32_t>> T_OE({{271, 16}});
+constexpr Gnss_Frame_Field<1> T_OE{{{271, 16}}};
 constexpr int32_t T_OE_LSB = static_cast<int32_t>(TWO_P4);
-const std::vector<std::pair<int32_t, int32_t>> FIT_INTERVAL_FLAG({{271, 1}});
-const std::vector<std::pair<int32_t, int32_t>> AODO({{272, 5}});
+constexpr Gnss_Frame_Field<1> FIT_INTERVAL_FLAG{{{271, 1}}};
+constexpr Gnss_Frame_Field<1> AODO{{{272, 5}}};
 constexpr int32_t AODO_LSB = 900;
 
 // SUBFRAME 3
-const std::vector<std::pair<int32_t, int32_t>> C_IC({{61, 16}});
+constexpr Gnss_Frame_Field<1> C_IC{{{61, 16}}};
 constexpr double C_IC_LSB = TWO_N29;
-const std::vector<std::pair<int32_t, int32_t>> OMEGA_0({{77, 8}, {91, 24}});
+constexpr Gnss_Frame_Field<2> OMEGA_0{{{77, 8}, {91, 24}}};
 constexpr double OMEGA_0_LSB = PI_TWO_N31;
-const std::vector<std::pair<int32_t, int32_t>> C_IS({{121, 16}});
+constexpr Gnss_Frame_Field<1> C_IS{{{121, 16}}};
 constexpr double C_IS_LSB = TWO_N29;
-const std::vector<std::pair<int32_t, int32_t>> I_0({{137, 8}, {151, 24}});
+constexpr Gnss_Frame_Field<2> I_0{{{137, 8}, {151, 24}}};
 constexpr double I_0_LSB = PI_TWO_N31;
-const std::vector<std::pair<int32_t, int32_t>> C_RC({{181, 16}});
+constexpr Gnss_Frame_Field<1> C_RC{{{181, 16}}};
 constexpr double C_RC_LSB = TWO_N5;
-const std::vector<std::pair<int32_t, int32_t>> OMEGA({{197, 8}, {211, 24}});
+constexpr Gnss_Frame_Field<2> OMEGA{{{197, 8}, {211, 24}}};
 constexpr double OMEGA_LSB = PI_TWO_N31;
-const std::vector<std::pair<int32_t, int32_t>> OMEGA_DOT({{241, 24}});
+constexpr Gnss_Frame_Field<1> OMEGA_DOT{{{241, 24}}};
 constexpr double OMEGA_DOT_LSB = PI_TWO_N43;
-const std::vector<std::pair<int32_t, int32_t>> IODE_SF3({{271, 8}});
-const std::vector<std::pair<int32_t, int32_t>> I_DOT({{279, 14}});
+constexpr Gnss_Frame_Field<1> IODE_SF3{{{271, 8}}};
+constexpr Gnss_Frame_Field<1> I_DOT{{{279, 14}}};
 constexpr double I_DOT_LSB = PI_TWO_N43;
 
 // SUBFRAME 4-5
-const std::vector<std::pair<int32_t, int32_t>> SV_DATA_ID({{61, 2}});
-const std::vector<std::pair<int32_t, int32_t>> SV_PAGE({{63, 6}});
+constexpr Gnss_Frame_Field<1> SV_DATA_ID{{{61, 2}}};
+constexpr Gnss_Frame_Field<1> SV_PAGE{{{63, 6}}};
 
 // SUBFRAME 4
 //! \todo read all pages of subframe 4
 // Page 18 - Ionospheric and UTC data
-const std::vector<std::pair<int32_t, int32_t>> ALPHA_0({{69, 8}});
+constexpr Gnss_Frame_Field<1> ALPHA_0{{{69, 8}}};
 constexpr double ALPHA_0_LSB = TWO_N30;
-const std::vector<std::pair<int32_t, int32_t>> ALPHA_1({{77, 8}});
+constexpr Gnss_Frame_Field<1> ALPHA_1{{{77, 8}}};
 constexpr double ALPHA_1_LSB = TWO_N27;
-const std::vector<std::pair<int32_t, int32_t>> ALPHA_2({{91, 8}});
+constexpr Gnss_Frame_Field<1> ALPHA_2{{{91, 8}}};
 constexpr double ALPHA_2_LSB = TWO_N24;
-const std::vector<std::pair<int32_t, int32_t>> ALPHA_3({{99, 8}});
+constexpr Gnss_Frame_Field<1> ALPHA_3{{{99, 8}}};
 constexpr double ALPHA_3_LSB = TWO_N24;
-const std::vector<std::pair<int32_t, int32_t>> BETA_0({{107, 8}});
+constexpr Gnss_Frame_Field<1> BETA_0{{{107, 8}}};
 constexpr double BETA_0_LSB = TWO_P11;
-const std::vector<std::pair<int32_t, int32_t>> BETA_1({{121, 8}});
+constexpr Gnss_Frame_Field<1> BETA_1{{{121, 8}}};
 constexpr double BETA_1_LSB = TWO_P14;
-const std::vector<std::pair<int32_t, int32_t>> BETA_2({{129, 8}});
+constexpr Gnss_Frame_Field<1> BETA_2{{{129, 8}}};
 constexpr double BETA_2_LSB = TWO_P16;
-const std::vector<std::pair<int32_t, int32_t>> BETA_3({{137, 8}});
+constexpr Gnss_Frame_Field<1> BETA_3{{{137, 8}}};
 constexpr double BETA_3_LSB = TWO_P16;
-const std::vector<std::pair<int32_t, int32_t>> A_1({{151, 24}});
+constexpr Gnss_Frame_Field<1> A_1{{{151, 24}}};
 constexpr double A_1_LSB = TWO_N50;
-const std::vector<std::pair<int32_t, int32_t>> A_0({{181, 24}, {211, 8}});
+constexpr Gnss_Frame_Field<2> A_0{{{181, 24}, {211, 8}}};
 constexpr double A_0_LSB = TWO_N30;
-const std::vector<std::pair<int32_t, int32_t>> T_OT({{219, 8}});
+constexpr Gnss_Frame_Field<1> T_OT{{{219, 8}}};
 constexpr double T_OT_LSB = TWO_P12;
-const std::vector<std::pair<int32_t, int32_t>> WN_T({{227, 8}});
+constexpr Gnss_Frame_Field<1> WN_T{{{227, 8}}};
 constexpr double WN_T_LSB = 1;
-const std::vector<std::pair<int32_t, int32_t>> DELTAT_LS({{241, 8}});
+constexpr Gnss_Frame_Field<1> DELTAT_LS{{{241, 8}}};
 constexpr double DELTAT_LS_LSB = 1;
-const std::vector<std::pair<int32_t, int32_t>> WN_LSF({{249, 8}});
+constexpr Gnss_Frame_Field<1> WN_LSF{{{249, 8}}};
 constexpr double WN_LSF_LSB = 1;
-const std::vector<std::pair<int32_t, int32_t>> DN({{257, 8}});
+constexpr Gnss_Frame_Field<1> DN{{{257, 8}}};
 constexpr double DN_LSB = 1;
-const std::vector<std::pair<int32_t, int32_t>> DELTAT_LSF({{271, 8}});
+constexpr Gnss_Frame_Field<1> DELTAT_LSF{{{271, 8}}};
 constexpr double DELTAT_LSF_LSB = 1;
 
 // Page 25 - Antispoofing, SV config and SV health (PRN 25 -32)
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV25({{229, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV26({{241, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV27({{247, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV28({{253, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV29({{259, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV30({{271, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV31({{277, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV32({{283, 6}});
+constexpr Gnss_Frame_Field<1> HEALTH_SV25{{{229, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV26{{{241, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV27{{{247, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV28{{{253, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV29{{{259, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV30{{{271, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV31{{{277, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV32{{{283, 6}}};
 
 
 // SUBFRAME 5
 //! \todo read all pages of subframe 5
 
 // page 25 - Health (PRN 1 - 24)
-const std::vector<std::pair<int32_t, int32_t>> T_OA({{69, 8}});
+constexpr Gnss_Frame_Field<1> T_OA{{{69, 8}}};
 constexpr int32_t T_OA_LSB = TWO_P12;
-const std::vector<std::pair<int32_t, int32_t>> WN_A({{77, 8}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV1({{91, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV2({{97, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV3({{103, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV4({{109, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV5({{121, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV6({{127, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV7({{133, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV8({{139, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV9({{151, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV10({{157, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV11({{163, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV12({{169, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV13({{181, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV14({{187, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV15({{193, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV16({{199, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV17({{211, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV18({{217, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV19({{223, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV20({{229, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV21({{241, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV22({{247, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV23({{253, 6}});
-const std::vector<std::pair<int32_t, int32_t>> HEALTH_SV24({{259, 6}});
+constexpr Gnss_Frame_Field<1> WN_A{{{77, 8}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV1{{{91, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV2{{{97, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV3{{{103, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV4{{{109, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV5{{{121, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV6{{{127, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV7{{{133, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV8{{{139, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV9{{{151, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV10{{{157, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV11{{{163, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV12{{{169, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV13{{{181, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV14{{{187, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV15{{{193, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV16{{{199, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV17{{{211, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV18{{{217, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV19{{{223, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV20{{{229, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV21{{{241, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV22{{{247, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV23{{{253, 6}}};
+constexpr Gnss_Frame_Field<1> HEALTH_SV24{{{259, 6}}};
 
 
 // Almanac
-const std::vector<std::pair<int32_t, int32_t>> ALM_ECC({{69, 16}});
+constexpr Gnss_Frame_Field<1> ALM_ECC{{{69, 16}}};
 constexpr double ALM_ECC_LSB = TWO_N21;
-const std::vector<std::pair<int32_t, int32_t>> ALM_TOA({{91, 8}});
+constexpr Gnss_Frame_Field<1> ALM_TOA{{{91, 8}}};
 constexpr int32_t ALM_TOA_LSB = static_cast<int32_t>(TWO_P12);
-const std::vector<std::pair<int32_t, int32_t>> ALM_DELTAI({{99, 16}});
+constexpr Gnss_Frame_Field<1> ALM_DELTAI{{{99, 16}}};
 constexpr double ALM_DELTAI_LSB = TWO_N19;
-const std::vector<std::pair<int32_t, int32_t>> ALM_OMEGADOT({{121, 16}});
+constexpr Gnss_Frame_Field<1> ALM_OMEGADOT{{{121, 16}}};
 constexpr double ALM_OMEGADOT_LSB = TWO_N38;
-const std::vector<std::pair<int32_t, int32_t>> ALM_SVHEALTH({{137, 8}});
-const std::vector<std::pair<int32_t, int32_t>> ALM_SQUAREA({{151, 24}});
+constexpr Gnss_Frame_Field<1> ALM_SVHEALTH{{{137, 8}}};
+constexpr Gnss_Frame_Field<1> ALM_SQUAREA{{{151, 24}}};
 constexpr double ALM_SQUAREA_LSB = TWO_N11;
-const std::vector<std::pair<int32_t, int32_t>> ALM_OMEGAZERO({{181, 24}});
+constexpr Gnss_Frame_Field<1> ALM_OMEGAZERO{{{181, 24}}};
 constexpr double ALM_OMEGAZERO_LSB = TWO_N23;
-const std::vector<std::pair<int32_t, int32_t>> ALM_OMEGA({{211, 24}});
+constexpr Gnss_Frame_Field<1> ALM_OMEGA{{{211, 24}}};
 constexpr double ALM_OMEGA_LSB = TWO_N23;
-const std::vector<std::pair<int32_t, int32_t>> ALM_MZERO({{241, 24}});
+constexpr Gnss_Frame_Field<1> ALM_MZERO{{{241, 24}}};
 constexpr double ALM_MZERO_LSB = TWO_N23;
 
-const std::vector<std::pair<int32_t, int32_t>> ALM_AF0({{271, 8}, {290, 3}});
+constexpr Gnss_Frame_Field<2> ALM_AF0{{{271, 8}, {290, 3}}};
 constexpr double ALM_AF0_LSB = TWO_N20;
-const std::vector<std::pair<int32_t, int32_t>> ALM_AF1({{279, 11}});
+constexpr Gnss_Frame_Field<1> ALM_AF1{{{279, 11}}};
 constexpr double ALM_AF1_LSB = TWO_N38;
 /** \} */
 /** \} */
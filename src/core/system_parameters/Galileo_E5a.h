@@ -8,7 +8,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -64,6 +64,7 @@ constexpr int32_t GALILEO_FNAV_PAGE_TYPE_BITS = 6;
 
 constexpr int32_t GALILEO_FNAV_DATA_FRAME_BITS = 214;
 constexpr int32_t GALILEO_FNAV_DATA_FRAME_BYTES = 27;
+constexpr int32_t GALILEO_FNAV_PAGE_BITS = 244;  //!< Decoded bits of a page, including CRC and tail bits
 
 constexpr char GALILEO_FNAV_PREAMBLE[13] = "101101110000";
 
@@ -14,7 +14,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -22,10 +22,7 @@
 
 #include "galileo_fnav_message.h"
 #include <boost/crc.hpp>  // for boost::crc_basic, boost::crc_optimal
-#include <boost/dynamic_bitset.hpp>
-#include <algorithm>  // for reverse
-#include <iostream>   // for string, operator<<
-#include <iterator>   // for back_insert_iterator
+#include <iostream>       // for string, operator<<
 
 #if USE_GLOG_AND_GFLAGS
 #include <glog/logging.h>
@@ -38,11 +35,16 @@ using CRC_Galileo_FNAV_type = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false
 
 void Galileo_Fnav_Message::split_page(const std::string& page_string)
 {
-    const std::string message_word = page_string.substr(0, 214);
-    const std::string CRC_data = page_string.substr(214, 24);
-    const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> Word_for_CRC_bits(message_word);
-    const std::bitset<24> checksum(CRC_data);
-    if (CRC_test(Word_for_CRC_bits, checksum.to_ulong()) == true)
+    split_page(Gnss_Packed_Frame<GALILEO_FNAV_PAGE_BITS>(page_string));
+}
+
+
+void Galileo_Fnav_Message::split_page(const Gnss_Packed_Frame<GALILEO_FNAV_PAGE_BITS>& page)
+{
+    Data_Frame_Bits message_word;
+    message_word.copy(page, 1, GALILEO_FNAV_DATA_FRAME_BITS, 1);
+    const auto CRC_data = static_cast<uint32_t>(page.read_unsigned(GALILEO_FNAV_DATA_FRAME_BITS + 1, 24));
+    if (CRC_test(message_word, CRC_data) == true)
         {
             flag_CRC_test = true;
             // CRC correct: Decode word
@@ -55,21 +57,14 @@ void Galileo_Fnav_Message::split_page(const std::string& page_string)
 }
 
 
-bool Galileo_Fnav_Message::CRC_test(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, uint32_t checksum) const
+bool Galileo_Fnav_Message::CRC_test(const Data_Frame_Bits& bits, uint32_t checksum) const
 {
     CRC_Galileo_FNAV_type CRC_Galileo;
 
     // Galileo FNAV frame for CRC is not an integer multiple of bytes
     // it needs to be filled with zeroes at the start of the frame.
-    // This operation is done in the transformation from bits to bytes
-    // using boost::dynamic_bitset.
-    // ToDo: Use boost::dynamic_bitset for all the bitset operations in this class
-
-    boost::dynamic_bitset<uint8_t> frame_bits(bits.to_string());
-
-    std::vector<uint8_t> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
+    // This is done by the transformation from bits to bytes.
+    const auto bytes = bits.to_bytes();
 
     CRC_Galileo.process_bytes(bytes.data(), GALILEO_FNAV_DATA_FRAME_BYTES);
 
@@ -83,9 +78,8 @@ bool Galileo_Fnav_Message::CRC_test(const std::bitset<GALILEO_FNAV_DATA_FRAME_BI
 }
 
 
-void Galileo_Fnav_Message::decode_page(const std::string& data)
+void Galileo_Fnav_Message::decode_page(const Data_Frame_Bits& data_bits)
 {
-    const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> data_bits(data);
     page_type = read_navigation_unsigned(data_bits, FNAV_PAGE_TYPE_BIT);
     switch (page_type)
         {
@@ -232,7 +226,7 @@ void Galileo_Fnav_Message::decode_page(const std::string& data)
             FNAV_deltai_2_5 *= FNAV_DELTAI_5_LSB;
             // TODO check this
             // Omega0_2 must be decoded when the two pieces are joined
-            omega0_1 = data.substr(210, 4);
+            omega0_1 = static_cast<uint32_t>(data_bits.read_unsigned(211, 4));
             // omega_flag=true;
             //
             // FNAV_Omega012_2_5=static_cast<double>(read_navigation_signed(data_bits, FNAV_Omega012_2_5_bit);
@@ -242,10 +236,10 @@ void Galileo_Fnav_Message::decode_page(const std::string& data)
             FNAV_IODa_6 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_IO_DA_6_BIT));
             // Don't worry about omega pieces. If page 5 has not been received, all_ephemeris
             // flag will be set to false and the data won't be recorded.*/
-            const std::string omega0_2 = data.substr(10, 12);
-            const std::string Omega0 = omega0_1 + omega0_2;
-            const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> omega_bits(Omega0);
-            const std::vector<std::pair<int32_t, int32_t>> om_bit({{0, 12}});
+            Data_Frame_Bits omega_bits;
+            omega_bits.write_unsigned(1, 4, omega0_1);
+            omega_bits.copy(data_bits, 11, 12, 5);
+            const Gnss_Frame_Field<1> om_bit{{{1, 16}}};
             FNAV_Omega0_2_6 = static_cast<double>(read_navigation_signed(omega_bits, om_bit));
             FNAV_Omega0_2_6 *= FNAV_OMEGA0_5_LSB;
             FNAV_Omegadot_2_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_OMEGADOT_2_6_BIT));
@@ -284,35 +278,6 @@ void Galileo_Fnav_Message::decode_page(const std::string& data)
 }
 
 
-uint64_t Galileo_Fnav_Message::read_navigation_unsigned(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    uint64_t value = 0ULL;
-    for (const auto& p : parameter)
-        {
-            for (int j = 0; j < p.second; j++)
-                {
-                    value <<= 1U;  // shift left
-                    value |= static_cast<uint64_t>(bits[GALILEO_FNAV_DATA_FRAME_BITS - p.first - j]);
-                }
-        }
-    return value;
-}
-
-
-int64_t Galileo_Fnav_Message::read_navigation_signed(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    int64_t value = (bits[GALILEO_FNAV_DATA_FRAME_BITS - parameter[0].first] == 1) ? -1LL : 0LL;
-    for (const auto& p : parameter)
-        {
-            for (int32_t j = 0; j < p.second; j++)
-                {
-                    value = (value << 1) | static_cast<int64_t>(bits[GALILEO_FNAV_DATA_FRAME_BITS - p.first - j]);
-                }
-        }
-    return value;
-}
-
-
 bool Galileo_Fnav_Message::have_new_ephemeris()  // Check if we have a new ephemeris stored in the galileo navigation class
 {
     if ((flag_ephemeris_1 == true) and (flag_ephemeris_2 == true) and (flag_ephemeris_3 == true) and (flag_iono_and_GST == true))
@@ -14,7 +14,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -30,11 +30,9 @@
 #include "galileo_ephemeris.h"
 #include "galileo_iono.h"
 #include "galileo_utc_model.h"
-#include <bitset>
+#include "gnss_packed_frame.h"
 #include <cstdint>
 #include <string>
-#include <utility>
-#include <vector>
 
 /** \addtogroup Core
  * \{ */
@@ -52,6 +50,14 @@ class Galileo_Fnav_Message
 public:
     Galileo_Fnav_Message() = default;
 
+    /*
+     * \brief Checks the CRC of a page and, if it is correct, decodes its data
+     */
+    void split_page(const Gnss_Packed_Frame<GALILEO_FNAV_PAGE_BITS>& page);
+
+    /*
+     * \brief Same as above, with the page given as a string of '0' and '1' characters
+     */
     void split_page(const std::string& page_string);
     bool have_new_ephemeris();
     bool have_new_iono_and_GST();
@@ -138,13 +144,24 @@ public:
     }
 
 private:
-    bool CRC_test(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, uint32_t checksum) const;
-    void decode_page(const std::string& data);
-    uint64_t read_navigation_unsigned(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    int64_t read_navigation_signed(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
+    using Data_Frame_Bits = Gnss_Packed_Frame<GALILEO_FNAV_DATA_FRAME_BITS>;
+
+    bool CRC_test(const Data_Frame_Bits& bits, uint32_t checksum) const;
+    void decode_page(const Data_Frame_Bits& data_bits);
+
+    template <typename Field>
+    inline uint64_t read_navigation_unsigned(const Data_Frame_Bits& bits, const Field& parameter) const
+    {
+        return bits.read_unsigned(parameter);
+    }
+
+    template <typename Field>
+    inline int64_t read_navigation_signed(const Data_Frame_Bits& bits, const Field& parameter) const
+    {
+        return bits.read_signed(parameter);
+    }
 
-    std::string omega0_1{};
-    // std::string omega0_2{};
+    uint32_t omega0_1{};  // First 4 bits of the Omega0 of SVID2, sent in word type 5
     // bool omega_flag{};
 
     int32_t IOD_ephemeris{};
@@ -10,7 +10,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -19,12 +19,11 @@
 #include "galileo_inav_message.h"
 #include "galileo_reduced_ced.h"
 #include "reed_solomon.h"
-#include <boost/crc.hpp>             // for boost::crc_basic, boost::crc_optimal
-#include <boost/dynamic_bitset.hpp>  // for boost::dynamic_bitset
-#include <algorithm>                 // for reverse
-#include <iostream>                  // for operator<<
-#include <limits>                    // for std::numeric_limits
-#include <numeric>                   // for std::accumulate
+#include <boost/crc.hpp>  // for boost::crc_basic, boost::crc_optimal
+#include <algorithm>      // for std::all_of
+#include <iostream>       // for operator<<
+#include <limits>         // for std::numeric_limits
+#include <numeric>        // for std::accumulate
 
 #if USE_GLOG_AND_GFLAGS
 #include <glog/logging.h>
@@ -48,21 +47,14 @@ Galileo_Inav_Message::Galileo_Inav_Message()
 Galileo_Inav_Message::~Galileo_Inav_Message() = default;
 
 
-bool Galileo_Inav_Message::CRC_test(const std::bitset<GALILEO_DATA_FRAME_BITS>& bits, uint32_t checksum) const
+bool Galileo_Inav_Message::CRC_test(const Gnss_Packed_Frame<GALILEO_DATA_FRAME_BITS>& bits, uint32_t checksum) const
 {
     CRC_Galileo_INAV_type CRC_Galileo;
 
     // Galileo INAV frame for CRC is not an integer multiple of bytes
     // it needs to be filled with zeroes at the start of the frame.
-    // This operation is done in the transformation from bits to bytes
-    // using boost::dynamic_bitset.
-    // ToDo: Use boost::dynamic_bitset for all the bitset operations in this class
-
-    boost::dynamic_bitset<unsigned char> frame_bits(bits.to_string());
-
-    std::vector<unsigned char> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
+    // This is done by the transformation from bits to bytes.
+    const auto bytes = bits.to_bytes();
 
     CRC_Galileo.process_bytes(bytes.data(), GALILEO_DATA_FRAME_BYTES);
 
@@ -75,92 +67,24 @@ bool Galileo_Inav_Message::CRC_test(const std::bitset<GALILEO_DATA_FRAME_BITS>&
 }
 
 
-uint64_t Galileo_Inav_Message::read_navigation_unsigned(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
+void Galileo_Inav_Message::split_page(const std::string& page_string, int32_t flag_even_word)
 {
-    uint64_t value = 0ULL;
-    for (const auto& p : parameter)
-        {
-            for (int j = 0; j < p.second; j++)
-                {
-                    value <<= 1U;  // shift left
-                    value |= static_cast<uint64_t>(bits[GALILEO_DATA_JK_BITS - p.first - j]);
-                }
-        }
-    return value;
+    split_page(Gnss_Packed_Frame<GALILEO_INAV_PAGE_PART_BITS>(page_string), flag_even_word);
 }
 
 
-uint8_t Galileo_Inav_Message::read_octet_unsigned(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
+void Galileo_Inav_Message::split_page(const Gnss_Packed_Frame<GALILEO_INAV_PAGE_PART_BITS>& page_part, int32_t flag_even_word)
 {
-    uint8_t value = 0;
-    for (const auto& p : parameter)
+    if (page_part.test(1))  // if page is odd
         {
-            for (int j = 0; j < p.second; j++)
-                {
-                    value <<= 1;  // shift left
-                    value |= static_cast<uint8_t>(bits[GALILEO_DATA_JK_BITS - p.first - j]);
-                }
-        }
-    return value;
-}
-
-
-uint64_t Galileo_Inav_Message::read_page_type_unsigned(const std::bitset<GALILEO_PAGE_TYPE_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    uint64_t value = 0ULL;
-    for (const auto& p : parameter)
-        {
-            for (int j = 0; j < p.second; j++)
-                {
-                    value <<= 1;  // shift left
-                    value |= static_cast<uint64_t>(bits[GALILEO_PAGE_TYPE_BITS - p.first - j]);
-                }
-        }
-    return value;
-}
-
-
-int64_t Galileo_Inav_Message::read_navigation_signed(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    int64_t value = (bits[GALILEO_DATA_JK_BITS - parameter[0].first] == 1) ? -1LL : 0LL;
-    for (const auto& p : parameter)
-        {
-            for (int32_t j = 0; j < p.second; j++)
-                {
-                    value = (value << 1) | static_cast<int64_t>(bits[GALILEO_DATA_JK_BITS - p.first - j]);
-                }
-        }
-    return value;
-}
-
-
-bool Galileo_Inav_Message::read_navigation_bool(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    bool value = bits[GALILEO_DATA_JK_BITS - parameter[0].first];
-    return value;
-}
-
-
-void Galileo_Inav_Message::split_page(std::string page_string, int32_t flag_even_word)
-{
-    if (page_string.at(0) == '1')  // if page is odd
-        {
-            const std::string& page_Odd = page_string;
+            const auto& page_Odd = page_part;
 
             if (flag_even_word == 1)  // An odd page has been received but the previous even page is kept in memory and it is considered to join pages
                 {
-                    const std::string page_INAV_even = page_Even;
-                    const std::string page_INAV = page_INAV_even + page_Odd;  // Join pages: Even + Odd = INAV page
-
-                    const std::string Data_k = page_INAV.substr(2, 112);
-                    const std::string Data_j = page_INAV.substr(116, 16);
-
-                    const std::string osnma_sis = page_INAV.substr(132, 40);
-                    // const std::string SAR = page_INAV.substr(172, 22);
-                    // const std::string Spare = page_INAV.substr(194, 2);
-                    const std::string CRC_data = page_INAV.substr(196, 24);
-                    // const std::string Reserved_2 = page_INAV.substr(220, 8);
-                    // const std::string Tail_odd = page_INAV.substr(228, 6);
+                    // Join pages: Even + Odd = INAV page. Positions in the odd page part:
+                    // Data_j: 3-18, OSNMA: 19-58, SAR: 59-80, Spare: 81-82, CRC: 83-106,
+                    // Reserved_2: 107-114, Tail: 115-120
+                    const auto CRC_data = static_cast<uint32_t>(page_Odd.read_unsigned(83, 24));
 
                     if (page_position_in_inav_subframe != 255)
                         {
@@ -168,18 +92,18 @@ void Galileo_Inav_Message::split_page(std::string page_string, int32_t flag_even
                         }
 
                     // ************ CRC checksum control *******/
-                    std::stringstream TLM_word_for_CRC_stream;
-                    TLM_word_for_CRC_stream << page_INAV;
-                    const std::string TLM_word_for_CRC = TLM_word_for_CRC_stream.str().substr(0, GALILEO_DATA_FRAME_BITS);
-                    const std::bitset<GALILEO_DATA_FRAME_BITS> TLM_word_for_CRC_bits(TLM_word_for_CRC);
-                    const std::bitset<24> checksum(CRC_data);
+                    Gnss_Packed_Frame<GALILEO_DATA_FRAME_BITS> TLM_word_for_CRC_bits;
+                    TLM_word_for_CRC_bits.copy(page_Even, 1, 114, 1);
+                    TLM_word_for_CRC_bits.copy(page_Odd, 1, GALILEO_DATA_FRAME_BITS - 114, 115);
 
-                    if (CRC_test(TLM_word_for_CRC_bits, checksum.to_ulong()) == true)
+                    if (CRC_test(TLM_word_for_CRC_bits, CRC_data) == true)
                         {
                             flag_CRC_test = true;
-                            // CRC correct: Decode word
-                            const std::string Data_jk_ephemeris = Data_k + Data_j;
-                            page_jk_decoder(Data_jk_ephemeris.c_str());
+                            // CRC correct: Decode word (Data_k + Data_j)
+                            Data_Jk_Bits Data_jk_ephemeris;
+                            Data_jk_ephemeris.copy(page_Even, 3, 112, 1);
+                            Data_jk_ephemeris.copy(page_Odd, 3, 16, 113);
+                            page_jk_decoder(Data_jk_ephemeris);
 
                             // Fill OSNMA data
                             if (page_position_in_inav_subframe != 255)
@@ -190,12 +114,12 @@ void Galileo_Inav_Message::split_page(std::string page_string, int32_t flag_even
                                             nma_msg.mack = std::array<uint32_t, 15>{};
                                             nma_msg.hkroot = std::array<uint8_t, 15>{};
                                         }
-                                    std::bitset<8> hkroot_bs(osnma_sis.substr(0, 8));
-                                    std::bitset<32> mack_bs(osnma_sis.substr(8, 32));
-                                    if (hkroot_bs.count() != 0 && mack_bs.count() != 0)
+                                    const auto hkroot = static_cast<uint8_t>(page_Odd.read_unsigned(19, 8));
+                                    const auto mack = static_cast<uint32_t>(page_Odd.read_unsigned(27, 32));
+                                    if (hkroot != 0 && mack != 0)
                                         {
-                                            hkroot_sis = static_cast<uint8_t>(hkroot_bs.to_ulong());
-                                            mack_sis = static_cast<uint32_t>(mack_bs.to_ulong());
+                                            hkroot_sis = hkroot;
+                                            mack_sis = mack;
                                             nma_msg.mack[page_position_in_inav_subframe] = mack_sis;
                                             nma_msg.hkroot[page_position_in_inav_subframe] = hkroot_sis;
                                             nma_position_filled[page_position_in_inav_subframe] = 1;
@@ -208,10 +132,10 @@ void Galileo_Inav_Message::split_page(std::string page_string, int32_t flag_even
                             flag_CRC_test = false;
                         }
                 }  // end of CRC checksum control
-        }  // end if (page_string.at(0)=='1')
+        }  // end if page is odd
     else
         {
-            page_Even = page_string.substr(0, 114);
+            page_Even = page_part;
         }
 }
 
@@ -314,22 +238,22 @@ bool Galileo_Inav_Message::have_new_ephemeris()  // Check if we have a new ephem
                         {
                             if (inav_rs_pages[0] == 0)
                                 {
-                                    std::bitset<GALILEO_DATA_JK_BITS> missing_bits = regenerate_page_1(rs_buffer);
+                                    const Data_Jk_Bits missing_bits(regenerate_page_1(rs_buffer));
                                     read_page_1(missing_bits);
                                 }
                             if (inav_rs_pages[1] == 0)
                                 {
-                                    std::bitset<GALILEO_DATA_JK_BITS> missing_bits = regenerate_page_2(rs_buffer);
+                                    const Data_Jk_Bits missing_bits(regenerate_page_2(rs_buffer));
                                     read_page_2(missing_bits);
                                 }
                             if (inav_rs_pages[2] == 0)
                                 {
-                                    std::bitset<GALILEO_DATA_JK_BITS> missing_bits = regenerate_page_3(rs_buffer);
+                                    const Data_Jk_Bits missing_bits(regenerate_page_3(rs_buffer));
                                     read_page_3(missing_bits);
                                 }
                             if (inav_rs_pages[3] == 0)
                                 {
-                                    std::bitset<GALILEO_DATA_JK_BITS> missing_bits = regenerate_page_4(rs_buffer);
+                                    const Data_Jk_Bits missing_bits(regenerate_page_4(rs_buffer));
                                     read_page_4(missing_bits);
                                 }
 
@@ -611,7 +535,7 @@ Galileo_Ephemeris Galileo_Inav_Message::get_reduced_ced() const
 }
 
 
-void Galileo_Inav_Message::read_page_1(const std::bitset<GALILEO_DATA_JK_BITS>& data_bits)
+void Galileo_Inav_Message::read_page_1(const Data_Jk_Bits& data_bits)
 {
     IOD_nav_1 = static_cast<int32_t>(read_navigation_unsigned(data_bits, IOD_NAV_1_BIT));
     DLOG(INFO) << "IOD_nav_1= " << IOD_nav_1;
@@ -633,7 +557,7 @@ void Galileo_Inav_Message::read_page_1(const std::bitset<GALILEO_DATA_JK_BITS>&
 }
 
 
-void Galileo_Inav_Message::read_page_2(const std::bitset<GALILEO_DATA_JK_BITS>& data_bits)
+void Galileo_Inav_Message::read_page_2(const Data_Jk_Bits& data_bits)
 {
     IOD_nav_2 = static_cast<int32_t>(read_navigation_unsigned(data_bits, IOD_NAV_2_BIT));
     DLOG(INFO) << "IOD_nav_2= " << IOD_nav_2;
@@ -655,7 +579,7 @@ void Galileo_Inav_Message::read_page_2(const std::bitset<GALILEO_DATA_JK_BITS>&
 }
 
 
-void Galileo_Inav_Message::read_page_3(const std::bitset<GALILEO_DATA_JK_BITS>& data_bits)
+void Galileo_Inav_Message::read_page_3(const Data_Jk_Bits& data_bits)
 {
     IOD_nav_3 = static_cast<int32_t>(read_navigation_unsigned(data_bits, IOD_NAV_3_BIT));
     DLOG(INFO) << "IOD_nav_3= " << IOD_nav_3;
@@ -685,7 +609,7 @@ void Galileo_Inav_Message::read_page_3(const std::bitset<GALILEO_DATA_JK_BITS>&
 }
 
 
-void Galileo_Inav_Message::read_page_4(const std::bitset<GALILEO_DATA_JK_BITS>& data_bits)
+void Galileo_Inav_Message::read_page_4(const Data_Jk_Bits& data_bits)
 {
     IOD_nav_4 = static_cast<int32_t>(read_navigation_unsigned(data_bits, IOD_NAV_4_BIT));
     DLOG(INFO) << "IOD_nav_4= " << IOD_nav_4;
@@ -838,11 +762,8 @@ std::bitset<GALILEO_DATA_JK_BITS> Galileo_Inav_Message::regenerate_page_4(const
 }
 
 
-int32_t Galileo_Inav_Message::page_jk_decoder(const char* data_jk)
+int32_t Galileo_Inav_Message::page_jk_decoder(const Data_Jk_Bits& data_jk_bits)
 {
-    const std::string data_jk_string = data_jk;
-    const std::bitset<GALILEO_DATA_JK_BITS> data_jk_bits(data_jk_string);
-
     const auto page_number = static_cast<int32_t>(read_navigation_unsigned(data_jk_bits, PAGE_TYPE_BIT));
     DLOG(INFO) << "Page number = " << page_number;
 
@@ -868,14 +789,14 @@ int32_t Galileo_Inav_Message::page_jk_decoder(const char* data_jk)
                             }
 
                         // Store RS information vector C_{RS,0}
-                        std::vector<std::pair<int32_t, int32_t>> info_octet_bits({{1, 6}, {15, 2}});
-                        rs_buffer[0] = read_octet_unsigned(data_jk_bits, info_octet_bits);
-                        info_octet_bits = std::vector<std::pair<int32_t, int32_t>>({{7, BITS_IN_OCTET}});
-                        rs_buffer[1] = read_octet_unsigned(data_jk_bits, info_octet_bits);
+                        const Gnss_Frame_Field<2> first_octet_bits{{{1, 6}, {15, 2}}};
+                        rs_buffer[0] = read_octet_unsigned(data_jk_bits, first_octet_bits);
+                        const Gnss_Frame_Field<1> second_octet_bits{{{7, BITS_IN_OCTET}}};
+                        rs_buffer[1] = read_octet_unsigned(data_jk_bits, second_octet_bits);
                         int32_t start_bit = FIRST_RS_BIT_AFTER_IODNAV;
                         for (size_t i = 2; i < 16; i++)
                             {
-                                info_octet_bits = std::vector<std::pair<int32_t, int32_t>>({{start_bit, BITS_IN_OCTET}});
+                                const Gnss_Frame_Field<1> info_octet_bits{{{start_bit, BITS_IN_OCTET}}};
                                 rs_buffer[i] = read_octet_unsigned(data_jk_bits, info_octet_bits);
                                 start_bit += BITS_IN_OCTET;
                             }
@@ -916,7 +837,7 @@ int32_t Galileo_Inav_Message::page_jk_decoder(const char* data_jk)
                         int32_t start_bit = FIRST_RS_BIT_AFTER_IODNAV;
                         for (size_t i = 16; i < 30; i++)
                             {
-                                std::vector<std::pair<int32_t, int32_t>> info_octet_bits({{start_bit, BITS_IN_OCTET}});
+                                const Gnss_Frame_Field<1> info_octet_bits{{{start_bit, BITS_IN_OCTET}}};
                                 rs_buffer[i] = read_octet_unsigned(data_jk_bits, info_octet_bits);
                                 start_bit += BITS_IN_OCTET;
                             }
@@ -948,7 +869,7 @@ int32_t Galileo_Inav_Message::page_jk_decoder(const char* data_jk)
                         int32_t start_bit = FIRST_RS_BIT_AFTER_IODNAV;
                         for (size_t i = 30; i < 44; i++)
                             {
-                                std::vector<std::pair<int32_t, int32_t>> info_octet_bits({{start_bit, BITS_IN_OCTET}});
+                                const Gnss_Frame_Field<1> info_octet_bits{{{start_bit, BITS_IN_OCTET}}};
                                 rs_buffer[i] = read_octet_unsigned(data_jk_bits, info_octet_bits);
                                 start_bit += BITS_IN_OCTET;
                             }
@@ -981,7 +902,7 @@ int32_t Galileo_Inav_Message::page_jk_decoder(const char* data_jk)
                         int32_t start_bit = FIRST_RS_BIT_AFTER_IODNAV;
                         for (size_t i = 44; i < INAV_RS_INFO_VECTOR_LENGTH; i++)
                             {
-                                std::vector<std::pair<int32_t, int32_t>> info_octet_bits({{start_bit, BITS_IN_OCTET}});
+                                const Gnss_Frame_Field<1> info_octet_bits{{{start_bit, BITS_IN_OCTET}}};
                                 rs_buffer[i] = read_octet_unsigned(data_jk_bits, info_octet_bits);
                                 start_bit += BITS_IN_OCTET;
                             }
@@ -1274,7 +1195,7 @@ int32_t Galileo_Inav_Message::page_jk_decoder(const char* data_jk)
                                 inav_rs_pages[3] = 0;
                             }
                         // Store RS parity vector gamma_{RS,0}
-                        std::vector<std::pair<int32_t, int32_t>> gamma_octet_bits({{FIRST_RS_BIT, BITS_IN_OCTET}});
+                        Gnss_Frame_Field<1> gamma_octet_bits{{{FIRST_RS_BIT, BITS_IN_OCTET}}};
                         rs_buffer[INAV_RS_INFO_VECTOR_LENGTH] = read_octet_unsigned(data_jk_bits, gamma_octet_bits);
                         int32_t start_bit = FIRST_RS_BIT_AFTER_IODNAV;
                         for (size_t i = 1; i < INAV_RS_SUBVECTOR_LENGTH; i++)
@@ -1304,7 +1225,7 @@ int32_t Galileo_Inav_Message::page_jk_decoder(const char* data_jk)
                                 inav_rs_pages[3] = 0;
                             }
                         // Store RS parity vector gamma_{RS,1}
-                        std::vector<std::pair<int32_t, int32_t>> gamma_octet_bits({{FIRST_RS_BIT, BITS_IN_OCTET}});
+                        Gnss_Frame_Field<1> gamma_octet_bits{{{FIRST_RS_BIT, BITS_IN_OCTET}}};
                         rs_buffer[INAV_RS_INFO_VECTOR_LENGTH + INAV_RS_SUBVECTOR_LENGTH] = read_octet_unsigned(data_jk_bits, gamma_octet_bits);
                         int32_t start_bit = FIRST_RS_BIT_AFTER_IODNAV;
                         for (size_t i = INAV_RS_SUBVECTOR_LENGTH + 1; i < 2 * INAV_RS_SUBVECTOR_LENGTH; i++)
@@ -1334,7 +1255,7 @@ int32_t Galileo_Inav_Message::page_jk_decoder(const char* data_jk)
                                 inav_rs_pages[3] = 0;
                             }
                         // Store RS parity vector gamma_{RS,2}
-                        std::vector<std::pair<int32_t, int32_t>> gamma_octet_bits({{FIRST_RS_BIT, BITS_IN_OCTET}});
+                        Gnss_Frame_Field<1> gamma_octet_bits{{{FIRST_RS_BIT, BITS_IN_OCTET}}};
                         rs_buffer[INAV_RS_INFO_VECTOR_LENGTH + 2 * INAV_RS_SUBVECTOR_LENGTH] = read_octet_unsigned(data_jk_bits, gamma_octet_bits);
                         int32_t start_bit = FIRST_RS_BIT_AFTER_IODNAV;
                         for (size_t i = 2 * INAV_RS_SUBVECTOR_LENGTH + 1; i < 3 * INAV_RS_SUBVECTOR_LENGTH; i++)
@@ -1364,7 +1285,7 @@ int32_t Galileo_Inav_Message::page_jk_decoder(const char* data_jk)
                                 inav_rs_pages[3] = 0;
                             }
                         // Store RS parity vector gamma_{RS,4}
-                        std::vector<std::pair<int32_t, int32_t>> gamma_octet_bits({{FIRST_RS_BIT, BITS_IN_OCTET}});
+                        Gnss_Frame_Field<1> gamma_octet_bits{{{FIRST_RS_BIT, BITS_IN_OCTET}}};
                         rs_buffer[INAV_RS_INFO_VECTOR_LENGTH + 3 * INAV_RS_SUBVECTOR_LENGTH] = read_octet_unsigned(data_jk_bits, gamma_octet_bits);
                         int32_t start_bit = FIRST_RS_BIT_AFTER_IODNAV;
                         for (size_t i = 3 * INAV_RS_SUBVECTOR_LENGTH + 1; i < 4 * INAV_RS_SUBVECTOR_LENGTH; i++)
@@ -1382,7 +1303,7 @@ int32_t Galileo_Inav_Message::page_jk_decoder(const char* data_jk)
             DLOG(INFO) << "Word type 22 arrived";
             ism_constellation_id = read_octet_unsigned(data_jk_bits, ISM_CONSTELLATION_ID_BIT);
             ism_service_level_id = read_octet_unsigned(data_jk_bits, ISM_SERVICE_LEVEL_ID_BIT);
-            if (gal_ism.check_ism_crc(data_jk_bits))
+            if (gal_ism.check_ism_crc(data_jk_bits.to_bitset()))
                 {
                     DLOG(INFO) << "I/NAV ARAIM Integrity Support Message CRC OK";
                     gal_ism.set_ism_constellation_id(ism_constellation_id);
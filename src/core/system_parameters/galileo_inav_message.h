@@ -10,7 +10,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -25,13 +25,13 @@
 #include "galileo_iono.h"
 #include "galileo_ism.h"
 #include "galileo_utc_model.h"
+#include "gnss_packed_frame.h"
 #include "gnss_sdr_make_unique.h"  // for std::unique_ptr in C++11
 #include <array>
 #include <bitset>
 #include <cstdint>
 #include <memory>
 #include <string>
-#include <utility>
 #include <vector>
 
 class ReedSolomon;  // Forward declaration of the ReedSolomon class
@@ -69,7 +69,12 @@ public:
     /*
      * \brief Takes in input a page (Odd or Even) of 120 bit, split it according ICD 4.3.2.3 and join Data_k with Data_j
      */
-    void split_page(std::string page_string, int32_t flag_even_word);
+    void split_page(const Gnss_Packed_Frame<GALILEO_INAV_PAGE_PART_BITS>& page_part, int32_t flag_even_word);
+
+    /*
+     * \brief Same as above, with the page given as a string of '0' and '1' characters
+     */
+    void split_page(const std::string& page_string, int32_t flag_even_word);
 
     /*
      * \brief Returns true if new Ephemeris has arrived. The flag is set to false when the function is executed
@@ -273,29 +278,51 @@ public:
     }
 
 private:
-    bool CRC_test(const std::bitset<GALILEO_DATA_FRAME_BITS>& bits, uint32_t checksum) const;
-    bool read_navigation_bool(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    uint64_t read_navigation_unsigned(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    uint64_t read_page_type_unsigned(const std::bitset<GALILEO_PAGE_TYPE_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    int64_t read_navigation_signed(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    uint8_t read_octet_unsigned(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    void read_page_1(const std::bitset<GALILEO_DATA_JK_BITS>& data_bits);
-    void read_page_2(const std::bitset<GALILEO_DATA_JK_BITS>& data_bits);
-    void read_page_3(const std::bitset<GALILEO_DATA_JK_BITS>& data_bits);
-    void read_page_4(const std::bitset<GALILEO_DATA_JK_BITS>& data_bits);
+    using Data_Jk_Bits = Gnss_Packed_Frame<GALILEO_DATA_JK_BITS>;
+
+    bool CRC_test(const Gnss_Packed_Frame<GALILEO_DATA_FRAME_BITS>& bits, uint32_t checksum) const;
+
+    template <typename Field>
+    inline bool read_navigation_bool(const Data_Jk_Bits& bits, const Field& parameter) const
+    {
+        return bits.read_bool(parameter);
+    }
+
+    template <typename Field>
+    inline uint64_t read_navigation_unsigned(const Data_Jk_Bits& bits, const Field& parameter) const
+    {
+        return bits.read_unsigned(parameter);
+    }
+
+    template <typename Field>
+    inline int64_t read_navigation_signed(const Data_Jk_Bits& bits, const Field& parameter) const
+    {
+        return bits.read_signed(parameter);
+    }
+
+    template <typename Field>
+    inline uint8_t read_octet_unsigned(const Data_Jk_Bits& bits, const Field& parameter) const
+    {
+        return static_cast<uint8_t>(bits.read_unsigned(parameter));
+    }
+
+    void read_page_1(const Data_Jk_Bits& data_bits);
+    void read_page_2(const Data_Jk_Bits& data_bits);
+    void read_page_3(const Data_Jk_Bits& data_bits);
+    void read_page_4(const Data_Jk_Bits& data_bits);
     std::bitset<GALILEO_DATA_JK_BITS> regenerate_page_1(const std::vector<uint8_t>& decoded) const;
     std::bitset<GALILEO_DATA_JK_BITS> regenerate_page_2(const std::vector<uint8_t>& decoded) const;
     std::bitset<GALILEO_DATA_JK_BITS> regenerate_page_3(const std::vector<uint8_t>& decoded) const;
     std::bitset<GALILEO_DATA_JK_BITS> regenerate_page_4(const std::vector<uint8_t>& decoded) const;
 
     Galileo_ISM gal_ism{};
-    std::string page_Even{};
+    Gnss_Packed_Frame<GALILEO_INAV_PAGE_PART_BITS> page_Even{};
 
     std::vector<uint8_t> rs_buffer;   // Reed-Solomon buffer
     std::unique_ptr<ReedSolomon> rs;  // The Reed-Solomon decoder
     std::vector<int> inav_rs_pages;   // Pages 1,2,3,4,17,18,19,20. Holds 1 if the page has arrived, 0 otherwise.
 
-    int32_t page_jk_decoder(const char* data_jk);
+    int32_t page_jk_decoder(const Data_Jk_Bits& data_jk_bits);
     int32_t IOD_ephemeris{};
 
     // Word type 1: Ephemeris (1/4)
@@ -0,0 +1,250 @@
+/*!
+ * \file gnss_packed_frame.h
+ * \brief Navigation message frame packed in 64-bit words, and descriptors of
+ * its data fields
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_PACKED_FRAME_H
+#define GNSS_SDR_GNSS_PACKED_FRAME_H
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup System_Parameters
+ * \{ */
+
+
+/*!
+ * \brief Descriptor of a data field of a navigation message: K pairs of
+ * {position of the first bit, number of bits}, with positions counted from 1
+ * at the start of the frame. The bits of all the pairs are concatenated, in
+ * order, to form the value of the field.
+ */
+template <size_t K>
+using Gnss_Frame_Field = std::array<std::pair<int32_t, int32_t>, K>;
+
+
+/*!
+ * \brief Frame of N bits of a navigation message, in transmission order and
+ * packed in 64-bit words, so that reading a data field takes a couple of
+ * shifts and masks instead of a loop over its bits.
+ *
+ * Bit positions are counted from 1 at the start of the frame, as in the
+ * field descriptors of the ICDs.
+ */
+template <size_t N>
+class Gnss_Packed_Frame
+{
+public:
+    constexpr Gnss_Packed_Frame() = default;
+
+    //! Frame from a string of '0' and '1' characters. Missing bits are zeros
+    explicit Gnss_Packed_Frame(const std::string& bits)
+    {
+        const size_t length = bits.size() < N ? bits.size() : N;
+        for (size_t i = 0; i < length; i++)
+            {
+                set_bit(static_cast<int32_t>(i + 1), bits[i] == '1');
+            }
+    }
+
+    //! Frame from a std::bitset, whose bit N - 1 is the first of the frame
+    explicit Gnss_Packed_Frame(const std::bitset<N>& bits)
+    {
+        for (size_t i = 0; i < N; i++)
+            {
+                set_bit(static_cast<int32_t>(i + 1), bits[N - 1 - i]);
+            }
+    }
+
+    //! Frame from decoded bits, one per element. Elements greater than zero are ones
+    explicit Gnss_Packed_Frame(const std::vector<int32_t>& bits)
+    {
+        const size_t length = bits.size() < N ? bits.size() : N;
+        for (size_t i = 0; i < length; i++)
+            {
+                set_bit(static_cast<int32_t>(i + 1), bits[i] > 0);
+            }
+    }
+
+    //! Bit at position (from 1 to N)
+    constexpr bool test(int32_t position) const
+    {
+        return ((d_words[(position - 1) / 64] >> (63 - (position - 1) % 64)) & 1U) != 0;
+    }
+
+    void set_bit(int32_t position, bool value)
+    {
+        const uint64_t mask = uint64_t(1) << (63 - (position - 1) % 64);
+        if (value)
+            {
+                d_words[(position - 1) / 64] |= mask;
+            }
+        else
+            {
+                d_words[(position - 1) / 64] &= ~mask;
+            }
+    }
+
+    //! Unsigned value of the length (from 1 to 64) bits starting at position first
+    constexpr uint64_t read_unsigned(int32_t first, int32_t length) const
+    {
+        const auto start = static_cast<uint32_t>(first - 1);
+        const uint32_t word = start / 64;
+        const uint32_t offset = start % 64;
+        uint64_t value = d_words[word] << offset;
+        if (offset + static_cast<uint32_t>(length) > 64 && word + 1 < d_words.size())
+            {
+                value |= d_words[word + 1] >> (64 - offset);
+            }
+        return value >> (64 - length);
+    }
+
+    //! Writes the length (from 1 to 64) least significant bits of value starting at position first
+    void write_unsigned(int32_t first, int32_t length, uint64_t value)
+    {
+        const auto start = static_cast<uint32_t>(first - 1);
+        const uint32_t word = start / 64;
+        const uint32_t offset = start % 64;
+        const uint64_t mask = length < 64 ? (uint64_t(1) << length) - 1 : ~uint64_t(0);
+        value &= mask;
+        if (offset + static_cast<uint32_t>(length) <= 64)
+            {
+                const uint32_t shift = 64 - offset - length;
+                d_words[word] = (d_words[word] & ~(mask << shift)) | (value << shift);
+            }
+        else
+            {
+                // The field continues in the next word
+                const uint32_t spill = offset + length - 64;
+                d_words[word] = (d_words[word] & ~(mask >> spill)) | (value >> spill);
+                if (word + 1 < d_words.size())
+                    {
+                        d_words[word + 1] = (d_words[word + 1] & ~(mask << (64 - spill))) | (value << (64 - spill));
+                    }
+            }
+    }
+
+    //! Unsigned value of a field, described by a Gnss_Frame_Field or a vector of pairs
+    template <typename Field>
+    constexpr uint64_t read_unsigned(const Field& field) const
+    {
+        uint64_t value = 0;
+        for (size_t i = 0; i < field.size(); i++)
+            {
+                const int32_t length = field[i].second;
+                const uint64_t bits = read_unsigned(field[i].first, length);
+                value = length < 64 ? ((value << length) | bits) : bits;
+            }
+        return value;
+    }
+
+    //! Two's complement value of a field
+    template <typename Field>
+    constexpr int64_t read_signed(const Field& field) const
+    {
+        int32_t length = 0;
+        for (size_t i = 0; i < field.size(); i++)
+            {
+                length += field[i].second;
+            }
+        const uint64_t value = read_unsigned(field);
+        if (length >= 64)
+            {
+                return static_cast<int64_t>(value);
+            }
+        const uint64_t sign = uint64_t(1) << (length - 1);
+        return static_cast<int64_t>(value ^ sign) - static_cast<int64_t>(sign);
+    }
+
+    //! First bit of a field
+    template <typename Field>
+    constexpr bool read_bool(const Field& field) const
+    {
+        return test(field[0].first);
+    }
+
+    //! Copies length bits of other, starting at its position other_first, to position first
+    template <size_t M>
+    void copy(const Gnss_Packed_Frame<M>& other, int32_t other_first, int32_t length, int32_t first)
+    {
+        while (length > 0)
+            {
+                const int32_t chunk = length < 64 ? length : 64;
+                write_unsigned(first, chunk, other.read_unsigned(other_first, chunk));
+                other_first += chunk;
+                first += chunk;
+                length -= chunk;
+            }
+    }
+
+    //! Frame in bytes, left-padded with zeros to a whole number of bytes
+    std::array<uint8_t, (N + 7) / 8> to_bytes() const
+    {
+        std::array<uint8_t, (N + 7) / 8> bytes{};
+        int32_t first = 1;
+        size_t i = 0;
+        if (N % 8 != 0)
+            {
+                bytes[i++] = static_cast<uint8_t>(read_unsigned(first, N % 8));
+                first += N % 8;
+            }
+        for (; i < bytes.size(); i++)
+            {
+                bytes[i] = static_cast<uint8_t>(read_unsigned(first, 8));
+                first += 8;
+            }
+        return bytes;
+    }
+
+    //! Frame as a string of '0' and '1' characters
+    std::string to_string() const
+    {
+        std::string bits(N, '0');
+        for (size_t i = 0; i < N; i++)
+            {
+                if (test(static_cast<int32_t>(i + 1)))
+                    {
+                        bits[i] = '1';
+                    }
+            }
+        return bits;
+    }
+
+    //! Frame as a std::bitset, with the first bit of the frame at its position N - 1
+    std::bitset<N> to_bitset() const
+    {
+        std::bitset<N> bits;
+        for (size_t i = 0; i < N; i++)
+            {
+                bits[N - 1 - i] = test(static_cast<int32_t>(i + 1));
+            }
+        return bits;
+    }
+
+private:
+    std::array<uint64_t, (N + 63) / 64> d_words{};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_PACKED_FRAME_H
@@ -11,7 +11,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -19,6 +19,7 @@
 
 #include "gps_navigation_message.h"
 #include "gnss_satellite.h"
+#include <bitset>    // for std::bitset
 #include <cmath>     // for fmod, abs, floor
 #include <cstring>   // for memcpy
 #include <iostream>  // for operator<<, cout
@@ -43,56 +44,16 @@ void Gps_Navigation_Message::print_gps_word_bytes(uint32_t GPS_word) const
 }
 
 
-bool Gps_Navigation_Message::read_navigation_bool(const std::bitset<GPS_SUBFRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    bool value = bits[GPS_SUBFRAME_BITS - parameter[0].first];
-    return value;
-}
-
-
-uint64_t Gps_Navigation_Message::read_navigation_unsigned(const std::bitset<GPS_SUBFRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    uint64_t value = 0ULL;
-    for (const auto& p : parameter)
-        {
-            for (int32_t j = 0; j < p.second; ++j)
-                {
-                    value = (value << 1) | (bits.test(GPS_SUBFRAME_BITS - p.first - j) ? 1 : 0);
-                }
-        }
-    return value;
-}
-
-
-int64_t Gps_Navigation_Message::read_navigation_signed(const std::bitset<GPS_SUBFRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    int64_t value = (bits[GPS_SUBFRAME_BITS - parameter[0].first] == 1) ? -1LL : 0LL;
-    for (const auto& p : parameter)
-        {
-            for (int32_t j = 0; j < p.second; j++)
-                {
-                    value = (value << 1) | static_cast<int64_t>(bits[GPS_SUBFRAME_BITS - p.first - j]);
-                }
-        }
-    return value;
-}
-
-
 int32_t Gps_Navigation_Message::subframe_decoder(const char* subframe)
 {
     uint32_t gps_word;
 
     // UNPACK BYTES TO BITS AND REMOVE THE CRC REDUNDANCE
-    std::bitset<GPS_SUBFRAME_BITS> subframe_bits;
-    std::bitset<GPS_WORD_BITS + 2> word_bits;
+    Subframe_Bits subframe_bits;
     for (int32_t i = 0; i < 10; i++)
         {
             memcpy(&gps_word, &subframe[i * 4], sizeof(char) * 4);
-            word_bits = std::bitset<(GPS_WORD_BITS + 2)>(gps_word);
-            for (int32_t j = 0; j < GPS_WORD_BITS; j++)
-                {
-                    subframe_bits[GPS_WORD_BITS * (9 - i) + j] = word_bits[j];
-                }
+            subframe_bits.write_unsigned(GPS_WORD_BITS * i + 1, GPS_WORD_BITS, gps_word);
         }
 
     const auto subframe_ID = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, SUBFRAME_ID));
@@ -9,7 +9,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -24,13 +24,11 @@
 #include "gps_almanac.h"
 #include "gps_ephemeris.h"
 #include "gps_iono.h"
+#include "gnss_packed_frame.h"
 #include "gps_utc_model.h"
-#include <bitset>
 #include <cstdint>
 #include <map>
 #include <string>
-#include <utility>  // for pair
-#include <vector>
 
 /** \addtogroup Core
  * \{ */
@@ -142,9 +140,26 @@ public:
     bool almanac_validation() const;
 
 private:
-    uint64_t read_navigation_unsigned(const std::bitset<GPS_SUBFRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    int64_t read_navigation_signed(const std::bitset<GPS_SUBFRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    bool read_navigation_bool(const std::bitset<GPS_SUBFRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
+    using Subframe_Bits = Gnss_Packed_Frame<GPS_SUBFRAME_BITS>;
+
+    template <typename Field>
+    inline uint64_t read_navigation_unsigned(const Subframe_Bits& bits, const Field& parameter) const
+    {
+        return bits.read_unsigned(parameter);
+    }
+
+    template <typename Field>
+    inline int64_t read_navigation_signed(const Subframe_Bits& bits, const Field& parameter) const
+    {
+        return bits.read_signed(parameter);
+    }
+
+    template <typename Field>
+    inline bool read_navigation_bool(const Subframe_Bits& bits, const Field& parameter) const
+    {
+        return bits.read_bool(parameter);
+    }
+
     void print_gps_word_bytes(uint32_t GPS_word) const;
 
     std::map<int32_t, int32_t> almanacHealth;  //!< Map that stores the health information stored in the almanac
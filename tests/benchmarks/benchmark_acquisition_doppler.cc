@@ -0,0 +1,196 @@
+/*!
+ * \file benchmark_acquisition_doppler.cc
+ * \brief Benchmark for the Doppler search strategies of the PCPS acquisition
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "MATH_CONSTANTS.h"
+#include "acq_shared_engine.h"
+#include "gnss_sdr_fft.h"
+#include "gps_sdr_signal_replica.h"
+#include <benchmark/benchmark.h>
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr int32_t FS_HZ = 4000000;     // sampling rate [Sps]
+constexpr uint32_t FFT_SIZE = 4000;    // 1 ms of GPS L1 C/A
+constexpr int32_t DOPPLER_STEP = 250;  // Doppler step [Hz]
+constexpr uint32_t NUM_PRNS = 32;      // satellites searched in a cold start
+
+/*
+ * Input snapshot, local codes and Doppler grid of a cold start. The search of
+ * each PRN includes the FFT of its local code, as a channel does when it is
+ * assigned a new satellite.
+ */
+struct Cold_Start_Setup
+{
+    explicit Cold_Start_Setup(int32_t doppler_max)
+        : input(FFT_SIZE),
+          codes(NUM_PRNS, volk_gnsssdr::vector<std::complex<float>>(FFT_SIZE)),
+          fft_codes(FFT_SIZE),
+          magnitude(FFT_SIZE),
+          fft_if(gnss_fft_fwd_make_unique(FFT_SIZE)),
+          ifft(gnss_fft_rev_make_unique(FFT_SIZE))
+    {
+        for (uint32_t prn = 1; prn <= NUM_PRNS; prn++)
+            {
+                gps_l1_ca_code_gen_complex_sampled(codes[prn - 1], prn, FS_HZ, 0);
+            }
+        // PRN 1 at 1680 Hz and a delay of 524 samples, in noise
+        std::default_random_engine e2(1);
+        std::normal_distribution<float> noise(0.0, 1.0);
+        volk_gnsssdr::vector<std::complex<float>> carrier(FFT_SIZE);
+        make_carrier(carrier, -1680.0);
+        for (uint32_t i = 0; i < FFT_SIZE; i++)
+            {
+                input[i] = codes[0][(i + FFT_SIZE - 524) % FFT_SIZE] * carrier[i] + std::complex<float>(noise(e2), noise(e2));
+            }
+        const auto num_bins = static_cast<uint32_t>(2 * doppler_max / DOPPLER_STEP);
+        for (uint32_t i = 0; i < num_bins; i++)
+            {
+                dopplers.push_back(static_cast<double>(-doppler_max + DOPPLER_STEP * static_cast<int32_t>(i)));
+            }
+    }
+
+    void make_carrier(volk_gnsssdr::vector<std::complex<float>>& carrier, double freq) const
+    {
+        std::array<float, 1> phase{};
+        volk_gnsssdr_s32f_sincos_32fc(carrier.data(), static_cast<float>(-TWO_PI * freq / FS_HZ), phase.data(), FFT_SIZE);
+    }
+
+    // FFT of the local code of the next PRN, as in pcps_acquisition::set_local_code()
+    void next_local_code()
+    {
+        std::copy(codes[prn_index].cbegin(), codes[prn_index].cend(), fft_if->get_inbuf());
+        fft_if->execute();
+        volk_32fc_conjugate_32fc(fft_codes.data(), fft_if->get_outbuf(), FFT_SIZE);
+        prn_index = (prn_index + 1) % NUM_PRNS;
+    }
+
+    // Squared magnitude of the inverse FFT and search of its peak
+    void detect(float& peak, uint32_t& peak_index)
+    {
+        ifft->execute();
+        volk_32fc_magnitude_squared_32f(magnitude.data(), ifft->get_outbuf(), FFT_SIZE);
+        uint32_t index = 0;
+        volk_gnsssdr_32f_index_max_32u(&index, magnitude.data(), FFT_SIZE);
+        if (magnitude[index] > peak)
+            {
+                peak = magnitude[index];
+                peak_index = index;
+            }
+    }
+
+    std::vector<double> dopplers;
+    volk_gnsssdr::vector<std::complex<float>> input;
+    volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> codes;
+    volk_gnsssdr::vector<std::complex<float>> fft_codes;
+    volk_gnsssdr::vector<float> magnitude;
+    std::unique_ptr<gnss_fft_complex_fwd> fft_if;
+    std::unique_ptr<gnss_fft_complex_rev> ifft;
+    uint32_t prn_index{0};
+};
+}  // namespace
+
+
+void bm_time_domain_doppler(benchmark::State& state)
+{
+    Cold_Start_Setup setup(static_cast<int32_t>(state.range(0)));
+    const auto num_bins = static_cast<uint32_t>(setup.dopplers.size());
+    volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> wipeoffs(num_bins, volk_gnsssdr::vector<std::complex<float>>(FFT_SIZE));
+    for (uint32_t i = 0; i < num_bins; i++)
+        {
+            setup.make_carrier(wipeoffs[i], setup.dopplers[i]);
+        }
+
+    // Each iteration is the search of one PRN over the whole Doppler grid
+    while (state.KeepRunning())
+        {
+            setup.next_local_code();
+            float peak = 0.0;
+            uint32_t peak_index = 0;
+            for (uint32_t i = 0; i < num_bins; i++)
+                {
+                    volk_32fc_x2_multiply_32fc(setup.fft_if->get_inbuf(), setup.input.data(), wipeoffs[i].data(), FFT_SIZE);
+                    setup.fft_if->execute();
+                    volk_32fc_x2_multiply_32fc(setup.ifft->get_inbuf(), setup.fft_if->get_outbuf(), setup.fft_codes.data(), FFT_SIZE);
+                    setup.detect(peak, peak_index);
+                }
+            benchmark::DoNotOptimize(peak_index);
+        }
+    state.counters["doppler_bins"] = num_bins;
+    state.counters["forward_ffts"] = num_bins + 1;
+}
+
+
+void bm_freq_domain_doppler(benchmark::State& state)
+{
+    Cold_Start_Setup setup(static_cast<int32_t>(state.range(0)));
+    const auto num_bins = static_cast<uint32_t>(setup.dopplers.size());
+    std::vector<float> residuals;
+    std::vector<uint32_t> residual_index;
+    std::vector<uint32_t> shifts;
+    acq_doppler_grid_shifts(setup.dopplers, static_cast<double>(FS_HZ) / static_cast<double>(FFT_SIZE), FFT_SIZE, residuals, residual_index, shifts);
+    volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> wipeoffs(residuals.size(), volk_gnsssdr::vector<std::complex<float>>(FFT_SIZE));
+    volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> spectra(residuals.size(), volk_gnsssdr::vector<std::complex<float>>(FFT_SIZE));
+    for (size_t i = 0; i < residuals.size(); i++)
+        {
+            setup.make_carrier(wipeoffs[i], residuals[i]);
+        }
+
+    // Each iteration is the search of one PRN over the whole Doppler grid,
+    // including the forward FFTs of its own input snapshot
+    while (state.KeepRunning())
+        {
+            setup.next_local_code();
+            for (size_t i = 0; i < residuals.size(); i++)
+                {
+                    volk_32fc_x2_multiply_32fc(setup.fft_if->get_inbuf(), setup.input.data(), wipeoffs[i].data(), FFT_SIZE);
+                    setup.fft_if->execute();
+                    std::copy(setup.fft_if->get_outbuf(), setup.fft_if->get_outbuf() + FFT_SIZE, spectra[i].data());
+                }
+            float peak = 0.0;
+            uint32_t peak_index = 0;
+            for (uint32_t i = 0; i < num_bins; i++)
+                {
+                    const uint32_t shift = shifts[i];
+                    const std::complex<float>* spectrum = spectra[residual_index[i]].data();
+                    volk_32fc_x2_multiply_32fc(setup.ifft->get_inbuf(), spectrum + shift, setup.fft_codes.data(), FFT_SIZE - shift);
+                    if (shift > 0)
+                        {
+                            volk_32fc_x2_multiply_32fc(setup.ifft->get_inbuf() + FFT_SIZE - shift, spectrum, setup.fft_codes.data() + FFT_SIZE - shift, shift);
+                        }
+                    setup.detect(peak, peak_index);
+                }
+            benchmark::DoNotOptimize(peak_index);
+        }
+    state.counters["doppler_bins"] = num_bins;
+    state.counters["forward_ffts"] = static_cast<double>(residuals.size() + 1);
+}
+
+
+// Argument: doppler_max [Hz]. 5000 -> 10 kHz grid, 25000 -> 50 kHz grid.
+BENCHMARK(bm_time_domain_doppler)->Arg(5000)->Arg(25000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bm_freq_domain_doppler)->Arg(5000)->Arg(25000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_MAIN();
@@ -0,0 +1,108 @@
+/*!
+ * \file benchmark_beamformer.cc
+ * \brief Benchmark for the combination of the array elements in the beamformer
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "beamformer.h"
+#include <benchmark/benchmark.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <algorithm>
+#include <complex>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr double FS_HZ = 20000000.0;  // sampling rate of the array front-end [Sps]
+constexpr int NUM_SAMPLES = 20000;    // 1 ms
+
+struct Array_Setup
+{
+    Array_Setup()
+        : output(NUM_SAMPLES),
+          tmp(GNSS_SDR_BEAMFORMER_BLOCK_SIZE),
+          weights(GNSS_SDR_BEAMFORMER_CHANNELS)
+    {
+        std::random_device rd;
+        std::default_random_engine e2(rd());
+        std::uniform_real_distribution<float> dist(-1.0, 1.0);
+        for (int i = 0; i < GNSS_SDR_BEAMFORMER_CHANNELS; i++)
+            {
+                channels.emplace_back(NUM_SAMPLES);
+                std::generate(channels.back().begin(), channels.back().end(), [&]() { return gr_complex(dist(e2), dist(e2)); });
+            }
+        for (const auto& ch : channels)
+            {
+                input.push_back(ch.data());
+            }
+        std::generate(weights.begin(), weights.end(), [&]() { return gr_complex(dist(e2), dist(e2)); });
+    }
+
+    std::vector<volk_gnsssdr::vector<gr_complex>> channels;
+    gr_vector_const_void_star input;
+    volk_gnsssdr::vector<gr_complex> output;
+    volk_gnsssdr::vector<gr_complex> tmp;
+    std::vector<gr_complex> weights;
+};
+
+
+void set_counters(benchmark::State& state)
+{
+    state.SetItemsProcessed(state.iterations() * NUM_SAMPLES);
+    // Processed signal time over processing time. Above 1, the beamformer
+    // keeps up with the array front-end in real time.
+    state.counters["realtime_factor"] = benchmark::Counter(NUM_SAMPLES / FS_HZ, benchmark::Counter::kIsIterationInvariantRate);
+}
+}  // namespace
+
+
+void bm_beamformer_scalar(benchmark::State& state)
+{
+    Array_Setup setup;
+    for (auto _ : state)
+        {
+            for (int n = 0; n < NUM_SAMPLES; n++)
+                {
+                    gr_complex sum(0.0, 0.0);
+                    for (size_t i = 0; i < setup.weights.size(); i++)
+                        {
+                            sum = sum + (reinterpret_cast<const gr_complex*>(setup.input[i]))[n] * setup.weights[i];
+                        }
+                    setup.output[n] = sum;
+                }
+            benchmark::DoNotOptimize(setup.output.data());
+            benchmark::ClobberMemory();
+        }
+    set_counters(state);
+}
+
+
+void bm_beamformer_volk(benchmark::State& state)
+{
+    Array_Setup setup;
+    for (auto _ : state)
+        {
+            beamformer_combine(setup.output.data(), setup.input, setup.weights, NUM_SAMPLES, setup.tmp.data());
+            benchmark::DoNotOptimize(setup.output.data());
+            benchmark::ClobberMemory();
+        }
+    set_counters(state);
+}
+
+
+BENCHMARK(bm_beamformer_scalar)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bm_beamformer_volk)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
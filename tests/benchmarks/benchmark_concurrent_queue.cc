@@ -0,0 +1,128 @@
+/*!
+ * \file benchmark_concurrent_queue.cc
+ * \brief Benchmark for the thread-safe queues used to pass messages between
+ * threads, with several producers and one consumer.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr int64_t MESSAGES_PER_PRODUCER = 10000;
+
+// Producers push messages as fast as possible, the consumer pops them
+template <typename Queue>
+void run_contention(benchmark::State& state, Queue& queue)
+{
+    const auto producers = static_cast<int32_t>(state.range(0));
+    while (state.KeepRunning())
+        {
+            std::vector<std::thread> threads;
+            for (int32_t p = 0; p < producers; p++)
+                {
+                    threads.emplace_back([&queue]() {
+                        for (int64_t i = 0; i < MESSAGES_PER_PRODUCER; i++)
+                            {
+                                queue.push(i);
+                            }
+                    });
+                }
+            int64_t message;
+            int64_t sum = 0;
+            for (int64_t i = 0; i < producers * MESSAGES_PER_PRODUCER; i++)
+                {
+                    queue.wait_and_pop(message);
+                    sum += message;
+                }
+            for (auto& t : threads)
+                {
+                    t.join();
+                }
+            benchmark::DoNotOptimize(sum);
+        }
+    state.SetItemsProcessed(state.iterations() * producers * MESSAGES_PER_PRODUCER);
+}
+
+
+// Time from a push until a consumer blocked in timed_wait_and_pop gets the
+// message, as in the receiver control thread
+template <typename Queue>
+void run_wakeup(benchmark::State& state, Queue& queue)
+{
+    Queue ack;
+    std::thread consumer([&]() {
+        int64_t message = 0;
+        while (message >= 0)
+            {
+                if (queue.timed_wait_and_pop(message, 100))
+                    {
+                        ack.push(message);
+                    }
+            }
+    });
+    int64_t reply;
+    int64_t i = 0;
+    while (state.KeepRunning())
+        {
+            queue.push(i++);
+            ack.wait_and_pop(reply);
+            benchmark::DoNotOptimize(reply);
+        }
+    queue.push(-1);
+    consumer.join();
+}
+}  // namespace
+
+
+void bm_concurrent_queue(benchmark::State& state)
+{
+    Concurrent_Queue<int64_t> queue;
+    run_contention(state, queue);
+}
+
+
+void bm_concurrent_ring_queue(benchmark::State& state)
+{
+    Concurrent_Ring_Queue<int64_t> queue;
+    run_contention(state, queue);
+}
+
+
+void bm_concurrent_queue_wakeup(benchmark::State& state)
+{
+    Concurrent_Queue<int64_t> queue;
+    run_wakeup(state, queue);
+}
+
+
+void bm_concurrent_ring_queue_wakeup(benchmark::State& state)
+{
+    Concurrent_Ring_Queue<int64_t> queue;
+    run_wakeup(state, queue);
+}
+
+
+// Argument: number of producer threads
+BENCHMARK(bm_concurrent_queue)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(bm_concurrent_ring_queue)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(bm_concurrent_queue_wakeup)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(bm_concurrent_ring_queue_wakeup)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_MAIN();
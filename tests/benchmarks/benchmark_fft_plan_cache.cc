@@ -0,0 +1,126 @@
+/*!
+ * \file benchmark_fft_plan_cache.cc
+ * \brief Benchmark for the creation of the acquisition FFT plans at receiver
+ * startup, with and without the plan cache.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_fft.h"
+#include "gnss_sdr_fft_cache.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int32_t FFT_SIZE = 4000;  // 1 ms of GPS L1 C/A at 4 Msps
+const std::string WISDOM_FILE("benchmark_fft_plan_cache.wisdom");
+}  // namespace
+
+
+void bm_fft_plans_new(benchmark::State& state)
+{
+    const auto channels = static_cast<size_t>(state.range(0));
+    while (state.KeepRunning())
+        {
+            std::vector<std::unique_ptr<gnss_fft_complex_fwd>> fwd;
+            std::vector<std::unique_ptr<gnss_fft_complex_rev>> rev;
+            for (size_t ch = 0; ch < channels; ch++)
+                {
+                    fwd.push_back(gnss_fft_fwd_make_unique(FFT_SIZE));
+                    rev.push_back(gnss_fft_rev_make_unique(FFT_SIZE));
+                }
+            benchmark::DoNotOptimize(fwd.data());
+            benchmark::DoNotOptimize(rev.data());
+        }
+}
+
+
+void bm_fft_plans_cached(benchmark::State& state)
+{
+    const auto channels = static_cast<size_t>(state.range(0));
+    while (state.KeepRunning())
+        {
+            std::vector<gnss_fft_fwd_cached_ptr> fwd;
+            std::vector<gnss_fft_rev_cached_ptr> rev;
+            for (size_t ch = 0; ch < channels; ch++)
+                {
+                    fwd.push_back(gnss_fft_fwd_make_cached(FFT_SIZE));
+                    rev.push_back(gnss_fft_rev_make_cached(FFT_SIZE));
+                }
+            benchmark::DoNotOptimize(fwd.data());
+            benchmark::DoNotOptimize(rev.data());
+        }
+    state.counters["plans_reused"] = static_cast<double>(Gnss_Fft_Cache::instance().hits());
+    state.counters["plans_created"] = static_cast<double>(Gnss_Fft_Cache::instance().misses());
+}
+
+
+// First start of a receiver, with an empty plan cache and no FFTW wisdom in
+// memory. If the second argument is 1, the wisdom stored by a previous run is
+// loaded before the plans are created, as GNSS-SDR.fftw_wisdom_file does.
+// GNU Radio also loads its own wisdom file (~/.gr_fftw_wisdom) when it plans,
+// so run it with an empty HOME to measure the start without any wisdom.
+void bm_fft_plans_cold_start(benchmark::State& state)
+{
+    const auto channels = static_cast<size_t>(state.range(0));
+    const bool with_wisdom = state.range(1) != 0;
+    auto& cache = Gnss_Fft_Cache::instance();
+    if (with_wisdom)
+        {
+            // Wisdom stored by a previous run
+            gnss_fft_fwd_make_unique(FFT_SIZE);
+            gnss_fft_rev_make_unique(FFT_SIZE);
+            if (!cache.export_wisdom(WISDOM_FILE))
+                {
+                    state.SkipWithError("This build does not support FFTW wisdom files");
+                    return;
+                }
+        }
+    while (state.KeepRunning())
+        {
+            state.PauseTiming();
+            cache.clear();
+            cache.forget_wisdom();
+            state.ResumeTiming();
+            if (with_wisdom)
+                {
+                    cache.import_wisdom(WISDOM_FILE);
+                }
+            std::vector<gnss_fft_fwd_cached_ptr> fwd;
+            std::vector<gnss_fft_rev_cached_ptr> rev;
+            for (size_t ch = 0; ch < channels; ch++)
+                {
+                    fwd.push_back(gnss_fft_fwd_make_cached(FFT_SIZE));
+                    rev.push_back(gnss_fft_rev_make_cached(FFT_SIZE));
+                }
+            benchmark::DoNotOptimize(fwd.data());
+            benchmark::DoNotOptimize(rev.data());
+            state.PauseTiming();
+            fwd.clear();
+            rev.clear();
+            state.ResumeTiming();
+        }
+    cache.clear();
+}
+
+
+// Argument: number of acquisition channels created at startup
+BENCHMARK(bm_fft_plans_new)->Arg(8)->Arg(32)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_fft_plans_cached)->Arg(8)->Arg(32)->Unit(benchmark::kMillisecond);
+// Arguments: number of acquisition channels, and whether wisdom is loaded
+BENCHMARK(bm_fft_plans_cold_start)->Args({8, 0})->Args({8, 1})->Args({32, 0})->Args({32, 1})->Unit(benchmark::kMillisecond);
+BENCHMARK_MAIN();
@@ -0,0 +1,142 @@
+/*!
+ * \file benchmark_interference_mitigation.cc
+ * \brief Benchmark for the pulse blanking and notch input filters
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_block_interface.h"
+#include "in_memory_configuration.h"
+#include "notch_filter.h"
+#include "notch_cc.h"
+#include "notch_filter.h"
+#include "notch_filter_lite.h"
+#include "notch_lite_cc.h"
+#include "pulse_blanking_cc.h"
+#include "pulse_blanking_filter.h"
+#include <benchmark/benchmark.h>
+#include <gnuradio/blocks/null_sink.h>
+#include <gnuradio/top_block.h>
+#include <complex>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
+
+namespace
+{
+constexpr double FS_HZ = 4000000.0;  // default sampling rate of the filters [Sps]
+constexpr int NUM_SAMPLES = 4000000;  // 1 s
+
+// Noise, a CW interference 20 dB above it in 10 % of the
+// samples, and 8 us pulses 30 dB above it every 100 us
+std::vector<gr_complex> rfi_signal()
+{
+    std::default_random_engine e2(1);
+    std::normal_distribution<float> noise(0.0, 1.0);
+    std::vector<gr_complex> x(NUM_SAMPLES);
+    for (int n = 0; n < NUM_SAMPLES; n++)
+        {
+            x[n] = gr_complex(noise(e2), noise(e2));
+            if ((n / 40000) % 10 == 9)
+                {
+                    x[n] += std::polar(14.0F, 0.3F * static_cast<float>(n));
+                }
+            if (n % 400 < 32)
+                {
+                    x[n] *= 31.0F;
+                }
+        }
+    return x;
+}
+
+
+// Counters of the block that implements the filter
+const Interference_Mitigation_Counters* block_counters(const gr::basic_block_sptr& block)
+{
+    if (const auto* pb = dynamic_cast<const pulse_blanking_cc*>(block.get()))
+        {
+            return &pb->counters();
+        }
+    if (const auto* notch = dynamic_cast<const Notch*>(block.get()))
+        {
+            return &notch->counters();
+        }
+    if (const auto* notch_lite = dynamic_cast<const NotchLite*>(block.get()))
+        {
+            return &notch_lite->counters();
+        }
+    return nullptr;
+}
+
+
+void bm_filter(benchmark::State& state, const std::string& implementation)
+{
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("SignalSource.sampling_frequency", std::to_string(static_cast<int>(FS_HZ)));
+    config->set_property("InputFilter.item_type", "gr_complex");
+    config->set_property("InputFilter.segments_est", "2500");
+
+    std::shared_ptr<GNSSBlockInterface> filter;
+    if (implementation == "Pulse_Blanking_Filter")
+        {
+            filter = std::make_shared<PulseBlankingFilter>(config.get(), "InputFilter", 1, 1);
+        }
+    else if (implementation == "Notch_Filter")
+        {
+            filter = std::make_shared<NotchFilter>(config.get(), "InputFilter", 1, 1);
+        }
+    else
+        {
+            filter = std::make_shared<NotchFilterLite>(config.get(), "InputFilter", 1, 1);
+        }
+
+    auto top_block = gr::make_top_block("Interference mitigation benchmark");
+    auto source = gr::blocks::vector_source_c::make(rfi_signal());
+    auto sink = gr::blocks::null_sink::make(sizeof(gr_complex));
+    filter->connect(top_block);
+    top_block->connect(source, 0, filter->get_left_block(), 0);
+    top_block->connect(filter->get_right_block(), 0, sink, 0);
+
+    for (auto _ : state)
+        {
+            source->rewind();
+            top_block->run();
+        }
+    state.SetItemsProcessed(state.iterations() * NUM_SAMPLES);
+    // Processed signal time over processing time. Above 1, the filter keeps
+    // up with the front-end in real time.
+    state.counters["realtime_factor"] = benchmark::Counter(NUM_SAMPLES / FS_HZ, benchmark::Counter::kIsIterationInvariantRate);
+    // Throughput of the filter alone, out of the scheduler and the other
+    // blocks, and segments blanked or filtered per run
+    const Interference_Mitigation_Counters* counters = block_counters(filter->get_right_block());
+    if (counters != nullptr)
+        {
+            state.counters["block_Msps"] = counters->throughput_sps() * 1e-6;
+            state.counters["filtered_segments"] = benchmark::Counter(static_cast<double>(counters->filtered_segments()), benchmark::Counter::kAvgIterations);
+        }
+}
+}  // namespace
+
+
+BENCHMARK_CAPTURE(bm_filter, Pulse_Blanking_Filter, std::string("Pulse_Blanking_Filter"))->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(bm_filter, Notch_Filter, std::string("Notch_Filter"))->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(bm_filter, Notch_Filter_Lite, std::string("Notch_Filter_Lite"))->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
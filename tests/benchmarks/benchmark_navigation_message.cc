@@ -0,0 +1,323 @@
+/*!
+ * \file benchmark_navigation_message.cc
+ * \brief Benchmark for the parsing of Galileo I/NAV, F/NAV and GPS LNAV
+ * navigation messages
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "galileo_fnav_message.h"
+#include "galileo_inav_message.h"
+#include "gnss_packed_frame.h"
+#include "gps_navigation_message.h"
+#include <benchmark/benchmark.h>
+#include <boost/crc.hpp>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using Inav_Page_Part = Gnss_Packed_Frame<GALILEO_INAV_PAGE_PART_BITS>;
+using Fnav_Page = Gnss_Packed_Frame<GALILEO_FNAV_PAGE_BITS>;
+using Crc_24_Q = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false>;
+
+// Word types of the I/NAV pages, in the order of a nominal E1-B subframe
+// (Reed-Solomon parity words excluded)
+const std::array<uint32_t, 15> INAV_WORD_TYPES{{2, 4, 6, 7, 8, 0, 0, 0, 0, 0, 1, 3, 5, 0, 16}};
+
+
+template <size_t N>
+Gnss_Packed_Frame<N> random_frame(std::mt19937& gen)
+{
+    Gnss_Packed_Frame<N> frame;
+    for (int32_t first = 1; first <= static_cast<int32_t>(N); first += 32)
+        {
+            const int32_t length = first + 31 <= static_cast<int32_t>(N) ? 32 : static_cast<int32_t>(N) - first + 1;
+            frame.write_unsigned(first, length, gen());
+        }
+    return frame;
+}
+
+
+template <size_t N>
+uint32_t crc_24_q(const Gnss_Packed_Frame<N>& frame)
+{
+    const auto bytes = frame.to_bytes();
+    Crc_24_Q crc;
+    crc.process_bytes(bytes.data(), bytes.size());
+    return crc.checksum();
+}
+
+
+// Even and odd page parts of synthetic I/NAV pages, with correct CRCs
+std::vector<Inav_Page_Part> inav_page_parts()
+{
+    std::mt19937 gen(1234);
+    std::vector<Inav_Page_Part> parts;
+    for (const uint32_t word_type : INAV_WORD_TYPES)
+        {
+            auto data_jk = random_frame<GALILEO_DATA_JK_BITS>(gen);
+            data_jk.write_unsigned(1, 6, word_type);
+            if (word_type >= 1 && word_type <= 4)
+                {
+                    data_jk.write_unsigned(7, 10, 77);  // same IODnav in the four ephemeris words
+                }
+            Inav_Page_Part even;
+            even.copy(data_jk, 1, 112, 3);
+            auto odd = random_frame<GALILEO_INAV_PAGE_PART_BITS>(gen);
+            odd.set_bit(1, true);
+            odd.set_bit(2, false);
+            odd.copy(data_jk, 113, 16, 3);
+            Gnss_Packed_Frame<GALILEO_DATA_FRAME_BITS> crc_frame;
+            crc_frame.copy(even, 1, 114, 1);
+            crc_frame.copy(odd, 1, GALILEO_DATA_FRAME_BITS - 114, 115);
+            odd.write_unsigned(83, 24, crc_24_q(crc_frame));
+            parts.push_back(even);
+            parts.push_back(odd);
+        }
+    return parts;
+}
+
+
+// Synthetic F/NAV pages of word types 1 to 6, with correct CRCs
+std::vector<Fnav_Page> fnav_pages()
+{
+    std::mt19937 gen(1234);
+    std::vector<Fnav_Page> pages;
+    for (uint32_t word_type = 1; word_type <= 6; word_type++)
+        {
+            auto data = random_frame<GALILEO_FNAV_DATA_FRAME_BITS>(gen);
+            data.write_unsigned(1, 6, word_type);
+            if (word_type >= 2 && word_type <= 4)
+                {
+                    data.write_unsigned(7, 10, 77);
+                }
+            auto page = random_frame<GALILEO_FNAV_PAGE_BITS>(gen);
+            page.copy(data, 1, GALILEO_FNAV_DATA_FRAME_BITS, 1);
+            page.write_unsigned(GALILEO_FNAV_DATA_FRAME_BITS + 1, 24, crc_24_q(data));
+            pages.push_back(page);
+        }
+    return pages;
+}
+
+
+// Synthetic GPS LNAV subframes 1 to 5, as delivered by the telemetry decoder:
+// ten 30-bit words, one per 32-bit integer
+std::vector<std::array<uint32_t, 10>> gps_subframes()
+{
+    std::mt19937 gen(1234);
+    std::vector<std::array<uint32_t, 10>> subframes;
+    for (uint32_t subframe_id = 1; subframe_id <= 5; subframe_id++)
+        {
+            std::array<uint32_t, 10> words{};
+            for (auto& word : words)
+                {
+                    word = gen() & 0x3FFFFFFFU;
+                }
+            // Subframe ID in bits 50 to 52
+            words[1] = (words[1] & ~(7U << 8)) | (subframe_id << 8);
+            subframes.push_back(words);
+        }
+    return subframes;
+}
+
+
+// Field reading of previous releases: one bit at a time from a std::bitset,
+// with the data field described by a std::vector of pairs
+uint64_t bitset_read_unsigned(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter)
+{
+    uint64_t value = 0ULL;
+    for (const auto& p : parameter)
+        {
+            for (int j = 0; j < p.second; j++)
+                {
+                    value <<= 1U;
+                    value |= static_cast<uint64_t>(bits[GALILEO_DATA_JK_BITS - p.first - j]);
+                }
+        }
+    return value;
+}
+
+
+int64_t bitset_read_signed(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter)
+{
+    int64_t value = (bits[GALILEO_DATA_JK_BITS - parameter[0].first] == 1) ? -1LL : 0LL;
+    for (const auto& p : parameter)
+        {
+            for (int32_t j = 0; j < p.second; j++)
+                {
+                    value = (value << 1) | static_cast<int64_t>(bits[GALILEO_DATA_JK_BITS - p.first - j]);
+                }
+        }
+    return value;
+}
+
+
+template <typename Field>
+std::vector<std::pair<int32_t, int32_t>> to_vector(const Field& field)
+{
+    return {field.cbegin(), field.cend()};
+}
+
+
+// Ephemeris data fields of I/NAV word types 1 to 4
+const std::vector<Gnss_Frame_Field<1>> EPHEMERIS_UNSIGNED_FIELDS{IOD_NAV_1_BIT, T0_E_1_BIT, E_1_BIT, A_1_BIT, SISA_3_BIT, SV_ID_PRN_4_BIT, T0C_4_BIT};
+const std::vector<Gnss_Frame_Field<1>> EPHEMERIS_SIGNED_FIELDS{M0_1_BIT, OMEGA_0_2_BIT, I_0_2_BIT, OMEGA_2_BIT, I_DOT_2_BIT, OMEGA_DOT_3_BIT, DELTA_N_3_BIT,
+    C_UC_3_BIT, C_US_3_BIT, C_RC_3_BIT, C_RS_3_BIT, C_IC_4_BIT, C_IS_4_BIT, AF0_4_BIT, AF1_4_BIT, AF2_4_BIT};
+}  // namespace
+
+
+void bm_bitset_field_reading(benchmark::State& state)
+{
+    std::mt19937 gen(1234);
+    const std::bitset<GALILEO_DATA_JK_BITS> bits = random_frame<GALILEO_DATA_JK_BITS>(gen).to_bitset();
+    std::vector<std::vector<std::pair<int32_t, int32_t>>> unsigned_fields;
+    std::vector<std::vector<std::pair<int32_t, int32_t>>> signed_fields;
+    for (const auto& field : EPHEMERIS_UNSIGNED_FIELDS)
+        {
+            unsigned_fields.push_back(to_vector(field));
+        }
+    for (const auto& field : EPHEMERIS_SIGNED_FIELDS)
+        {
+            signed_fields.push_back(to_vector(field));
+        }
+    while (state.KeepRunning())
+        {
+            int64_t sum = 0;
+            for (const auto& field : unsigned_fields)
+                {
+                    sum += static_cast<int64_t>(bitset_read_unsigned(bits, field));
+                }
+            for (const auto& field : signed_fields)
+                {
+                    sum += bitset_read_signed(bits, field);
+                }
+            benchmark::DoNotOptimize(sum);
+        }
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+void bm_packed_field_reading(benchmark::State& state)
+{
+    std::mt19937 gen(1234);
+    const Gnss_Packed_Frame<GALILEO_DATA_JK_BITS> bits = random_frame<GALILEO_DATA_JK_BITS>(gen);
+    while (state.KeepRunning())
+        {
+            int64_t sum = 0;
+            for (const auto& field : EPHEMERIS_UNSIGNED_FIELDS)
+                {
+                    sum += static_cast<int64_t>(bits.read_unsigned(field));
+                }
+            for (const auto& field : EPHEMERIS_SIGNED_FIELDS)
+                {
+                    sum += bits.read_signed(field);
+                }
+            benchmark::DoNotOptimize(sum);
+        }
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+void bm_inav_split_page(benchmark::State& state)
+{
+    const std::vector<Inav_Page_Part> parts = inav_page_parts();
+    Galileo_Inav_Message inav;
+    while (state.KeepRunning())
+        {
+            int32_t flag_even_word = 0;
+            for (const auto& part : parts)
+                {
+                    inav.split_page(part, flag_even_word);
+                    flag_even_word = part.test(1) ? 0 : 1;
+                }
+            benchmark::DoNotOptimize(inav.get_flag_CRC_test());
+        }
+    state.SetItemsProcessed(state.iterations() * INAV_WORD_TYPES.size());
+}
+
+
+void bm_inav_split_page_string(benchmark::State& state)
+{
+    std::vector<std::string> parts;
+    for (const auto& part : inav_page_parts())
+        {
+            parts.push_back(part.to_string());
+        }
+    Galileo_Inav_Message inav;
+    while (state.KeepRunning())
+        {
+            int32_t flag_even_word = 0;
+            for (const auto& part : parts)
+                {
+                    inav.split_page(part, flag_even_word);
+                    flag_even_word = part[0] == '1' ? 0 : 1;
+                }
+            benchmark::DoNotOptimize(inav.get_flag_CRC_test());
+        }
+    state.SetItemsProcessed(state.iterations() * INAV_WORD_TYPES.size());
+}
+
+
+void bm_fnav_split_page(benchmark::State& state)
+{
+    const std::vector<Fnav_Page> pages = fnav_pages();
+    Galileo_Fnav_Message fnav;
+    while (state.KeepRunning())
+        {
+            for (const auto& page : pages)
+                {
+                    fnav.split_page(page);
+                }
+            benchmark::DoNotOptimize(fnav.get_flag_CRC_test());
+        }
+    state.SetItemsProcessed(state.iterations() * pages.size());
+}
+
+
+void bm_gps_subframe_decoder(benchmark::State& state)
+{
+    const std::vector<std::array<uint32_t, 10>> subframes = gps_subframes();
+    std::vector<std::array<char, 40>> buffers(subframes.size());
+    for (size_t i = 0; i < subframes.size(); i++)
+        {
+            std::memcpy(buffers[i].data(), subframes[i].data(), buffers[i].size());
+        }
+    Gps_Navigation_Message nav;
+    while (state.KeepRunning())
+        {
+            for (const auto& buffer : buffers)
+                {
+                    benchmark::DoNotOptimize(nav.subframe_decoder(buffer.data()));
+                }
+        }
+    state.SetItemsProcessed(state.iterations() * buffers.size());
+}
+
+
+// Ephemeris data fields read bit by bit from a std::bitset, as in previous
+// releases, and from a packed frame
+BENCHMARK(bm_bitset_field_reading);
+BENCHMARK(bm_packed_field_reading);
+// Items: I/NAV pages (even + odd), F/NAV pages and GPS LNAV subframes
+BENCHMARK(bm_inav_split_page);
+BENCHMARK(bm_inav_split_page_string);
+BENCHMARK(bm_fnav_split_page);
+BENCHMARK(bm_gps_subframe_decoder);
+BENCHMARK_MAIN();
@@ -0,0 +1,296 @@
+/*!
+ * \file benchmark_rtcm.cc
+ * \brief Benchmark for the generation and decoding of RTCM 3 messages
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "galileo_ephemeris.h"
+#include "gnss_synchro.h"
+#include "gps_ephemeris.h"
+#include "rtcm.h"
+#include <benchmark/benchmark.h>
+#include <boost/crc.hpp>
+#include <boost/dynamic_bitset.hpp>
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Lengths of the data fields of a MT1019 message (488 bits)
+const std::array<uint32_t, 31> MT1019_FIELDS{{12, 6, 10, 4, 2, 14, 8, 16, 8, 16, 22, 10, 16, 16, 32, 16,
+    32, 16, 32, 16, 16, 32, 16, 32, 16, 32, 24, 8, 6, 1, 1}};
+
+
+std::vector<uint32_t> random_fields()
+{
+    std::mt19937 gen(1234);
+    std::vector<uint32_t> values;
+    for (const uint32_t length : MT1019_FIELDS)
+        {
+            values.push_back(static_cast<uint32_t>(gen() & (length == 32 ? 0xFFFFFFFFU : (1U << length) - 1)));
+        }
+    return values;
+}
+
+
+// Message generation of previous releases: data fields concatenated as a
+// string of '0' and '1' characters, which is padded, converted to bytes to
+// compute the CRC, and converted again to binary data
+std::string string_build_message(Rtcm& rtcm, const std::vector<uint32_t>& values)
+{
+    std::string data;
+    for (size_t i = 0; i < values.size(); i++)
+        {
+            data += std::bitset<32>(values[i]).to_string().substr(32 - MT1019_FIELDS[i]);
+        }
+    const auto msg_length_bytes = static_cast<uint32_t>((data.length() + 7) / 8);
+    data += std::string(8 * msg_length_bytes - data.length(), '0');
+    const std::string msg_without_crc = std::bitset<8>(0xD3).to_string() + std::bitset<6>().to_string() + std::bitset<10>(msg_length_bytes).to_string() + data;
+
+    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc_24_q;
+    boost::dynamic_bitset<uint8_t> frame_bits(msg_without_crc);
+    std::vector<uint8_t> bytes;
+    boost::to_block_range(frame_bits, std::back_inserter(bytes));
+    std::reverse(bytes.begin(), bytes.end());
+    crc_24_q.process_bytes(bytes.data(), bytes.size());
+    return rtcm.bin_to_binary_data(msg_without_crc + std::bitset<24>(crc_24_q.checksum()).to_string());
+}
+
+
+// Message decoding of previous releases: the message is converted to a string
+// of '0' and '1' characters, and each data field is read from a substring
+uint64_t string_read_message(Rtcm& rtcm, const std::string& message)
+{
+    const std::string message_bin = rtcm.binary_data_to_bin(message);
+    const std::string msg_without_crc = message_bin.substr(0, message_bin.length() - 24);
+    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc_24_q;
+    boost::dynamic_bitset<uint8_t> frame_bits(msg_without_crc);
+    std::vector<uint8_t> bytes;
+    boost::to_block_range(frame_bits, std::back_inserter(bytes));
+    std::reverse(bytes.begin(), bytes.end());
+    crc_24_q.process_bytes(bytes.data(), bytes.size());
+    if (std::bitset<24>(message_bin.substr(message_bin.length() - 24)) != std::bitset<24>(crc_24_q.checksum()))
+        {
+            return 0;
+        }
+    uint64_t sum = 0;
+    uint32_t index = 24;
+    for (const uint32_t length : MT1019_FIELDS)
+        {
+            sum += rtcm.bin_to_uint(message_bin.substr(index, length));
+            index += length;
+        }
+    return sum;
+}
+
+
+Gps_Ephemeris sample_gps_ephemeris()
+{
+    Gps_Ephemeris eph;
+    eph.PRN = 3;
+    eph.WN = 2200;
+    eph.IODC = 4;
+    eph.toc = 302400;
+    eph.toe = 302400;
+    eph.ecc = 0.01;
+    eph.sqrtA = 5153.6;
+    eph.M_0 = 1.2;
+    eph.omega = -0.8;
+    eph.af0 = 1e-4;
+    eph.fit_interval_flag = true;
+    return eph;
+}
+
+
+Galileo_Ephemeris sample_galileo_ephemeris()
+{
+    Galileo_Ephemeris eph;
+    eph.PRN = 5;
+    eph.WN = 1176;
+    eph.toc = 302400;
+    eph.toe = 302400;
+    eph.ecc = 0.0002;
+    eph.sqrtA = 5440.6;
+    eph.M_0 = -2.1;
+    eph.omega = 0.4;
+    eph.af0 = -2e-4;
+    eph.E5a_DVS = true;
+    return eph;
+}
+
+
+// Dual-frequency GPS observables of num_sats satellites
+std::map<int32_t, Gnss_Synchro> gps_observables(int32_t num_sats)
+{
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    std::map<int32_t, Gnss_Synchro> observables;
+    const std::array<const char*, 2> signals{{"1C", "2S"}};
+    int32_t channel = 0;
+    for (int32_t sat = 0; sat < num_sats; sat++)
+        {
+            for (const char* signal : signals)
+                {
+                    Gnss_Synchro gnss_synchro{};
+                    gnss_synchro.System = 'G';
+                    std::snprintf(gnss_synchro.Signal, 3, "%s", signal);
+                    gnss_synchro.PRN = 2 * sat + 1;
+                    gnss_synchro.Pseudorange_m = 2.0e7 + 6.0e6 * dist(gen);
+                    gnss_synchro.Carrier_phase_rads = 1.0e8 * (dist(gen) - 0.5);
+                    gnss_synchro.Carrier_Doppler_hz = 1.0e4 * (dist(gen) - 0.5);
+                    gnss_synchro.CN0_dB_hz = 30.0 + 20.0 * dist(gen);
+                    observables[channel++] = gnss_synchro;
+                }
+        }
+    return observables;
+}
+}  // namespace
+
+
+void bm_string_assembly(benchmark::State& state)
+{
+    Rtcm rtcm;
+    const std::vector<uint32_t> values = random_fields();
+    while (state.KeepRunning())
+        {
+            std::string msg = string_build_message(rtcm, values);
+            benchmark::DoNotOptimize(msg.data());
+        }
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+void bm_bit_writer_assembly(benchmark::State& state)
+{
+    const std::vector<uint32_t> values = random_fields();
+    while (state.KeepRunning())
+        {
+            Rtcm_Bit_Writer data;
+            for (size_t i = 0; i < values.size(); i++)
+                {
+                    data.put(values[i], MT1019_FIELDS[i]);
+                }
+            const auto msg_length_bytes = static_cast<uint32_t>(data.bytes().size());
+            std::string msg{static_cast<char>(0xD3), static_cast<char>((msg_length_bytes >> 8) & 0x3), static_cast<char>(msg_length_bytes & 0xFF)};
+            msg.append(data.bytes().cbegin(), data.bytes().cend());
+            const uint32_t crc = rtcm_crc24q(reinterpret_cast<const uint8_t*>(msg.data()), msg.size());
+            msg.push_back(static_cast<char>(crc >> 16));
+            msg.push_back(static_cast<char>(crc >> 8));
+            msg.push_back(static_cast<char>(crc));
+            benchmark::DoNotOptimize(msg.data());
+        }
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+void bm_string_decoding(benchmark::State& state)
+{
+    Rtcm rtcm;
+    const std::string msg = string_build_message(rtcm, random_fields());
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(string_read_message(rtcm, msg));
+        }
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+void bm_print_MT1019(benchmark::State& state)
+{
+    Rtcm rtcm;
+    const Gps_Ephemeris eph = sample_gps_ephemeris();
+    while (state.KeepRunning())
+        {
+            std::string msg = rtcm.print_MT1019(eph);
+            benchmark::DoNotOptimize(msg.data());
+        }
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+void bm_print_MT1045(benchmark::State& state)
+{
+    Rtcm rtcm;
+    const Galileo_Ephemeris eph = sample_galileo_ephemeris();
+    while (state.KeepRunning())
+        {
+            std::string msg = rtcm.print_MT1045(eph);
+            benchmark::DoNotOptimize(msg.data());
+        }
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+void bm_print_MSM_7(benchmark::State& state)
+{
+    Rtcm rtcm;
+    const Gps_Ephemeris eph = sample_gps_ephemeris();
+    const std::map<int32_t, Gnss_Synchro> observables = gps_observables(static_cast<int32_t>(state.range(0)));
+    while (state.KeepRunning())
+        {
+            std::string msg = rtcm.print_MSM_7(eph, {}, {}, {}, 302400.0, observables, 1234, 0, 0, 0, false, false);
+            benchmark::DoNotOptimize(msg.data());
+        }
+    state.SetItemsProcessed(state.iterations());
+    // Messages are generated at 1 Hz
+    state.counters["realtime_factor"] = benchmark::Counter(1.0, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+
+void bm_read_MT1019(benchmark::State& state)
+{
+    Rtcm rtcm;
+    const std::string msg = rtcm.print_MT1019(sample_gps_ephemeris());
+    Gps_Ephemeris eph;
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(rtcm.read_MT1019(msg, eph));
+        }
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+void bm_read_MT1045(benchmark::State& state)
+{
+    Rtcm rtcm;
+    const std::string msg = rtcm.print_MT1045(sample_galileo_ephemeris());
+    Galileo_Ephemeris eph;
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(rtcm.read_MT1045(msg, eph));
+        }
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+// A MT1019 data field layout assembled and decoded with strings of '0' and
+// '1' characters, as in previous releases, and with the bit writer
+BENCHMARK(bm_string_assembly);
+BENCHMARK(bm_bit_writer_assembly);
+BENCHMARK(bm_string_decoding);
+BENCHMARK(bm_print_MT1019);
+BENCHMARK(bm_print_MT1045);
+// Argument: number of dual-frequency satellites in view
+BENCHMARK(bm_print_MSM_7)->Arg(8)->Arg(12);
+BENCHMARK(bm_read_MT1019);
+BENCHMARK(bm_read_MT1045);
+BENCHMARK_MAIN();
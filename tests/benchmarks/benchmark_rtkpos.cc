@@ -0,0 +1,228 @@
+/*!
+ * \file benchmark_rtkpos.cc
+ * \brief Benchmark for the computation of an epoch of the RTKLIB positioning
+ * engine, in RTK and PPP modes
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * The RTKLIB debug traces are compiled out in release builds. Adding
+ * -DRTKLIB_TRACE_LEVEL=5 to CMAKE_CXX_FLAGS measures the cost of the traces
+ * when they are compiled in but disabled at run time.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "MATH_CONSTANTS.h"
+#include "rtklib_ephemeris.h"
+#include "rtklib_rtkcmn.h"
+#include "rtklib_rtkpos.h"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <vector>
+
+namespace
+{
+constexpr int EPOCHS = 600;  // 10 minutes at 1 Hz
+
+// Observations of a static rover, and of a static base at 1 km, of a GPS
+// constellation of six orbital planes, simulated from the broadcast orbits
+struct Scenario
+{
+    Scenario()
+    {
+        const gtime_t toe = gpst2time(2200, 345600.0);
+        for (int plane = 0; plane < 6; plane++)
+            {
+                for (int slot = 0; slot < 5; slot++)
+                    {
+                        eph_t eph{};
+                        eph.sat = satno(SYS_GPS, plane * 5 + slot + 1);
+                        eph.iode = 1;
+                        eph.toe = toe;
+                        eph.toc = toe;
+                        eph.toes = 345600.0;
+                        eph.A = 26559700.0;
+                        eph.e = 0.01;
+                        eph.i0 = 55.0 * D2R;
+                        eph.OMG0 = 60.0 * D2R * plane;
+                        eph.M0 = (72.0 * slot + 15.0 * plane) * D2R;
+                        eph.OMGd = -8e-9;
+                        eph.f0 = 1e-5 * (slot - 2);
+                        ephs.push_back(eph);
+                        nav.lam[eph.sat - 1][0] = SPEED_OF_LIGHT_M_S / FREQ1;
+                        nav.lam[eph.sat - 1][1] = SPEED_OF_LIGHT_M_S / FREQ2;
+                        nav.lam[eph.sat - 1][2] = SPEED_OF_LIGHT_M_S / FREQ5;
+                    }
+            }
+        nav.eph = ephs.data();
+        nav.n = static_cast<int>(ephs.size());
+
+        const std::array<double, 3> pos{41.27 * D2R, 1.99 * D2R, 50.0};
+        const std::array<double, 3> baseline_enu{1000.0, 0.0, 0.0};
+        std::array<double, 3> baseline{};
+        pos2ecef(pos.data(), rover.data());
+        enu2ecef(pos.data(), baseline_enu.data(), baseline.data());
+        for (int i = 0; i < 3; i++)
+            {
+                base[i] = rover[i] + baseline[i];
+            }
+
+        for (int k = 0; k < EPOCHS; k++)
+            {
+                const gtime_t time = timeadd(toe, 600.0 + k);
+                std::vector<obsd_t> obs;
+                simulate(time, rover.data(), 1, obs);
+                const auto rover_obs = obs.size();
+                simulate(time, base.data(), 2, obs);
+                rtk_epochs.push_back(obs);
+                obs.resize(rover_obs);
+                ppp_epochs.push_back(obs);
+            }
+    }
+
+    // Code and phase observations of the satellites above 15 degrees
+    void simulate(gtime_t time, const double* rr, int rcv, std::vector<obsd_t>& obs) const
+    {
+        std::array<double, 3> pos{};
+        ecef2pos(rr, pos.data());
+        for (const auto& eph : ephs)
+            {
+                std::array<double, 3> rs{};
+                std::array<double, 3> e{};
+                std::array<double, 2> azel{};
+                double dts = 0.0;
+                double var = 0.0;
+                double range = 0.0;
+                double tau = 0.075;
+                for (int iter = 0; iter < 3; iter++)
+                    {
+                        eph2pos(timeadd(time, -tau), &eph, rs.data(), &dts, &var);
+                        range = geodist(rs.data(), rr, e.data());
+                        tau = range / SPEED_OF_LIGHT_M_S;
+                    }
+                if (satazel(pos.data(), e.data(), azel.data()) < 15.0 * D2R)
+                    {
+                        continue;
+                    }
+                const double rho = range - SPEED_OF_LIGHT_M_S * dts + tropmodel(time, pos.data(), azel.data(), 0.7);
+                obsd_t o{};
+                o.time = time;
+                o.sat = eph.sat;
+                o.rcv = rcv;
+                o.SNR[0] = 45 * 4;
+                o.code[0] = CODE_L1C;
+                o.P[0] = rho;
+                o.L[0] = rho / (SPEED_OF_LIGHT_M_S / FREQ1) + 1000.0 * eph.sat + 37.0 * rcv;
+                obs.push_back(o);
+            }
+    }
+
+    prcopt_t options(int mode) const
+    {
+        prcopt_t opt{};
+        opt.mode = mode;
+        opt.nf = 1;
+        opt.navsys = SYS_GPS;
+        opt.elmin = 15.0 * D2R;
+        opt.modear = mode == PMODE_KINEMA ? 1 : 0;
+        opt.maxout = 5;
+        opt.minfix = 10;
+        opt.armaxiter = 1;
+        opt.tropopt = TROPOPT_SAAS;
+        opt.niter = 1;
+        opt.eratio[0] = 100.0;
+        opt.err[0] = 100.0;
+        opt.err[1] = 0.003;
+        opt.err[2] = 0.003;
+        opt.err[4] = 1.0;
+        opt.std[0] = 30.0;
+        opt.std[1] = 0.03;
+        opt.std[2] = 0.3;
+        opt.prn[0] = 1e-4;
+        opt.prn[1] = 1e-3;
+        opt.prn[2] = 1e-4;
+        opt.prn[3] = 1e-1;
+        opt.prn[4] = 1e-2;
+        opt.sclkstab = 5e-12;
+        opt.thresar[0] = 3.0;
+        opt.thresar[1] = 0.9999;
+        opt.thresar[2] = 0.25;
+        opt.thresar[3] = 0.1;
+        opt.thresar[4] = 0.05;
+        opt.thresslip = 0.05;
+        opt.maxtdiff = 30.0;
+        opt.maxinno = 30.0;
+        opt.maxgdop = 30.0;
+        for (int i = 0; i < 3; i++)
+            {
+                opt.rb[i] = base[i];
+            }
+        opt.bancroft_init = true;
+        return opt;
+    }
+
+    std::vector<eph_t> ephs;
+    nav_t nav{};
+    std::array<double, 3> rover{};
+    std::array<double, 3> base{};
+    std::vector<std::vector<obsd_t>> rtk_epochs;
+    std::vector<std::vector<obsd_t>> ppp_epochs;
+};
+
+
+// Processes the epochs in order, starting again from the first one with a
+// new filter when they run out
+void run(benchmark::State& state, int mode)
+{
+    Scenario scenario;
+    const prcopt_t opt = scenario.options(mode);
+    auto& epochs = mode == PMODE_KINEMA ? scenario.rtk_epochs : scenario.ppp_epochs;
+    rtk_t rtk;
+    rtkinit(&rtk, &opt);
+    size_t k = 0;
+    int64_t solutions = 0;
+    while (state.KeepRunning())
+        {
+            if (k == epochs.size())
+                {
+                    state.PauseTiming();
+                    rtkfree(&rtk);
+                    rtkinit(&rtk, &opt);
+                    k = 0;
+                    state.ResumeTiming();
+                }
+            rtkpos(&rtk, epochs[k].data(), static_cast<int>(epochs[k].size()), &scenario.nav);
+            solutions += rtk.sol.stat != SOLQ_NONE;
+            k++;
+        }
+    rtkfree(&rtk);
+    state.SetItemsProcessed(state.iterations());
+    state.counters["solved"] = static_cast<double>(solutions) / static_cast<double>(state.iterations());
+    state.counters["trace_level"] = RTKLIB_TRACE_LEVEL;
+}
+
+
+void bm_rtkpos_rtk(benchmark::State& state)
+{
+    run(state, PMODE_KINEMA);
+}
+
+
+void bm_rtkpos_ppp(benchmark::State& state)
+{
+    run(state, PMODE_PPP_KINEMA);
+}
+}  // namespace
+
+
+BENCHMARK(bm_rtkpos_rtk);
+BENCHMARK(bm_rtkpos_ppp);
+
+BENCHMARK_MAIN();
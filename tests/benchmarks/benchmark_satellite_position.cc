@@ -0,0 +1,144 @@
+/*!
+ * \file benchmark_satellite_position.cc
+ * \brief Benchmark for the computation of satellite positions, velocities and
+ * clocks from broadcast ephemerides at a high solution rate, with and without
+ * the orbit and clock evaluation cache
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtklib_ephemeris.h"
+#include "rtklib_orbit_cache.h"
+#include "rtklib_rtkcmn.h"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <vector>
+
+namespace
+{
+// Broadcast ephemerides of a constellation in view: num_sats satellites with
+// Keplerian orbits, each with several ephemerides along the day, and four
+// GLONASS satellites
+struct Constellation
+{
+    explicit Constellation(int num_sats)
+    {
+        const gtime_t toe = gpst2time(2200, 345600.0);
+        for (int iode = 0; iode < 4; iode++)
+            {
+                for (int prn = 1; prn <= num_sats; prn++)
+                    {
+                        eph_t eph{};
+                        eph.sat = satno(prn % 2 ? SYS_GPS : SYS_GAL, prn);
+                        eph.iode = iode;
+                        eph.toe = timeadd(toe, 7200.0 * (iode - 1));
+                        eph.toc = eph.toe;
+                        eph.toes = time2gpst(eph.toe, nullptr);
+                        eph.A = prn % 2 ? 26559700.0 : 29600000.0;
+                        eph.e = 0.001 * prn;
+                        eph.i0 = 0.96;
+                        eph.OMG0 = 0.4 * prn;
+                        eph.omg = 0.5;
+                        eph.M0 = 0.7 * prn;
+                        eph.deln = 4.5e-9;
+                        eph.OMGd = -8e-9;
+                        eph.crc = 200.0;
+                        eph.crs = -50.0;
+                        eph.f0 = 1e-4;
+                        eph.f1 = 1e-11;
+                        ephs.push_back(eph);
+                    }
+            }
+        for (int prn = 1; prn <= 4; prn++)
+            {
+                geph_t geph{};
+                geph.sat = satno(SYS_GLO, prn);
+                geph.iode = 45;
+                geph.toe = toe;
+                geph.pos[0] = 25510000.0;
+                geph.vel[1] = 1688.0 - 7.292115e-5 * 25510000.0;
+                geph.vel[2] = 3578.0 + prn;
+                geph.taun = -2e-5;
+                gephs.push_back(geph);
+            }
+        nav.eph = ephs.data();
+        nav.n = static_cast<int>(ephs.size());
+        nav.geph = gephs.data();
+        nav.ng = static_cast<int>(gephs.size());
+        for (const auto& eph : ephs)
+            {
+                sats.push_back(eph.sat);
+            }
+        sats.resize(num_sats);
+        for (const auto& geph : gephs)
+            {
+                sats.push_back(geph.sat);
+            }
+    }
+
+    std::vector<eph_t> ephs;
+    std::vector<geph_t> gephs;
+    std::vector<int> sats;
+    nav_t nav{};
+};
+
+
+// Positions, velocities and clocks of all the satellites of a 20 Hz epoch
+void epoch(Constellation& constellation, int k)
+{
+    const gtime_t time = timeadd(gpst2time(2200, 345600.0), 0.05 * k);
+    std::array<double, 6> rs{};
+    std::array<double, 2> dts{};
+    double var;
+    int svh;
+    for (int sat : constellation.sats)
+        {
+            ephpos(time, time, sat, &constellation.nav, -1, rs.data(), dts.data(), &var, &svh);
+            benchmark::DoNotOptimize(rs.data());
+        }
+}
+
+
+void bm_satellite_position_direct(benchmark::State& state)
+{
+    Constellation constellation(static_cast<int>(state.range(0)));
+    int k = 0;
+    while (state.KeepRunning())
+        {
+            epoch(constellation, k++);
+        }
+    state.SetItemsProcessed(state.iterations() * constellation.sats.size());
+}
+
+
+void bm_satellite_position_cache(benchmark::State& state)
+{
+    Constellation constellation(static_cast<int>(state.range(0)));
+    Rtklib_Orbit_Cache cache;
+    constellation.nav.orbits = &cache;
+    cache.index(&constellation.nav);
+    int k = 0;
+    while (state.KeepRunning())
+        {
+            epoch(constellation, k++);
+        }
+    state.SetItemsProcessed(state.iterations() * constellation.sats.size());
+    state.counters["evaluations"] = static_cast<double>(cache.evaluations());
+}
+}  // namespace
+
+
+BENCHMARK(bm_satellite_position_direct)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(bm_satellite_position_cache)->Arg(8)->Arg(16)->Arg(32);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,197 @@
+/*!
+ * \file benchmark_signal_pool.cc
+ * \brief Benchmark for the selection of the next signal to acquire, in a
+ * receiver with 200 channels and four constellations.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_signal_pool.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int32_t CHANNELS = 200;
+constexpr int32_t EVENTS = 10000;
+
+struct Band
+{
+    std::string system;
+    std::string signal;
+    uint32_t n_prns;
+    int32_t primary;  // index of the band used to assist it, or -1
+};
+
+const std::array<Band, 8> BANDS{{{"GPS", "1C", 32, -1},
+    {"GPS", "L5", 32, 0},
+    {"Galileo", "1B", 36, -1},
+    {"Galileo", "5X", 36, 2},
+    {"Glonass", "1G", 24, -1},
+    {"Glonass", "2G", 24, 4},
+    {"Beidou", "B1", 63, -1},
+    {"Beidou", "B3", 63, 6}}};
+
+
+// Available signals stored as before, in one std::list per band
+struct List_Pools
+{
+    std::array<std::list<Gnss_Signal>, 8> pools;
+
+    Gnss_Signal search(size_t band, const std::vector<uint32_t>& tracked_primary)
+    {
+        auto& pool = pools[band];
+        if (BANDS[band].primary >= 0)
+            {
+                for (const auto prn : tracked_primary)
+                    {
+                        auto it = std::find_if(pool.begin(), pool.end(),
+                            [&](const Gnss_Signal& sig) { return sig.get_satellite().get_PRN() == prn; });
+                        if (it != pool.end())
+                            {
+                                Gnss_Signal result = *it;
+                                pool.erase(it);
+                                return result;
+                            }
+                    }
+            }
+        Gnss_Signal result = pool.front();
+        pool.pop_front();
+        pool.push_back(result);
+        return result;
+    }
+
+    void push_back(size_t band, const Gnss_Signal& gs)
+    {
+        pools[band].remove(gs);
+        pools[band].push_back(gs);
+    }
+
+    void remove(size_t band, const Gnss_Signal& gs)
+    {
+        pools[band].remove(gs);
+    }
+};
+
+
+struct Indexed_Pools
+{
+    std::array<Gnss_Signal_Pool, 8> pools;
+
+    Gnss_Signal search(size_t band, const std::vector<uint32_t>& tracked_primary)
+    {
+        auto& pool = pools[band];
+        Gnss_Signal result;
+        if (BANDS[band].primary >= 0)
+            {
+                for (const auto prn : tracked_primary)
+                    {
+                        if (pool.take(prn, result))
+                            {
+                                return result;
+                            }
+                    }
+            }
+        return pool.rotate();
+    }
+
+    void push_back(size_t band, const Gnss_Signal& gs)
+    {
+        pools[band].push_back(gs);
+    }
+
+    void remove(size_t band, const Gnss_Signal& gs)
+    {
+        pools[band].remove(gs);
+    }
+};
+
+
+// Channels acquire signals of their band. Failed acquisitions put the signal
+// back in the pool, successful ones keep it until the channel loses lock.
+template <typename Pools>
+void run_acquisitions(benchmark::State& state)
+{
+    for (auto _ : state)
+        {
+            state.PauseTiming();
+            Pools pools;
+            for (size_t b = 0; b < BANDS.size(); b++)
+                {
+                    for (uint32_t prn = 1; prn <= BANDS[b].n_prns; prn++)
+                        {
+                            pools.pools[b].emplace_back(Gnss_Satellite(BANDS[b].system, prn), BANDS[b].signal);
+                        }
+                }
+            std::vector<Gnss_Signal> channel_signal(CHANNELS);
+            std::vector<bool> tracking(CHANNELS, false);
+            std::array<std::vector<uint32_t>, 8> tracked;
+            std::mt19937 gen(1234);
+            std::uniform_int_distribution<int32_t> channel_dist(0, CHANNELS - 1);
+            std::uniform_int_distribution<int32_t> outcome_dist(0, 9);
+            state.ResumeTiming();
+
+            for (int32_t e = 0; e < EVENTS; e++)
+                {
+                    const int32_t ch = channel_dist(gen);
+                    const size_t band = ch % BANDS.size();
+                    if (tracking[ch])
+                        {
+                            // loss of lock: search again
+                            tracking[ch] = false;
+                            auto& t = tracked[band];
+                            t.erase(std::remove(t.begin(), t.end(), channel_signal[ch].get_satellite().get_PRN()), t.end());
+                            pools.push_back(band, channel_signal[ch]);
+                        }
+                    const auto& primary = BANDS[band].primary >= 0 ? tracked[BANDS[band].primary] : tracked[band];
+                    channel_signal[ch] = pools.search(band, primary);
+                    if (outcome_dist(gen) < 3)
+                        {
+                            tracking[ch] = true;
+                            tracked[band].push_back(channel_signal[ch].get_satellite().get_PRN());
+                            pools.remove(band, channel_signal[ch]);
+                        }
+                    else
+                        {
+                            pools.push_back(band, channel_signal[ch]);
+                        }
+                }
+            benchmark::DoNotOptimize(channel_signal.data());
+        }
+    state.SetItemsProcessed(state.iterations() * EVENTS);
+}
+
+
+void bm_signal_list(benchmark::State& state)
+{
+    run_acquisitions<List_Pools>(state);
+}
+
+
+void bm_signal_pool(benchmark::State& state)
+{
+    run_acquisitions<Indexed_Pools>(state);
+}
+}  // namespace
+
+
+BENCHMARK(bm_signal_list);
+BENCHMARK(bm_signal_pool);
+
+BENCHMARK_MAIN();
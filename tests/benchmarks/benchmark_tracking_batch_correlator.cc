@@ -0,0 +1,179 @@
+/*!
+ * \file benchmark_tracking_batch_correlator.cc
+ * \brief Benchmark for the correlation step of several tracking channels
+ * reading from the same input buffer, with a correlator per channel and with
+ * the batch correlator shared by the channels
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "GPS_L1_CA.h"
+#include "cpu_multicorrelator_real_codes.h"
+#include "gps_sdr_signal_replica.h"
+#include "tracking_batch_correlator.h"
+#include <benchmark/benchmark.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <algorithm>
+#include <atomic>
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr int32_t SAMPLES = 4000;  // 1 ms of GPS L1 C/A at 4 MSps
+constexpr int32_t TAPS = 3;        // Early, Prompt and Late
+constexpr int32_t MAX_CHANNELS = 32;
+
+// Correlation requests of MAX_CHANNELS GPS L1 C/A channels, reading from
+// different offsets of the same buffer, as the tracking blocks connected to
+// the same signal conditioner do
+struct Channels
+{
+    Channels()
+        : input(SAMPLES + 50 * MAX_CHANNELS),
+          shifts_chips{-0.5, 0.0, 0.5},
+          outs(MAX_CHANNELS, volk_gnsssdr::vector<gr_complex>(TAPS)),
+          correlators(MAX_CHANNELS)
+    {
+        std::random_device rd;
+        std::default_random_engine e2(rd());
+        std::uniform_real_distribution<float> dist(-1.0, 1.0);
+        std::generate(input.begin(), input.end(), [&]() { return gr_complex(dist(e2), dist(e2)); });
+        for (int32_t ch = 0; ch < MAX_CHANNELS; ch++)
+            {
+                codes.emplace_back(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS));
+                gps_l1_ca_code_gen_float(codes.back(), ch + 1, 0);
+                Tracking_Batch_Request r;
+                r.sig_in = &input[ch * 50];
+                r.corr_out = outs[ch].data();
+                r.local_code = codes[ch].data();
+                r.shifts_chips = shifts_chips.data();
+                r.rem_carrier_phase_rad = 0.1F * static_cast<float>(ch);
+                r.phase_step_rad = 0.001F * static_cast<float>(ch - MAX_CHANNELS / 2);
+                r.rem_code_phase_chips = 0.01F * static_cast<float>(ch);
+                r.code_phase_step_chips = static_cast<float>(GPS_L1_CA_CODE_RATE_CPS / 4e6);
+                r.code_length_chips = static_cast<int32_t>(GPS_L1_CA_CODE_LENGTH_CHIPS);
+                r.n_correlators = TAPS;
+                r.n_samples = SAMPLES;
+                requests.push_back(r);
+                correlators[ch].set_high_dynamics_resampler(false);
+                correlators[ch].init(SAMPLES, TAPS);
+                correlators[ch].set_local_code_and_taps(r.code_length_chips, r.local_code, shifts_chips.data());
+                correlators[ch].set_input_output_vectors(r.corr_out, r.sig_in);
+            }
+    }
+
+    ~Channels()
+    {
+        for (auto& correlator : correlators)
+            {
+                correlator.free();
+            }
+    }
+
+    // Correlation step of channel ch with its own correlator
+    void correlate(int32_t ch)
+    {
+        const Tracking_Batch_Request& r = requests[ch];
+        correlators[ch].Carrier_wipeoff_multicorrelator_resampler(r.rem_carrier_phase_rad, r.phase_step_rad, r.rem_code_phase_chips, r.code_phase_step_chips, 0.0, r.n_samples);
+    }
+
+    volk_gnsssdr::vector<gr_complex> input;
+    volk_gnsssdr::vector<float> shifts_chips;
+    std::vector<volk_gnsssdr::vector<float>> codes;
+    std::vector<volk_gnsssdr::vector<gr_complex>> outs;
+    std::vector<Tracking_Batch_Request> requests;
+    std::vector<Cpu_Multicorrelator_Real_Codes> correlators;
+};
+
+
+Channels& channels()
+{
+    static Channels c;
+    return c;
+}
+
+
+// One thread correlating the channels one after the other
+void bm_per_channel_correlators(benchmark::State& state)
+{
+    Channels& c = channels();
+    const auto n = static_cast<int32_t>(state.range(0));
+    while (state.KeepRunning())
+        {
+            for (int32_t ch = 0; ch < n; ch++)
+                {
+                    c.correlate(ch);
+                }
+        }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+
+// One thread correlating all the channels in a single pass
+void bm_batch_correlator(benchmark::State& state)
+{
+    Channels& c = channels();
+    const auto n = static_cast<size_t>(state.range(0));
+    std::vector<const Tracking_Batch_Request*> batch;
+    for (size_t ch = 0; ch < n; ch++)
+        {
+            batch.push_back(&c.requests[ch]);
+        }
+    while (state.KeepRunning())
+        {
+            Tracking_Batch_Correlator::correlate_batch(batch.data(), n);
+        }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+
+// One thread per channel, as the tracking blocks run, each with its own correlator
+void bm_per_channel_correlators_threads(benchmark::State& state)
+{
+    static std::atomic<int32_t> next_channel{0};
+    Channels& c = channels();
+    const int32_t ch = next_channel++ % MAX_CHANNELS;
+    while (state.KeepRunning())
+        {
+            c.correlate(ch);
+        }
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+// One thread per channel, sharing the batch correlator
+void bm_batch_correlator_threads(benchmark::State& state)
+{
+    static std::atomic<int32_t> next_channel{0};
+    Channels& c = channels();
+    const int32_t ch = next_channel++ % MAX_CHANNELS;
+    auto engine = Tracking_Batch_Correlator::get_instance("BENCHMARK", MAX_CHANNELS);
+    while (state.KeepRunning())
+        {
+            engine->correlate(c.requests[ch]);
+        }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["batch_size"] = benchmark::Counter(static_cast<double>(engine->max_batch_size()), benchmark::Counter::kAvgThreads);
+}
+}  // namespace
+
+
+BENCHMARK(bm_per_channel_correlators)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(bm_batch_correlator)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(bm_per_channel_correlators_threads)->Threads(8)->Threads(16)->UseRealTime();
+BENCHMARK(bm_batch_correlator_threads)->Threads(8)->Threads(16)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,162 @@
+/*!
+ * \file benchmark_viterbi.cc
+ * \brief Benchmark for the Viterbi decoding of Galileo navigation message
+ * pages.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "viterbi_decoder.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr int32_t KK = 7;
+constexpr int32_t MM = KK - 1;
+constexpr int32_t STATES = 1 << MM;
+const std::array<int32_t, 2> G_ENCODER{{121, 91}};
+
+std::vector<float> random_symbols(int32_t data_length)
+{
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> dist(0.0, 1.0);
+    std::vector<float> symbols(2 * (data_length + MM));
+    std::generate(symbols.begin(), symbols.end(), [&]() { return dist(gen); });
+    return symbols;
+}
+
+
+int32_t parity(int32_t x)
+{
+    int32_t p = 0;
+    for (; x != 0; x >>= 1)
+        {
+            p ^= x & 1;
+        }
+    return p;
+}
+
+
+// Trellis walked one state at a time, with indexed next state lookups and a
+// 32-bit survivor state and bit per state and step
+class State_By_State_Viterbi
+{
+public:
+    explicit State_By_State_Viterbi(int32_t data_length)
+        : prev_section(STATES, -1e7),
+          next_section(STATES, -1e7),
+          prev_state(STATES * (data_length + MM)),
+          prev_bit(STATES * (data_length + MM)),
+          LL(data_length)
+    {
+        for (int32_t input = 0; input < 2; input++)
+            {
+                for (int32_t state = 0; state < STATES; state++)
+                    {
+                        const int32_t word = (input << MM) ^ state;
+                        out[input][state] = (parity(word & G_ENCODER[0]) << 1) + parity(word & G_ENCODER[1]);
+                        next_state[input][state] = word >> 1;
+                    }
+            }
+    }
+
+    void decode(std::vector<int32_t>& output, const std::vector<float>& input)
+    {
+        prev_section[0] = 0.0;
+        for (int32_t t = 0; t < LL + MM; t++)
+            {
+                const std::array<float, 4> metric_c{0.0F, input[2 * t + 1], input[2 * t], input[2 * t + 1] + input[2 * t]};
+                for (int32_t state = 0; state < STATES; state++)
+                    {
+                        for (int32_t bit = 0; bit < 2; bit++)
+                            {
+                                const float metric = prev_section[state] + metric_c[out[bit][state]];
+                                const int32_t ns = next_state[bit][state];
+                                if (metric > next_section[ns])
+                                    {
+                                        next_section[ns] = metric;
+                                        prev_state[t * STATES + ns] = state;
+                                        prev_bit[t * STATES + ns] = bit;
+                                    }
+                            }
+                    }
+                const float max_val = *std::max_element(next_section.begin(), next_section.end());
+                for (int32_t state = 0; state < STATES; state++)
+                    {
+                        prev_section[state] = next_section[state] - max_val;
+                        next_section[state] = -1e7;
+                    }
+            }
+        int32_t state = 0;
+        for (int32_t t = LL + MM - 1; t >= LL; t--)
+            {
+                state = prev_state[t * STATES + state];
+            }
+        for (int32_t t = LL - 1; t >= 0; t--)
+            {
+                output[t] = prev_bit[t * STATES + state];
+                state = prev_state[t * STATES + state];
+            }
+    }
+
+private:
+    std::array<std::array<int32_t, STATES>, 2> out{};
+    std::array<std::array<int32_t, STATES>, 2> next_state{};
+    std::vector<float> prev_section;
+    std::vector<float> next_section;
+    std::vector<int32_t> prev_state;
+    std::vector<int32_t> prev_bit;
+    int32_t LL;
+};
+}  // namespace
+
+
+void bm_viterbi_state_by_state(benchmark::State& state)
+{
+    const auto data_length = static_cast<int32_t>(state.range(0));
+    const std::vector<float> symbols = random_symbols(data_length);
+    std::vector<int32_t> bits(data_length);
+    State_By_State_Viterbi decoder(data_length);
+    while (state.KeepRunning())
+        {
+            decoder.decode(bits, symbols);
+            benchmark::DoNotOptimize(bits.data());
+        }
+    state.SetItemsProcessed(state.iterations() * data_length);
+}
+
+
+void bm_viterbi_decoder(benchmark::State& state)
+{
+    const auto data_length = static_cast<int32_t>(state.range(0));
+    const std::vector<float> symbols = random_symbols(data_length);
+    std::vector<int32_t> bits(data_length);
+    Viterbi_Decoder decoder(KK, 2, data_length, G_ENCODER);
+    while (state.KeepRunning())
+        {
+            decoder.decode(bits, symbols);
+            benchmark::DoNotOptimize(bits.data());
+        }
+    state.SetItemsProcessed(state.iterations() * data_length);
+}
+
+
+// Argument: decoded bits per page (Galileo I/NAV page part, F/NAV page)
+BENCHMARK(bm_viterbi_state_by_state)->Arg(114)->Arg(238);
+BENCHMARK(bm_viterbi_decoder)->Arg(114)->Arg(238);
+BENCHMARK_MAIN();
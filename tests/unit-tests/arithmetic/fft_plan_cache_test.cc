@@ -0,0 +1,90 @@
+/*!
+ * \file fft_plan_cache_test.cc
+ * \brief Tests for the process-wide cache of FFT plans.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_fft_cache.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <complex>
+
+
+TEST(FFTPlanCacheTest, ReusesReleasedPlans)
+{
+    auto& cache = Gnss_Fft_Cache::instance();
+    cache.clear();
+    const uint64_t misses = cache.misses();
+    const uint64_t hits = cache.hits();
+
+    const gnss_fft_complex_fwd* first = nullptr;
+    {
+        auto fft = gnss_fft_fwd_make_cached(1000);
+        first = fft.get();
+    }
+    EXPECT_EQ(cache.idle_plans(), 1U);
+
+    auto fwd = gnss_fft_fwd_make_cached(1000);
+    auto rev = gnss_fft_rev_make_cached(1000);
+    auto other = gnss_fft_fwd_make_cached(2000);
+    EXPECT_EQ(fwd.get(), first);
+    EXPECT_EQ(cache.idle_plans(), 0U);
+    EXPECT_EQ(cache.hits() - hits, 1U);
+    EXPECT_EQ(cache.misses() - misses, 3U);
+
+    // A reused plan still computes the right transform
+    std::fill_n(fwd->get_inbuf(), 1000, std::complex<float>(0.0, 0.0));
+    fwd->get_inbuf()[0] = std::complex<float>(1.0, 0.0);
+    fwd->execute();
+    for (int i = 0; i < 1000; i++)
+        {
+            EXPECT_NEAR(std::abs(fwd->get_outbuf()[i] - std::complex<float>(1.0, 0.0)), 0.0, 1e-6);
+        }
+
+    fwd.reset();
+    rev.reset();
+    other.reset();
+    EXPECT_EQ(cache.idle_plans(), 3U);
+    cache.clear();
+    EXPECT_EQ(cache.idle_plans(), 0U);
+}
+
+
+TEST(FFTPlanCacheTest, CapsIdlePlans)
+{
+    auto& cache = Gnss_Fft_Cache::instance();
+    cache.clear();
+    const size_t max_idle_plans = cache.max_idle_plans();
+    const uint64_t evictions = cache.evictions();
+
+    cache.set_max_idle_plans(2);
+    {
+        auto a = gnss_fft_fwd_make_cached(1000);
+        auto b = gnss_fft_fwd_make_cached(1000);
+        auto c = gnss_fft_rev_make_cached(1000);
+    }
+    EXPECT_EQ(cache.idle_plans(), 2U);
+    EXPECT_EQ(cache.evictions() - evictions, 1U);
+
+    // Lowering the maximum destroys the plans above it
+    cache.set_max_idle_plans(1);
+    EXPECT_EQ(cache.idle_plans(), 1U);
+
+    // Clearing the cache does not change the maximum
+    cache.clear();
+    EXPECT_EQ(cache.idle_plans(), 0U);
+    EXPECT_EQ(cache.max_idle_plans(), 1U);
+
+    cache.set_max_idle_plans(max_idle_plans);
+}
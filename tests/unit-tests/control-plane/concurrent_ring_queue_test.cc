@@ -0,0 +1,88 @@
+/*!
+ * \file concurrent_ring_queue_test.cc
+ * \brief Tests for the bounded lock-free queue.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "concurrent_ring_queue.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+TEST(ConcurrentRingQueueTest, SingleThread)
+{
+    Concurrent_Ring_Queue<std::string> queue(3);
+    EXPECT_EQ(queue.capacity(), 4U);
+    EXPECT_TRUE(queue.empty());
+
+    std::string s;
+    EXPECT_FALSE(queue.try_pop(s));
+    EXPECT_FALSE(queue.timed_wait_and_pop(s, 1));
+
+    for (int i = 0; i < 4; i++)
+        {
+            EXPECT_TRUE(queue.try_push(std::to_string(i)));
+        }
+    std::string rejected("4");
+    EXPECT_FALSE(queue.try_push(std::move(rejected)));
+    EXPECT_EQ(rejected, "4");
+    EXPECT_EQ(queue.size(), 4U);
+
+    // FIFO order, also after wrapping around the ring
+    for (int i = 0; i < 10; i++)
+        {
+            queue.wait_and_pop(s);
+            EXPECT_EQ(s, std::to_string(i));
+            queue.push(std::to_string(i + 4));
+        }
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+}
+
+
+TEST(ConcurrentRingQueueTest, MultipleProducers)
+{
+    const int producers = 4;
+    const int messages = 20000;
+    Concurrent_Ring_Queue<int> queue(64);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++)
+        {
+            threads.emplace_back([&queue, p]() {
+                for (int i = 0; i < messages; i++)
+                    {
+                        queue.push(p * messages + i);
+                    }
+            });
+        }
+
+    // Messages from each producer arrive in order, and none is lost
+    std::vector<int> last(producers, -1);
+    int value;
+    for (int i = 0; i < producers * messages; i++)
+        {
+            ASSERT_TRUE(queue.timed_wait_and_pop(value, 10000));
+            const int p = value / messages;
+            EXPECT_GT(value % messages, last[p]);
+            last[p] = value % messages;
+        }
+    for (auto& t : threads)
+        {
+            t.join();
+        }
+    EXPECT_FALSE(queue.try_pop(value));
+}
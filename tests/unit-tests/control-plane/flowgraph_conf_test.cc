@@ -0,0 +1,46 @@
+/*!
+ * \file flowgraph_conf_test.cc
+ * \brief Tests for the configuration parameters read by the flowgraph.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "flowgraph_conf.h"
+#include "in_memory_configuration.h"
+#include <gtest/gtest.h>
+#include <memory>
+
+
+TEST(FlowgraphConfTest, ReadsChannelSatellites)
+{
+    auto configuration = std::make_shared<InMemoryConfiguration>();
+    configuration->set_property("Channels_1C.count", "3");
+    configuration->set_property("Channels_5X.count", "1");
+    configuration->set_property("Channel1.satellite", "11");
+    configuration->set_property("Channel3.satellite", "not_a_number");
+
+    Flowgraph_Conf conf;
+    conf.SetFromConfiguration(configuration.get(), 4, true);
+    ASSERT_EQ(conf.channel_satellite.size(), 4U);
+    EXPECT_EQ(conf.channel_satellite[0], 0U);
+    EXPECT_EQ(conf.channel_satellite[1], 11U);
+    EXPECT_EQ(conf.channel_satellite[2], 0U);
+    EXPECT_EQ(conf.channel_satellite[3], 0U);
+    EXPECT_TRUE(conf.assist_dual_frequency_acq);  // defaults to multiband
+    EXPECT_TRUE(conf.there_are_gps_l1_channels);
+    EXPECT_FALSE(conf.there_are_gal_e1_channels);
+
+    configuration->set_property("GNSS-SDR.assist_dual_frequency_acq", "false");
+    conf.SetFromConfiguration(configuration.get(), 4, true);
+    EXPECT_FALSE(conf.assist_dual_frequency_acq);
+}
@@ -0,0 +1,131 @@
+/*!
+ * \file gnss_signal_pool_test.cc
+ * \brief Tests for the pool of signals available for acquisition.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_signal_pool.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+
+TEST(GnssSignalPoolTest, SearchOrder)
+{
+    Gnss_Signal_Pool pool;
+    EXPECT_TRUE(pool.empty());
+    for (uint32_t prn = 1; prn <= 4; prn++)
+        {
+            pool.emplace_back(Gnss_Satellite(std::string("GPS"), prn), std::string("1C"));
+        }
+    EXPECT_EQ(pool.size(), 4U);
+    EXPECT_EQ(pool.rotate().get_satellite().get_PRN(), 1U);
+    EXPECT_EQ(pool.rotate().get_satellite().get_PRN(), 2U);
+    EXPECT_EQ(pool.front().get_satellite().get_PRN(), 3U);
+
+    Gnss_Signal taken;
+    EXPECT_TRUE(pool.take(4, taken));
+    EXPECT_EQ(taken.get_satellite().get_PRN(), 4U);
+    EXPECT_FALSE(pool.take(4, taken));
+    EXPECT_FALSE(pool.contains(4));
+    EXPECT_FALSE(pool.take(200, taken));
+
+    pool.push_front(taken);
+    EXPECT_EQ(pool.front().get_satellite().get_PRN(), 4U);
+    EXPECT_EQ(pool.size(), 4U);
+
+    const auto signals = pool.signals();
+    ASSERT_EQ(signals.size(), 4U);
+    const uint32_t expected[4] = {4, 3, 1, 2};
+    for (size_t i = 0; i < 4; i++)
+        {
+            EXPECT_EQ(signals[i].get_satellite().get_PRN(), expected[i]);
+        }
+}
+
+
+TEST(GnssSignalPoolTest, SameBehaviourAsList)
+{
+    // Random sequence of the operations done by the flowgraph, applied both to
+    // the pool and to a std::list as it was used before
+    Gnss_Signal_Pool pool;
+    std::list<Gnss_Signal> list;
+    for (uint32_t prn = 1; prn <= 36; prn++)
+        {
+            pool.emplace_back(Gnss_Satellite(std::string("Galileo"), prn), std::string("5X"));
+            list.emplace_back(Gnss_Satellite(std::string("Galileo"), prn), std::string("5X"));
+        }
+
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> op_dist(0, 4);
+    std::uniform_int_distribution<uint32_t> prn_dist(1, 36);
+    for (int i = 0; i < 10000; i++)
+        {
+            const Gnss_Signal gs(Gnss_Satellite(std::string("Galileo"), prn_dist(gen)), std::string("5X"));
+            switch (op_dist(gen))
+                {
+                case 0:
+                    if (!list.empty())
+                        {
+                            const Gnss_Signal result = list.front();
+                            list.pop_front();
+                            list.push_back(result);
+                            EXPECT_EQ(pool.rotate().get_satellite().get_PRN(), result.get_satellite().get_PRN());
+                        }
+                    break;
+                case 1:
+                    list.remove(gs);
+                    list.push_back(gs);
+                    pool.push_back(gs);
+                    break;
+                case 2:
+                    list.remove(gs);
+                    pool.remove(gs);
+                    break;
+                case 3:
+                    {
+                        const auto old_size = list.size();
+                        list.remove(gs);
+                        if (old_size > list.size())
+                            {
+                                list.push_front(gs);
+                            }
+                        if (pool.remove(gs))
+                            {
+                                pool.push_front(gs);
+                            }
+                    }
+                    break;
+                default:
+                    {
+                        Gnss_Signal taken;
+                        const auto old_size = list.size();
+                        list.remove(gs);
+                        EXPECT_EQ(pool.take(gs.get_satellite().get_PRN(), taken), old_size > list.size());
+                    }
+                }
+            ASSERT_EQ(pool.size(), list.size());
+        }
+
+    const auto signals = pool.signals();
+    auto it = list.cbegin();
+    for (const auto& signal : signals)
+        {
+            EXPECT_EQ(signal.get_satellite().get_PRN(), it->get_satellite().get_PRN());
+            ++it;
+        }
+}
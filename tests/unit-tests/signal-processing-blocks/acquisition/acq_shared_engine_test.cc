@@ -0,0 +1,123 @@
+/*!
+ * \file acq_shared_engine_test.cc
+ * \brief Tests for the Doppler search engine shared by acquisition channels.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acq_shared_engine.h"
+#include <gtest/gtest.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <algorithm>
+#include <complex>
+#include <random>
+#include <thread>
+#include <vector>
+
+
+TEST(AcqSharedEngineTest, SameInstanceForSameParameters)
+{
+    auto engine_a = Acq_Shared_Engine::get_instance("1C", 0, 4000000, 4000, 4000, 5000, 250, false);
+    auto engine_b = Acq_Shared_Engine::get_instance("1C", 0, 4000000, 4000, 4000, 5000, 250, false);
+    auto engine_c = Acq_Shared_Engine::get_instance("1B", 0, 4000000, 4000, 4000, 5000, 250, false);
+    // Same signal and parameters, but another front-end
+    auto engine_d = Acq_Shared_Engine::get_instance("1C", 1, 4000000, 4000, 4000, 5000, 250, false);
+    EXPECT_EQ(engine_a.get(), engine_b.get());
+    EXPECT_NE(engine_a.get(), engine_c.get());
+    EXPECT_NE(engine_a.get(), engine_d.get());
+    EXPECT_EQ(engine_a->num_doppler_bins(), 40U);
+}
+
+
+TEST(AcqSharedEngineTest, SnapshotReuse)
+{
+    const uint32_t fft_size = 1000;
+    Acq_Shared_Engine engine(1000000, fft_size, 5000, 500, true);
+    volk_gnsssdr::vector<gr_complex> input(fft_size, gr_complex(1.0, 0.0));
+
+    EXPECT_EQ(engine.latest_snapshot(0), nullptr);
+    auto snapshot = engine.publish(input.data(), 1000);
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_EQ(snapshot->sample_stamp, 1000ULL);
+    EXPECT_EQ(engine.latest_snapshot(1000).get(), snapshot.get());
+    EXPECT_EQ(engine.latest_snapshot(1001), nullptr);
+
+    // An older snapshot does not replace a newer one
+    EXPECT_EQ(engine.publish(input.data(), 500).get(), snapshot.get());
+    EXPECT_EQ(engine.published_snapshots(), 1ULL);
+    EXPECT_EQ(engine.reused_snapshots(), 2ULL);
+}
+
+
+TEST(AcqSharedEngineTest, ConcurrentPublish)
+{
+    const uint32_t fft_size = 4000;
+    Acq_Shared_Engine engine(4000000, fft_size, 5000, 250, false);
+    volk_gnsssdr::vector<gr_complex> input(fft_size, gr_complex(1.0, 0.0));
+    std::vector<std::shared_ptr<const Acq_Shared_Engine::Snapshot>> snapshots(8);
+    std::vector<std::thread> threads;
+    for (auto& snapshot : snapshots)
+        {
+            threads.emplace_back([&engine, &input, &snapshot]() { snapshot = engine.publish(input.data(), 4000); });
+        }
+    for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+    // The spectra are computed only once, and all the channels get them
+    EXPECT_EQ(engine.published_snapshots(), 1ULL);
+    EXPECT_EQ(engine.reused_snapshots(), 7ULL);
+    for (const auto& snapshot : snapshots)
+        {
+            EXPECT_EQ(snapshot.get(), snapshots[0].get());
+        }
+}
+
+
+TEST(AcqSharedEngineTest, FrequencyDomainMatchesTimeDomain)
+{
+    const int64_t fs = 1000000;
+    const uint32_t fft_size = 1000;
+    const int32_t doppler_max = 5000;
+    const uint32_t doppler_step = 250;
+    Acq_Shared_Engine time_engine(fs, fft_size, doppler_max, doppler_step, false);
+    Acq_Shared_Engine freq_engine(fs, fft_size, doppler_max, doppler_step, true);
+    ASSERT_EQ(time_engine.num_doppler_bins(), freq_engine.num_doppler_bins());
+
+    std::default_random_engine e2(1234);
+    std::uniform_real_distribution<float> dist(-1.0, 1.0);
+    volk_gnsssdr::vector<gr_complex> input(fft_size);
+    volk_gnsssdr::vector<gr_complex> fft_code(fft_size);
+    std::generate(input.begin(), input.end(), [&]() { return gr_complex(dist(e2), dist(e2)); });
+    std::generate(fft_code.begin(), fft_code.end(), [&]() { return gr_complex(dist(e2), dist(e2)); });
+
+    auto time_snapshot = time_engine.publish(input.data(), 1);
+    auto freq_snapshot = freq_engine.publish(input.data(), 1);
+
+    volk_gnsssdr::vector<gr_complex> time_out(fft_size);
+    volk_gnsssdr::vector<gr_complex> freq_out(fft_size);
+    for (uint32_t doppler_index = 0; doppler_index < time_engine.num_doppler_bins(); doppler_index++)
+        {
+            time_engine.multiply_code(*time_snapshot, doppler_index, fft_code.data(), time_out.data());
+            freq_engine.multiply_code(*freq_snapshot, doppler_index, fft_code.data(), freq_out.data());
+            float max_error = 0.0;
+            float max_value = 0.0;
+            for (uint32_t i = 0; i < fft_size; i++)
+                {
+                    max_error = std::max(max_error, std::abs(time_out[i] - freq_out[i]));
+                    max_value = std::max(max_value, std::abs(time_out[i]));
+                }
+            EXPECT_LT(max_error, 1e-3 * max_value) << "Doppler bin " << doppler_index;
+        }
+}
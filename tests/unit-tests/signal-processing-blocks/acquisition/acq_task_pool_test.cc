@@ -0,0 +1,162 @@
+/*!
+ * \file acq_task_pool_test.cc
+ * \brief Tests for the pool of acquisition worker threads.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acq_task_pool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+TEST(AcqTaskPoolTest, PriorityOrderAndQueueLimit)
+{
+    auto& pool = Acq_Task_Pool::instance();
+    pool.stop();
+    EXPECT_FALSE(pool.submit([]() {}, 0));
+
+    pool.start(1, std::vector<int32_t>(), 3);
+    ASSERT_TRUE(pool.running());
+
+    // Keep the only worker busy while the other tasks are queued
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool release = false;
+    std::atomic<bool> busy{false};
+    ASSERT_TRUE(pool.submit([&]() {
+        busy = true;
+        std::unique_lock<std::mutex> lk(mtx);
+        cv.wait(lk, [&]() { return release; });
+    },
+        0));
+    while (!busy)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+    std::vector<int> order;
+    std::mutex order_mtx;
+    auto record = [&](int id) {
+        return [&order, &order_mtx, id]() {
+            std::lock_guard<std::mutex> lk(order_mtx);
+            order.push_back(id);
+        };
+    };
+    EXPECT_TRUE(pool.submit(record(1), 10));
+    EXPECT_TRUE(pool.submit(record(2), 45));
+    EXPECT_TRUE(pool.submit(record(3), 10));
+    EXPECT_FALSE(pool.submit(record(4), 90));  // queue is full
+
+    {
+        std::lock_guard<std::mutex> lk(mtx);
+        release = true;
+    }
+    cv.notify_one();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (pool.stats().executed < 4 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+    const Acq_Task_Pool::Stats stats = pool.stats();
+    pool.stop();
+    EXPECT_FALSE(pool.running());
+
+    ASSERT_EQ(order.size(), 3U);
+    EXPECT_EQ(order[0], 2);
+    EXPECT_EQ(order[1], 1);
+    EXPECT_EQ(order[2], 3);
+    EXPECT_EQ(stats.executed, 4ULL);
+    EXPECT_EQ(stats.queue_depth, 0U);
+    EXPECT_EQ(stats.max_queue_depth, 3U);
+    EXPECT_EQ(stats.rejected, 1ULL);
+}
+
+
+TEST(AcqTaskPoolTest, SatellitePriorities)
+{
+    auto& pool = Acq_Task_Pool::instance();
+    pool.clear_satellite_priorities();
+    pool.set_satellite_priority('G', 5, 60);
+    pool.set_satellite_priority('E', 5, 20);
+    EXPECT_EQ(pool.satellite_priority('G', 5), 60);
+    EXPECT_EQ(pool.satellite_priority('E', 5), 20);
+    EXPECT_EQ(pool.satellite_priority('G', 6), Acq_Task_Pool::DEFAULT_PRIORITY);
+    pool.clear_satellite_priorities();
+    EXPECT_EQ(pool.satellite_priority('G', 5), Acq_Task_Pool::DEFAULT_PRIORITY);
+}
+
+
+TEST(AcqTaskPoolTest, StopCancelsPendingTasks)
+{
+    auto& pool = Acq_Task_Pool::instance();
+    pool.stop();
+    pool.start(1, std::vector<int32_t>(), 4);
+
+    // Keep the only worker busy while the other tasks are queued
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool release = false;
+    std::atomic<bool> busy{false};
+    ASSERT_TRUE(pool.submit([&]() {
+        busy = true;
+        std::unique_lock<std::mutex> lk(mtx);
+        cv.wait(lk, [&]() { return release; });
+    },
+        0));
+    while (!busy)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+    std::atomic<int> run{0};
+    std::atomic<int> cancelled{0};
+    for (int i = 0; i < 3; i++)
+        {
+            EXPECT_TRUE(pool.submit([&]() { run++; }, 0, [&]() { cancelled++; }));
+        }
+
+    std::thread stopper([&]() { pool.stop(); });
+    while (pool.running())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    {
+        std::lock_guard<std::mutex> lk(mtx);
+        release = true;
+    }
+    cv.notify_one();
+    stopper.join();
+
+    EXPECT_EQ(run, 0);
+    EXPECT_EQ(cancelled, 3);
+    EXPECT_EQ(pool.stats().cancelled, 3ULL);
+
+    // The pool can be started again after a stop
+    pool.start(1, std::vector<int32_t>(), 4);
+    EXPECT_TRUE(pool.submit([&]() { run++; }, 0));
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (run == 0 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    pool.stop();
+    EXPECT_EQ(run, 1);
+}
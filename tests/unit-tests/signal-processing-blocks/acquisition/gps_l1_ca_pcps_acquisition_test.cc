@@ -34,6 +34,7 @@
 #include <gnuradio/top_block.h>
 #include <gtest/gtest.h>
 #include <pmt/pmt.h>
+#include <array>
 #include <chrono>
 #include <memory>
 #include <utility>
@@ -385,3 +386,87 @@ TEST_F(GpsL1CaPcpsAcquisitionTest /*unused*/, ValidationOfResults /*unused*/)
             plot_grid();
         }
 }
+
+
+TEST_F(GpsL1CaPcpsAcquisitionTest /*unused*/, ValidationOfResultsFreqDomainDoppler /*unused*/)
+{
+    // The time-domain (0) and frequency-domain (1) Doppler searches are run
+    // on the same signal, and must find the same peak
+    const std::string data_str = "./tmp-acq-gps1-doppler";
+    std::array<Gnss_Synchro, 2> results{};
+    std::array<float, 2> test_statistics{};
+    std::array<int, 2> rx_messages{};
+
+    double expected_delay_samples = 524;
+    double expected_doppler_hz = 1680;
+
+    for (int mode = 0; mode < 2; mode++)
+        {
+            top_block = gr::make_top_block("Acquisition test");
+            gnss_synchro = Gnss_Synchro();
+            init();
+            const std::string dump_filename = data_str + "/acquisition_" + std::to_string(mode);
+            config->set_property("Acquisition_1C.dump", "true");
+            config->set_property("Acquisition_1C.dump_filename", dump_filename);
+            config->set_property("Acquisition_1C.freq_domain_doppler", mode == 1 ? "true" : "false");
+
+            auto acquisition = gnss_make_shared<GpsL1CaPcpsAcquisition>(config.get(), "Acquisition_1C", 1, 0);
+            auto msg_rx = GpsL1CaPcpsAcquisitionTest_msg_rx_make();
+
+            ASSERT_NO_THROW({
+                acquisition->set_channel(1);
+                acquisition->set_gnss_synchro(&gnss_synchro);
+                acquisition->set_threshold(0.001);
+                acquisition->set_doppler_max(doppler_max);
+                acquisition->set_doppler_step(doppler_step);
+                acquisition->connect(top_block);
+            }) << "Failure setting up the acquisition block.";
+
+            ASSERT_NO_THROW({
+                std::string path = std::string(TEST_PATH);
+                std::string file = path + "signal_samples/GPS_L1_CA_ID_1_Fs_4Msps_2ms.dat";
+                const char *file_name = file.c_str();
+                gr::blocks::file_source::sptr file_source = gr::blocks::file_source::make(sizeof(gr_complex), file_name, false);
+                top_block->connect(file_source, 0, acquisition->get_left_block(), 0);
+                top_block->msg_connect(acquisition->get_right_block(), pmt::mp("events"), msg_rx, pmt::mp("events"));
+            }) << "Failure connecting the blocks of acquisition test.";
+
+            acquisition->set_local_code();
+            acquisition->set_state(1);  // Ensure that acquisition starts at the first sample
+            acquisition->init();
+
+            EXPECT_NO_THROW({
+                top_block->run();  // Start threads and wait
+            }) << "Failure running the top_block.";
+
+            rx_messages[mode] = msg_rx->rx_message;
+            results[mode] = gnss_synchro;
+
+            auto samples_per_code = static_cast<unsigned int>(round(4000000 / (GPS_L1_CA_CODE_RATE_CPS / GPS_L1_CA_CODE_LENGTH_CHIPS)));
+            Acquisition_Dump_Reader acq_dump(dump_filename + "_G_1C", gnss_synchro.PRN, doppler_max, doppler_step, samples_per_code, 1);
+            if (acq_dump.read_binary_acq())
+                {
+                    test_statistics[mode] = acq_dump.test_statistic;
+                }
+        }
+    if (fs::exists(data_str))
+        {
+            fs::remove_all(data_str);
+        }
+
+    ASSERT_EQ(1, rx_messages[0]) << "Time-domain Doppler search failure. Expected message: 1=ACQ SUCCESS.";
+    ASSERT_EQ(1, rx_messages[1]) << "Frequency-domain Doppler search failure. Expected message: 1=ACQ SUCCESS.";
+
+    EXPECT_EQ(results[0].PRN, results[1].PRN);
+    EXPECT_NEAR(results[0].Acq_delay_samples, results[1].Acq_delay_samples, 1.0) << "Both Doppler search modes must find the same code phase";
+    EXPECT_LE(std::abs(results[0].Acq_doppler_hz - results[1].Acq_doppler_hz), static_cast<double>(doppler_step)) << "Both Doppler search modes must find the same Doppler within one grid step";
+    ASSERT_GT(test_statistics[0], 0.0) << "Error reading the time-domain acquisition dump file.";
+    EXPECT_NEAR(test_statistics[1], test_statistics[0], 0.05 * test_statistics[0]) << "Both Doppler search modes must yield a close test statistic";
+
+    double delay_error_samples = std::abs(expected_delay_samples - results[1].Acq_delay_samples);
+    auto delay_error_chips = static_cast<float>(delay_error_samples * 1023 / 4000);
+    double doppler_error_hz = std::abs(expected_doppler_hz - results[1].Acq_doppler_hz);
+
+    EXPECT_LE(doppler_error_hz, 666) << "Doppler error exceeds the expected value: 666 Hz = 2/(3*integration period)";
+    EXPECT_LT(delay_error_chips, 0.5) << "Delay error exceeds the expected value: 0.5 chips";
+}
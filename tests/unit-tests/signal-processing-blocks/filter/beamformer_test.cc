@@ -0,0 +1,160 @@
+/*!
+ * \file beamformer_test.cc
+ * \brief Tests for the beamformer block.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "beamformer.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
+
+
+namespace
+{
+std::vector<gr_complex> run_beamformer(const beamformer_sptr& bf, const std::vector<std::vector<gr_complex>>& channels)
+{
+    gr::top_block_sptr top_block = gr::make_top_block("BeamformerTest");
+    auto sink = gr::blocks::vector_sink_c::make();
+    for (int i = 0; i < GNSS_SDR_BEAMFORMER_CHANNELS; i++)
+        {
+            top_block->connect(gr::blocks::vector_source_c::make(channels[i]), 0, bf, i);
+        }
+    top_block->connect(bf, 0, sink, 0);
+    top_block->run();
+    return sink->data();
+}
+
+
+double mean_power(const std::vector<gr_complex>& x)
+{
+    double power = 0.0;
+    for (const auto& sample : x)
+        {
+            power += std::norm(sample);
+        }
+    return power / static_cast<double>(x.size());
+}
+}  // namespace
+
+
+TEST(BeamformerTest, CombinesWithWeights)
+{
+    const int num_samples = 10000;
+    std::default_random_engine e2(1);
+    std::uniform_real_distribution<float> dist(-1.0, 1.0);
+    std::vector<std::vector<gr_complex>> channels(GNSS_SDR_BEAMFORMER_CHANNELS, std::vector<gr_complex>(num_samples));
+    for (auto& ch : channels)
+        {
+            for (auto& x : ch)
+                {
+                    x = gr_complex(dist(e2), dist(e2));
+                }
+        }
+    std::vector<gr_complex> weights(GNSS_SDR_BEAMFORMER_CHANNELS);
+    for (auto& w : weights)
+        {
+            w = gr_complex(dist(e2), dist(e2));
+        }
+
+    auto bf = make_beamformer_sptr();
+    bf->set_weights(std::vector<gr_complex>(3, gr_complex(2.0, 0.0)));  // wrong size, ignored
+    bf->set_weights(weights);
+    EXPECT_EQ(bf->get_weights(), weights);
+
+    const std::vector<gr_complex> out = run_beamformer(bf, channels);
+    ASSERT_EQ(out.size(), static_cast<size_t>(num_samples));
+    for (int n = 0; n < num_samples; n++)
+        {
+            gr_complex expected(0.0, 0.0);
+            for (int i = 0; i < GNSS_SDR_BEAMFORMER_CHANNELS; i++)
+                {
+                    expected += channels[i][n] * weights[i];
+                }
+            EXPECT_NEAR(std::abs(out[n] - expected), 0.0, 1e-4);
+        }
+}
+
+
+TEST(BeamformerTest, PowerInversionNullsInterference)
+{
+    // Noise on each element plus a strong interference arriving with a
+    // different phase on each element
+    const int num_samples = 20000;
+    std::default_random_engine e2(2);
+    std::normal_distribution<float> noise(0.0, 1.0);
+    std::vector<std::vector<gr_complex>> channels(GNSS_SDR_BEAMFORMER_CHANNELS, std::vector<gr_complex>(num_samples));
+    for (int n = 0; n < num_samples; n++)
+        {
+            const gr_complex jammer = 100.0F * gr_complex(noise(e2), noise(e2));
+            for (int i = 0; i < GNSS_SDR_BEAMFORMER_CHANNELS; i++)
+                {
+                    channels[i][n] = gr_complex(noise(e2), noise(e2)) + jammer * std::polar(1.0F, 0.7F * static_cast<float>(i));
+                }
+        }
+
+    auto bf = make_beamformer_sptr(true, 1000000, 1024);
+    const std::vector<gr_complex> out = run_beamformer(bf, channels);
+    ASSERT_EQ(out.size(), static_cast<size_t>(num_samples));
+    EXPECT_NEAR(std::abs(bf->get_weights()[0] - gr_complex(1.0, 0.0)), 0.0, 1e-5);
+
+    // More than 30 dB of rejection of the interference
+    EXPECT_LT(mean_power(out), 1e-3 * mean_power(channels[0]));
+}
+
+
+TEST(BeamformerTest, AdaptiveUpdateAfterShortCall)
+{
+    // A call to work() with fewer samples than elements cannot update the
+    // weights, so the update must run in the next call
+    const int num_samples = 1024;
+    std::default_random_engine e2(3);
+    std::normal_distribution<float> noise(0.0, 1.0);
+    std::vector<std::vector<gr_complex>> channels(GNSS_SDR_BEAMFORMER_CHANNELS, std::vector<gr_complex>(num_samples));
+    for (int n = 0; n < num_samples; n++)
+        {
+            const gr_complex jammer = 100.0F * gr_complex(noise(e2), noise(e2));
+            for (int i = 0; i < GNSS_SDR_BEAMFORMER_CHANNELS; i++)
+                {
+                    channels[i][n] = gr_complex(noise(e2), noise(e2)) + jammer * std::polar(1.0F, 0.7F * static_cast<float>(i));
+                }
+        }
+    gr_vector_const_void_star input_items(GNSS_SDR_BEAMFORMER_CHANNELS);
+    for (int i = 0; i < GNSS_SDR_BEAMFORMER_CHANNELS; i++)
+        {
+            input_items[i] = channels[i].data();
+        }
+    std::vector<gr_complex> out(num_samples);
+    gr_vector_void_star output_items(1, out.data());
+
+    auto bf = make_beamformer_sptr(true, 1000000, 1024);
+    const std::vector<gr_complex> initial_weights = bf->get_weights();
+    EXPECT_EQ(bf->work(GNSS_SDR_BEAMFORMER_CHANNELS - 1, input_items, output_items), GNSS_SDR_BEAMFORMER_CHANNELS - 1);
+    EXPECT_EQ(bf->get_weights(), initial_weights);
+
+    EXPECT_EQ(bf->work(num_samples, input_items, output_items), num_samples);
+    const std::vector<gr_complex> weights = bf->get_weights();
+    EXPECT_NEAR(std::abs(weights[0] - gr_complex(1.0, 0.0)), 0.0, 1e-5);
+    EXPECT_NE(weights, initial_weights);
+}
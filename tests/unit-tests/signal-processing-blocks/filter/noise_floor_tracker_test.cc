@@ -0,0 +1,77 @@
+/*!
+ * \file noise_floor_tracker_test.cc
+ * \brief Tests for the noise floor estimator of the interference mitigation
+ * blocks.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "noise_floor_tracker.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <complex>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+std::vector<gr_complex> noise_and_cw(int num_samples, float sigma, float cw_amplitude)
+{
+    std::default_random_engine e2(3);
+    std::normal_distribution<float> noise(0.0, sigma);
+    std::vector<gr_complex> x(num_samples);
+    for (int n = 0; n < num_samples; n++)
+        {
+            x[n] = gr_complex(noise(e2), noise(e2)) + std::polar(cw_amplitude, 0.9F * static_cast<float>(n));
+        }
+    return x;
+}
+}  // namespace
+
+
+TEST(NoiseFloorTrackerTest, WhiteNoise)
+{
+    // Noise power of 2 per complex sample, with and without a narrowband
+    // interference 26 dB above it
+    for (const float cw_amplitude : {0.0F, 30.0F})
+        {
+            const std::vector<gr_complex> x = noise_and_cw(400000, 1.0, cw_amplitude);
+            Noise_Floor_Tracker tracker(32);
+            for (size_t n = 0; n + 32 <= x.size(); n += 32)
+                {
+                    tracker.update(x.data() + n, 32);
+                }
+            EXPECT_GT(tracker.num_estimates(), 600U);
+            EXPECT_NEAR(tracker.noise_power(), 2.0, 0.4);
+        }
+}
+
+
+TEST(NoiseFloorTrackerTest, SegmentSizeAndReset)
+{
+    const std::vector<gr_complex> x = noise_and_cw(5000, 1.0, 0.0);
+    Noise_Floor_Tracker whole(32);
+    Noise_Floor_Tracker segmented(32);
+    whole.update(x.data(), static_cast<int32_t>(x.size()));
+    for (int n = 0; n < static_cast<int>(x.size()); n += 7)
+        {
+            segmented.update(x.data() + n, std::min(7, static_cast<int>(x.size()) - n));
+        }
+    EXPECT_GT(whole.num_estimates(), 0U);
+    EXPECT_EQ(whole.num_estimates(), segmented.num_estimates());
+    EXPECT_FLOAT_EQ(whole.noise_power(), segmented.noise_power());
+
+    segmented.reset();
+    EXPECT_EQ(segmented.num_estimates(), 0U);
+    EXPECT_EQ(segmented.noise_power(), 0.0);
+}
@@ -19,12 +19,16 @@
 #include <chrono>
 #include <complex>
 #include <cstdint>
+#include <random>
 #include <thread>
 #include <utility>
+#include <vector>
 #ifdef GR_GREATER_38
 #include <gnuradio/analog/sig_source.h>
+#include <gnuradio/blocks/vector_source.h>
 #else
 #include <gnuradio/analog/sig_source_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
 #endif
 #include "concurrent_queue.h"
 #include "file_signal_source.h"
@@ -33,6 +37,7 @@
 #include "gnss_sdr_make_unique.h"
 #include "gnss_sdr_valve.h"
 #include "in_memory_configuration.h"
+#include "pulse_blanking_cc.h"
 #include "pulse_blanking_filter.h"
 #include <gnuradio/blocks/null_sink.h>
 #include <gtest/gtest.h>
@@ -211,3 +216,51 @@ TEST_F(PulseBlankingFilterTest, ConnectAndRunGrcomplex)
     ch_thread.join();
     std::cout << "Filtered " << nsamples << " gr_complex samples in " << elapsed_seconds.count() * 1e6 << " microseconds\n";
 }
+
+
+TEST_F(PulseBlankingFilterTest, BlanksPulsesOverCw)
+{
+    // Noise and a CW interference 17 dB above it. After the segments used to
+    // estimate the noise power, a 32-sample pulse 30 dB above the noise
+    // every 416 samples, aligned to the segments
+    const int num_samples = 400000;
+    const int est_samples = 40000;
+    std::default_random_engine e2(1);
+    std::normal_distribution<float> noise(0.0, 1.0);
+    std::vector<gr_complex> x(num_samples);
+    int num_pulses = 0;
+    for (int n = 0; n < num_samples; n++)
+        {
+            x[n] = gr_complex(noise(e2), noise(e2)) + std::polar(10.0F, 0.3F * static_cast<float>(n));
+            if (n >= est_samples && n % 416 < 32)
+                {
+                    x[n] *= 31.0F;
+                    num_pulses += (n % 416 == 0) ? 1 : 0;
+                }
+        }
+
+    config->set_property("InputFilter.pfa", "0.0001");
+    config->set_property("InputFilter.length", "32");
+    config->set_property("InputFilter.segments_est", std::to_string(est_samples / 32));
+    config->set_property("InputFilter.segments_reset", "5000000");
+    configure_gr_complex_gr_complex();
+    top_block = gr::make_top_block("Pulse Blanking filter test");
+    auto filter = std::make_shared<PulseBlankingFilter>(config.get(), "InputFilter", 1, 1);
+    auto source = gr::blocks::vector_source_c::make(x);
+    auto null_sink = gr::blocks::null_sink::make(sizeof(gr_complex));
+    filter->connect(top_block);
+    top_block->connect(source, 0, filter->get_left_block(), 0);
+    top_block->connect(filter->get_right_block(), 0, null_sink, 0);
+    top_block->run();
+
+    const auto* block = dynamic_cast<pulse_blanking_cc*>(filter->get_right_block().get());
+    ASSERT_NE(block, nullptr);
+    const Interference_Mitigation_Counters& counters = block->counters();
+    EXPECT_GT(counters.samples(), static_cast<uint64_t>(num_samples - 32 * 64));
+    EXPECT_EQ(counters.estimation_segments(), static_cast<uint64_t>(est_samples / 32));
+    // The CW interference is part of the noise power, so only the pulses
+    // are blanked
+    EXPECT_GE(counters.filtered_segments(), static_cast<uint64_t>(num_pulses - 2));
+    EXPECT_LE(counters.filtered_segments(), static_cast<uint64_t>(num_pulses + 2));
+    EXPECT_GT(counters.throughput_sps(), 0.0);
+}
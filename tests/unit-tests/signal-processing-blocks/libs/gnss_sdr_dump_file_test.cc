@@ -0,0 +1,125 @@
+/*!
+ * \file gnss_sdr_dump_file_test.cc
+ * \brief Tests for the dump file written by a background thread.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_dump_file.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+// Writes records of one double and one int32 each, as the tracking dumps do
+void write_records(Gnss_Sdr_Dump_File& file, int32_t first, int32_t n)
+{
+    for (int32_t i = first; i < first + n; i++)
+        {
+            const double value = 0.5 * static_cast<double>(i);
+            file.write(reinterpret_cast<const char*>(&value), sizeof(double));
+            file.write(reinterpret_cast<const char*>(&i), sizeof(int32_t));
+        }
+}
+
+
+std::vector<char> read_file(const std::string& filename)
+{
+    std::ifstream in(filename, std::ios::binary);
+    return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+}  // namespace
+
+
+TEST(GnssSdrDumpFileTest, SameContentAsOfstream)
+{
+    const int32_t n_records = 100000;  // several buffers
+    const std::string filename_async = "dump_file_test_async.dat";
+    const std::string filename_ref = "dump_file_test_ref.dat";
+
+    Gnss_Sdr_Dump_File file;
+    file.exceptions(std::ios::failbit | std::ios::badbit);
+    EXPECT_FALSE(file.is_open());
+    file.open(filename_async, std::ios::out | std::ios::binary);
+    EXPECT_TRUE(file.is_open());
+    write_records(file, 0, n_records);
+    EXPECT_EQ(static_cast<int64_t>(file.tellp()), static_cast<int64_t>(n_records * (sizeof(double) + sizeof(int32_t))));
+    file.close();
+    EXPECT_FALSE(file.is_open());
+
+    std::ofstream ref(filename_ref, std::ios::out | std::ios::binary);
+    for (int32_t i = 0; i < n_records; i++)
+        {
+            const double value = 0.5 * static_cast<double>(i);
+            ref.write(reinterpret_cast<const char*>(&value), sizeof(double));
+            ref.write(reinterpret_cast<const char*>(&i), sizeof(int32_t));
+        }
+    ref.close();
+
+    EXPECT_TRUE(read_file(filename_async) == read_file(filename_ref));
+    EXPECT_EQ(Gnss_Sdr_Dump_File::statistics().bytes_dropped, 0U);
+    std::remove(filename_async.c_str());
+    std::remove(filename_ref.c_str());
+}
+
+
+TEST(GnssSdrDumpFileTest, ConcurrentFiles)
+{
+    const int32_t n_files = 8;
+    const int32_t n_records = 20000;
+    std::vector<std::thread> threads;
+    for (int32_t f = 0; f < n_files; f++)
+        {
+            threads.emplace_back([f]() {
+                Gnss_Sdr_Dump_File file;
+                file.open("dump_file_test_" + std::to_string(f) + ".dat");
+                write_records(file, f * n_records, n_records);
+                // closed by the destructor
+            });
+        }
+    for (auto& t : threads)
+        {
+            t.join();
+        }
+
+    for (int32_t f = 0; f < n_files; f++)
+        {
+            const std::string filename = "dump_file_test_" + std::to_string(f) + ".dat";
+            const auto content = read_file(filename);
+            ASSERT_EQ(content.size(), n_records * (sizeof(double) + sizeof(int32_t)));
+            for (int32_t i = 0; i < n_records; i++)
+                {
+                    int32_t index;
+                    std::copy_n(&content[i * (sizeof(double) + sizeof(int32_t)) + sizeof(double)], sizeof(int32_t), reinterpret_cast<char*>(&index));
+                    ASSERT_EQ(index, f * n_records + i);
+                }
+            std::remove(filename.c_str());
+        }
+}
+
+
+TEST(GnssSdrDumpFileTest, OpenFailureThrows)
+{
+    Gnss_Sdr_Dump_File file;
+    file.exceptions(std::ios::failbit | std::ios::badbit);
+    EXPECT_THROW(file.open("/nonexistent_dir/dump_file_test.dat", std::ios::out | std::ios::binary), std::ofstream::failure);
+    EXPECT_FALSE(file.is_open());
+}
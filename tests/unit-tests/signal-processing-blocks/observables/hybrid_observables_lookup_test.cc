@@ -0,0 +1,174 @@
+/*!
+ * \file hybrid_observables_lookup_test.cc
+ * \brief Tests the search of the tracking outputs nearest to the receiver
+ * clock in the history of the observables block
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_circular_deque.h"
+#include "gnss_synchro.h"
+#include "hybrid_observables_gs.h"
+#include "obs_conf.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+class HybridObservablesLookupTest : public ::testing::Test
+{
+protected:
+    HybridObservablesLookupTest()
+    {
+        Obs_Conf conf;
+        conf.nchannels_in = 1;
+        conf.nchannels_out = 1;
+        obs = hybrid_observables_gs_make(conf);
+    }
+
+    static Gnss_Synchro trk_obs(uint32_t prn, uint64_t sample_counter)
+    {
+        Gnss_Synchro gs{};
+        gs.PRN = prn;
+        gs.fs = 4000000;
+        gs.Tracking_sample_counter = sample_counter;
+        return gs;
+    }
+
+    hybrid_observables_gs_sptr obs;
+};
+
+
+TEST_F(HybridObservablesLookupTest, NearestAtEntry)
+{
+    for (uint64_t k = 1; k <= 10; k++)
+        {
+            obs->store_trk_obs(0, trk_obs(1, 1000 * k));
+        }
+    int64_t abs_diff = 0;
+    EXPECT_EQ(obs->find_nearest_trk_obs(0, 1000, abs_diff), 0);
+    EXPECT_EQ(abs_diff, 0);
+    EXPECT_EQ(obs->find_nearest_trk_obs(0, 5000, abs_diff), 4);
+    EXPECT_EQ(abs_diff, 0);
+    EXPECT_EQ(obs->find_nearest_trk_obs(0, 10000, abs_diff), 9);
+    EXPECT_EQ(abs_diff, 0);
+}
+
+
+TEST_F(HybridObservablesLookupTest, NearestBetweenEntries)
+{
+    for (uint64_t k = 1; k <= 10; k++)
+        {
+            obs->store_trk_obs(0, trk_obs(1, 1000 * k));
+        }
+    int64_t abs_diff = 0;
+    EXPECT_EQ(obs->find_nearest_trk_obs(0, 5400, abs_diff), 4);
+    EXPECT_EQ(abs_diff, 400);
+    EXPECT_EQ(obs->find_nearest_trk_obs(0, 5600, abs_diff), 5);
+    EXPECT_EQ(abs_diff, 400);
+    // On a tie, the earliest element, as the linear scan did
+    EXPECT_EQ(obs->find_nearest_trk_obs(0, 5500, abs_diff), 4);
+    EXPECT_EQ(abs_diff, 500);
+}
+
+
+TEST_F(HybridObservablesLookupTest, NearestOutsideEntries)
+{
+    int64_t abs_diff = 0;
+    EXPECT_EQ(obs->find_nearest_trk_obs(0, 1000, abs_diff), -1);
+    EXPECT_EQ(abs_diff, std::numeric_limits<int64_t>::max());
+
+    for (uint64_t k = 1; k <= 10; k++)
+        {
+            obs->store_trk_obs(0, trk_obs(1, 1000 * k));
+        }
+    EXPECT_EQ(obs->find_nearest_trk_obs(0, 100, abs_diff), 0);
+    EXPECT_EQ(abs_diff, 900);
+    EXPECT_EQ(obs->find_nearest_trk_obs(0, 0, abs_diff), 0);
+    EXPECT_EQ(abs_diff, 1000);
+    EXPECT_EQ(obs->find_nearest_trk_obs(0, 20000, abs_diff), 9);
+    EXPECT_EQ(abs_diff, 10000);
+}
+
+
+TEST_F(HybridObservablesLookupTest, MatchesLinearScan)
+{
+    // More elements than the history holds, so the search also runs over
+    // a history that has wrapped around
+    std::default_random_engine e2(1);
+    std::uniform_int_distribution<uint64_t> step(1, 8000);
+    std::vector<uint64_t> counters;
+    uint64_t counter = 100000;
+    for (int k = 0; k < 1500; k++)
+        {
+            counter += step(e2);
+            counters.push_back(counter);
+            obs->store_trk_obs(0, trk_obs(1, counter));
+        }
+    counters.erase(counters.begin(), counters.end() - obs->d_sample_counter_history->size(0));
+    ASSERT_EQ(obs->d_gnss_synchro_history->size(0), counters.size());
+
+    std::uniform_int_distribution<uint64_t> rx_clock_dist(counters.front() - 10000, counters.back() + 10000);
+    for (int q = 0; q < 10000; q++)
+        {
+            const uint64_t rx_clock = rx_clock_dist(e2);
+            int32_t expected = -1;
+            int64_t expected_diff = std::numeric_limits<int64_t>::max();
+            for (size_t i = 0; i < counters.size(); i++)
+                {
+                    const int64_t diff = llabs(static_cast<int64_t>(rx_clock) - static_cast<int64_t>(counters[i]));
+                    if (expected_diff > diff)
+                        {
+                            expected_diff = diff;
+                            expected = static_cast<int32_t>(i);
+                        }
+                }
+            int64_t abs_diff = 0;
+            ASSERT_EQ(obs->find_nearest_trk_obs(0, rx_clock, abs_diff), expected) << "rx_clock = " << rx_clock;
+            ASSERT_EQ(abs_diff, expected_diff);
+            ASSERT_EQ(obs->d_gnss_synchro_history->get(0, expected).Tracking_sample_counter, counters[expected]);
+        }
+}
+
+
+TEST_F(HybridObservablesLookupTest, ResetOnNonIncreasingCounter)
+{
+    for (uint64_t k = 1; k <= 5; k++)
+        {
+            obs->store_trk_obs(0, trk_obs(1, 1000 * k));
+        }
+    ASSERT_EQ(obs->d_sample_counter_history->size(0), 5U);
+
+    // A sample counter lower than the last one empties the history
+    obs->store_trk_obs(0, trk_obs(1, 4000));
+    EXPECT_EQ(obs->d_gnss_synchro_history->size(0), 1U);
+    EXPECT_EQ(obs->d_sample_counter_history->size(0), 1U);
+    int64_t abs_diff = 0;
+    EXPECT_EQ(obs->find_nearest_trk_obs(0, 1000, abs_diff), 0);
+    EXPECT_EQ(abs_diff, 3000);
+
+    // So does a repeated sample counter
+    obs->store_trk_obs(0, trk_obs(1, 5000));
+    obs->store_trk_obs(0, trk_obs(1, 5000));
+    EXPECT_EQ(obs->d_sample_counter_history->size(0), 1U);
+
+    // And a change of satellite
+    obs->store_trk_obs(0, trk_obs(1, 6000));
+    obs->store_trk_obs(0, trk_obs(2, 7000));
+    EXPECT_EQ(obs->d_gnss_synchro_history->size(0), 1U);
+    EXPECT_EQ(obs->d_sample_counter_history->size(0), 1U);
+    EXPECT_EQ(obs->d_gnss_synchro_history->front(0).PRN, 2U);
+}
@@ -0,0 +1,197 @@
+/*!
+ * \file nav_data_store_test.cc
+ * \brief Tests for the binary log of navigation data.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_filesystem.h"
+#include "nav_data_store.h"
+#include <gtest/gtest.h>
+#include <fstream>
+
+
+TEST(NavDataStoreTest, AppendAndLoad)
+{
+    const std::string filename("nav_data_store_test.dat");
+    errorlib::error_code ec;
+    fs::remove(fs::path(filename), ec);
+    {
+        Nav_Data_Store store(filename);
+        Gps_Ephemeris gps_eph;
+        gps_eph.PRN = 1;
+        gps_eph.IODE_SF2 = 10;
+        EXPECT_TRUE(store.append(gps_eph));
+        gps_eph.PRN = 2;
+        EXPECT_TRUE(store.append(gps_eph));
+        gps_eph.PRN = 1;
+        gps_eph.IODE_SF2 = 11;
+        EXPECT_TRUE(store.append(gps_eph));
+        Galileo_Ephemeris gal_eph;
+        gal_eph.PRN = 11;
+        gal_eph.IOD_ephemeris = 55;
+        EXPECT_TRUE(store.append(gal_eph));
+        Gps_Iono iono;
+        iono.alpha0 = 1.5e-8;
+        iono.valid = true;
+        EXPECT_TRUE(store.append(iono));
+        // Repeated data is not appended
+        EXPECT_TRUE(store.append(iono));
+        EXPECT_TRUE(store.append(gal_eph));
+        EXPECT_EQ(store.size(), 4U);
+        EXPECT_EQ(store.file_records(), 5U);
+    }
+
+    Nav_Data_Store store(filename);
+    ASSERT_TRUE(store.load());
+    EXPECT_EQ(store.size(), 4U);
+    EXPECT_EQ(store.file_records(), 5U);
+    ASSERT_EQ(store.gps_ephemeris_map.size(), 2U);
+    EXPECT_EQ(store.gps_ephemeris_map.at(1).IODE_SF2, 11);
+    EXPECT_EQ(store.gps_ephemeris_map.at(2).IODE_SF2, 10);
+    ASSERT_EQ(store.galileo_ephemeris_map.size(), 1U);
+    EXPECT_EQ(store.galileo_ephemeris_map.at(11).IOD_ephemeris, 55);
+    ASSERT_NE(store.gps_iono, nullptr);
+    EXPECT_DOUBLE_EQ(store.gps_iono->alpha0, 1.5e-8);
+    EXPECT_EQ(store.galileo_iono, nullptr);
+
+    // Appending after a restart keeps the records of the previous run
+    Gps_Almanac almanac;
+    almanac.PRN = 5;
+    EXPECT_TRUE(store.append(almanac));
+    Nav_Data_Store reloaded(filename);
+    ASSERT_TRUE(reloaded.load());
+    EXPECT_EQ(reloaded.size(), 5U);
+    EXPECT_EQ(reloaded.gps_almanac_map.count(5), 1U);
+    EXPECT_TRUE(fs::remove(fs::path(filename), ec)) << "Failure deleting a temporary file.";
+}
+
+
+TEST(NavDataStoreTest, TruncatedRecord)
+{
+    const std::string filename("nav_data_store_test.dat");
+    errorlib::error_code ec;
+    fs::remove(fs::path(filename), ec);
+    {
+        Nav_Data_Store store(filename);
+        Galileo_Ephemeris eph;
+        eph.PRN = 1;
+        EXPECT_TRUE(store.append(eph));
+        eph.PRN = 2;
+        EXPECT_TRUE(store.append(eph));
+    }
+    // Simulate a receiver killed while writing the last record
+    fs::resize_file(fs::path(filename), fs::file_size(fs::path(filename)) - 10, ec);
+    ASSERT_FALSE(ec);
+
+    Nav_Data_Store store(filename);
+    ASSERT_TRUE(store.load());
+    EXPECT_EQ(store.galileo_ephemeris_map.size(), 1U);
+    EXPECT_EQ(store.galileo_ephemeris_map.count(1), 1U);
+
+    // The truncated record is cut off, so the next ones can be read back
+    Galileo_Ephemeris eph;
+    eph.PRN = 3;
+    EXPECT_TRUE(store.append(eph));
+    eph.PRN = 4;
+    EXPECT_TRUE(store.append(eph));
+    Nav_Data_Store reloaded(filename);
+    ASSERT_TRUE(reloaded.load());
+    EXPECT_EQ(reloaded.file_records(), 3U);
+    EXPECT_EQ(reloaded.galileo_ephemeris_map.size(), 3U);
+    EXPECT_EQ(reloaded.galileo_ephemeris_map.count(3), 1U);
+    EXPECT_EQ(reloaded.galileo_ephemeris_map.count(4), 1U);
+    EXPECT_TRUE(fs::remove(fs::path(filename), ec)) << "Failure deleting a temporary file.";
+}
+
+
+TEST(NavDataStoreTest, CorruptRecord)
+{
+    const std::string filename("nav_data_store_test.dat");
+    errorlib::error_code ec;
+    fs::remove(fs::path(filename), ec);
+    {
+        Nav_Data_Store store(filename);
+        Gps_Ephemeris eph;
+        eph.PRN = 1;
+        EXPECT_TRUE(store.append(eph));
+    }
+    {
+        // A record with a wrong size, followed by garbage
+        std::ofstream out(filename, std::ios::binary | std::ios::app);
+        const uint8_t type = 1;
+        const uint32_t size = 0xFFFFFFF0;
+        out.write(reinterpret_cast<const char*>(&type), sizeof(type));
+        out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        out << "garbage";
+    }
+
+    Nav_Data_Store store(filename);
+    ASSERT_TRUE(store.load());
+    EXPECT_EQ(store.file_records(), 1U);
+    EXPECT_EQ(store.gps_ephemeris_map.count(1), 1U);
+    Gps_Ephemeris eph;
+    eph.PRN = 2;
+    EXPECT_TRUE(store.append(eph));
+    Nav_Data_Store reloaded(filename);
+    ASSERT_TRUE(reloaded.load());
+    EXPECT_EQ(reloaded.file_records(), 2U);
+    EXPECT_EQ(reloaded.gps_ephemeris_map.size(), 2U);
+    EXPECT_TRUE(fs::remove(fs::path(filename), ec)) << "Failure deleting a temporary file.";
+}
+
+
+TEST(NavDataStoreTest, Compaction)
+{
+    const std::string filename("nav_data_store_test.dat");
+    errorlib::error_code ec;
+    fs::remove(fs::path(filename), ec);
+    Nav_Data_Store store(filename);
+    Gps_Ephemeris eph;
+    for (int i = 0; i < 1000; i++)
+        {
+            eph.PRN = 1 + (i % 4);
+            eph.IODE_SF2 = i;
+            EXPECT_TRUE(store.append(eph));
+        }
+    EXPECT_EQ(store.size(), 4U);
+    EXPECT_LT(store.file_records(), 300U);
+
+    Nav_Data_Store reloaded(filename);
+    ASSERT_TRUE(reloaded.load());
+    ASSERT_EQ(reloaded.gps_ephemeris_map.size(), 4U);
+    EXPECT_EQ(reloaded.gps_ephemeris_map.at(4).IODE_SF2, 999);
+    EXPECT_TRUE(fs::remove(fs::path(filename), ec)) << "Failure deleting a temporary file.";
+}
+
+
+TEST(NavDataStoreTest, NotAStore)
+{
+    const std::string filename("nav_data_store_test.dat");
+    errorlib::error_code ec;
+    {
+        std::ofstream out(filename);
+        out << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\" ?>\n";
+    }
+    Nav_Data_Store store(filename);
+    EXPECT_FALSE(store.load());
+
+    // The first append starts a new store
+    Glonass_Gnav_Utc_Model utc_model;
+    utc_model.d_tau_c = 1e-9;
+    EXPECT_TRUE(store.append(utc_model));
+    Nav_Data_Store reloaded(filename);
+    ASSERT_TRUE(reloaded.load());
+    ASSERT_NE(reloaded.glonass_gnav_utc_model, nullptr);
+    EXPECT_DOUBLE_EQ(reloaded.glonass_gnav_utc_model->d_tau_c, 1e-9);
+    EXPECT_TRUE(fs::remove(fs::path(filename), ec)) << "Failure deleting a temporary file.";
+}
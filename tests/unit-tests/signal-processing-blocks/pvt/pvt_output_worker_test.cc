@@ -0,0 +1,97 @@
+/*!
+ * \file pvt_output_worker_test.cc
+ * \brief Tests for the threads that write the outputs of the PVT block.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_output_worker.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+#include <vector>
+
+
+TEST(PvtOutputWorkerTest, RunsTasksInOrder)
+{
+    std::vector<int> written;
+    {
+        Pvt_Output_Worker worker("test", 4, Pvt_Output_Worker::BLOCK);
+        for (int i = 0; i < 100; i++)
+            {
+                EXPECT_TRUE(worker.submit([&written, i] { written.push_back(i); }));
+            }
+        worker.flush();
+        const auto stats = worker.stats();
+        EXPECT_EQ(stats.name, "test");
+        EXPECT_EQ(stats.processed, 100U);
+        EXPECT_EQ(stats.dropped, 0U);
+        EXPECT_LE(stats.mean_latency_ms, stats.max_latency_ms);
+    }
+    ASSERT_EQ(written.size(), 100U);
+    for (int i = 0; i < 100; i++)
+        {
+            EXPECT_EQ(written[i], i);
+        }
+}
+
+
+TEST(PvtOutputWorkerTest, DropPolicies)
+{
+    for (const auto policy : {Pvt_Output_Worker::DROP_OLDEST, Pvt_Output_Worker::DROP_NEWEST})
+        {
+            std::promise<void> started;
+            std::promise<void> release;
+            std::shared_future<void> released = release.get_future().share();
+            std::vector<int> written;
+            {
+                Pvt_Output_Worker worker("test", 2, policy);
+                // The first task blocks the worker, and the next ones overflow the queue
+                worker.submit([&started, released] {
+                    started.set_value();
+                    released.wait();
+                });
+                started.get_future().wait();
+                EXPECT_TRUE(worker.submit([&written] { written.push_back(1); }));
+                EXPECT_TRUE(worker.submit([&written] { written.push_back(2); }));
+                EXPECT_FALSE(worker.submit([&written] { written.push_back(3); }));
+                EXPECT_FALSE(worker.submit([&written] { written.push_back(4); }));
+                release.set_value();
+                worker.flush();
+                EXPECT_EQ(worker.stats().processed, 3U);
+                EXPECT_EQ(worker.stats().dropped, 2U);
+            }
+            const std::vector<int> expected = (policy == Pvt_Output_Worker::DROP_OLDEST) ? std::vector<int>{3, 4} : std::vector<int>{1, 2};
+            EXPECT_EQ(written, expected);
+        }
+}
+
+
+TEST(PvtOutputWorkerTest, Synchronous)
+{
+    std::atomic<int> count{0};
+    Pvt_Output_Worker worker("test", 0, Pvt_Output_Worker::DROP_NEWEST);
+    for (int i = 0; i < 10; i++)
+        {
+            worker.submit([&count] { count++; });
+            EXPECT_EQ(count, i + 1);
+        }
+    EXPECT_EQ(worker.stats().processed, 10U);
+}
+
+
+TEST(PvtOutputWorkerTest, PolicyFromString)
+{
+    EXPECT_EQ(Pvt_Output_Worker::policy_from_string("block"), Pvt_Output_Worker::BLOCK);
+    EXPECT_EQ(Pvt_Output_Worker::policy_from_string("drop_oldest"), Pvt_Output_Worker::DROP_OLDEST);
+    EXPECT_EQ(Pvt_Output_Worker::policy_from_string("drop_newest"), Pvt_Output_Worker::DROP_NEWEST);
+}
@@ -20,8 +20,63 @@
 #include "rtklib_rtkpos.h"
 #include "rtklib_solver.h"
 #include <fstream>
+#include <iterator>
 #include <string>
 #include <utility>
+#include <vector>
+
+
+namespace
+{
+// RINEX header line of 80 characters
+std::string header_line(const std::string& content, const std::string& label)
+{
+    std::string line = content;
+    line.resize(60, ' ');
+    line += label;
+    line.resize(80, ' ');
+    return line;
+}
+
+
+void write_file(const std::string& filename, const std::vector<std::string>& lines, const std::string& records)
+{
+    std::ofstream out(filename, std::ios::trunc);
+    for (const auto& line : lines)
+        {
+            out << line << '\n';
+        }
+    out << records;
+}
+
+
+// Reads the header lines up to END OF HEADER, as the update_*_header() methods do
+std::vector<std::string> read_header(std::fstream& in)
+{
+    std::vector<std::string> header;
+    std::string line;
+    while (std::getline(in, line))
+        {
+            header.push_back(line);
+            if (line.find("END OF HEADER", 59) != std::string::npos)
+                {
+                    break;
+                }
+        }
+    return header;
+}
+
+
+std::string file_contents(const std::string& filename)
+{
+    std::ifstream in(filename, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+}
+
+
+const std::string HEADER_TEST_FILE("rinex_header_test.26o");
+const std::string HEADER_TEST_RECORDS("> 2026 10 18 12 00  0.0000000  0  1\nE01  22000000.000 6\n");
+}  // namespace
 
 
 class RinexPrinterTest : public ::testing::Test
@@ -1033,3 +1088,86 @@ TEST_F(RinexPrinterTest, MixedObsLogGpsGlo)
     fs::remove(navfile);
     fs::remove(obsfile);
 }
+
+
+TEST_F(RinexPrinterTest, HeaderOverwrittenInPlace)
+{
+    Rinex_Printer rp;
+    const std::string version = header_line("     3.02           OBSERVATION DATA    E (GALILEO)", "RINEX VERSION / TYPE");
+    const std::string leap = header_line("    18    18  2347     7", "LEAP SECONDS");
+    const std::string end = header_line("", "END OF HEADER");
+    write_file(HEADER_TEST_FILE, {version, rp.reserved_header_line(), end}, HEADER_TEST_RECORDS);
+
+    // The new LEAP SECONDS record takes the place of the reserved line
+    std::fstream out(HEADER_TEST_FILE, std::ios::in | std::ios::out);
+    std::vector<std::string> header = read_header(out);
+    header.insert(header.end() - 1, leap);
+    EXPECT_TRUE(rp.overwrite_header(out, HEADER_TEST_FILE, header));
+    out << "> 2026 10 18 12 00  1.0000000  0  0\n";
+    out.close();
+
+    EXPECT_EQ(file_contents(HEADER_TEST_FILE), version + '\n' + leap + '\n' + end + '\n' + HEADER_TEST_RECORDS + "> 2026 10 18 12 00  1.0000000  0  0\n");
+    fs::remove(HEADER_TEST_FILE);
+}
+
+
+TEST_F(RinexPrinterTest, HeaderPaddedWithReservedLines)
+{
+    Rinex_Printer rp;
+    const std::string version = header_line("     3.02           N: GNSS NAV DATA    E: Galileo", "RINEX VERSION / TYPE");
+    const std::string iono = header_line("GAL    1.2500E+02  2.3438E-01 -3.2043E-03  0.0000E+00", "IONOSPHERIC CORR");
+    const std::string end = header_line("", "END OF HEADER");
+    write_file(HEADER_TEST_FILE, {version, iono, iono, end}, HEADER_TEST_RECORDS);
+
+    // A header with two lines less is padded with two reserved lines
+    std::fstream out(HEADER_TEST_FILE, std::ios::in | std::ios::out);
+    std::vector<std::string> header = read_header(out);
+    header.erase(header.begin() + 1, header.begin() + 3);
+    EXPECT_TRUE(rp.overwrite_header(out, HEADER_TEST_FILE, header));
+    out.close();
+
+    const std::string reserved = rp.reserved_header_line();
+    EXPECT_EQ(file_contents(HEADER_TEST_FILE), version + '\n' + reserved + '\n' + reserved + '\n' + end + '\n' + HEADER_TEST_RECORDS);
+    fs::remove(HEADER_TEST_FILE);
+}
+
+
+TEST_F(RinexPrinterTest, HeaderGrowsRewritesFile)
+{
+    Rinex_Printer rp;
+    const std::string version = header_line("     3.02           OBSERVATION DATA    E (GALILEO)", "RINEX VERSION / TYPE");
+    const std::string leap = header_line("    18    18  2347     7", "LEAP SECONDS");
+    const std::string end = header_line("", "END OF HEADER");
+    write_file(HEADER_TEST_FILE, {version, end}, HEADER_TEST_RECORDS);
+
+    // There is no reserved line, so the records are moved
+    std::fstream out(HEADER_TEST_FILE, std::ios::in | std::ios::out);
+    std::vector<std::string> header = read_header(out);
+    header.insert(header.end() - 1, leap);
+    EXPECT_TRUE(rp.overwrite_header(out, HEADER_TEST_FILE, header));
+    out << "> 2026 10 18 12 00  1.0000000  0  0\n";
+    out.close();
+
+    EXPECT_EQ(file_contents(HEADER_TEST_FILE), version + '\n' + leap + '\n' + end + '\n' + HEADER_TEST_RECORDS + "> 2026 10 18 12 00  1.0000000  0  0\n");
+    fs::remove(HEADER_TEST_FILE);
+}
+
+
+TEST_F(RinexPrinterTest, HeaderWithoutEndKeepsFile)
+{
+    Rinex_Printer rp;
+    const std::string version = header_line("     3.02           OBSERVATION DATA    E (GALILEO)", "RINEX VERSION / TYPE");
+    const std::string leap = header_line("    18    18  2347     7", "LEAP SECONDS");
+    write_file(HEADER_TEST_FILE, {version}, HEADER_TEST_RECORDS);
+
+    // Reading the header hits the end of the file, so nothing is overwritten
+    std::fstream out(HEADER_TEST_FILE, std::ios::in | std::ios::out);
+    std::vector<std::string> header = read_header(out);
+    header.push_back(leap);
+    EXPECT_FALSE(rp.overwrite_header(out, HEADER_TEST_FILE, header));
+    out << "> 2026 10 18 12 00  1.0000000  0  0\n";
+    out.close();
+
+    EXPECT_EQ(file_contents(HEADER_TEST_FILE), version + '\n' + HEADER_TEST_RECORDS + "> 2026 10 18 12 00  1.0000000  0  0\n");
+    fs::remove(HEADER_TEST_FILE);
+}
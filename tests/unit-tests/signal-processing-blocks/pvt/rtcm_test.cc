@@ -9,7 +9,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -157,6 +157,32 @@ TEST(RtcmTest, BinToBinaryData)
 }
 
 
+TEST(RtcmTest, BitWriterAndReader)
+{
+    auto rtcm = std::make_shared<Rtcm>();
+    Rtcm_Bit_Writer writer;
+    writer << std::bitset<3>("101") << std::bitset<12>("111100001111");
+    writer.put(0x2A, 8);
+    writer << std::vector<bool>{true, false, true};
+    Rtcm_Bit_Writer other;
+    other << std::bitset<38>("10000000000000000000000000000000000001");
+    writer << other;
+    EXPECT_EQ(64U, writer.size());
+    EXPECT_EQ(8U, writer.bytes().size());
+    EXPECT_EQ(0, rtcm->bin_to_hex(rtcm->binary_data_to_bin(std::string(writer.bytes().cbegin(), writer.bytes().cend()))).compare("BE1E556000000001"));
+
+    const std::string data(writer.bytes().cbegin(), writer.bytes().cend());
+    const Rtcm_Bit_Reader reader(data);
+    EXPECT_EQ(5U, reader.get_uint(0, 3));
+    EXPECT_EQ(3855U, reader.get_uint(3, 12));
+    EXPECT_EQ(-1, reader.get_int(0, 1));
+    EXPECT_EQ(-241, reader.get_int(3, 12));
+    EXPECT_EQ(42U, reader.get_uint(15, 8));
+    EXPECT_EQ(-137438953471, reader.get_signed_bits(26, 38));
+    EXPECT_EQ(4U, reader.get_uint(60, 6));  // bits beyond the end of the data read as zeros
+}
+
+
 TEST(RtcmTest, CheckCRC)
 {
     auto rtcm = std::make_shared<Rtcm>();
@@ -0,0 +1,215 @@
+/*!
+ * \file rtklib_arena_test.cc
+ * \brief Tests for the scratch memory of the matrix temporaries of the RTKLIB
+ * solvers.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtklib_arena.h"
+#include "rtklib_lambda.h"
+#include "rtklib_rtkcmn.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+constexpr int NX_TEST = 12;  // states
+constexpr int NV_TEST = 16;  // measurements
+constexpr int NA_TEST = 8;   // ambiguities
+
+struct Epoch_Result
+{
+    std::vector<double> x;
+    std::vector<double> P;
+    std::vector<double> F;
+    std::vector<double> s;
+};
+
+
+// Matrix work of an epoch of the RTK solver: a least squares solution, a
+// Kalman filter update, an inversion and an ambiguity search
+Epoch_Result solve_epoch(int seed)
+{
+    std::default_random_engine e2(seed);
+    std::normal_distribution<double> normal(0.0, 1.0);
+
+    std::vector<double> H(NX_TEST * NV_TEST);
+    std::vector<double> v(NV_TEST);
+    for (auto& h : H)
+        {
+            h = normal(e2);
+        }
+    for (auto& y : v)
+        {
+            y = normal(e2);
+        }
+
+    Epoch_Result result;
+    result.x = std::vector<double>(NX_TEST);
+    result.P = std::vector<double>(NX_TEST * NX_TEST);
+    EXPECT_EQ(lsq(H.data(), v.data(), NX_TEST, NV_TEST, result.x.data(), result.P.data()), 0);
+
+    double* R = eye(NV_TEST);
+    for (auto& x : result.x)
+        {
+            x += 1.0;  // filter() skips the states equal to zero
+        }
+    EXPECT_EQ(filter(result.x.data(), result.P.data(), H.data(), v.data(), R, NX_TEST, NV_TEST), 0);
+    matfree(R);
+
+    double* Q = mat(NA_TEST, NA_TEST);
+    for (int i = 0; i < NA_TEST; i++)
+        {
+            for (int j = 0; j < NA_TEST; j++)
+                {
+                    Q[i + j * NA_TEST] = result.P[i + j * NX_TEST];
+                }
+        }
+    EXPECT_EQ(matinv(Q, NA_TEST), 0);
+    EXPECT_EQ(matinv(Q, NA_TEST), 0);
+
+    std::vector<double> a(NA_TEST);
+    for (int i = 0; i < NA_TEST; i++)
+        {
+            a[i] = 10.0 * result.x[i];
+        }
+    result.F = std::vector<double>(NA_TEST * 2);
+    result.s = std::vector<double>(2);
+    EXPECT_EQ(lambda(NA_TEST, 2, a.data(), Q, result.F.data(), result.s.data()), 0);
+    matfree(Q);
+    return result;
+}
+}  // namespace
+
+
+TEST(RtklibArenaTest, AllocateAndReset)
+{
+    Rtklib_Arena arena(1024);
+    EXPECT_EQ(arena.heap_allocations(), 1U);
+    EXPECT_GE(arena.capacity(), 1024U);
+
+    std::vector<void*> blocks;
+    for (size_t bytes : {1, 3, 8, 100, 700, 5000, 24})
+        {
+            void* p = arena.allocate(bytes);
+            ASSERT_NE(p, nullptr);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % alignof(std::max_align_t), 0U);
+            EXPECT_TRUE(arena.owns(p));
+            blocks.push_back(p);
+        }
+    int local = 0;
+    EXPECT_FALSE(arena.owns(&local));
+    EXPECT_FALSE(arena.owns(nullptr));
+
+    // The epoch did not fit in the first block
+    const uint64_t heap_allocations = arena.heap_allocations();
+    EXPECT_GT(heap_allocations, 1U);
+
+    // After a reset, the same epoch fits in a single block
+    const size_t capacity = arena.capacity();
+    arena.reset();
+    EXPECT_EQ(arena.capacity(), capacity);
+    EXPECT_EQ(arena.heap_allocations(), heap_allocations + 1);
+    for (int epoch = 0; epoch < 10; epoch++)
+        {
+            for (size_t bytes : {1, 3, 8, 100, 700, 5000, 24})
+                {
+                    arena.allocate(bytes);
+                }
+            arena.reset();
+        }
+    EXPECT_EQ(arena.capacity(), capacity);
+    EXPECT_EQ(arena.heap_allocations(), heap_allocations + 1);
+}
+
+
+TEST(RtklibArenaTest, ActiveArena)
+{
+    Rtklib_Arena arena;
+    EXPECT_EQ(rtklib_active_arena(), nullptr);
+
+    // Out of any scope, matrices come from the heap
+    double* A = mat(4, 4);
+    EXPECT_FALSE(arena.owns(A));
+
+    {
+        const Rtklib_Arena_Scope scope(arena);
+        EXPECT_EQ(rtklib_active_arena(), &arena);
+        double* B = mat(4, 4);
+        int* C = imat(3, 2);
+        double* D = zeros(5, 5);
+        double* E = eye(3);
+        EXPECT_TRUE(arena.owns(B));
+        EXPECT_TRUE(arena.owns(C));
+        EXPECT_TRUE(arena.owns(D));
+        EXPECT_TRUE(arena.owns(E));
+        for (int i = 0; i < 25; i++)
+            {
+                EXPECT_EQ(D[i], 0.0);
+            }
+        EXPECT_EQ(E[0], 1.0);
+        EXPECT_EQ(E[1], 0.0);
+        EXPECT_EQ(E[4], 1.0);
+        EXPECT_EQ(mat(0, 4), nullptr);
+
+        // Releasing matrices of the arena, or of the heap, is valid in the scope
+        matfree(B);
+        matfree(C);
+        matfree(D);
+        matfree(E);
+        matfree(A);
+
+        {
+            // Nested scopes of the same arena do not reset it
+            const Rtklib_Arena_Scope inner(arena);
+            double* F = mat(2, 2);
+            EXPECT_TRUE(arena.owns(F));
+        }
+        EXPECT_EQ(rtklib_active_arena(), &arena);
+    }
+    EXPECT_EQ(rtklib_active_arena(), nullptr);
+}
+
+
+TEST(RtklibArenaTest, NoHeapAllocationsPerEpoch)
+{
+    Rtklib_Arena arena(256);
+    std::vector<uint64_t> heap_allocations;
+    for (int epoch = 0; epoch < 20; epoch++)
+        {
+            const Epoch_Result expected = solve_epoch(epoch);
+            Epoch_Result result;
+            {
+                const Rtklib_Arena_Scope scope(arena);
+                result = solve_epoch(epoch);
+            }
+            heap_allocations.push_back(arena.heap_allocations());
+
+            // The arena does not change the solution
+            EXPECT_EQ(result.x, expected.x);
+            EXPECT_EQ(result.P, expected.P);
+            EXPECT_EQ(result.F, expected.F);
+            EXPECT_EQ(result.s, expected.s);
+        }
+
+    // The first epoch grows the arena, and merges its blocks when the scope
+    // ends. The following epochs do not touch the heap
+    EXPECT_GT(heap_allocations[0], 1U);
+    for (size_t epoch = 1; epoch < heap_allocations.size(); epoch++)
+        {
+            EXPECT_EQ(heap_allocations[epoch], heap_allocations[0]);
+        }
+}
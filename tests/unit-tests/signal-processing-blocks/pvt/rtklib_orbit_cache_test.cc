@@ -0,0 +1,295 @@
+/*!
+ * \file rtklib_orbit_cache_test.cc
+ * \brief Tests for the analytic satellite velocities and the orbit and clock
+ * evaluation cache of the RTKLIB solvers.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtklib_ephemeris.h"
+#include "rtklib_orbit_cache.h"
+#include "rtklib_rtkcmn.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cmath>
+#include <vector>
+
+
+namespace
+{
+eph_t kepler_ephemeris(int sys, int prn, double A, double e, double i0)
+{
+    eph_t eph{};
+    eph.sat = satno(sys, prn);
+    eph.iode = 17;
+    eph.toe = gpst2time(2200, 345600.0);
+    eph.toc = eph.toe;
+    eph.toes = 345600.0;
+    eph.A = A;
+    eph.e = e;
+    eph.i0 = i0;
+    eph.OMG0 = 1.0;
+    eph.omg = 0.5;
+    eph.M0 = 0.3;
+    eph.deln = 4.5e-9;
+    eph.OMGd = -8e-9;
+    eph.idot = 1e-10;
+    eph.crc = 200.0;
+    eph.crs = -50.0;
+    eph.cuc = -2e-6;
+    eph.cus = 8e-6;
+    eph.cic = 1e-7;
+    eph.cis = -1e-7;
+    eph.f0 = 1e-4;
+    eph.f1 = 1e-11;
+    eph.f2 = 1e-18;
+    return eph;
+}
+
+
+std::vector<eph_t> kepler_ephemerides()
+{
+    std::vector<eph_t> ephs;
+    ephs.push_back(kepler_ephemeris(SYS_GPS, 5, 26559700.0, 0.01, 0.96));
+    ephs.push_back(kepler_ephemeris(SYS_GAL, 11, 29600000.0, 0.0003, 0.98));
+    ephs.push_back(kepler_ephemeris(SYS_BDS, 20, 27906000.0, 0.002, 0.96));
+    ephs.push_back(kepler_ephemeris(SYS_BDS, 3, 42164000.0, 0.0005, 0.05));  // GEO
+    eph_t has = kepler_ephemeris(SYS_GAL, 12, 29600000.0, 0.0003, 0.98);
+    has.apply_has_corrections = true;
+    has.has_clock_correction_m = 0.2F;
+    has.has_orbit_radial_correction_m = 0.1F;
+    has.has_orbit_in_track_correction_m = -0.3F;
+    has.has_orbit_cross_track_correction_m = 0.05F;
+    ephs.push_back(has);
+    return ephs;
+}
+
+
+geph_t glonass_ephemeris()
+{
+    // Inclined circular orbit, with the velocity in the ECEF frame
+    geph_t geph{};
+    geph.sat = satno(SYS_GLO, 7);
+    geph.iode = 45;
+    geph.toe = gpst2time(2200, 345600.0);
+    geph.pos[0] = 25510000.0;
+    geph.vel[1] = 1688.0 - 7.292115e-5 * 25510000.0;
+    geph.vel[2] = 3578.0;
+    geph.acc[0] = 1e-6;
+    geph.acc[1] = -2e-6;
+    geph.taun = -2e-5;
+    geph.gamn = 1e-12;
+    return geph;
+}
+
+
+double distance(const double* a, const double* b)
+{
+    return std::sqrt((a[0] - b[0]) * (a[0] - b[0]) + (a[1] - b[1]) * (a[1] - b[1]) + (a[2] - b[2]) * (a[2] - b[2]));
+}
+}  // namespace
+
+
+TEST(RtklibOrbitCacheTest, AnalyticKeplerVelocity)
+{
+    for (const auto& eph : kepler_ephemerides())
+        {
+            for (double t = -7200.0; t <= 7200.0; t += 900.0)
+                {
+                    const gtime_t time = timeadd(eph.toe, t + 0.123);
+                    std::array<double, 6> rs{};
+                    std::array<double, 2> dts{};
+                    double var = 0.0;
+                    eph2posvel(time, &eph, rs.data(), dts.data(), &var);
+
+                    // Same position and clock bias as eph2pos()
+                    std::array<double, 3> pos{};
+                    double clk = 0.0;
+                    double var0 = 0.0;
+                    eph2pos(time, &eph, pos.data(), &clk, &var0);
+                    EXPECT_EQ(rs[0], pos[0]);
+                    EXPECT_EQ(rs[1], pos[1]);
+                    EXPECT_EQ(rs[2], pos[2]);
+                    EXPECT_EQ(dts[0], clk);
+                    EXPECT_EQ(var, var0);
+
+                    // Velocity and clock drift by central differences
+                    std::array<double, 3> before{};
+                    std::array<double, 3> after{};
+                    double clk_before = 0.0;
+                    double clk_after = 0.0;
+                    eph2pos(timeadd(time, -0.05), &eph, before.data(), &clk_before, &var0);
+                    eph2pos(timeadd(time, 0.05), &eph, after.data(), &clk_after, &var0);
+                    for (int i = 0; i < 3; i++)
+                        {
+                            EXPECT_NEAR(rs[i + 3], (after[i] - before[i]) / 0.1, 1e-4) << "sat " << eph.sat << " t " << t;
+                        }
+                    EXPECT_NEAR(dts[1], (clk_after - clk_before) / 0.1, 1e-14) << "sat " << eph.sat << " t " << t;
+                }
+        }
+}
+
+
+TEST(RtklibOrbitCacheTest, GlonassPropagation)
+{
+    const geph_t geph = glonass_ephemeris();
+    int steps = 0;
+    std::array<double, 6> x{};
+    for (double t = -1700.0; t <= 1700.0; t += 37.3)
+        {
+            const gtime_t time = timeadd(geph.toe, t);
+            std::array<double, 6> rs{};
+            std::array<double, 2> dts{};
+            double var = 0.0;
+            geph2posvel(time, &geph, rs.data(), dts.data(), &var);
+
+            // Continuing the integration gives the same state as starting it at toe
+            std::array<double, 6> xt{};
+            gloprop(t, &geph, &steps, x.data(), xt.data());
+            for (int i = 0; i < 6; i++)
+                {
+                    EXPECT_EQ(xt[i], rs[i]);
+                }
+
+            std::array<double, 3> pos{};
+            double clk = 0.0;
+            geph2pos(time, &geph, pos.data(), &clk, &var);
+            EXPECT_EQ(rs[0], pos[0]);
+            EXPECT_EQ(rs[1], pos[1]);
+            EXPECT_EQ(rs[2], pos[2]);
+            EXPECT_EQ(dts[0], clk);
+            EXPECT_EQ(dts[1], geph.gamn);
+
+            std::array<double, 3> before{};
+            std::array<double, 3> after{};
+            geph2pos(timeadd(time, -0.05), &geph, before.data(), &clk, &var);
+            geph2pos(timeadd(time, 0.05), &geph, after.data(), &clk, &var);
+            for (int i = 0; i < 3; i++)
+                {
+                    EXPECT_NEAR(rs[i + 3], (after[i] - before[i]) / 0.1, 1e-3);
+                }
+        }
+}
+
+
+TEST(RtklibOrbitCacheTest, Interpolation)
+{
+    // 20 Hz solutions during 10 minutes
+    const std::vector<eph_t> ephs = kepler_ephemerides();
+    const geph_t geph = glonass_ephemeris();
+    Rtklib_Orbit_Cache cache;
+    const int epochs = 12000;
+    for (int k = 0; k < epochs; k++)
+        {
+            const double t = 600.0 + 0.05 * k - 0.071;
+            std::array<double, 6> rs{};
+            std::array<double, 6> expected_rs{};
+            std::array<double, 2> dts{};
+            std::array<double, 2> expected_dts{};
+            double var = 0.0;
+            double expected_var = 0.0;
+            for (const auto& eph : ephs)
+                {
+                    const gtime_t time = timeadd(eph.toe, t);
+                    cache.eph2posvel(time, &eph, rs.data(), dts.data(), &var);
+                    eph2posvel(time, &eph, expected_rs.data(), expected_dts.data(), &expected_var);
+                    ASSERT_LT(distance(rs.data(), expected_rs.data()), 1e-3) << "sat " << eph.sat << " t " << t;
+                    ASSERT_LT(distance(rs.data() + 3, expected_rs.data() + 3), 1e-5);
+                    ASSERT_NEAR(dts[0], expected_dts[0], 1e-13);
+                    ASSERT_NEAR(dts[1], expected_dts[1], 1e-14);
+                    ASSERT_EQ(var, expected_var);
+                }
+            const gtime_t time = timeadd(geph.toe, t);
+            cache.geph2posvel(time, &geph, rs.data(), dts.data(), &var);
+            geph2posvel(time, &geph, expected_rs.data(), expected_dts.data(), &expected_var);
+            ASSERT_LT(distance(rs.data(), expected_rs.data()), 1e-3) << "t " << t;
+            ASSERT_LT(distance(rs.data() + 3, expected_rs.data() + 3), 1e-5);
+            ASSERT_NEAR(dts[0], expected_dts[0], 1e-16);
+            ASSERT_EQ(var, expected_var);
+        }
+
+    // One evaluation per satellite every 30 s, plus the first node
+    const uint64_t satellites = ephs.size() + 1;
+    EXPECT_LE(cache.evaluations(), satellites * (epochs * 0.05 / 30.0 + 2));
+
+    // A new ephemeris replaces the cached one
+    eph_t eph = ephs[0];
+    eph.M0 += 0.01;
+    std::array<double, 6> rs{};
+    std::array<double, 6> expected_rs{};
+    std::array<double, 2> dts{};
+    double var = 0.0;
+    const gtime_t time = timeadd(eph.toe, 1000.0);
+    cache.eph2posvel(time, &eph, rs.data(), dts.data(), &var);
+    eph2posvel(time, &eph, expected_rs.data(), dts.data(), &var);
+    EXPECT_LT(distance(rs.data(), expected_rs.data()), 1e-3);
+}
+
+
+TEST(RtklibOrbitCacheTest, EphemerisIndex)
+{
+    // Several ephemerides of each satellite, interleaved
+    std::vector<eph_t> ephs;
+    for (int iode = 0; iode < 4; iode++)
+        {
+            for (auto eph : kepler_ephemerides())
+                {
+                    eph.iode = iode;
+                    eph.toe = timeadd(eph.toe, 3600.0 * (iode - 1));
+                    ephs.push_back(eph);
+                }
+        }
+    std::vector<geph_t> gephs(3, glonass_ephemeris());
+    gephs[1].iode = 46;
+    gephs[1].toe = timeadd(gephs[1].toe, 900.0);
+    gephs[2].sat = satno(SYS_GLO, 8);
+
+    nav_t nav{};
+    nav.eph = ephs.data();
+    nav.n = static_cast<int>(ephs.size());
+    nav.geph = gephs.data();
+    nav.ng = static_cast<int>(gephs.size());
+    Rtklib_Orbit_Cache cache;
+
+    for (int indexed = 0; indexed < 2; indexed++)
+        {
+            if (indexed)
+                {
+                    nav.orbits = &cache;
+                    cache.index(&nav);
+                }
+            for (int iode = -1; iode < 5; iode++)
+                {
+                    for (double t = -4000.0; t < 10000.0; t += 500.0)
+                        {
+                            nav_t unindexed = nav;
+                            unindexed.orbits = nullptr;
+                            for (const auto& eph : ephs)
+                                {
+                                    const gtime_t time = timeadd(ephs[0].toe, t);
+                                    EXPECT_EQ(seleph(time, eph.sat, iode, &nav), seleph(time, eph.sat, iode, &unindexed));
+                                }
+                            const gtime_t time = timeadd(gephs[0].toe, t / 4.0);
+                            EXPECT_EQ(selgeph(time, gephs[0].sat, iode + 44, &nav), selgeph(time, gephs[0].sat, iode + 44, &unindexed));
+                            EXPECT_EQ(selgeph(time, gephs[2].sat, -1, &nav), selgeph(time, gephs[2].sat, -1, &unindexed));
+                        }
+                }
+        }
+
+    // The index is not used for other ephemerides than the indexed ones
+    int n = 0;
+    EXPECT_NE(cache.eph_index(&nav, ephs[0].sat, &n), nullptr);
+    EXPECT_EQ(n, 4);
+    nav.n--;
+    EXPECT_EQ(cache.eph_index(&nav, ephs[0].sat, &n), nullptr);
+    EXPECT_EQ(seleph(timeadd(ephs[0].toe, 3600.0), ephs[0].sat, -1, &nav), &ephs[5]);
+}
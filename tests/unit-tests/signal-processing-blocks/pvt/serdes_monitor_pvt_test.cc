@@ -35,6 +35,32 @@ TEST(Serdes_Monitor_Pvt_Test, Simpletest)
 }
 
 
+TEST(Serdes_Monitor_Pvt_Test, OutputStats)
+{
+    auto monitor = std::make_shared<Monitor_Pvt>(Monitor_Pvt());
+    Monitor_Pvt_Output output;
+    output.name = "NMEA";
+    output.processed = 100;
+    output.dropped = 3;
+    output.max_latency_ms = 12.5;
+    monitor->outputs.push_back(output);
+
+    Serdes_Monitor_Pvt serdes = Serdes_Monitor_Pvt();
+    std::string serialized_data = serdes.createProtobuffer(monitor.get());
+
+    gnss_sdr::MonitorPvt mon;
+    mon.ParseFromString(serialized_data);
+    ASSERT_EQ(mon.outputs_size(), 1);
+    EXPECT_EQ(mon.outputs(0).name(), "NMEA");
+
+    const Monitor_Pvt read_monitor = serdes.readProtobuffer(mon);
+    ASSERT_EQ(read_monitor.outputs.size(), 1U);
+    EXPECT_EQ(read_monitor.outputs[0].processed, 100U);
+    EXPECT_EQ(read_monitor.outputs[0].dropped, 3U);
+    EXPECT_NEAR(read_monitor.outputs[0].max_latency_ms, 12.5, 1e-9);
+}
+
+
 TEST(Serdes_Monitor_Pvt_Test, GalileoEphemerisSerdes)
 {
     auto eph = std::make_shared<Galileo_Ephemeris>();
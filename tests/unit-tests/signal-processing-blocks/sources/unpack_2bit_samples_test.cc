@@ -10,7 +10,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -157,6 +157,56 @@ TEST(Unpack2bitSamplesTest, CheckLittleEndianByte)
 }
 
 
+TEST(Unpack2bitSamplesTest, CheckLittleEndianByteLongVector)
+{
+    // Long enough to go through the SIMD kernels, plus a tail
+    bool big_endian_bytes = false;
+    size_t item_size = 1;
+    bool big_endian_items = false;
+
+    const std::vector<int8_t> values = {1, 3, -3, -1};
+    std::vector<int8_t> raw_data(1028);
+    for (size_t i = 0; i < raw_data.size(); ++i)
+        {
+            raw_data[i] = values[(i * 7 + i / 5) % 4];
+        }
+    std::vector<uint8_t> packed_data = packData(raw_data, big_endian_bytes);
+    std::vector<uint8_t> unpacked_data;
+
+    gr::top_block_sptr top_block = gr::make_top_block("Unpack2bitSamplesTest");
+
+    gr::blocks::vector_source_b::sptr source =
+        gr::blocks::vector_source_b::make(packed_data);
+
+    auto unpacker =
+        make_unpack_2bit_samples(big_endian_bytes,
+            item_size,
+            big_endian_items);
+
+    gr::blocks::stream_to_vector::sptr stov =
+        gr::blocks::stream_to_vector::make(item_size, raw_data.size());
+
+    gr::blocks::vector_sink_b::sptr sink =
+        gr::blocks::vector_sink_b::make(raw_data.size());
+
+    top_block->connect(source, 0, unpacker, 0);
+    top_block->connect(unpacker, 0, stov, 0);
+    top_block->connect(stov, 0, sink, 0);
+
+    top_block->run();
+    top_block->stop();
+
+    unpacked_data = sink->data();
+
+    EXPECT_EQ(raw_data.size(), unpacked_data.size());
+
+    for (size_t i = 0; i < raw_data.size(); ++i)
+        {
+            EXPECT_EQ(raw_data[i], static_cast<int8_t>(unpacked_data[i]));
+        }
+}
+
+
 TEST(Unpack2bitSamplesTest, CheckBigEndianShortBigEndianByte)
 {
     bool big_endian_bytes = true;
@@ -0,0 +1,99 @@
+/*!
+ * \file viterbi_decoder_test.cc
+ * \brief Tests for the Viterbi decoder of convolutional codes.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "viterbi_decoder.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+// Rate 1/2 convolutional encoder, followed by BPSK with Gaussian noise. The
+// output is in the LLR-like form expected by Viterbi_Decoder.
+std::vector<float> encode_and_modulate(const std::vector<int32_t>& bits, int32_t KK, const std::array<int32_t, 2>& g, float sigma, std::mt19937& gen)
+{
+    std::normal_distribution<float> noise(0.0, sigma);
+    std::vector<float> symbols;
+    int32_t state = 0;
+    for (const auto bit : bits)
+        {
+            const int32_t word = (bit << (KK - 1)) ^ state;
+            for (const auto polynomial : g)
+                {
+                    int32_t parity = 0;
+                    for (int32_t reg = word & polynomial; reg != 0; reg >>= 1)
+                        {
+                            parity ^= reg & 1;
+                        }
+                    symbols.push_back((parity ? 1.0F : -1.0F) + noise(gen));
+                }
+            state = word >> 1;
+        }
+    return symbols;
+}
+
+
+int32_t count_bit_errors(int32_t KK, const std::array<int32_t, 2>& g, int32_t data_length, float sigma, int32_t frames)
+{
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int32_t> uniform_bit(0, 1);
+    Viterbi_Decoder decoder(KK, 2, data_length, g);
+    int32_t errors = 0;
+    for (int32_t f = 0; f < frames; f++)
+        {
+            std::vector<int32_t> bits(data_length + KK - 1, 0);  // zero tail
+            for (int32_t i = 0; i < data_length; i++)
+                {
+                    bits[i] = uniform_bit(gen);
+                }
+            const std::vector<float> symbols = encode_and_modulate(bits, KK, g, sigma, gen);
+            std::vector<int32_t> decoded(data_length);
+            decoder.decode(decoded, symbols);
+            for (int32_t i = 0; i < data_length; i++)
+                {
+                    errors += (decoded[i] != bits[i]);
+                }
+        }
+    return errors;
+}
+}  // namespace
+
+
+TEST(ViterbiDecoderTest, GalileoCodeNoiseless)
+{
+    // Constraint length 7, uses the butterfly implementation
+    EXPECT_EQ(count_bit_errors(7, {{121, 91}}, 114, 0.0, 10), 0);
+}
+
+
+TEST(ViterbiDecoderTest, GalileoCodeWithNoise)
+{
+    // Eb/N0 = 6 dB. Both symbols of each pair must contribute to the metrics
+    // for the decoding to be error-free at this noise level.
+    EXPECT_EQ(count_bit_errors(7, {{121, 91}}, 238, 0.5, 100), 0);
+}
+
+
+TEST(ViterbiDecoderTest, ConstraintLengthFive)
+{
+    // Generic state-by-state implementation
+    EXPECT_EQ(count_bit_errors(5, {{19, 29}}, 100, 0.0, 10), 0);
+    EXPECT_EQ(count_bit_errors(5, {{19, 29}}, 100, 0.4, 100), 0);
+}
@@ -279,3 +279,64 @@ TEST(CpuMulticorrelatorRealCodesTest, MeasureExecutionTimeAlloc)
             correlator_pool[n]->free();
         }
 }
+
+
+TEST(CpuMulticorrelatorRealCodesTest, FusedCorrelatorMatchesSeparateCorrelators)
+{
+    const int vector_length = 4096;
+    const int n_taps = 3;
+    volk_gnsssdr::vector<float> pilot_code(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS));
+    volk_gnsssdr::vector<float> data_code(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS));
+    gps_l1_ca_code_gen_float(pilot_code, 1, 0);
+    gps_l1_ca_code_gen_float(data_code, 2, 0);
+    volk_gnsssdr::vector<float> shifts_chips{-0.5, 0.0, 0.5};
+
+    std::default_random_engine e1(1234);
+    std::uniform_real_distribution<float> uniform_dist(-1, 1);
+    volk_gnsssdr::vector<gr_complex> in_cpu(vector_length);
+    for (auto& sample : in_cpu)
+        {
+            sample = gr_complex(uniform_dist(e1), uniform_dist(e1));
+        }
+
+    for (bool high_dyn : {true, false})
+        {
+            volk_gnsssdr::vector<gr_complex> pilot_outs(n_taps);
+            volk_gnsssdr::vector<gr_complex> data_out(1);
+            volk_gnsssdr::vector<gr_complex> fused_pilot_outs(n_taps);
+            volk_gnsssdr::vector<gr_complex> fused_data_out(1);
+
+            Cpu_Multicorrelator_Real_Codes pilot_correlator;
+            Cpu_Multicorrelator_Real_Codes data_correlator;
+            Cpu_Multicorrelator_Real_Codes fused_correlator;
+            pilot_correlator.set_high_dynamics_resampler(high_dyn);
+            data_correlator.set_high_dynamics_resampler(high_dyn);
+            fused_correlator.set_high_dynamics_resampler(high_dyn);
+            pilot_correlator.init(vector_length, n_taps);
+            data_correlator.init(vector_length, 1);
+            fused_correlator.init(vector_length, n_taps);
+
+            pilot_correlator.set_local_code_and_taps(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS), pilot_code.data(), shifts_chips.data());
+            data_correlator.set_local_code_and_taps(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS), data_code.data(), &shifts_chips[1]);
+            fused_correlator.set_local_code_and_taps(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS), pilot_code.data(), shifts_chips.data());
+            EXPECT_TRUE(fused_correlator.set_fused_code_and_tap(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS), data_code.data(), &shifts_chips[1], fused_data_out.data()));
+
+            pilot_correlator.set_input_output_vectors(pilot_outs.data(), in_cpu.data());
+            data_correlator.set_input_output_vectors(data_out.data(), in_cpu.data());
+            fused_correlator.set_input_output_vectors(fused_pilot_outs.data(), in_cpu.data());
+
+            pilot_correlator.Carrier_wipeoff_multicorrelator_resampler(0.2, 0.1, 1e-6, 0.4, 0.25, 1e-7, vector_length);
+            data_correlator.Carrier_wipeoff_multicorrelator_resampler(0.2, 0.1, 1e-6, 0.4, 0.25, 1e-7, vector_length);
+            fused_correlator.Carrier_wipeoff_multicorrelator_resampler(0.2, 0.1, 1e-6, 0.4, 0.25, 1e-7, vector_length);
+
+            for (int n = 0; n < n_taps; n++)
+                {
+                    EXPECT_NEAR(std::abs(pilot_outs[n] - fused_pilot_outs[n]), 0.0, 1e-3 * std::abs(pilot_outs[n]) + 1e-3);
+                }
+            EXPECT_NEAR(std::abs(data_out[0] - fused_data_out[0]), 0.0, 1e-3 * std::abs(data_out[0]) + 1e-3);
+
+            pilot_correlator.free();
+            data_correlator.free();
+            fused_correlator.free();
+        }
+}
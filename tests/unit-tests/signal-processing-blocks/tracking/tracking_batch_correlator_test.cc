@@ -0,0 +1,200 @@
+/*!
+ * \file tracking_batch_correlator_test.cc
+ * \brief Tests for the multi-channel batch tracking correlator.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "GPS_L1_CA.h"
+#include "cpu_multicorrelator_real_codes.h"
+#include "gps_sdr_signal_replica.h"
+#include "tracking_batch_correlator.h"
+#include <gnuradio/gr_complex.h>
+#include <gtest/gtest.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+constexpr int32_t BATCH_TEST_CHANNELS = 6;
+constexpr int32_t BATCH_TEST_TAPS = 3;
+constexpr int32_t BATCH_TEST_SAMPLES = 4096;
+
+class TrackingBatchCorrelatorTest : public ::testing::Test
+{
+protected:
+    TrackingBatchCorrelatorTest()
+        : in_cpu(BATCH_TEST_SAMPLES + BATCH_TEST_CHANNELS * 7),
+          shifts_chips{-0.5, 0.0, 0.5}
+    {
+        std::default_random_engine e1(1234);
+        std::uniform_real_distribution<float> uniform_dist(-1, 1);
+        for (auto& sample : in_cpu)
+            {
+                sample = gr_complex(uniform_dist(e1), uniform_dist(e1));
+            }
+        for (int32_t ch = 0; ch < BATCH_TEST_CHANNELS; ch++)
+            {
+                codes.emplace_back(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS));
+                gps_l1_ca_code_gen_float(codes.back(), ch + 1, 0);
+            }
+        for (int32_t ch = 0; ch < BATCH_TEST_CHANNELS; ch++)
+            {
+                Tracking_Batch_Request r;
+                r.sig_in = &in_cpu[ch * 7];  // each channel reads from a different offset of the same buffer
+                r.local_code = codes[ch].data();
+                r.shifts_chips = shifts_chips.data();
+                r.rem_carrier_phase_rad = 0.1F * static_cast<float>(ch);
+                r.phase_step_rad = 0.01F + 0.02F * static_cast<float>(ch);
+                r.rem_code_phase_chips = -0.3F + 0.1F * static_cast<float>(ch);
+                r.code_phase_step_chips = 0.25F + 1e-6F * static_cast<float>(ch);
+                r.code_length_chips = static_cast<int32_t>(GPS_L1_CA_CODE_LENGTH_CHIPS);
+                r.n_correlators = BATCH_TEST_TAPS;
+                r.n_samples = BATCH_TEST_SAMPLES - (ch % 2);
+                requests.push_back(r);
+            }
+    }
+
+    // Reference outputs of each channel computed with its own correlator
+    std::vector<std::vector<gr_complex>> reference_outputs() const
+    {
+        std::vector<std::vector<gr_complex>> outs;
+        for (const auto& r : requests)
+            {
+                volk_gnsssdr::vector<gr_complex> corr(BATCH_TEST_TAPS);
+                Cpu_Multicorrelator_Real_Codes correlator;
+                correlator.set_high_dynamics_resampler(false);
+                correlator.init(BATCH_TEST_SAMPLES, BATCH_TEST_TAPS);
+                correlator.set_local_code_and_taps(r.code_length_chips, r.local_code, const_cast<float*>(r.shifts_chips));
+                correlator.set_input_output_vectors(corr.data(), r.sig_in);
+                correlator.Carrier_wipeoff_multicorrelator_resampler(r.rem_carrier_phase_rad, r.phase_step_rad, r.rem_code_phase_chips, r.code_phase_step_chips, 0.0, r.n_samples);
+                correlator.free();
+                outs.emplace_back(corr.begin(), corr.end());
+            }
+        return outs;
+    }
+
+    volk_gnsssdr::vector<gr_complex> in_cpu;
+    volk_gnsssdr::vector<float> shifts_chips;
+    std::vector<volk_gnsssdr::vector<float>> codes;
+    std::vector<Tracking_Batch_Request> requests;
+};
+}  // namespace
+
+
+TEST_F(TrackingBatchCorrelatorTest, BatchMatchesPerChannelCorrelators)
+{
+    std::vector<std::vector<gr_complex>> batch_outs(BATCH_TEST_CHANNELS, std::vector<gr_complex>(BATCH_TEST_TAPS));
+    std::vector<const Tracking_Batch_Request*> batch;
+    for (int32_t ch = 0; ch < BATCH_TEST_CHANNELS; ch++)
+        {
+            requests[ch].corr_out = batch_outs[ch].data();
+            batch.push_back(&requests[ch]);
+        }
+    Tracking_Batch_Correlator::correlate_batch(batch.data(), batch.size());
+
+    const auto expected = reference_outputs();
+    for (int32_t ch = 0; ch < BATCH_TEST_CHANNELS; ch++)
+        {
+            for (int32_t tap = 0; tap < BATCH_TEST_TAPS; tap++)
+                {
+                    EXPECT_NEAR(std::abs(batch_outs[ch][tap] - expected[ch][tap]), 0.0, 1e-3 * std::abs(expected[ch][tap]) + 1e-2);
+                }
+        }
+}
+
+
+TEST_F(TrackingBatchCorrelatorTest, ChannelsOnDifferentBuffers)
+{
+    // Odd channels read from another buffer, so the batch has two input spans
+    volk_gnsssdr::vector<gr_complex> other_in(in_cpu.rbegin(), in_cpu.rend());
+    std::vector<std::vector<gr_complex>> batch_outs(BATCH_TEST_CHANNELS, std::vector<gr_complex>(BATCH_TEST_TAPS));
+    std::vector<const Tracking_Batch_Request*> batch;
+    for (int32_t ch = 0; ch < BATCH_TEST_CHANNELS; ch++)
+        {
+            if (ch % 2)
+                {
+                    requests[ch].sig_in = &other_in[ch * 7];
+                }
+            requests[ch].corr_out = batch_outs[ch].data();
+            batch.push_back(&requests[ch]);
+        }
+    Tracking_Batch_Correlator::correlate_batch(batch.data(), batch.size());
+
+    const auto expected = reference_outputs();
+    for (int32_t ch = 0; ch < BATCH_TEST_CHANNELS; ch++)
+        {
+            for (int32_t tap = 0; tap < BATCH_TEST_TAPS; tap++)
+                {
+                    EXPECT_NEAR(std::abs(batch_outs[ch][tap] - expected[ch][tap]), 0.0, 1e-3 * std::abs(expected[ch][tap]) + 1e-2);
+                }
+        }
+}
+
+
+TEST_F(TrackingBatchCorrelatorTest, FusedCorrelatorMatchesPrompt)
+{
+    // A fused correlator with the same code and the prompt shift must match the prompt tap
+    std::vector<gr_complex> outs(BATCH_TEST_TAPS);
+    gr_complex fused_out(0.0, 0.0);
+    requests[0].corr_out = outs.data();
+    requests[0].fused_code = requests[0].local_code;
+    requests[0].fused_shift_chips = &shifts_chips[1];
+    requests[0].fused_corr_out = &fused_out;
+    const Tracking_Batch_Request* batch[1] = {&requests[0]};
+    Tracking_Batch_Correlator::correlate_batch(batch, 1);
+    EXPECT_EQ(fused_out, outs[1]);
+}
+
+
+TEST_F(TrackingBatchCorrelatorTest, ConcurrentChannels)
+{
+    auto engine = Tracking_Batch_Correlator::get_instance("TEST_batch", 4);
+    EXPECT_EQ(engine, Tracking_Batch_Correlator::get_instance("TEST_batch", 4));
+
+    const int32_t iterations = 50;
+    std::vector<std::vector<gr_complex>> outs(BATCH_TEST_CHANNELS, std::vector<gr_complex>(BATCH_TEST_TAPS));
+    std::vector<std::thread> threads;
+    for (int32_t ch = 0; ch < BATCH_TEST_CHANNELS; ch++)
+        {
+            requests[ch].corr_out = outs[ch].data();
+            threads.emplace_back([&, ch]() {
+                for (int32_t i = 0; i < iterations; i++)
+                    {
+                        engine->correlate(requests[ch]);
+                    }
+            });
+        }
+    for (auto& t : threads)
+        {
+            t.join();
+        }
+
+    EXPECT_EQ(engine->served_requests(), static_cast<uint64_t>(BATCH_TEST_CHANNELS * iterations));
+    EXPECT_LE(engine->served_batches(), engine->served_requests());
+    EXPECT_LE(engine->max_batch_size(), 4U);
+
+    const auto expected = reference_outputs();
+    for (int32_t ch = 0; ch < BATCH_TEST_CHANNELS; ch++)
+        {
+            for (int32_t tap = 0; tap < BATCH_TEST_TAPS; tap++)
+                {
+                    EXPECT_NEAR(std::abs(outs[ch][tap] - expected[ch][tap]), 0.0, 1e-3 * std::abs(expected[ch][tap]) + 1e-2);
+                }
+        }
+}
@@ -0,0 +1,301 @@
+/*!
+ * \file gnss_packed_frame_test.cc
+ * \brief Tests the packed navigation message frames and the field tables of
+ * the Galileo I/NAV, Galileo F/NAV and GPS LNAV messages against the
+ * decoding of the same fields from a std::bitset
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "GPS_L1_CA.h"
+#include "Galileo_E5a.h"
+#include "Galileo_FNAV.h"
+#include "Galileo_INAV.h"
+#include "gnss_packed_frame.h"
+#include <gtest/gtest.h>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+// Random frames of N bits, as strings of '0' and '1' characters
+template <size_t N>
+std::vector<std::string> random_frames(size_t n_frames)
+{
+    std::default_random_engine e2(N);
+    std::bernoulli_distribution bit(0.5);
+    std::vector<std::string> frames;
+    for (size_t k = 0; k < n_frames; k++)
+        {
+            std::string bits(N, '0');
+            for (auto& b : bits)
+                {
+                    b = bit(e2) ? '1' : '0';
+                }
+            frames.push_back(bits);
+        }
+    // All ones and all zeros, to check the sign extension
+    frames.emplace_back(N, '1');
+    frames.emplace_back(N, '0');
+    return frames;
+}
+
+
+// Unsigned value of a field, read bit by bit from a std::bitset as the
+// navigation message classes did before the packed frames
+template <size_t N, typename Field>
+uint64_t bitset_unsigned(const std::bitset<N>& bits, const Field& field)
+{
+    uint64_t value = 0ULL;
+    for (const auto& p : field)
+        {
+            for (int32_t j = 0; j < p.second; j++)
+                {
+                    value <<= 1U;
+                    if (bits[N - p.first - j] == 1)
+                        {
+                            value += 1;
+                        }
+                }
+        }
+    return value;
+}
+
+
+// Two's complement value of a field, read bit by bit from a std::bitset
+template <size_t N, typename Field>
+int64_t bitset_signed(const std::bitset<N>& bits, const Field& field)
+{
+    int64_t value = (bits[N - field[0].first] == 1) ? -1LL : 0LL;
+    for (const auto& p : field)
+        {
+            for (int32_t j = 0; j < p.second; j++)
+                {
+                    value = static_cast<int64_t>(static_cast<uint64_t>(value) << 1U) | static_cast<int64_t>(bits[N - p.first - j]);
+                }
+        }
+    return value;
+}
+
+
+// True if any part of the field spans two 64-bit words of the packed frame
+template <typename Field>
+bool straddles_word(const Field& field)
+{
+    for (const auto& p : field)
+        {
+            if ((p.first - 1) / 64 != (p.first + p.second - 2) / 64)
+                {
+                    return true;
+                }
+        }
+    return false;
+}
+
+
+// Checks a field table on a set of frames
+template <size_t N, typename Field>
+void check_field(const std::vector<std::string>& frames, const Field& field, const std::string& name)
+{
+    for (const auto& frame : frames)
+        {
+            const std::bitset<N> bits(frame);
+            const Gnss_Packed_Frame<N> packed(frame);
+            EXPECT_EQ(packed.read_unsigned(field), bitset_unsigned(bits, field)) << name;
+            EXPECT_EQ(packed.read_signed(field), bitset_signed(bits, field)) << name;
+            EXPECT_EQ(packed.read_bool(field), bits[N - field[0].first] == 1) << name;
+        }
+}
+}  // namespace
+
+
+#define CHECK_FIELD(N, frames, field) check_field<N>(frames, field, #field)
+
+
+TEST(GnssPackedFrameTest, ConstructorsAgree)
+{
+    for (const auto& frame : random_frames<GPS_SUBFRAME_BITS>(20))
+        {
+            const std::bitset<GPS_SUBFRAME_BITS> bits(frame);
+            std::vector<int32_t> symbols;
+            for (const auto& b : frame)
+                {
+                    symbols.push_back(b == '1' ? 1 : -1);
+                }
+            const Gnss_Packed_Frame<GPS_SUBFRAME_BITS> from_string(frame);
+            const Gnss_Packed_Frame<GPS_SUBFRAME_BITS> from_bitset(bits);
+            const Gnss_Packed_Frame<GPS_SUBFRAME_BITS> from_symbols(symbols);
+            EXPECT_EQ(from_string.to_string(), frame);
+            EXPECT_EQ(from_bitset.to_string(), frame);
+            EXPECT_EQ(from_symbols.to_string(), frame);
+            EXPECT_EQ(from_string.to_bitset(), bits);
+        }
+}
+
+
+TEST(GnssPackedFrameTest, ReadsAnyBitRange)
+{
+    // Every position and length, within a word and across words
+    for (const auto& frame : random_frames<GPS_SUBFRAME_BITS>(10))
+        {
+            const std::bitset<GPS_SUBFRAME_BITS> bits(frame);
+            const Gnss_Packed_Frame<GPS_SUBFRAME_BITS> packed(frame);
+            for (int32_t first = 1; first <= GPS_SUBFRAME_BITS; first++)
+                {
+                    for (int32_t length = 1; length <= 64 && first + length - 1 <= GPS_SUBFRAME_BITS; length++)
+                        {
+                            const Gnss_Frame_Field<1> field{{{first, length}}};
+                            ASSERT_EQ(packed.read_unsigned(first, length), bitset_unsigned(bits, field)) << "first = " << first << ", length = " << length;
+                            ASSERT_EQ(packed.read_signed(field), bitset_signed(bits, field)) << "first = " << first << ", length = " << length;
+                        }
+                }
+        }
+}
+
+
+TEST(GnssPackedFrameTest, WritesAndCopiesAnyBitRange)
+{
+    std::default_random_engine e2(1);
+    std::uniform_int_distribution<uint64_t> values;
+    const auto frames = random_frames<GALILEO_FNAV_DATA_FRAME_BITS>(10);
+    for (const auto& frame : frames)
+        {
+            for (int32_t first = 1; first <= GALILEO_FNAV_DATA_FRAME_BITS; first += 3)
+                {
+                    for (int32_t length = 1; length <= 64 && first + length - 1 <= GALILEO_FNAV_DATA_FRAME_BITS; length++)
+                        {
+                            const uint64_t value = values(e2);
+                            std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> bits(frame);
+                            Gnss_Packed_Frame<GALILEO_FNAV_DATA_FRAME_BITS> packed(frame);
+                            packed.write_unsigned(first, length, value);
+                            for (int32_t j = 0; j < length; j++)
+                                {
+                                    bits[GALILEO_FNAV_DATA_FRAME_BITS - first - j] = ((value >> (length - 1 - j)) & 1U) == 1U;
+                                }
+                            // Only the field changes
+                            ASSERT_EQ(packed.to_bitset(), bits) << "first = " << first << ", length = " << length;
+                        }
+                }
+        }
+
+    // Copies between frames of different sizes, at different word offsets
+    const Gnss_Packed_Frame<GALILEO_FNAV_DATA_FRAME_BITS> source(frames[0]);
+    Gnss_Packed_Frame<GPS_SUBFRAME_BITS> destination(random_frames<GPS_SUBFRAME_BITS>(1)[0]);
+    const std::string before = destination.to_string();
+    destination.copy(source, 37, 150, 60);
+    const std::string after = destination.to_string();
+    EXPECT_EQ(after.substr(0, 59), before.substr(0, 59));
+    EXPECT_EQ(after.substr(59, 150), frames[0].substr(36, 150));
+    EXPECT_EQ(after.substr(209), before.substr(209));
+}
+
+
+TEST(GnssPackedFrameTest, InavFieldTables)
+{
+    const auto frames = random_frames<GALILEO_DATA_JK_BITS>(100);
+
+    // Fields that straddle the 64-bit word boundary
+    EXPECT_TRUE(straddles_word(E_1_BIT));
+    EXPECT_TRUE(straddles_word(I_0_2_BIT));
+    EXPECT_TRUE(straddles_word(ISM_MASK_BIT));
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, E_1_BIT);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, I_0_2_BIT);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, C_UC_3_BIT);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, T0C_4_BIT);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, BGD_E1_E5B_5_BIT);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, DELTA_T_LS_6_BIT);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, OMEGA_7_BIT);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, E_8_BIT);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, AF1_9_BIT);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, AF0_10_BIT);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, CED_Omega0red_BIT);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, ISM_MASK_BIT);
+
+    // Fields within a word
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, TYPE);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, IOD_NAV_1_BIT);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, T0_E_1_BIT);
+    CHECK_FIELD(GALILEO_DATA_JK_BITS, frames, M0_1_BIT);
+}
+
+
+TEST(GnssPackedFrameTest, FnavFieldTables)
+{
+    const auto frames = random_frames<GALILEO_FNAV_DATA_FRAME_BITS>(100);
+
+    // Fields that straddle the 64-bit word boundaries
+    EXPECT_TRUE(straddles_word(FNAV_AF0_1_BIT));
+    EXPECT_TRUE(straddles_word(FNAV_A12_2_BIT));
+    EXPECT_TRUE(straddles_word(FNAV_TOW_3_BIT));
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_AF0_1_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_AI2_1_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_OMEGADOT_2_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_A12_2_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_WN_2_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_W_3_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_TOW_3_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_A0_4_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_TOW_4_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_W_1_5_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_AF0_1_5_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_W_2_5_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_AF0_2_6_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_DELTAI_3_6_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_AF0_3_6_BIT);
+
+    // Fields within a word
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_OMEGA0_2_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_OMEGA0_1_5_BIT);
+    CHECK_FIELD(GALILEO_FNAV_DATA_FRAME_BITS, frames, FNAV_OMEGA0_3_6_BIT);
+}
+
+
+TEST(GnssPackedFrameTest, LnavFieldTables)
+{
+    const auto frames = random_frames<GPS_SUBFRAME_BITS>(100);
+
+    // Fields that straddle the 64-bit word boundaries, some of them split
+    // in two parts
+    EXPECT_TRUE(straddles_word(GPS_WEEK));
+    EXPECT_TRUE(straddles_word(M_0));
+    EXPECT_TRUE(straddles_word(A_0));
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, GPS_WEEK);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, A_F1);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, IODE_SF2);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, M_0);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, ECCENTRICITY);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, SQRT_A);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, C_IC);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, C_IS);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, C_RC);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, OMEGA_DOT);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, SV_PAGE);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, A_0);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, HEALTH_SV6);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, HEALTH_SV28);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, ALM_OMEGADOT);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, ALM_OMEGAZERO);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, ALM_MZERO);
+
+    // Fields split in two parts within a word
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, IODC);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, OMEGA_0);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, I_0);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, OMEGA);
+    CHECK_FIELD(GPS_SUBFRAME_BITS, frames, ALM_AF0);
+}